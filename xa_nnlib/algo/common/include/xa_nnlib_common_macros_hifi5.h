@@ -1987,4 +1987,28 @@ ae_int16 _ae_int16_bias = ZERO16; \
 /* Alignment checking */
 #define ALIGNED_PTR(ptr, alignment) ((((unsigned int)ptr & (alignment - 1))) == 0)
 
+/* IEEE half precision to single precision conversion of two values held in
+ * the low 16 bits of each 32-bit lane. Normals, zeros and Inf/NaN are
+ * rebiased with integer ops, subnormals go through an exact int to float
+ * conversion (mantissa * 2^-24). */
+#define CVT_F16_F32X2(out, d_h32) \
+{ \
+  ae_int32x2 _mag = AE_AND32(d_h32, AE_MOVDA32(0x7FFF)); \
+  ae_int32x2 _sgn = AE_SLAI32(AE_AND32(d_h32, AE_MOVDA32(0x8000)), 16); \
+  ae_int32x2 _bits = AE_ADD32(AE_SLAI32(_mag, 13), AE_MOVDA32(0x38000000)); \
+  ae_int32x2 _sub = XT_AE_MOVINT32X2_FROMXTFLOATX2(XT_FLOAT_SX2(_mag, 24)); \
+  AE_MOVT32X2(_bits, AE_ADD32(_bits, AE_MOVDA32(0x38000000)), AE_LE32(AE_MOVDA32(0x7C00), _mag)); \
+  AE_MOVT32X2(_bits, _sub, AE_LT32(_mag, AE_MOVDA32(0x0400))); \
+  out = XT_AE_MOVXTFLOATX2_FROMINT32X2(AE_ADD32(_bits, _sgn)); \
+}
+
+/* Converts four half precision values to two xtfloatx2, elements 0,1 in out0 */
+#define CVT_F16X4_F32X2X2(out0, out1, d_h16x4) \
+{ \
+  ae_int32x2 _h32_0 = AE_SEXT32X2D16_32(d_h16x4); \
+  ae_int32x2 _h32_1 = AE_SEXT32X2D16_10(d_h16x4); \
+  CVT_F16_F32X2(out0, _h32_0); \
+  CVT_F16_F32X2(out1, _h32_1); \
+}
+
 #endif /* __XA_NNLIB_COMMON_MACROS_H__ */
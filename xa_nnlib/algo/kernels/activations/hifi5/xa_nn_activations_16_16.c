@@ -29,8 +29,8 @@
 /*
  * inp: p_vec: 2 byte aligned input pointer
  * out: p_out: 2 byte aligned output pointer */
-WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 * __restrict__ p_out,
-                                      const  WORD16 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 *p_out,
+                                      const  WORD16 *p_vec,
                                       int    activation_min,
                                       int    activation_max,
                                       WORD32 vec_length)
@@ -149,8 +149,8 @@ WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 * __restrict__ p_out,
  * ReLU 16-bit:
  */
 WORD32 xa_nn_vec_relu_16_16(
-    WORD16       * __restrict__ p_out,
-    const WORD16 * __restrict__ p_vec,
+    WORD16       *p_out,
+    const WORD16 *p_vec,
     WORD16       threshold,
     WORD32       vec_length)
 {
@@ -166,8 +166,8 @@ WORD32 xa_nn_vec_relu_16_16(
  * ReLU Standard 16-bit:
  */
 WORD32 xa_nn_vec_relu_std_16_16(
-    WORD16       * __restrict__ p_out,
-    const WORD16 * __restrict__ p_vec,
+    WORD16       *p_out,
+    const WORD16 *p_vec,
     WORD32       vec_length)
 {
 
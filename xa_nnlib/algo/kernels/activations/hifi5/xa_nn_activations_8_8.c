@@ -34,8 +34,8 @@
 /*
  * inp: p_vec: 1 byte aligned input pointer
  * out: p_out: no alignment needed for output pointer*/
-WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 * __restrict__ p_out,
-                                      const  WORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 *p_out,
+                                      const  WORD8 *p_vec,
                                       int    activation_min,
                                       int    activation_max,
                                       WORD32 vec_length)
@@ -152,8 +152,8 @@ WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 * __restrict__ p_out,
  * ReLU 8-bit:
  */
 WORD32 xa_nn_vec_relu_8_8(
-    WORD8        * __restrict__ p_out,
-    const WORD8  * __restrict__ p_vec,
+    WORD8        *p_out,
+    const WORD8  *p_vec,
     WORD8       threshold,
     WORD32       vec_length)
 {
@@ -169,8 +169,8 @@ WORD32 xa_nn_vec_relu_8_8(
  * ReLU Standard 8-bit:
  */
 WORD32 xa_nn_vec_relu_std_8_8(
-    WORD8        * __restrict__ p_out,
-    const WORD8  * __restrict__ p_vec,
+    WORD8        *p_out,
+    const WORD8  *p_vec,
     WORD32       vec_length)
 {
     xa_nn_vec_activation_min_max_8_8( p_out,
@@ -896,8 +896,8 @@ WORD32 xa_nn_vec_sigmoid_asym8s_asym8s(WORD8 *p_out,
 /*
  * inp: p_vec: 1 byte aligned input pointer
  * out: p_out: 1 byte aligned output pointer*/
-WORD32 xa_nn_vec_activation_min_max_asym8_asym8(UWORD8 * __restrict__ p_out,
-                                      const  UWORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_asym8_asym8(UWORD8 *p_out,
+                                      const  UWORD8 *p_vec,
                                       int    activation_min,
                                       int    activation_max,
                                       WORD32 vec_length)
@@ -1051,8 +1051,8 @@ WORD32 xa_nn_vec_activation_min_max_asym8_asym8(UWORD8 * __restrict__ p_out,
   out = AE_SAT16X4(inp1, inp2); \
 }
 
-WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 * __restrict__ p_out,
-                    const   UWORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 *p_out,
+                    const   UWORD8 *p_vec,
                             WORD32 inp_zero_bias,
                             WORD32 out_multiplier,
                             WORD32 out_shift,
@@ -1183,8 +1183,8 @@ WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 * __restrict__ p_out,
   return 0;
 }
 
-WORD32 xa_nn_vec_relu_asym8s_asym8s( WORD8 * __restrict__ p_out,
-                    const   WORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_relu_asym8s_asym8s( WORD8 *p_out,
+                    const   WORD8 *p_vec,
                             WORD32 inp_zero_bias,
                             WORD32 out_multiplier,
                             WORD32 out_shift,
@@ -1315,9 +1315,9 @@ WORD32 xa_nn_vec_relu_asym8s_asym8s( WORD8 * __restrict__ p_out,
   return 0;
 }
 
-WORD32 xa_nn_vec_prelu_asym8s_asym8s( WORD8 * __restrict__ p_out,
-                    const   WORD8 * __restrict__ p_vec,
-                    const   WORD8 * __restrict__ p_vec_alpha,
+WORD32 xa_nn_vec_prelu_asym8s_asym8s( WORD8 *p_out,
+                    const   WORD8 *p_vec,
+                    const   WORD8 *p_vec_alpha,
                             WORD32 inp_zero_bias,
                             WORD32 alpha_zero_bias,
                             WORD32 alpha_multiplier,
@@ -1516,8 +1516,8 @@ WORD32 xa_nn_vec_prelu_asym8s_asym8s( WORD8 * __restrict__ p_out,
   inp1 = AE_SRAA16SYMS(inp1, right_shift); \
 }
 
-WORD32 xa_nn_vec_hard_swish_asym8s_asym8s( WORD8 * __restrict__ p_out,
-                            const   WORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_hard_swish_asym8s_asym8s( WORD8 *p_out,
+                            const   WORD8 *p_vec,
                             WORD32 inp_zero_bias,
                             WORD16 reluish_multiplier,
                             WORD32 reluish_shift,
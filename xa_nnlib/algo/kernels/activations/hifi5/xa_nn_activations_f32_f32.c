@@ -44,8 +44,8 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_activation_min_max_f32_f32,(
  * inp: p_vec: 4 byte aligned pointer
  * out: p_out: 4 byte aligned pointer */
 
-WORD32 xa_nn_vec_activation_min_max_f32_f32(FLOAT32 * __restrict__ p_out,
-           const  FLOAT32 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_f32_f32(FLOAT32 *p_out,
+           const  FLOAT32 *p_vec,
                   FLOAT32 activation_min,
                   FLOAT32 activation_max,
                   WORD32  vec_length)
@@ -207,8 +207,8 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_relu_std_f32_f32,(
     WORD32        vec_length)                  )
 #else
 WORD32 xa_nn_vec_relu_std_f32_f32(
-    FLOAT32       * __restrict__ p_out,        /* result, floating point */
-    const FLOAT32 * __restrict__ p_vec,        /* input data, floating point */
+    FLOAT32       *p_out,                      /* result, floating point */
+    const FLOAT32 *p_vec,                      /* input data, floating point */
     WORD32        vec_length)                  /* length of vectors */
 {
     xa_nn_vec_activation_min_max_f32_f32(p_out, p_vec, 0, INFINITY, vec_length);
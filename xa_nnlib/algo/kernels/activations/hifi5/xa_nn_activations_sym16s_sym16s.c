@@ -0,0 +1,243 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include "NatureDSP_Signal_math.h"
+
+/* Number of elements converted to Q6.25 per call of the NatureDSP cores */
+#define SYM16S_ACT_BLK  256
+
+/*
+ * Converts (x - offset) from int16 to Q6.25 for the 32x32 NatureDSP cores.
+ * The difference is pre-shifted left by 14 (it needs at most 17 bits), so
+ * multiplier/shift is the quantized representation of input_scale * 2^11.
+ */
+static void sym16s_to_q6_25(WORD32 * __restrict__ p_dst,
+                            const WORD16 * __restrict__ p_src,
+                            WORD32 offset,
+                            WORD32 multiplier,
+                            WORD32 left_shift,
+                            WORD32 right_shift,
+                            WORD32 num_elm)
+{
+  int i;
+  ae_int16x4 d_inp;
+  ae_int32x2 d0, d1;
+  ae_int32x2 d_offset = AE_MOVDA32(offset);
+  ae_int16x4 *p_in = (ae_int16x4 *)p_src;
+  ae_int32x2 *p_out = (ae_int32x2 *)p_dst;
+  ae_valign align_src = AE_LA64_PP(p_in);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    AE_LA16X4_IP(d_inp, align_src, p_in);
+    d0 = AE_SUB32(AE_SEXT32X2D16_32(d_inp), d_offset);
+    d1 = AE_SUB32(AE_SEXT32X2D16_10(d_inp), d_offset);
+    d0 = AE_SLAI32(d0, 14);
+    d1 = AE_SLAI32(d1, 14);
+    d0 = AE_MULFP32X2RAS(d0, AE_MOVDA32(multiplier));
+    d1 = AE_MULFP32X2RAS(d1, AE_MOVDA32(multiplier));
+    d0 = AE_SRAA32SYMS(AE_SLAA32S(d0, left_shift), right_shift);
+    d1 = AE_SRAA32SYMS(AE_SLAA32S(d1, left_shift), right_shift);
+    AE_SA32X2_IP(d0, align_dst, p_out);
+    AE_SA32X2_IP(d1, align_dst, p_out);
+  }
+  AE_SA64POS_FP(align_dst, p_out);
+
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    AE_L16_IP(d_inp, (ae_int16 *)p_in, 2);
+    d0 = AE_SUB32(AE_SEXT32X2D16_10(d_inp), d_offset);
+    d0 = AE_SLAI32(d0, 14);
+    d0 = AE_MULFP32X2RAS(d0, AE_MOVDA32(multiplier));
+    d0 = AE_SRAA32SYMS(AE_SLAA32S(d0, left_shift), right_shift);
+    AE_S32_L_IP(d0, (ae_int32 *)p_out, 4);
+  }
+}
+
+/* Saturates Q16.15 results of the NatureDSP cores to int16 (scale 1/32768) */
+static void q16_15_to_sym16s(WORD16 * __restrict__ p_dst,
+                             const WORD32 * __restrict__ p_src,
+                             WORD32 num_elm)
+{
+  int i;
+  ae_int32x2 d0, d1;
+  ae_int16x4 d_out;
+  ae_int32x2 *p_in = (ae_int32x2 *)p_src;
+  ae_int16x4 *p_out = (ae_int16x4 *)p_dst;
+  ae_valign align_src = AE_LA64_PP(p_in);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    AE_LA32X2_IP(d0, align_src, p_in);
+    AE_LA32X2_IP(d1, align_src, p_in);
+    d_out = AE_SAT16X4(d0, d1);
+    AE_SA16X4_IP(d_out, align_dst, p_out);
+  }
+  AE_SA64POS_FP(align_dst, p_out);
+
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    AE_L32_IP(d0, (ae_int32 *)p_in, 4);
+    d_out = AE_SAT16X4(d0, d0);
+    AE_S16_0_IP(d_out, (ae_int16 *)p_out, 2);
+  }
+}
+
+/*
+ * TFLite int16 logistic: input scale folded into input_multiplier /
+ * input_left_shift (quantized input_scale * 2^11), output scale 1/32768 and
+ * zero point 0.
+ */
+WORD32 xa_nn_vec_sigmoid_sym16s_sym16s(WORD16 *p_out,
+                      const WORD16 *p_vec,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift,
+                            WORD32 vec_length)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_left_shift < -31) || (input_left_shift > 31)), -1);
+
+  WORD32 ALIGN(16) x32[SYM16S_ACT_BLK];
+  WORD32 ALIGN(16) y32[SYM16S_ACT_BLK];
+  int left_shift  = input_left_shift < 0 ? 0 : input_left_shift;
+  int right_shift = input_left_shift > 0 ? 0 : -input_left_shift;
+  int i, blk;
+
+  for(i = 0; i < vec_length; i += SYM16S_ACT_BLK)
+  {
+    blk = XT_MIN(vec_length - i, SYM16S_ACT_BLK);
+    sym16s_to_q6_25(x32, &p_vec[i], 0, input_multiplier, left_shift, right_shift, blk);
+    vec_sigmoid32x32(y32, x32, blk);
+    q16_15_to_sym16s(&p_out[i], y32, blk);
+  }
+
+  return 0;
+}
+
+/*
+ * TFLite int16 tanh: input scale folded into input_multiplier /
+ * input_left_shift (quantized input_scale * 2^11), output scale 1/32768 and
+ * zero point 0.
+ */
+WORD32 xa_nn_vec_tanh_sym16s_sym16s(WORD16 *p_out,
+                      const WORD16 *p_vec,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift,
+                            WORD32 vec_length)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_left_shift < -31) || (input_left_shift > 31)), -1);
+
+  WORD32 ALIGN(16) x32[SYM16S_ACT_BLK];
+  WORD32 ALIGN(16) y32[SYM16S_ACT_BLK];
+  int left_shift  = input_left_shift < 0 ? 0 : input_left_shift;
+  int right_shift = input_left_shift > 0 ? 0 : -input_left_shift;
+  int i, blk;
+
+  for(i = 0; i < vec_length; i += SYM16S_ACT_BLK)
+  {
+    blk = XT_MIN(vec_length - i, SYM16S_ACT_BLK);
+    sym16s_to_q6_25(x32, &p_vec[i], 0, input_multiplier, left_shift, right_shift, blk);
+    vec_tanh32x32(y32, x32, blk);
+    q16_15_to_sym16s(&p_out[i], y32, blk);
+  }
+
+  return 0;
+}
+
+/*
+ * TFLite int16 softmax: beta * input_scale folded into input_beta_multiplier /
+ * input_beta_left_shift (quantized beta * input_scale * 2^11), output scale
+ * 1/32768 and zero point 0. Needs get_softmax_scratch_size(PREC_SYM16S, ...)
+ * bytes of scratch.
+ */
+WORD32 xa_nn_vec_softmax_sym16s_sym16s( WORD16 * __restrict__ p_out,
+                    const   WORD16 * __restrict__ p_vec,
+                            WORD32  input_beta_left_shift,
+                            WORD32  input_beta_multiplier,
+                            WORD32  vec_length,
+                            pVOID   p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_beta_left_shift < -31) || (input_beta_left_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((input_beta_multiplier < 0), -1);
+
+  int i;
+  int left_shift  = input_beta_left_shift < 0 ? 0 : input_beta_left_shift;
+  int right_shift = input_beta_left_shift > 0 ? 0 : -input_beta_left_shift;
+  WORD32 *p_x32 = (WORD32 *)p_scratch;
+  WORD32 *p_y32 = p_x32 + vec_length;
+  WORD32 max_val;
+  ae_int16x4 d_inp, d_max = AE_MOVDA16(-32768);
+  ae_int16x4 *p_in = (ae_int16x4 *)p_vec;
+  ae_valign align_src = AE_LA64_PP(p_in);
+
+  /* Subtracting the max keeps (x - max) <= 0, the range the exponent
+   * polynomial is most accurate in */
+  for(i = 0; i < (vec_length >> 2); i++)
+  {
+    AE_LA16X4_IP(d_inp, align_src, p_in);
+    d_max = AE_MAX16(d_max, d_inp);
+  }
+  max_val = AE_MOVAD16_0(d_max);
+  max_val = XT_MAX(max_val, AE_MOVAD16_1(d_max));
+  max_val = XT_MAX(max_val, AE_MOVAD16_2(d_max));
+  max_val = XT_MAX(max_val, AE_MOVAD16_3(d_max));
+  for(i = (vec_length & ~3); i < vec_length; i++)
+  {
+    max_val = XT_MAX(max_val, p_vec[i]);
+  }
+
+  sym16s_to_q6_25(p_x32, p_vec, max_val, input_beta_multiplier, left_shift, right_shift, vec_length);
+  vec_softmax32x32(p_y32, p_x32, vec_length);
+  q16_15_to_sym16s(p_out, p_y32, vec_length);
+
+  return 0;
+}
@@ -1031,6 +1031,10 @@ int get_softmax_scratch_size(int inp_precision, int out_precision, int length)
         case -4:
             size_of_one_elm_in_bytes = 4;
             break;
+        case -8:
+            /* Q6.25 input and Q16.15 output of the 32x32 softmax core */
+            size_of_one_elm_in_bytes = 8;
+            break;
     }
 
     total_bytes = size_of_one_elm_in_bytes*length;
@@ -0,0 +1,429 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "common_fpu.h"
+
+#define ARG_INP_ASYM8S  0
+#define ARG_INP_ASYM8U  1
+#define ARG_INP_16      2
+
+#define ARG_INT_MIN     ((WORD32)0x80000000)
+
+/* Splits the input shape around axis into outer x axis_size x inner,
+ * returns -1 for invalid shape/axis */
+static WORD32 arg_min_max_chk_params(WORD32 *p_outer,
+                                     WORD32 *p_axis_size,
+                                     WORD32 *p_inner,
+                                     const WORD32 *p_inp_shape,
+                                     WORD32 num_inp_dims,
+                                     WORD32 axis)
+{
+  int i;
+  WORD32 outer = 1, inner = 1;
+
+  if(num_inp_dims <= 0 || num_inp_dims > 8)
+    return -1;
+  if(axis < 0)
+    axis += num_inp_dims;
+  if(axis < 0 || axis >= num_inp_dims)
+    return -1;
+
+  for(i = 0; i < num_inp_dims; i++)
+  {
+    if(p_inp_shape[i] <= 0)
+      return -1;
+    if(i < axis)
+      outer *= p_inp_shape[i];
+    else if(i > axis)
+      inner *= p_inp_shape[i];
+  }
+
+  *p_outer = outer;
+  *p_axis_size = p_inp_shape[axis];
+  *p_inner = inner;
+  return 0;
+}
+
+/* Loads the next 4 elements of a stream primed with AE_LA64_PP, widened to
+ * 32 bits, and advances *pp_inp past them */
+static inline void arg_load_4(ae_int32x2 *p_d01,
+                              ae_int32x2 *p_d23,
+                              const WORD8 **pp_inp,
+                              ae_valign *p_inp_a,
+                              WORD32 inp_type)
+{
+  ae_int16x4 d_inp;
+  ae_valign inp_a = *p_inp_a;
+
+  if(inp_type == ARG_INP_ASYM8S)
+  {
+    const WORD8 *pt_inp = *pp_inp;
+    AE_LA8X4S_IP(d_inp, inp_a, pt_inp);
+    *pp_inp = pt_inp;
+  }
+  else if(inp_type == ARG_INP_ASYM8U)
+  {
+    const UWORD8 *pt_inp = (const UWORD8 *)*pp_inp;
+    AE_LA8X4U_IP(d_inp, inp_a, pt_inp);
+    *pp_inp = (const WORD8 *)pt_inp;
+  }
+  else
+  {
+    ae_int16x4 *pt_inp = (ae_int16x4 *)*pp_inp;
+    AE_LA16X4_IP(d_inp, inp_a, pt_inp);
+    *pp_inp = (const WORD8 *)pt_inp;
+  }
+  *p_inp_a = inp_a;
+  *p_d01 = AE_SEXT32X2D16_32(d_inp);
+  *p_d23 = AE_SEXT32X2D16_10(d_inp);
+}
+
+static inline WORD32 arg_load_1(const WORD8 *p_inp,
+                                WORD32 inp_type)
+{
+  if(inp_type == ARG_INP_ASYM8S)
+    return *p_inp;
+  else if(inp_type == ARG_INP_ASYM8U)
+    return *(const UWORD8 *)p_inp;
+  return *(const WORD16 *)p_inp;
+}
+
+/* Running max and index vectors along the reduced axis; argmin is argmax of
+ * the negated input. Ties resolve to the lowest index, as in TFLite. */
+static inline WORD32 arg_min_max_int(WORD32 * __restrict__ p_out,
+                                     const WORD8 * __restrict__ p_inp,
+                                     const WORD32 * __restrict__ p_inp_shape,
+                                     WORD32 num_inp_dims,
+                                     WORD32 axis,
+                                     WORD32 inp_type,
+                                     WORD32 is_min)
+{
+  WORD32 outer, axis_size, inner;
+  int o_itr, a_itr, i_itr, k;
+  WORD32 elm_bytes = (inp_type == ARG_INP_16) ? sizeof(WORD16) : sizeof(WORD8);
+
+  if(arg_min_max_chk_params(&outer, &axis_size, &inner, p_inp_shape, num_inp_dims, axis) != 0)
+    return -1;
+
+  ae_int32x2 d01, d23, max01, max23, idx01, idx23;
+  xtbool2 b01, b23;
+  const WORD8 *pt_inp;
+  ae_valign inp_a;
+
+  for(o_itr = 0; o_itr < outer; o_itr++)
+  {
+    const WORD8 *p_base = p_inp + o_itr * axis_size * inner * elm_bytes;
+    WORD32 *p_dst = p_out + o_itr * inner;
+
+    if(inner == 1)
+    {
+      ae_int32x2 cur01 = AE_MOVDA32X2(0, 1);
+      ae_int32x2 cur23 = AE_MOVDA32X2(2, 3);
+      max01 = max23 = AE_MOVDA32(ARG_INT_MIN);
+      idx01 = idx23 = AE_ZERO32();
+
+      /* The row is contiguous: prime once and stream along the axis */
+      pt_inp = p_base;
+      inp_a = AE_LA64_PP(pt_inp);
+      for(a_itr = 0; a_itr < (axis_size & ~3); a_itr += 4)
+      {
+        arg_load_4(&d01, &d23, &pt_inp, &inp_a, inp_type);
+        if(is_min)
+        {
+          d01 = AE_NEG32(d01);
+          d23 = AE_NEG32(d23);
+        }
+        b01 = AE_LT32(max01, d01);
+        b23 = AE_LT32(max23, d23);
+        AE_MOVT32X2(max01, d01, b01);
+        AE_MOVT32X2(max23, d23, b23);
+        AE_MOVT32X2(idx01, cur01, b01);
+        AE_MOVT32X2(idx23, cur23, b23);
+        cur01 = AE_ADD32(cur01, AE_MOVDA32(4));
+        cur23 = AE_ADD32(cur23, AE_MOVDA32(4));
+      }
+
+      /* Horizontal reduction of the 4 lanes */
+      WORD32 lane_max[4], lane_idx[4];
+      lane_max[0] = AE_MOVAD32_H(max01); lane_idx[0] = AE_MOVAD32_H(idx01);
+      lane_max[1] = AE_MOVAD32_L(max01); lane_idx[1] = AE_MOVAD32_L(idx01);
+      lane_max[2] = AE_MOVAD32_H(max23); lane_idx[2] = AE_MOVAD32_H(idx23);
+      lane_max[3] = AE_MOVAD32_L(max23); lane_idx[3] = AE_MOVAD32_L(idx23);
+      WORD32 best = lane_max[0], best_idx = lane_idx[0];
+      for(k = 1; k < 4; k++)
+      {
+        if(lane_max[k] > best || (lane_max[k] == best && lane_idx[k] < best_idx))
+        {
+          best = lane_max[k];
+          best_idx = lane_idx[k];
+        }
+      }
+
+      // Remainder loop for axis
+      for(; a_itr < axis_size; a_itr++)
+      {
+        WORD32 val = arg_load_1(p_base + a_itr * elm_bytes, inp_type);
+        val = is_min ? -val : val;
+        if(val > best)
+        {
+          best = val;
+          best_idx = a_itr;
+        }
+      }
+      p_dst[0] = best_idx;
+    }
+    else
+    {
+      for(i_itr = 0; i_itr < (inner & ~3); i_itr += 4)
+      {
+        max01 = max23 = AE_MOVDA32(ARG_INT_MIN);
+        idx01 = idx23 = AE_ZERO32();
+        for(a_itr = 0; a_itr < axis_size; a_itr++)
+        {
+          /* Steps along the axis are inner elements apart, each needs its
+           * own priming */
+          pt_inp = p_base + (a_itr * inner + i_itr) * elm_bytes;
+          inp_a = AE_LA64_PP(pt_inp);
+          arg_load_4(&d01, &d23, &pt_inp, &inp_a, inp_type);
+          if(is_min)
+          {
+            d01 = AE_NEG32(d01);
+            d23 = AE_NEG32(d23);
+          }
+          b01 = AE_LT32(max01, d01);
+          b23 = AE_LT32(max23, d23);
+          AE_MOVT32X2(max01, d01, b01);
+          AE_MOVT32X2(max23, d23, b23);
+          AE_MOVT32X2(idx01, AE_MOVDA32(a_itr), b01);
+          AE_MOVT32X2(idx23, AE_MOVDA32(a_itr), b23);
+        }
+        p_dst[i_itr + 0] = AE_MOVAD32_H(idx01);
+        p_dst[i_itr + 1] = AE_MOVAD32_L(idx01);
+        p_dst[i_itr + 2] = AE_MOVAD32_H(idx23);
+        p_dst[i_itr + 3] = AE_MOVAD32_L(idx23);
+      }
+
+      // Remainder loop for inner
+      for(; i_itr < inner; i_itr++)
+      {
+        WORD32 best = ARG_INT_MIN, best_idx = 0;
+        for(a_itr = 0; a_itr < axis_size; a_itr++)
+        {
+          WORD32 val = arg_load_1(p_base + (a_itr * inner + i_itr) * elm_bytes, inp_type);
+          val = is_min ? -val : val;
+          if(val > best)
+          {
+            best = val;
+            best_idx = a_itr;
+          }
+        }
+        p_dst[i_itr] = best_idx;
+      }
+    }
+  }
+  return 0;
+}
+
+#define ARG_MIN_MAX_INT_FUN(name, data_type, inp_type, is_min) \
+WORD32 name(WORD32 * __restrict__ p_out, \
+            const data_type * __restrict__ p_inp, \
+            const WORD32 * __restrict__ p_inp_shape, \
+            WORD32 num_inp_dims, \
+            WORD32 axis) \
+{ \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD32), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(data_type), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1); \
+ \
+  return arg_min_max_int(p_out, (const WORD8 *)p_inp, p_inp_shape, num_inp_dims, axis, inp_type, is_min); \
+}
+
+ARG_MIN_MAX_INT_FUN(xa_nn_argmax_asym8s, WORD8,  ARG_INP_ASYM8S, 0)
+ARG_MIN_MAX_INT_FUN(xa_nn_argmin_asym8s, WORD8,  ARG_INP_ASYM8S, 1)
+ARG_MIN_MAX_INT_FUN(xa_nn_argmax_asym8u, UWORD8, ARG_INP_ASYM8U, 0)
+ARG_MIN_MAX_INT_FUN(xa_nn_argmin_asym8u, UWORD8, ARG_INP_ASYM8U, 1)
+ARG_MIN_MAX_INT_FUN(xa_nn_argmax_16,     WORD16, ARG_INP_16,     0)
+ARG_MIN_MAX_INT_FUN(xa_nn_argmin_16,     WORD16, ARG_INP_16,     1)
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_argmax_f32,(WORD32 * __restrict__ p_out,
+            const FLOAT32 * __restrict__ p_inp,
+            const WORD32 * __restrict__ p_inp_shape,
+            WORD32 num_inp_dims,
+            WORD32 axis))
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_argmin_f32,(WORD32 * __restrict__ p_out,
+            const FLOAT32 * __restrict__ p_inp,
+            const WORD32 * __restrict__ p_inp_shape,
+            WORD32 num_inp_dims,
+            WORD32 axis))
+#else
+/* Returns true if val replaces the current extreme (strict, so the first
+ * occurrence wins) */
+#define ARG_F32_BETTER(val, ref, is_min) ((is_min) ? ((val) < (ref)) : ((val) > (ref)))
+
+static inline WORD32 arg_min_max_f32(WORD32 * __restrict__ p_out,
+                                     const FLOAT32 * __restrict__ p_inp,
+                                     const WORD32 * __restrict__ p_inp_shape,
+                                     WORD32 num_inp_dims,
+                                     WORD32 axis,
+                                     WORD32 is_min)
+{
+  WORD32 outer, axis_size, inner;
+  int o_itr, a_itr, i_itr;
+
+  if(arg_min_max_chk_params(&outer, &axis_size, &inner, p_inp_shape, num_inp_dims, axis) != 0)
+    return -1;
+
+  xtfloatx2 d_inp, d_max;
+  ae_int32x2 d_idx, d_cur;
+  xtbool2 b_upd;
+  ae_valign inp_a;
+
+  for(o_itr = 0; o_itr < outer; o_itr++)
+  {
+    const FLOAT32 *p_base = p_inp + o_itr * axis_size * inner;
+    WORD32 *p_dst = p_out + o_itr * inner;
+
+    if(inner == 1)
+    {
+      FLOAT32 best = p_base[0];
+      WORD32 best_idx = 0;
+      a_itr = 1;
+      if(axis_size >= 4)
+      {
+        xtfloatx2 *pt_inp = (xtfloatx2 *)p_base;
+        inp_a = XT_LASX2PP(pt_inp);
+        XT_LASX2IP(d_max, inp_a, pt_inp);
+        d_idx = AE_MOVDA32X2(0, 1);
+        d_cur = AE_MOVDA32X2(2, 3);
+        for(a_itr = 2; a_itr < (axis_size & ~1); a_itr += 2)
+        {
+          XT_LASX2IP(d_inp, inp_a, pt_inp);
+          b_upd = is_min ? XT_OLT_SX2(d_inp, d_max) : XT_OLT_SX2(d_max, d_inp);
+          XT_MOVT_SX2(d_max, d_inp, b_upd);
+          AE_MOVT32X2(d_idx, d_cur, b_upd);
+          d_cur = AE_ADD32(d_cur, AE_MOVDA32(2));
+        }
+        /* Horizontal reduction of the 2 lanes */
+        FLOAT32 max_h = XT_HIGH_S(d_max), max_l = XT_LOW_S(d_max);
+        best = max_h;
+        best_idx = AE_MOVAD32_H(d_idx);
+        if(ARG_F32_BETTER(max_l, max_h, is_min) ||
+           (max_l == max_h && AE_MOVAD32_L(d_idx) < best_idx))
+        {
+          best = max_l;
+          best_idx = AE_MOVAD32_L(d_idx);
+        }
+      }
+      // Remainder loop for axis
+      for(; a_itr < axis_size; a_itr++)
+      {
+        if(ARG_F32_BETTER(p_base[a_itr], best, is_min))
+        {
+          best = p_base[a_itr];
+          best_idx = a_itr;
+        }
+      }
+      p_dst[0] = best_idx;
+    }
+    else
+    {
+      for(i_itr = 0; i_itr < (inner & ~1); i_itr += 2)
+      {
+        xtfloatx2 *pt_inp = (xtfloatx2 *)&p_base[i_itr];
+        inp_a = XT_LASX2PP(pt_inp);
+        XT_LASX2IP(d_max, inp_a, pt_inp);
+        d_idx = AE_ZERO32();
+        for(a_itr = 1; a_itr < axis_size; a_itr++)
+        {
+          pt_inp = (xtfloatx2 *)&p_base[a_itr * inner + i_itr];
+          inp_a = XT_LASX2PP(pt_inp);
+          XT_LASX2IP(d_inp, inp_a, pt_inp);
+          b_upd = is_min ? XT_OLT_SX2(d_inp, d_max) : XT_OLT_SX2(d_max, d_inp);
+          XT_MOVT_SX2(d_max, d_inp, b_upd);
+          AE_MOVT32X2(d_idx, AE_MOVDA32(a_itr), b_upd);
+        }
+        p_dst[i_itr + 0] = AE_MOVAD32_H(d_idx);
+        p_dst[i_itr + 1] = AE_MOVAD32_L(d_idx);
+      }
+
+      // Remainder loop for inner
+      for(; i_itr < inner; i_itr++)
+      {
+        FLOAT32 best = p_base[i_itr];
+        WORD32 best_idx = 0;
+        for(a_itr = 1; a_itr < axis_size; a_itr++)
+        {
+          if(ARG_F32_BETTER(p_base[a_itr * inner + i_itr], best, is_min))
+          {
+            best = p_base[a_itr * inner + i_itr];
+            best_idx = a_itr;
+          }
+        }
+        p_dst[i_itr] = best_idx;
+      }
+    }
+  }
+  return 0;
+}
+
+WORD32 xa_nn_argmax_f32(WORD32 * __restrict__ p_out,
+                        const FLOAT32 * __restrict__ p_inp,
+                        const WORD32 * __restrict__ p_inp_shape,
+                        WORD32 num_inp_dims,
+                        WORD32 axis)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
+
+  return arg_min_max_f32(p_out, p_inp, p_inp_shape, num_inp_dims, axis, 0);
+}
+
+WORD32 xa_nn_argmin_f32(WORD32 * __restrict__ p_out,
+                        const FLOAT32 * __restrict__ p_inp,
+                        const WORD32 * __restrict__ p_inp_shape,
+                        WORD32 num_inp_dims,
+                        WORD32 axis)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
+
+  return arg_min_max_f32(p_out, p_inp, p_inp_shape, num_inp_dims, axis, 1);
+}
+#endif /* !HAVE_VFPU */
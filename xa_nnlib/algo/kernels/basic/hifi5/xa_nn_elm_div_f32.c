@@ -38,9 +38,9 @@ DISCARD_FUN_FOR_NONVOID_RETURN(
               )
            )
 #else
-WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
+WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 *p_out,
+                               const FLOAT32 *p_inp1,
+                               const FLOAT32 *p_inp2,
                                WORD32 num_elm)
 {
     /* NULL pointer checks */
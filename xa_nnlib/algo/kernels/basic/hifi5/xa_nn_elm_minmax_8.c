@@ -56,9 +56,9 @@ typedef enum {
 #define NUMDIMS_8D (8)
 
 // out = (in1 > in2 ) ? in1 : in2 ;
-WORD32 xa_nn_elm_max_8x8_8( WORD8* __restrict__ p_out,
-                      const WORD8* __restrict__ p_in1,
-                      const WORD8* __restrict__ p_in2,
+WORD32 xa_nn_elm_max_8x8_8( WORD8* p_out,
+                      const WORD8* p_in1,
+                      const WORD8* p_in2,
                             WORD32              num_element)
 {
     /* NULL pointer checks */
@@ -145,9 +145,9 @@ WORD32 xa_nn_elm_max_8x8_8( WORD8* __restrict__ p_out,
 
 
 // out = (in1 < in2 ) ? in1 : in2 ;
-WORD32 xa_nn_elm_min_8x8_8( WORD8* __restrict__ p_out,
-                      const WORD8* __restrict__ p_in1,
-                      const WORD8* __restrict__ p_in2,
+WORD32 xa_nn_elm_min_8x8_8( WORD8* p_out,
+                      const WORD8* p_in1,
+                      const WORD8* p_in2,
                             WORD32              num_element)
 {
     /* NULL pointer checks */
@@ -20,6 +20,7 @@
 
 ******************************************************************************/
 #include "xa_nnlib_common.h"
+#include "common_fpu.h"
 //#include "xa_nn_basic_state.h"
 
 #define MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out, inp, inp1, multiplier, l_shift, right_shift, out_off) \
@@ -180,3 +181,407 @@ WORD32 xa_nn_elm_quantize_asym16s_asym32s(WORD32 * __restrict__ p_out,
   }
   return 0;
 }
+
+WORD32 xa_nn_elm_quantize_asym8s_asym8s(WORD8 *p_out,
+                                    const WORD8 *p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -128) || (out_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -128) || (inp_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+
+  int i;
+  WORD8 *out = p_out;
+  WORD8 *p_i = (WORD8 *)p_inp;
+
+  int left_shift, right_shift;
+  left_shift  = (out_shift < 0)?0:out_shift;
+  right_shift = (out_shift > 0)?0:-out_shift;
+
+  ae_valign align_inp = AE_LA64_PP(p_inp);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  ae_int16x4 d_inp_zero_bias = AE_MOVDA16(inp_zero_bias);
+  ae_int32x2 d_out_multiplier = AE_MOVDA32(out_multiplier);
+  ae_int32x2 l_mult = AE_MOVDA32(1 << left_shift);
+
+  ae_int16x4 out_0, out_1;
+
+  for(i = 0; i < (num_elm >> 3); i++)
+  {
+    ae_int16x4 d_inp0, d_inp1;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    ae_int32x2 d_inp32_2, d_inp32_3;
+    AE_LA8X4S_IP(d_inp0, align_inp, p_i);
+    AE_LA8X4S_IP(d_inp1, align_inp, p_i);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    AE_SUBW16(d_inp32_2, d_inp32_3, d_inp1, d_inp_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out_0, d_inp32_0, d_inp32_1, d_out_multiplier, l_mult, right_shift, out_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out_1, d_inp32_2, d_inp32_3, d_out_multiplier, l_mult, right_shift, out_zero_bias);
+
+    ae_int8x8 out32_0;
+    PACK_32X2(out32_0, out_0, out_1);
+
+    AE_SA8X8_IP(out32_0, align_dst, (ae_int8x8 *)out);
+  }
+  AE_SA64POS_FP(align_dst, out);
+
+  /*Remainder loop*/
+  for(i = 0; i < (num_elm & 7); i++)
+  {
+    ae_int16x4 d_inp0;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    d_inp0 = AE_MOVDA16(*p_i++);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out_0, d_inp32_0, d_inp32_1, d_out_multiplier, l_mult, right_shift, out_zero_bias);
+
+    ae_int8x8 out32_0;
+    PACK_32X2(out32_0, out_0, out_0);
+
+    AE_S8_0_IP(out32_0, (ae_int8 *)out, 1);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_elm_quantize_asym8u_asym8s(WORD8 *p_out,
+                                    const UWORD8 *p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -128) || (out_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < 0) || (inp_zero_bias > 255)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+
+  int i;
+  WORD8 *out = p_out;
+  UWORD8 *p_i = (UWORD8 *)p_inp;
+
+  int left_shift, right_shift;
+  left_shift  = (out_shift < 0)?0:out_shift;
+  right_shift = (out_shift > 0)?0:-out_shift;
+
+  ae_valign align_inp = AE_LA64_PP(p_inp);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  ae_int16x4 d_inp_zero_bias = AE_MOVDA16(inp_zero_bias);
+  ae_int32x2 d_out_multiplier = AE_MOVDA32(out_multiplier);
+  ae_int32x2 l_mult = AE_MOVDA32(1 << left_shift);
+
+  ae_int16x4 out_0, out_1;
+
+  for(i = 0; i < (num_elm >> 3); i++)
+  {
+    ae_int16x4 d_inp0, d_inp1;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    ae_int32x2 d_inp32_2, d_inp32_3;
+    AE_LA8X4U_IP(d_inp0, align_inp, p_i);
+    AE_LA8X4U_IP(d_inp1, align_inp, p_i);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    AE_SUBW16(d_inp32_2, d_inp32_3, d_inp1, d_inp_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out_0, d_inp32_0, d_inp32_1, d_out_multiplier, l_mult, right_shift, out_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out_1, d_inp32_2, d_inp32_3, d_out_multiplier, l_mult, right_shift, out_zero_bias);
+
+    ae_int8x8 out32_0;
+    PACK_32X2(out32_0, out_0, out_1);
+
+    AE_SA8X8_IP(out32_0, align_dst, (ae_int8x8 *)out);
+  }
+  AE_SA64POS_FP(align_dst, out);
+
+  /*Remainder loop*/
+  for(i = 0; i < (num_elm & 7); i++)
+  {
+    ae_int16x4 d_inp0;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    d_inp0 = AE_MOVDA16(*p_i++);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X4(out_0, d_inp32_0, d_inp32_1, d_out_multiplier, l_mult, right_shift, out_zero_bias);
+
+    ae_int8x8 out32_0;
+    PACK_32X2(out32_0, out_0, out_0);
+
+    AE_S8_0_IP(out32_0, (ae_int8 *)out, 1);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_elm_quantize_asym8s_asym16s(WORD16 * __restrict__ p_out,
+                                    const WORD8 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -32768) || (out_zero_bias > 32767)), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -128) || (inp_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+
+  int i;
+  WORD16 *p_o = p_out;
+  WORD8 *p_i = (WORD8 *)p_inp;
+
+  int left_shift, right_shift;
+  left_shift  = (out_shift < 0)?0:out_shift;
+  right_shift = (out_shift > 0)?0:-out_shift;
+
+  ae_valign align_inp = AE_LA64_PP(p_inp);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  ae_int16x4 d_inp_zero_bias = AE_MOVDA16(inp_zero_bias);
+  ae_int32x2 d_out_multiplier = AE_MOVDA32(out_multiplier);
+  ae_int32x2 d_out_zero_bias = AE_MOVDA32(out_zero_bias);
+  ae_int16x4 d_out;
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    ae_int16x4 d_inp0;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    AE_LA8X4S_IP(d_inp0, align_inp, p_i);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_inp32_0, d_out_multiplier, left_shift, right_shift);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_inp32_1, d_out_multiplier, left_shift, right_shift);
+    d_inp32_0 = AE_ADD32S(d_inp32_0, d_out_zero_bias);
+    d_inp32_1 = AE_ADD32S(d_inp32_1, d_out_zero_bias);
+    d_out = AE_SAT16X4(d_inp32_0, d_inp32_1);
+    AE_SA16X4_IP(d_out, align_dst, (ae_int16x4 *)p_o);
+  }
+  AE_SA64POS_FP(align_dst, p_o);
+
+  /*Remainder loop*/
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    ae_int16x4 d_inp0;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    d_inp0 = AE_MOVDA16(*p_i++);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(d_inp32_0, d_out_multiplier, left_shift, right_shift);
+    d_inp32_0 = AE_ADD32S(d_inp32_0, d_out_zero_bias);
+    d_out = AE_SAT16X4(d_inp32_0, d_inp32_0);
+    AE_S16_0_IP(d_out, (ae_int16 *)p_o, 2);
+  }
+  return 0;
+}
+
+/* Float input is divided by the output scale (not multiplied by its
+ * reciprocal) and rounded half away from zero to match the reference
+ * AffineQuantize bit exactly */
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_elm_quantize_f32_asym8s,(WORD8 * __restrict__ p_out,
+                                    const FLOAT32 * __restrict__ p_inp,
+                                    FLOAT32 out_scale,
+                                    WORD32  out_zero_bias,
+                                    WORD32  num_elm))
+#else
+WORD32 xa_nn_elm_quantize_f32_asym8s(WORD8 * __restrict__ p_out,
+                                    const FLOAT32 * __restrict__ p_inp,
+                                    FLOAT32 out_scale,
+                                    WORD32  out_zero_bias,
+                                    WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_scale <= 0.0f), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -128) || (out_zero_bias > 127)), -1);
+
+  int i;
+  WORD8 *out = p_out;
+  const xtfloatx2 *p_i = (const xtfloatx2 *)p_inp;
+
+  ae_valign align_inp = XT_LASX2PP(p_i);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  xtfloatx2 d_out_scale = (xtfloatx2)out_scale;
+  ae_int32x2 d_out_zero_bias = AE_MOVDA32(out_zero_bias);
+
+  for(i = 0; i < (num_elm >> 3); i++)
+  {
+    xtfloatx2 d_inp0, d_inp1, d_inp2, d_inp3;
+    ae_int32x2 d_out32_0, d_out32_1, d_out32_2, d_out32_3;
+    ae_int16x4 out_0, out_1;
+    XT_LASX2IP(d_inp0, align_inp, p_i);
+    XT_LASX2IP(d_inp1, align_inp, p_i);
+    XT_LASX2IP(d_inp2, align_inp, p_i);
+    XT_LASX2IP(d_inp3, align_inp, p_i);
+
+    d_inp0 = XT_FIROUND_SX2(XT_DIV_SX2(d_inp0, d_out_scale));
+    d_inp1 = XT_FIROUND_SX2(XT_DIV_SX2(d_inp1, d_out_scale));
+    d_inp2 = XT_FIROUND_SX2(XT_DIV_SX2(d_inp2, d_out_scale));
+    d_inp3 = XT_FIROUND_SX2(XT_DIV_SX2(d_inp3, d_out_scale));
+
+    d_out32_0 = AE_ADD32S(XT_TRUNC_SX2(d_inp0, 0), d_out_zero_bias);
+    d_out32_1 = AE_ADD32S(XT_TRUNC_SX2(d_inp1, 0), d_out_zero_bias);
+    d_out32_2 = AE_ADD32S(XT_TRUNC_SX2(d_inp2, 0), d_out_zero_bias);
+    d_out32_3 = AE_ADD32S(XT_TRUNC_SX2(d_inp3, 0), d_out_zero_bias);
+
+    out_0 = AE_SAT16X4(d_out32_0, d_out32_1);
+    out_1 = AE_SAT16X4(d_out32_2, d_out32_3);
+
+    AE_SA8X8_IP(AE_SAT8X8X16(out_0, out_1), align_dst, (ae_int8x8 *)out);
+  }
+  AE_SA64POS_FP(align_dst, out);
+
+  /*Remainder loop*/
+  for(i = 0; i < (num_elm & 7); i++)
+  {
+    xtfloat d_inp;
+    WORD32 d_out;
+    XT_LSIP(d_inp, (xtfloat *)p_i, sizeof(FLOAT32));
+    d_out = XT_TRUNC_S(XT_FIROUND_S(XT_DIV_S(d_inp, out_scale)), 0) + out_zero_bias;
+    d_out = d_out < -128 ? -128 : (d_out > 127 ? 127 : d_out);
+    *out++ = (WORD8)d_out;
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU */
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_elm_quantize_asym8s_f32,(FLOAT32 * __restrict__ p_out,
+                                    const WORD8 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    FLOAT32 inp_scale,
+                                    WORD32  num_elm))
+#else
+WORD32 xa_nn_elm_quantize_asym8s_f32(FLOAT32 * __restrict__ p_out,
+                                    const WORD8 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    FLOAT32 inp_scale,
+                                    WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -128) || (inp_zero_bias > 127)), -1);
+
+  int i;
+  WORD8 *p_i = (WORD8 *)p_inp;
+  xtfloatx2 *p_o = (xtfloatx2 *)p_out;
+
+  ae_valign align_inp = AE_LA64_PP(p_inp);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  ae_int16x4 d_inp_zero_bias = AE_MOVDA16(inp_zero_bias);
+  xtfloatx2 d_inp_scale = (xtfloatx2)inp_scale;
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    ae_int16x4 d_inp0;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    xtfloatx2 d_out0, d_out1;
+    AE_LA8X4S_IP(d_inp0, align_inp, p_i);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    d_out0 = XT_MUL_SX2(XT_FLOAT_SX2(d_inp32_0, 0), d_inp_scale);
+    d_out1 = XT_MUL_SX2(XT_FLOAT_SX2(d_inp32_1, 0), d_inp_scale);
+    XT_SASX2IP(d_out0, align_dst, p_o);
+    XT_SASX2IP(d_out1, align_dst, p_o);
+  }
+  XT_SASX2POSFP(align_dst, p_o);
+
+  /*Remainder loop*/
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    xtfloat d_out = XT_MUL_S(XT_FLOAT_S(*p_i++ - inp_zero_bias, 0), inp_scale);
+    XT_SSIP(d_out, (xtfloat *)p_o, sizeof(FLOAT32));
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU */
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_elm_quantize_asym16s_f32,(FLOAT32 * __restrict__ p_out,
+                                    const WORD16 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    FLOAT32 inp_scale,
+                                    WORD32  num_elm))
+#else
+WORD32 xa_nn_elm_quantize_asym16s_f32(FLOAT32 * __restrict__ p_out,
+                                    const WORD16 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    FLOAT32 inp_scale,
+                                    WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -32768) || (inp_zero_bias > 32767)), -1);
+
+  int i;
+  WORD16 *p_i = (WORD16 *)p_inp;
+  xtfloatx2 *p_o = (xtfloatx2 *)p_out;
+
+  ae_valign align_inp = AE_LA64_PP(p_inp);
+  ae_valign align_dst = AE_ZALIGN64();
+
+  ae_int16x4 d_inp_zero_bias = AE_MOVDA16(inp_zero_bias);
+  xtfloatx2 d_inp_scale = (xtfloatx2)inp_scale;
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    ae_int16x4 d_inp0;
+    ae_int32x2 d_inp32_0, d_inp32_1;
+    xtfloatx2 d_out0, d_out1;
+    AE_LA16X4_IP(d_inp0, align_inp, (ae_int16x4 *)p_i);
+    AE_SUBW16(d_inp32_0, d_inp32_1, d_inp0, d_inp_zero_bias);
+    d_out0 = XT_MUL_SX2(XT_FLOAT_SX2(d_inp32_0, 0), d_inp_scale);
+    d_out1 = XT_MUL_SX2(XT_FLOAT_SX2(d_inp32_1, 0), d_inp_scale);
+    XT_SASX2IP(d_out0, align_dst, p_o);
+    XT_SASX2IP(d_out1, align_dst, p_o);
+  }
+  XT_SASX2POSFP(align_dst, p_o);
+
+  /*Remainder loop*/
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    xtfloat d_out = XT_MUL_S(XT_FLOAT_S(*p_i++ - inp_zero_bias, 0), inp_scale);
+    XT_SSIP(d_out, (xtfloat *)p_o, sizeof(FLOAT32));
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU */
@@ -36,8 +36,8 @@ DISCARD_FUN_FOR_NONVOID_RETURN(
               )
            )
 #else
-WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp,
+WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 *p_out,
+                               const FLOAT32 *p_inp,
                                WORD32 num_elm)
 {
   /* NULL pointer checks */
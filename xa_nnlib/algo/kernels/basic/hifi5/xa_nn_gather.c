@@ -0,0 +1,289 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "common_fpu.h"
+
+/* Copies num_bytes from p_src to p_dst, 16 bytes per iteration with
+ * variable-length load/store for the tail */
+static inline void gather_copy_bytes(WORD8 * __restrict__ p_dst,
+                                     const WORD8 * __restrict__ p_src,
+                                     WORD32 num_bytes)
+{
+  int i;
+  ae_int8x8 d0, d1;
+  ae_int8x16 *p_i = (ae_int8x16 *)p_src;
+  ae_int8x16 *p_o = (ae_int8x16 *)p_dst;
+  ae_valignx2 align_src = AE_LA128_PP(p_i);
+  ae_valignx2 align_dst = AE_ZALIGN128();
+
+  for(i = 0; i < (num_bytes >> 4); i++)
+  {
+    AE_LA8X8X2_IP(d0, d1, align_src, p_i);
+    AE_SA8X8X2_IP(d0, d1, align_dst, p_o);
+  }
+  if(num_bytes & 15)
+  {
+    AE_LAV8X8X2_XP(d0, d1, align_src, p_i, (num_bytes & 15));
+    AE_SAV8X8X2_XP(d0, d1, align_dst, p_o, (num_bytes & 15));
+  }
+  AE_SA128POS_FP(align_dst, p_o);
+}
+
+/* Splits the input shape around axis into outer x axis_size x inner,
+ * returns -1 for invalid shape/axis/indices */
+static WORD32 gather_chk_params(WORD32 *p_outer,
+                                WORD32 *p_axis_size,
+                                WORD32 *p_inner,
+                                const WORD32 *p_inp_shape,
+                                WORD32 num_inp_dims,
+                                const WORD32 *p_indices,
+                                WORD32 num_indices,
+                                WORD32 axis)
+{
+  int i;
+  WORD32 outer = 1, inner = 1;
+
+  if(num_inp_dims <= 0 || num_inp_dims > 8 || num_indices <= 0)
+    return -1;
+  if(axis < 0)
+    axis += num_inp_dims;
+  if(axis < 0 || axis >= num_inp_dims)
+    return -1;
+
+  for(i = 0; i < num_inp_dims; i++)
+  {
+    if(p_inp_shape[i] <= 0)
+      return -1;
+    if(i < axis)
+      outer *= p_inp_shape[i];
+    else if(i > axis)
+      inner *= p_inp_shape[i];
+  }
+  for(i = 0; i < num_indices; i++)
+  {
+    if(p_indices[i] < 0 || p_indices[i] >= p_inp_shape[axis])
+      return -1;
+  }
+
+  *p_outer = outer;
+  *p_axis_size = p_inp_shape[axis];
+  *p_inner = inner;
+  return 0;
+}
+
+/* Output shape is p_inp_shape[0..axis-1] x (shape of p_indices) x
+ * p_inp_shape[axis+1..num_inp_dims-1]; every gathered slice is a contiguous
+ * block of inner elements */
+static WORD32 gather_bytes(WORD8 * __restrict__ p_out,
+                           const WORD8 * __restrict__ p_inp,
+                           const WORD32 * __restrict__ p_inp_shape,
+                           WORD32 num_inp_dims,
+                           const WORD32 * __restrict__ p_indices,
+                           WORD32 num_indices,
+                           WORD32 axis,
+                           WORD32 elm_size)
+{
+  WORD32 outer, axis_size, inner;
+  int o_itr, i_itr;
+
+  if(gather_chk_params(&outer, &axis_size, &inner, p_inp_shape, num_inp_dims,
+                       p_indices, num_indices, axis) != 0)
+    return -1;
+
+  WORD32 block_bytes = inner * elm_size;
+  for(o_itr = 0; o_itr < outer; o_itr++)
+  {
+    const WORD8 *p_src = p_inp + o_itr * axis_size * block_bytes;
+    for(i_itr = 0; i_itr < num_indices; i_itr++)
+    {
+      gather_copy_bytes(p_out, p_src + p_indices[i_itr] * block_bytes, block_bytes);
+      p_out += block_bytes;
+    }
+  }
+  return 0;
+}
+
+WORD32 xa_nn_gather_8(WORD8 * __restrict__ p_out,
+                      const WORD8 * __restrict__ p_inp,
+                      const WORD32 * __restrict__ p_inp_shape,
+                      WORD32 num_inp_dims,
+                      const WORD32 * __restrict__ p_indices,
+                      WORD32 num_indices,
+                      WORD32 axis)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_indices, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_indices, sizeof(WORD32), -1);
+
+  return gather_bytes(p_out, p_inp, p_inp_shape, num_inp_dims, p_indices,
+                      num_indices, axis, sizeof(WORD8));
+}
+
+WORD32 xa_nn_gather_16(WORD16 * __restrict__ p_out,
+                       const WORD16 * __restrict__ p_inp,
+                       const WORD32 * __restrict__ p_inp_shape,
+                       WORD32 num_inp_dims,
+                       const WORD32 * __restrict__ p_indices,
+                       WORD32 num_indices,
+                       WORD32 axis)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_indices, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_indices, sizeof(WORD32), -1);
+
+  return gather_bytes((WORD8 *)p_out, (const WORD8 *)p_inp, p_inp_shape,
+                      num_inp_dims, p_indices, num_indices, axis, sizeof(WORD16));
+}
+
+WORD32 xa_nn_gather_32(WORD32 * __restrict__ p_out,
+                       const WORD32 * __restrict__ p_inp,
+                       const WORD32 * __restrict__ p_inp_shape,
+                       WORD32 num_inp_dims,
+                       const WORD32 * __restrict__ p_indices,
+                       WORD32 num_indices,
+                       WORD32 axis)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_indices, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_indices, sizeof(WORD32), -1);
+
+  return gather_bytes((WORD8 *)p_out, (const WORD8 *)p_inp, p_inp_shape,
+                      num_inp_dims, p_indices, num_indices, axis, sizeof(WORD32));
+}
+
+/* Row-wise requantization of an int8 embedding table: row p_ids[i] is
+ * requantized with p_out_multiplier/p_out_shift of that row */
+WORD32 xa_nn_embedding_lookup_asym8s_asym8s(WORD8 * __restrict__ p_out,
+                                            const WORD8 * __restrict__ p_table,
+                                            const WORD32 * __restrict__ p_ids,
+                                            WORD32 num_ids,
+                                            WORD32 num_rows,
+                                            WORD32 row_length,
+                                            WORD32 inp_zero_bias,
+                                            const WORD32 * __restrict__ p_out_multiplier,
+                                            const WORD32 * __restrict__ p_out_shift,
+                                            WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_table, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_ids, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_ids, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_ids <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_length <= 0), -1);
+
+  int i;
+  for(i = 0; i < num_ids; i++)
+  {
+    WORD32 id = p_ids[i];
+    /* ids are runtime data, checked even when argument checks are disabled */
+    if(id < 0 || id >= num_rows)
+      return -1;
+    if(xa_nn_elm_quantize_asym8s_asym8s(&p_out[i * row_length],
+                                        &p_table[id * row_length],
+                                        inp_zero_bias,
+                                        out_zero_bias,
+                                        p_out_shift[id],
+                                        p_out_multiplier[id],
+                                        row_length) != 0)
+      return -1;
+  }
+  return 0;
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_embedding_lookup_asym8s_f32,(FLOAT32 * __restrict__ p_out,
+                                            const WORD8 * __restrict__ p_table,
+                                            const WORD32 * __restrict__ p_ids,
+                                            WORD32 num_ids,
+                                            WORD32 num_rows,
+                                            WORD32 row_length,
+                                            WORD32 inp_zero_bias,
+                                            const FLOAT32 * __restrict__ p_scale))
+#else
+/* Row-wise dequantization of an int8 embedding table with per-row scales */
+WORD32 xa_nn_embedding_lookup_asym8s_f32(FLOAT32 * __restrict__ p_out,
+                                         const WORD8 * __restrict__ p_table,
+                                         const WORD32 * __restrict__ p_ids,
+                                         WORD32 num_ids,
+                                         WORD32 num_rows,
+                                         WORD32 row_length,
+                                         WORD32 inp_zero_bias,
+                                         const FLOAT32 * __restrict__ p_scale)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_table, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_ids, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scale, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_ids, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scale, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_ids <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_length <= 0), -1);
+
+  int i;
+  for(i = 0; i < num_ids; i++)
+  {
+    WORD32 id = p_ids[i];
+    /* ids are runtime data, checked even when argument checks are disabled */
+    if(id < 0 || id >= num_rows)
+      return -1;
+    if(xa_nn_elm_quantize_asym8s_f32(&p_out[i * row_length],
+                                     &p_table[id * row_length],
+                                     inp_zero_bias,
+                                     p_scale[id],
+                                     row_length) != 0)
+      return -1;
+  }
+  return 0;
+}
+#endif /* !HAVE_VFPU */
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "common_fpu.h"
+
+/* In-place capability of the elementwise, activation and quantize kernels.
+ *
+ * A kernel is listed here only if p_out may be exactly the same pointer as
+ * the input(s) named by its flags. All listed kernels stream through their
+ * operands: every output element is stored after the input element(s) at
+ * the same index have been loaded, and no input element is loaded again
+ * after the output element at that index has been stored. Aligning stores
+ * (SA*) trail the aligning loads (LA*), so the alignment registers never
+ * write ahead of the read position. Partial overlap is not supported.
+ *
+ * None of the listed kernels declares p_out or the aliased inputs
+ * __restrict__, down to the helpers they call.
+ *
+ * Notes from the audit:
+ * - xa_nn_vec_activation_min_max_f32_f32 processes a full 8-element head
+ *   and then restarts at the first multiple-of-8 boundary, so up to 7 head
+ *   elements are read back after they have been written. Clamping is
+ *   idempotent, so the result is the same as for distinct buffers.
+ * - Kernels that forward to restrict-qualified NatureDSP routines
+ *   (relu/relu1/relu6/sigmoid/tanh f32, relu 32_32) are not listed.
+ * - xa_nn_vec_sigmoid_sym16s_sym16s and xa_nn_vec_tanh_sym16s_sym16s
+ *   stage each block through a stack buffer.
+ * - Softmax kernels read the input several times (max, exp-sum, normalize)
+ *   and kernels that change element width are not listed.
+ */
+
+typedef struct _xa_nn_inplace_entry_t
+{
+  const char *p_name;
+  WORD32 flags;
+} xa_nn_inplace_entry_t;
+
+#define INPLACE_1   (XA_NN_INPLACE_INP1)
+#define INPLACE_12  (XA_NN_INPLACE_INP1 | XA_NN_INPLACE_INP2)
+
+static const xa_nn_inplace_entry_t inplace_table[] =
+{
+  /* Activations */
+  {"xa_nn_vec_activation_min_max_8_8",        INPLACE_1},
+  {"xa_nn_vec_activation_min_max_16_16",      INPLACE_1},
+  {"xa_nn_vec_activation_min_max_asym8u_asym8u", INPLACE_1},
+  {"xa_nn_vec_relu_8_8",                      INPLACE_1},
+  {"xa_nn_vec_relu_std_8_8",                  INPLACE_1},
+  {"xa_nn_vec_relu_16_16",                    INPLACE_1},
+  {"xa_nn_vec_relu_std_16_16",                INPLACE_1},
+  {"xa_nn_vec_relu_asym8s_asym8s",            INPLACE_1},
+  {"xa_nn_vec_relu_asym8u_asym8u",            INPLACE_1},
+  {"xa_nn_vec_sigmoid_asym8s_asym8s",         INPLACE_1},
+  {"xa_nn_vec_sigmoid_sym16s_sym16s",         INPLACE_1},
+  {"xa_nn_vec_tanh_asym8s_asym8s",            INPLACE_1},
+  {"xa_nn_vec_tanh_sym16s_sym16s",            INPLACE_1},
+  {"xa_nn_vec_hard_swish_asym8s_asym8s",      INPLACE_1},
+  {"xa_nn_vec_prelu_asym8s_asym8s",           INPLACE_12},
+#if HAVE_VFPU
+  {"xa_nn_vec_activation_min_max_f32_f32",    INPLACE_1},
+  {"xa_nn_vec_relu_std_f32_f32",              INPLACE_1},
+#endif /* HAVE_VFPU */
+
+  /* Elementwise */
+  {"xa_nn_elm_add_asym8sxasym8s_asym8s",      INPLACE_12},
+  {"xa_nn_elm_sub_asym8sxasym8s_asym8s",      INPLACE_12},
+  {"xa_nn_elm_mul_asym8sxasym8s_asym8s",      INPLACE_12},
+  {"xa_nn_elm_max_8x8_8",                     INPLACE_12},
+  {"xa_nn_elm_min_8x8_8",                     INPLACE_12},
+#if HAVE_VFPU
+  {"xa_nn_elm_add_f32xf32_f32",               INPLACE_12},
+  {"xa_nn_elm_sub_f32xf32_f32",               INPLACE_12},
+  {"xa_nn_elm_mul_f32xf32_f32",               INPLACE_12},
+  {"xa_nn_elm_div_f32xf32_f32",               INPLACE_12},
+  {"xa_nn_elm_floor_f32_f32",                 INPLACE_1},
+#endif /* HAVE_VFPU */
+
+  /* Quantize */
+  {"xa_nn_elm_quantize_asym8s_asym8s",        INPLACE_1},
+  {"xa_nn_elm_quantize_asym8u_asym8s",        INPLACE_1},
+};
+
+WORD32 xa_nn_get_inplace_capability(const char *p_kernel_name)
+{
+  int i;
+
+  XA_NNLIB_CHK_PTR(p_kernel_name, XA_NN_INPLACE_NONE);
+
+  for(i = 0; i < (int)(sizeof(inplace_table) / sizeof(inplace_table[0])); i++)
+  {
+    if(strcmp(p_kernel_name, inplace_table[i].p_name) == 0)
+    {
+      return inplace_table[i].flags;
+    }
+  }
+  return XA_NN_INPLACE_NONE;
+}
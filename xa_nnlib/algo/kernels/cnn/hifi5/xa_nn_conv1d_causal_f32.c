@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv1d_causal_state.h"
+#include "xa_nnlib_err_chk.h"
+
+#if HAVE_VFPU
+
+WORD32 xa_nn_conv1d_causal_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 num_frames,
+    WORD32 input_channels,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 out_channels,
+    VOID *p_state,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_state, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT_16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, ALIGNMENT_16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT_16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT_16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_state, ALIGNMENT_16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_frames <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((dilation <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND((input_channels & 3), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels & 3), -1);
+
+  xa_nn_conv1d_causal_state_t *p_st = (xa_nn_conv1d_causal_state_t *)p_state;
+  XA_NNLIB_ARG_CHK_COND((conv1d_causal_check_state(p_st, kernel_width, dilation, input_channels, sizeof(FLOAT32)) != 0), -1);
+
+  WORD32 t, ret;
+  FLOAT32 *p_ker = (FLOAT32 *)p_kernel;
+
+  /* Each output frame is one matXvec over kernel_width taps; past taps are
+     read from the history, nothing already convolved is recomputed */
+  for(t = 0; t < num_frames; t++)
+  {
+    if(kernel_width == 2)
+    {
+      /* Two taps map directly onto mat1/vec1 and mat2/vec2 */
+      ret = xa_nn_matXvec_f32xf32_f32
+        (p_out
+         ,p_ker
+         ,p_ker + input_channels
+         ,(FLOAT32 *)conv1d_causal_frame(p_st, p_inp, t - dilation)
+         ,(FLOAT32 *)conv1d_causal_frame(p_st, p_inp, t)
+         ,(FLOAT32 *)p_bias
+         ,out_channels
+         ,input_channels
+         ,input_channels
+         ,2 * input_channels
+         ,2 * input_channels
+        );
+    }
+    else
+    {
+      ret = xa_nn_matXvec_f32xf32_f32
+        (p_out
+         ,p_ker
+         ,NULL
+         ,(FLOAT32 *)conv1d_causal_taps(p_st, p_inp, t, p_scratch)
+         ,NULL
+         ,(FLOAT32 *)p_bias
+         ,out_channels
+         ,kernel_width * input_channels
+         ,0
+         ,kernel_width * input_channels
+         ,0
+        );
+    }
+    if(ret < 0)
+    {
+      return -1;
+    }
+    p_out += out_channels;
+  }
+
+  conv1d_causal_update_hist(p_st, p_inp, num_frames);
+
+  return 0;
+}
+
+#endif /* HAVE_VFPU */
@@ -0,0 +1,211 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include <string.h>
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv1d_causal_state.h"
+#include "xa_nnlib_err_chk.h"
+
+static WORD32 conv1d_causal_bytewidth(WORD32 input_precision)
+{
+  switch(input_precision)
+  {
+    case 8:
+      return sizeof(WORD8);
+    case 16:
+      return sizeof(WORD16);
+    case -1:
+      return sizeof(FLOAT32);
+    default:
+      return -1;
+  }
+}
+
+WORD32 xa_nn_conv1d_causal_state_getsize(
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 input_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((dilation <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+
+  WORD32 input_bytewidth = conv1d_causal_bytewidth(input_precision);
+  XA_NNLIB_CHK_COND((input_bytewidth < 0), -1);
+
+  WORD32 mem_req = 0;
+  mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv1d_causal_state_t), ALIGNMENT_16);
+  /* (kernel_width-1)*dilation frames of history */
+  mem_req += ALIGNED_SIZE((kernel_width - 1) * dilation * input_channels * input_bytewidth, ALIGNMENT_16);
+
+  return mem_req;
+}
+
+WORD32 xa_nn_conv1d_causal_state_init(
+    VOID *p_state,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 input_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_PTR(p_state, -1);
+  XA_NNLIB_CHK_ALIGN(p_state, ALIGNMENT_16, -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((dilation <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+
+  WORD32 input_bytewidth = conv1d_causal_bytewidth(input_precision);
+  XA_NNLIB_CHK_COND((input_bytewidth < 0), -1);
+
+  xa_nn_conv1d_causal_state_t *p_st = (xa_nn_conv1d_causal_state_t *)p_state;
+  p_st->kernel_width = kernel_width;
+  p_st->dilation = dilation;
+  p_st->input_channels = input_channels;
+  p_st->input_bytewidth = input_bytewidth;
+  p_st->hist_frames = (kernel_width - 1) * dilation;
+  p_st->head = 0;
+  p_st->p_hist = ALIGNED_ADDR((pWORD8)p_state + sizeof(xa_nn_conv1d_causal_state_t), ALIGNMENT_16);
+
+  /* Samples before the first call are zero */
+  memset(p_st->p_hist, 0, p_st->hist_frames * input_channels * input_bytewidth);
+
+  return 0;
+}
+
+WORD32 xa_nn_conv1d_causal_getsize(
+    WORD32 kernel_width,
+    WORD32 input_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+
+  WORD32 input_bytewidth = conv1d_causal_bytewidth(input_precision);
+  XA_NNLIB_CHK_COND((input_bytewidth < 0), -1);
+
+  /* Gathered taps for one output frame */
+  return ALIGNED_SIZE(kernel_width * input_channels * input_bytewidth, ALIGNMENT_16);
+}
+
+WORD32 conv1d_causal_check_state(
+    const xa_nn_conv1d_causal_state_t *p_state,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 input_channels,
+    WORD32 input_bytewidth)
+{
+  if(p_state->kernel_width != kernel_width ||
+     p_state->dilation != dilation ||
+     p_state->input_channels != input_channels ||
+     p_state->input_bytewidth != input_bytewidth)
+  {
+    return -1;
+  }
+  return 0;
+}
+
+/* Frame frame_idx relative to the start of the current block; negative
+ * indices come from the history ring buffer */
+const VOID *conv1d_causal_frame(
+    const xa_nn_conv1d_causal_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 frame_idx)
+{
+  WORD32 frame_bytes = p_state->input_channels * p_state->input_bytewidth;
+  WORD32 slot;
+
+  if(frame_idx >= 0)
+  {
+    return (const WORD8 *)p_inp + frame_idx * frame_bytes;
+  }
+
+  slot = p_state->head + p_state->hist_frames + frame_idx;
+  if(slot >= p_state->hist_frames)
+  {
+    slot -= p_state->hist_frames;
+  }
+  return (const WORD8 *)p_state->p_hist + slot * frame_bytes;
+}
+
+/* Returns the kernel_width taps of output frame out_idx as one contiguous
+ * vector. Undilated windows inside the block are used in place, all others
+ * are gathered into p_taps. */
+const VOID *conv1d_causal_taps(
+    const xa_nn_conv1d_causal_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 out_idx,
+    VOID *p_taps)
+{
+  WORD32 frame_bytes = p_state->input_channels * p_state->input_bytewidth;
+  WORD32 first = out_idx - p_state->hist_frames;
+  WORD32 k;
+
+  if(first >= 0 && (p_state->dilation == 1 || p_state->kernel_width == 1))
+  {
+    return (const WORD8 *)p_inp + first * frame_bytes;
+  }
+
+  for(k = 0; k < p_state->kernel_width; k++)
+  {
+    memcpy((WORD8 *)p_taps + k * frame_bytes,
+           conv1d_causal_frame(p_state, p_inp, first + k * p_state->dilation),
+           frame_bytes);
+  }
+  return p_taps;
+}
+
+/* Keeps the last hist_frames frames of history followed by the block */
+VOID conv1d_causal_update_hist(
+    xa_nn_conv1d_causal_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 num_frames)
+{
+  WORD32 frame_bytes = p_state->input_channels * p_state->input_bytewidth;
+  WORD32 hist_frames = p_state->hist_frames;
+  WORD8 *p_hist = (WORD8 *)p_state->p_hist;
+  const WORD8 *p_src = (const WORD8 *)p_inp;
+  WORD32 first;
+
+  if(hist_frames == 0)
+  {
+    return;
+  }
+
+  if(num_frames >= hist_frames)
+  {
+    memcpy(p_hist, p_src + (num_frames - hist_frames) * frame_bytes, hist_frames * frame_bytes);
+    p_state->head = 0;
+    return;
+  }
+
+  /* Overwrite the num_frames oldest slots, wrapping at most once */
+  first = hist_frames - p_state->head;
+  first = first > num_frames ? num_frames : first;
+  memcpy(p_hist + p_state->head * frame_bytes, p_src, first * frame_bytes);
+  memcpy(p_hist, p_src + first * frame_bytes, (num_frames - first) * frame_bytes);
+  p_state->head += num_frames;
+  if(p_state->head >= hist_frames)
+  {
+    p_state->head -= hist_frames;
+  }
+}
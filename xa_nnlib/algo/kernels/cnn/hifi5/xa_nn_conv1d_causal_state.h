@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef  __XA_NN_CONV1D_CAUSAL_STATE_H__
+#define  __XA_NN_CONV1D_CAUSAL_STATE_H__
+
+#include "xa_nn_conv2d_std_state.h"
+
+/* Persistent state of one causal conv1d layer. p_hist holds the last
+ * (kernel_width-1)*dilation input frames as a ring buffer of
+ * input_channels-wide frames, oldest frame at slot head. */
+typedef struct _xa_nn_conv1d_causal_state_t{
+  WORD32 kernel_width;
+  WORD32 dilation;
+  WORD32 input_channels;
+  WORD32 input_bytewidth;
+  WORD32 hist_frames;
+  WORD32 head;
+  VOID *p_hist;
+} xa_nn_conv1d_causal_state_t;
+
+WORD32 conv1d_causal_check_state(
+    const xa_nn_conv1d_causal_state_t *p_state,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 input_channels,
+    WORD32 input_bytewidth);
+
+const VOID *conv1d_causal_frame(
+    const xa_nn_conv1d_causal_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 frame_idx);
+
+const VOID *conv1d_causal_taps(
+    const xa_nn_conv1d_causal_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 out_idx,
+    VOID *p_taps);
+
+VOID conv1d_causal_update_hist(
+    xa_nn_conv1d_causal_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 num_frames);
+
+#endif /* __XA_NN_CONV1D_CAUSAL_STATE_H__ */
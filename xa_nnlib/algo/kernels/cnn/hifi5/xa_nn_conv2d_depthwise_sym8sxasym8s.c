@@ -2065,7 +2065,10 @@ static void process_single_output_vplane_single_stride
    Supports multiple of 4 channels, y_stride 1  
    Channel multiplier should be 1
  */
-WORD32 xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3
+#ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
+/* 3x3 special case without argument checks, shared by the checked entry
+   point and plan_execute */
+static void xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3_run
   (pWORD8 __restrict__ p_out
   ,const WORD8 *__restrict__ p_kernel
   ,const WORD8 *__restrict__ p_inp
@@ -2073,9 +2076,6 @@ WORD32 xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3
   ,WORD32  input_height
   ,WORD32  input_width
   ,WORD32  input_channels
-  ,WORD32  kernel_height
-  ,WORD32  kernel_width
-  ,WORD32  channels_multiplier
   ,WORD32  x_stride
   ,WORD32  y_stride
   ,WORD32  x_padding
@@ -2086,48 +2086,10 @@ WORD32 xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3
   ,const WORD32 *p_out_multiplier
   ,const WORD32 *p_out_shift
   ,WORD32  out_zero_bias
-  ,WORD32  inp_data_format
-  ,WORD32  out_data_format
   ,pVOID p_scratch
   )
 {
-  int i;
-  //TODO: input pointer alignment check
-  /* NULL pointer checks */
-  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-  /* Pointer alignment checks */
-  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
-  /* Basic Parameter checks */
-  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((input_channels <= 0) || ((input_channels & 0x3) != 0), -1);
-  XA_NNLIB_ARG_CHK_COND((kernel_height != 3) || (kernel_width != 3), -1);
-  XA_NNLIB_ARG_CHK_COND((channels_multiplier != 1), -1);
-  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((input_zero_bias > 128 || input_zero_bias < -127), -1);
-  for(i = 0; i < input_channels*channels_multiplier; i++)
-    XA_NNLIB_ARG_CHK_COND((p_out_shift[i] < -31 || p_out_shift[i] > 31), -1);
-  XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
-  XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
-  /* Implementation dependent checks */
-  //TOOD: support y_stride 2
-  XA_NNLIB_ARG_CHK_COND((y_stride != 1) && (y_stride != 2), -1);
-  XA_NNLIB_ARG_CHK_COND((y_stride > kernel_height), -1);
-  XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
-  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
-  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
-
-#ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
+  WORD32 kernel_width = 3;
   WORD32 input_zero_bias_neg = -input_zero_bias;
   int itr_ow;
   xa_nn_conv2d_dw_k3x3_state_t * p_state;
@@ -2196,6 +2158,457 @@ WORD32 xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3
         );
     }
   }
+}
+#endif /* DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE */
+
+WORD32 xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  )
+{
+  int i;
+  //TODO: input pointer alignment check
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0) || ((input_channels & 0x3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height != 3) || (kernel_width != 3), -1);
+  XA_NNLIB_ARG_CHK_COND((channels_multiplier != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias > 128 || input_zero_bias < -127), -1);
+  for(i = 0; i < input_channels*channels_multiplier; i++)
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[i] < -31 || p_out_shift[i] > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+  /* Implementation dependent checks */
+  //TOOD: support y_stride 2
+  XA_NNLIB_ARG_CHK_COND((y_stride != 1) && (y_stride != 2), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride > kernel_height), -1);
+  XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+
+#ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
+  xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3_run
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,p_scratch
+    );
+#else
+  xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,out_data_format
+    ,p_scratch
+    );
+#endif
+
+  return 0;
+}
+
+#ifndef DISABLE_DEPTHWISE_CONV2D_K5X5_SPECIAL_CASE
+
+#define KH_5X5 5
+#define KW_5X5 5
+
+/* Output multipliers for 4 channels at a time: l_mult, out_multiplier, r_mult,
+   same layout as used by the 3x3 special case */
+static void xa_nn_conv2d_depthwise_init_scale_multipliers
+  (WORD32 *p_scale_multipliers
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32 channels
+  )
+{
+  int i, j;
+  for(i = 0; i < channels; i += 4)
+  {
+    for(j = 0; j < 4; j++)
+    {
+      WORD32 left_shift = p_out_shift[i + j] < 0 ? 0 : p_out_shift[i + j];
+      WORD32 right_shift = p_out_shift[i + j] > 0 ? 0 : -p_out_shift[i + j];
+      p_scale_multipliers[i * 3 + j] = (1 << left_shift);
+      p_scale_multipliers[i * 3 + 4 + j] = -p_out_multiplier[i + j];
+      p_scale_multipliers[i * 3 + 8 + j] = (0xFFFFFFFF << (31 - right_shift));
+    }
+  }
+}
+
+/* Two horizontally adjacent outputs with all 5 kernel columns inside the
+   input, input rows are read in place (no circular buffer copy) */
+static void process_k5x5_output_pair
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,const WORD32 *__restrict__ p_scale_multipliers
+  ,WORD32  input_channels
+  ,WORD32  input_row_offset
+  ,WORD32  kernel_rows
+  ,WORD32  x_stride
+  ,WORD32  input_zero_bias_neg
+  ,WORD32  out_zero_bias
+  )
+{
+  int itr_ch, itr_kh, itr_kw;
+  int x_offset = x_stride * input_channels;
+
+  for(itr_ch = 0; itr_ch < input_channels; itr_ch += 4)
+  {
+    ae_int32x2 d_acc0_01, d_acc0_23, d_acc1_01, d_acc1_23;
+    ae_int16x4 d_inp0, d_inp1, d_ker;
+
+    d_acc0_01 = AE_MOVDA32X2(p_bias[itr_ch + 0], p_bias[itr_ch + 1]);
+    d_acc0_23 = AE_MOVDA32X2(p_bias[itr_ch + 2], p_bias[itr_ch + 3]);
+    d_acc1_01 = d_acc0_01;
+    d_acc1_23 = d_acc0_23;
+
+#pragma loop_count min=1
+    for(itr_kh = 0; itr_kh < kernel_rows; itr_kh++)
+    {
+      const WORD8 *p_inp0 = p_inp + itr_kh * input_row_offset + itr_ch;
+      const WORD8 *p_ker0 = p_kernel + itr_kh * KW_5X5 * input_channels + itr_ch;
+
+      for(itr_kw = 0; itr_kw < KW_5X5; itr_kw++)
+      {
+        d_inp1 = AE_L8X4S_X(p_inp0, x_offset);
+        AE_L8X4S_XP(d_inp0, p_inp0, input_channels);
+        AE_L8X4S_XP(d_ker, p_ker0, input_channels);
+        d_inp0 = AE_SUB16S(d_inp0, AE_MOVDA16(input_zero_bias_neg));
+        d_inp1 = AE_SUB16S(d_inp1, AE_MOVDA16(input_zero_bias_neg));
+        AE_MULA16X4(d_acc0_01, d_acc0_23, d_inp0, d_ker);
+        AE_MULA16X4(d_acc1_01, d_acc1_23, d_inp1, d_ker);
+      }
+    }
+
+    /* Quantize */
+    ae_int32x2 lmult01, lmult23;
+    ae_int32x2 mult01, mult23;
+    ae_int32x2 rmult01, rmult23;
+    const ae_int32x4 *p_mult = (const ae_int32x4 *)&p_scale_multipliers[itr_ch * 3];
+    AE_L32X2X2_IP(lmult01, lmult23, p_mult, 16);
+    AE_L32X2X2_IP(mult01, mult23, p_mult, 16);
+    AE_L32X2X2_IP(rmult01, rmult23, p_mult, 16);
+
+    ae_int16x4 out_0, out_1;
+    MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, d_acc0_01, d_acc0_23, \
+        lmult01, lmult23, mult01, mult23, rmult01, rmult23, out_zero_bias);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_1, d_acc1_01, d_acc1_23, \
+        lmult01, lmult23, mult01, mult23, rmult01, rmult23, out_zero_bias);
+
+    /* Pack and store output */
+    ae_int8x8 out32_0;
+    PACK_32X2(out32_0, out_0, out_1);
+    ae_int32 *p_dst = (ae_int32 *)(p_out + itr_ch);
+    AE_S32_H_XP(AE_MOVINT32X2_FROMINT8X8(out32_0), p_dst, input_channels);
+    AE_S32_L_XP(AE_MOVINT32X2_FROMINT8X8(out32_0), p_dst, input_channels);
+  }
+}
+
+/* Single output over a kernel_rows x kernel_cols window of the input, used
+   at the padded borders (window can be empty when fully in padding) */
+static void process_k5x5_output_single
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,const WORD32 *__restrict__ p_scale_multipliers
+  ,WORD32  input_channels
+  ,WORD32  input_row_offset
+  ,WORD32  kernel_rows
+  ,WORD32  kernel_cols
+  ,WORD32  input_zero_bias_neg
+  ,WORD32  out_zero_bias
+  )
+{
+  int itr_ch, itr_kh, itr_kw;
+
+  for(itr_ch = 0; itr_ch < input_channels; itr_ch += 4)
+  {
+    ae_int32x2 d_acc01, d_acc23;
+    ae_int16x4 d_inp, d_ker;
+
+    d_acc01 = AE_MOVDA32X2(p_bias[itr_ch + 0], p_bias[itr_ch + 1]);
+    d_acc23 = AE_MOVDA32X2(p_bias[itr_ch + 2], p_bias[itr_ch + 3]);
+
+    for(itr_kh = 0; itr_kh < kernel_rows; itr_kh++)
+    {
+      const WORD8 *p_inp0 = p_inp + itr_kh * input_row_offset + itr_ch;
+      const WORD8 *p_ker0 = p_kernel + itr_kh * KW_5X5 * input_channels + itr_ch;
+      for(itr_kw = 0; itr_kw < kernel_cols; itr_kw++)
+      {
+        AE_L8X4S_XP(d_inp, p_inp0, input_channels);
+        AE_L8X4S_XP(d_ker, p_ker0, input_channels);
+        d_inp = AE_SUB16S(d_inp, AE_MOVDA16(input_zero_bias_neg));
+        AE_MULA16X4(d_acc01, d_acc23, d_inp, d_ker);
+      }
+    }
+
+    /* Quantize */
+    ae_int32x2 lmult01, lmult23;
+    ae_int32x2 mult01, mult23;
+    ae_int32x2 rmult01, rmult23;
+    const ae_int32x4 *p_mult = (const ae_int32x4 *)&p_scale_multipliers[itr_ch * 3];
+    AE_L32X2X2_IP(lmult01, lmult23, p_mult, 16);
+    AE_L32X2X2_IP(mult01, mult23, p_mult, 16);
+    AE_L32X2X2_IP(rmult01, rmult23, p_mult, 16);
+
+    ae_int16x4 out_0;
+    MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, d_acc01, d_acc23, \
+        lmult01, lmult23, mult01, mult23, rmult01, rmult23, out_zero_bias);
+
+    /* Pack and store output */
+    ae_int8x8 out32_0;
+    PACK_32X2(out32_0, out_0, AE_ZERO16());
+    AE_S32_H_I(AE_MOVINT32X2_FROMINT8X8(out32_0), (ae_int32 *)(p_out + itr_ch), 0);
+  }
+}
+static void xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k5x5_run
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,pVOID p_scratch
+  )
+{
+  WORD32 input_zero_bias_neg = -input_zero_bias;
+  WORD32 input_row_offset = input_width * input_channels;
+  int itr_oh, itr_ow;
+
+  /* Scratch requirement is covered by the 3x3 special case size */
+  WORD32 *p_scale_multipliers = (WORD32 *)ALIGN_PTR(p_scratch, ALIGNMENT_16);
+  xa_nn_conv2d_depthwise_init_scale_multipliers(p_scale_multipliers
+      ,p_out_multiplier
+      ,p_out_shift
+      ,input_channels
+      );
+
+  for(itr_oh = 0; itr_oh < out_height; itr_oh++)
+  {
+    /* Valid kernel rows for this output row */
+    int y_start = itr_oh * y_stride - y_padding;
+    int kh_start = XT_MAX(0, -y_start);
+    int kh_end = XT_MIN(KH_5X5, input_height - y_start);
+    int kernel_rows = XT_MAX(0, kh_end - kh_start);
+    const WORD8 *p_inp_row = p_inp + (y_start + kh_start) * input_row_offset;
+    const WORD8 *p_ker_row = p_kernel + kh_start * KW_5X5 * input_channels;
+    pWORD8 p_out_row = p_out + itr_oh * out_width * input_channels;
+
+    for(itr_ow = 0; itr_ow < out_width; )
+    {
+      int x_start = itr_ow * x_stride - x_padding;
+      int x_start_next = x_start + x_stride;
+
+      if((kernel_rows > 0) &&
+         (itr_ow + 1 < out_width) &&
+         (x_start >= 0) &&
+         (x_start_next + KW_5X5 <= input_width))
+      {
+        process_k5x5_output_pair(p_out_row + itr_ow * input_channels
+            ,p_ker_row
+            ,p_inp_row + x_start * input_channels
+            ,p_bias
+            ,p_scale_multipliers
+            ,input_channels
+            ,input_row_offset
+            ,kernel_rows
+            ,x_stride
+            ,input_zero_bias_neg
+            ,out_zero_bias
+            );
+        itr_ow += 2;
+      }
+      else
+      {
+        int kw_start = XT_MAX(0, -x_start);
+        int kw_end = XT_MIN(KW_5X5, input_width - x_start);
+        int kernel_cols = XT_MAX(0, kw_end - kw_start);
+        process_k5x5_output_single(p_out_row + itr_ow * input_channels
+            ,p_ker_row + kw_start * input_channels
+            ,p_inp_row + (x_start + kw_start) * input_channels
+            ,p_bias
+            ,p_scale_multipliers
+            ,input_channels
+            ,input_row_offset
+            ,kernel_rows
+            ,kernel_cols
+            ,input_zero_bias_neg
+            ,out_zero_bias
+            );
+        itr_ow++;
+      }
+    }
+  }
+}
+#endif /* DISABLE_DEPTHWISE_CONV2D_K5X5_SPECIAL_CASE */
+
+/* Special case of 5x5 kernel for NHWC format
+   Supports multiple of 4 channels, x_stride and y_stride 1 or 2
+   Channel multiplier should be 1
+   Input rows are streamed directly from the input, interior outputs are
+   computed two at a time sharing the kernel loads
+ */
+WORD32 xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k5x5
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  )
+{
+  int i;
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0) || ((input_channels & 0x3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height != 5) || (kernel_width != 5), -1);
+  XA_NNLIB_ARG_CHK_COND((channels_multiplier != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias > 128 || input_zero_bias < -127), -1);
+  for(i = 0; i < input_channels*channels_multiplier; i++)
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[i] < -31 || p_out_shift[i] > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((inp_data_format != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND((y_stride != 1) && (y_stride != 2), -1);
+  XA_NNLIB_ARG_CHK_COND((x_stride != 1) && (x_stride != 2), -1);
+
+#ifndef DISABLE_DEPTHWISE_CONV2D_K5X5_SPECIAL_CASE
+  xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k5x5_run
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,p_scratch
+    );
 #else
   xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s
     (p_out
@@ -2466,6 +2879,46 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
       ,p_scratch
       );
   }
+#endif
+#ifndef DISABLE_DEPTHWISE_CONV2D_K5X5_SPECIAL_CASE
+  else if((channels_multiplier == 1) &&
+     (kernel_height == 5) &&
+     (kernel_width == 5) &&
+      ALIGNED_PTR(p_inp, 4) &&
+      ALIGNED_PTR(p_kernel, 4) &&
+      ALIGNED_PTR(p_out, 4) &&
+     ((x_stride == 1) || (x_stride == 2)) &&
+     ((y_stride == 1) || (y_stride == 2)) &&
+     (inp_data_format == 0) &&
+     ((input_channels & 0x3) == 0) &&
+     1)
+  {
+    return xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k5x5
+      (p_out
+      ,p_kernel
+      ,p_inp
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,channels_multiplier
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,inp_data_format
+      ,out_data_format
+      ,p_scratch
+      );
+  }
 #endif
   else 
   {
@@ -2496,3 +2949,364 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
       );
   }
 }
+
+#define DW_PLAN_PATH_STD     0
+#define DW_PLAN_PATH_GENERIC 1
+#define DW_PLAN_PATH_K3X3    2
+#define DW_PLAN_PATH_K5X5    3
+
+/* Validated arguments and selected kernel of one per-channel depthwise layer.
+   For the single input channel case the plan memory also holds the
+   conv2d_std plan and the kernel rearranged to NCHW. */
+typedef struct _xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t
+{
+  const WORD8 *p_kernel;
+  const WORD32 *p_bias;
+  const WORD32 *p_out_multiplier;
+  const WORD32 *p_out_shift;
+  WORD32 input_height;
+  WORD32 input_width;
+  WORD32 input_channels;
+  WORD32 kernel_height;
+  WORD32 kernel_width;
+  WORD32 channels_multiplier;
+  WORD32 x_stride;
+  WORD32 y_stride;
+  WORD32 x_padding;
+  WORD32 y_padding;
+  WORD32 out_height;
+  WORD32 out_width;
+  WORD32 input_zero_bias;
+  WORD32 out_zero_bias;
+  WORD32 inp_data_format;
+  WORD32 out_data_format;
+  WORD32 path;
+  WORD32 generic_ok;
+  pVOID p_std_plan;
+} xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t;
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_getsize
+  (WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  inp_data_format
+  )
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((channels_multiplier <= 0), -1);
+  XA_NNLIB_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
+
+  WORD32 mem_req = ALIGNED_SIZE(sizeof(xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t), ALIGNMENT_16);
+  if((input_channels == 1) && (inp_data_format == 0))
+  {
+    mem_req += ALIGNED_SIZE(xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_getsize(), ALIGNMENT_16);
+    mem_req += ALIGNED_SIZE(channels_multiplier * kernel_height * kernel_width, ALIGNMENT_16);
+  }
+  return mem_req;
+}
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_create
+  (pVOID p_plan
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  )
+{
+  int i;
+  /* Checks are done once here regardless of DISABLE_ARG_CHK */
+  /* NULL pointer checks */
+  XA_NNLIB_CHK_PTR(p_plan, -1);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_CHK_PTR(p_bias, -1);
+  XA_NNLIB_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_CHK_ALIGN(p_plan, ALIGNMENT_16, -1);
+  XA_NNLIB_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((channels_multiplier <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_zero_bias > 128 || input_zero_bias < -127), -1);
+  for(i = 0; i < input_channels*channels_multiplier; i++)
+    XA_NNLIB_CHK_COND((p_out_shift[i] < -31 || p_out_shift[i] > 31), -1);
+  XA_NNLIB_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
+  XA_NNLIB_CHK_COND((out_data_format != 0), -1);
+
+  xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t *p_dw_plan = (xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t *)p_plan;
+  p_dw_plan->p_kernel = p_kernel;
+  p_dw_plan->p_bias = p_bias;
+  p_dw_plan->p_out_multiplier = p_out_multiplier;
+  p_dw_plan->p_out_shift = p_out_shift;
+  p_dw_plan->input_height = input_height;
+  p_dw_plan->input_width = input_width;
+  p_dw_plan->input_channels = input_channels;
+  p_dw_plan->kernel_height = kernel_height;
+  p_dw_plan->kernel_width = kernel_width;
+  p_dw_plan->channels_multiplier = channels_multiplier;
+  p_dw_plan->x_stride = x_stride;
+  p_dw_plan->y_stride = y_stride;
+  p_dw_plan->x_padding = x_padding;
+  p_dw_plan->y_padding = y_padding;
+  p_dw_plan->out_height = out_height;
+  p_dw_plan->out_width = out_width;
+  p_dw_plan->input_zero_bias = input_zero_bias;
+  p_dw_plan->out_zero_bias = out_zero_bias;
+  p_dw_plan->inp_data_format = inp_data_format;
+  p_dw_plan->out_data_format = out_data_format;
+  p_dw_plan->p_std_plan = NULL;
+
+  /* For single input channel, use the standard convolution with the kernel
+     rearranged once into plan memory */
+  if((input_channels == 1) && (inp_data_format == 0))
+  {
+    pWORD8 p_kernel_nchw;
+    WORD32 scratch_size;
+    p_dw_plan->path = DW_PLAN_PATH_STD;
+    p_dw_plan->generic_ok = 0;
+    p_dw_plan->p_std_plan = (pVOID)((pWORD8)p_plan + ALIGNED_SIZE(sizeof(xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t), ALIGNMENT_16));
+    p_kernel_nchw = (pWORD8)p_dw_plan->p_std_plan + ALIGNED_SIZE(xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_getsize(), ALIGNMENT_16);
+
+    xa_nn_rearrange_hwc_to_chw(p_kernel_nchw, p_kernel, kernel_height, kernel_width, channels_multiplier);
+
+    scratch_size = xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_create
+      (p_dw_plan->p_std_plan
+      ,p_kernel_nchw
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,channels_multiplier
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,(WORD32 *)p_out_multiplier
+      ,(WORD32 *)p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      );
+    if(scratch_size < 0)
+      return -1;
+    return scratch_size;
+  }
+
+  /* Generic kernel is also the fallback when the special case cannot be
+     used for unaligned input or output pointers at execute time */
+  p_dw_plan->generic_ok = (y_stride <= kernel_height) &&
+                          (x_stride <= kernel_width) &&
+                          (kernel_height <= input_height) &&
+                          (kernel_width <= input_width);
+  p_dw_plan->path = DW_PLAN_PATH_GENERIC;
+#ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
+  if((channels_multiplier == 1) &&
+     (kernel_height == 3) &&
+     (kernel_width == 3) &&
+      ALIGNED_PTR(p_kernel, 4) &&
+     ((y_stride == 1) || (y_stride == 2)) &&
+     (x_stride <= kernel_width) &&
+     (kernel_height <= input_height) &&
+     (kernel_width <= input_width) &&
+     (inp_data_format == 0) &&
+     ((input_channels & 0x3) == 0))
+  {
+    p_dw_plan->path = DW_PLAN_PATH_K3X3;
+  }
+#endif
+#ifndef DISABLE_DEPTHWISE_CONV2D_K5X5_SPECIAL_CASE
+  if((channels_multiplier == 1) &&
+     (kernel_height == 5) &&
+     (kernel_width == 5) &&
+      ALIGNED_PTR(p_kernel, 4) &&
+     ((x_stride == 1) || (x_stride == 2)) &&
+     ((y_stride == 1) || (y_stride == 2)) &&
+     (inp_data_format == 0) &&
+     ((input_channels & 0x3) == 0))
+  {
+    p_dw_plan->path = DW_PLAN_PATH_K5X5;
+  }
+#endif
+  XA_NNLIB_CHK_COND((p_dw_plan->path == DW_PLAN_PATH_GENERIC) && !p_dw_plan->generic_ok, -1);
+
+  /* Scratch size needed by plan_execute */
+  return xa_nn_conv2d_depthwise_getsize
+    (input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,PREC_ASYM8S
+    ,inp_data_format
+    );
+}
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_execute
+  (const VOID *p_plan
+  ,pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_inp
+  ,pVOID p_scratch
+  )
+{
+  const xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t *p_dw_plan = (const xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_t *)p_plan;
+  WORD32 path = p_dw_plan->path;
+
+  if(path == DW_PLAN_PATH_STD)
+  {
+    return xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_execute(p_dw_plan->p_std_plan, p_out, p_inp, p_scratch);
+  }
+
+  /* Special cases need word aligned input and output */
+  if((path != DW_PLAN_PATH_GENERIC) && !(ALIGNED_PTR(p_inp, 4) && ALIGNED_PTR(p_out, 4)))
+  {
+    if(!p_dw_plan->generic_ok)
+      return -1;
+    path = DW_PLAN_PATH_GENERIC;
+  }
+
+  switch(path)
+  {
+#ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
+    case DW_PLAN_PATH_K3X3:
+      xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k3x3_run
+        (p_out
+        ,p_dw_plan->p_kernel
+        ,p_inp
+        ,p_dw_plan->p_bias
+        ,p_dw_plan->input_height
+        ,p_dw_plan->input_width
+        ,p_dw_plan->input_channels
+        ,p_dw_plan->x_stride
+        ,p_dw_plan->y_stride
+        ,p_dw_plan->x_padding
+        ,p_dw_plan->y_padding
+        ,p_dw_plan->out_height
+        ,p_dw_plan->out_width
+        ,p_dw_plan->input_zero_bias
+        ,p_dw_plan->p_out_multiplier
+        ,p_dw_plan->p_out_shift
+        ,p_dw_plan->out_zero_bias
+        ,p_scratch
+        );
+      break;
+#endif
+#ifndef DISABLE_DEPTHWISE_CONV2D_K5X5_SPECIAL_CASE
+    case DW_PLAN_PATH_K5X5:
+      xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s_k5x5_run
+        (p_out
+        ,p_dw_plan->p_kernel
+        ,p_inp
+        ,p_dw_plan->p_bias
+        ,p_dw_plan->input_height
+        ,p_dw_plan->input_width
+        ,p_dw_plan->input_channels
+        ,p_dw_plan->x_stride
+        ,p_dw_plan->y_stride
+        ,p_dw_plan->x_padding
+        ,p_dw_plan->y_padding
+        ,p_dw_plan->out_height
+        ,p_dw_plan->out_width
+        ,p_dw_plan->input_zero_bias
+        ,p_dw_plan->p_out_multiplier
+        ,p_dw_plan->p_out_shift
+        ,p_dw_plan->out_zero_bias
+        ,p_scratch
+        );
+      break;
+#endif
+    default:
+      if(p_dw_plan->inp_data_format == 0)
+      {
+        xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s
+          (p_out
+          ,p_dw_plan->p_kernel
+          ,p_inp
+          ,p_dw_plan->p_bias
+          ,p_dw_plan->input_height
+          ,p_dw_plan->input_width
+          ,p_dw_plan->input_channels
+          ,p_dw_plan->kernel_height
+          ,p_dw_plan->kernel_width
+          ,p_dw_plan->channels_multiplier
+          ,p_dw_plan->x_stride
+          ,p_dw_plan->y_stride
+          ,p_dw_plan->x_padding
+          ,p_dw_plan->y_padding
+          ,p_dw_plan->out_height
+          ,p_dw_plan->out_width
+          ,p_dw_plan->input_zero_bias
+          ,p_dw_plan->p_out_multiplier
+          ,p_dw_plan->p_out_shift
+          ,p_dw_plan->out_zero_bias
+          ,p_dw_plan->out_data_format
+          ,p_scratch
+          );
+      }
+      else
+      {
+        xa_nn_conv2d_depthwise_nchw_per_chan_sym8sxasym8s
+          (p_out
+          ,p_dw_plan->p_kernel
+          ,p_inp
+          ,p_dw_plan->p_bias
+          ,p_dw_plan->input_height
+          ,p_dw_plan->input_width
+          ,p_dw_plan->input_channels
+          ,p_dw_plan->kernel_height
+          ,p_dw_plan->kernel_width
+          ,p_dw_plan->channels_multiplier
+          ,p_dw_plan->x_stride
+          ,p_dw_plan->y_stride
+          ,p_dw_plan->x_padding
+          ,p_dw_plan->y_padding
+          ,p_dw_plan->out_height
+          ,p_dw_plan->out_width
+          ,p_dw_plan->input_zero_bias
+          ,p_dw_plan->p_out_multiplier
+          ,p_dw_plan->p_out_shift
+          ,p_dw_plan->out_zero_bias
+          ,p_dw_plan->out_data_format
+          ,p_scratch
+          );
+      }
+      break;
+  }
+
+  return 0;
+}
@@ -0,0 +1,333 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nn_conv2d_std_state.h"
+
+/* Grouped convolution circular buffer
+ *
+ * The circular buffer of a grouped convolution holds one sub-image per group,
+ * stacked along the height: group g occupies rows
+ * [g * height_pad, (g + 1) * height_pad) with height_pad = y_padding +
+ * input_height + y_b_pad, and every row holds kernel_width planes of
+ * group_channels_pad channels of that group only. Seen from the matXvec
+ * kernels this is the circular buffer of a standard convolution over an
+ * image of height groups * height_pad and group_channels_pad channels, so the
+ * matrix of group g starts g * height_pad rows after cir_buf.p_curr and has
+ * contiguous kernel_height * kernel_width * group_channels_pad columns. */
+
+static WORD32 conv2d_grouped_channels_pad(
+    WORD32 group_channels,
+    WORD32 input_precision)
+{
+  /* Only 8-bit asymmetric and 32-bit float inputs are supported */
+  switch(input_precision)
+  {
+    case PREC_ASYM8S:
+      return group_channels;
+    case PREC_F32:
+      return PADDED_SIZE(group_channels, (ALIGNMENT>>2));
+    default:
+      return -1;
+  }
+}
+
+static WORD32 conv2d_grouped_cir_buf_size(
+    WORD32 input_height,
+    WORD32 groups,
+    WORD32 group_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height)
+{
+  // Determine y-bottom padding
+  WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
+  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+  WORD32 cir_buf_size_bytes = groups * (y_padding + input_height + y_b_pad) * kernel_width * group_channels_pad * input_bytewidth;
+  while(cir_buf_size_bytes%16 !=0)
+  {
+      cir_buf_size_bytes+= kernel_width*group_channels_pad*input_bytewidth;
+  }
+  return cir_buf_size_bytes;
+}
+
+WORD32 xa_nn_conv2d_grouped_getsize(
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 groups,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((input_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0), -1);
+  XA_NNLIB_CHK_COND((groups <= 0 || (input_channels % groups) != 0), -1);
+
+  WORD32 mem_req = 0;
+  WORD32 input_size = (input_precision == PREC_F32) ? sizeof(FLOAT32) : sizeof(WORD8);
+  WORD32 group_channels_pad = conv2d_grouped_channels_pad(input_channels / groups, input_precision);
+
+  /* Input precision is checked here */
+  XA_NNLIB_CHK_COND((group_channels_pad < 0), -1);
+
+  mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), ALIGNMENT_16);
+  /* scratch memory for convolution using matrix multiplication */
+  mem_req += conv2d_grouped_cir_buf_size(input_height, groups, group_channels_pad, input_size, kernel_height, kernel_width, y_stride, y_padding, out_height);
+  mem_req += BUS_WIDTH;
+
+  return mem_req;
+}
+
+VOID xa_nn_conv2d_grouped_init_state(
+    VOID *p_scratch,
+    VOID *p_kernel,
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 groups,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_precision)
+{
+  WORD8 *p_mem = (WORD8 *)p_scratch;
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_mem;
+  WORD32 input_size = (input_precision == PREC_F32) ? sizeof(FLOAT32) : sizeof(WORD8);
+  WORD32 group_channels_pad = conv2d_grouped_channels_pad(input_channels / groups, input_precision);
+
+  p_mem += sizeof(xa_nn_conv_state_t);
+  p_mem = ALIGNED_ADDR(p_mem, ALIGNMENT_16);
+
+  if(((UWORD32)p_kernel & BUS_WIDTH_MASK) == ((UWORD32)p_mem & BUS_WIDTH_MASK))
+  {
+    p_mem += BUS_WIDTH; /* Add a offset to avoid banking stall */
+  }
+
+  p_state->cir_buf.p_begin = p_mem;
+  p_state->cir_buf.p_curr = p_mem;
+
+  p_mem += conv2d_grouped_cir_buf_size(input_height, groups, group_channels_pad, input_size, kernel_height, kernel_width, y_stride, y_padding, out_height);
+  p_state->cir_buf.p_end = p_mem;
+
+  AE_SETCBEGIN0(p_state->cir_buf.p_begin);
+  AE_SETCEND0(p_state->cir_buf.p_end);
+}
+
+VOID conv2d_grouped_init_cir_buf(
+    WORD32 input_channels,
+    WORD32 groups,
+    WORD32 group_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val)
+{
+  WORD32 g,i,k;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
+  WORD8 *p_inp_group;
+  WORD32 group_bytes = (input_channels / groups) * input_bytewidth;
+  WORD32 plane_bytes = group_channels_pad * input_bytewidth;
+  WORD32 pixel_bytes = input_channels * input_bytewidth;
+  WORD32 planes_to_add = x_stride > kernel_width ? 0 : kernel_width - x_stride;
+  WORD32 planes_to_keep = kernel_width - planes_to_add;
+  UWORD8 pad_val_8 = (UWORD8)pad_val;
+  WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+
+  // Set 'input_height' rows of cir_buf with zero and/or input data
+  WORD32 copy_x_pad_width = x_padding;
+  WORD32 copy_inp_width = 0;
+  if(planes_to_add <= x_padding)
+  {
+    copy_x_pad_width = planes_to_add;
+  }
+  else
+  {
+    copy_inp_width = planes_to_add - x_padding;
+  }
+
+  // Sub-images of the groups are written one after another
+  for(g=0;g<groups;g++)
+  {
+    p_inp_group = p_inp + g * group_bytes;
+
+    // Set first 'y_padding' rows of the group to zero
+    for(i=0;i<y_padding;i++)
+    {
+      for(k=0;k<planes_to_add;k++)
+      {
+        memset(p_dst, pad_val_8, plane_bytes);
+        AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_bytes);
+      }
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+    }
+
+    for(i=0;i<input_height;i++)
+    {
+      for(k=0;k<copy_x_pad_width;k++)
+      {
+        memset(p_dst, pad_val_8, plane_bytes);
+        AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_bytes);
+      }
+      for(k=0;k<copy_inp_width;k++)
+      {
+        memcpy(p_dst, &p_inp_group[(i * input_width + k) * pixel_bytes], group_bytes);
+        memset(&p_dst[group_bytes], pad_val_8, plane_bytes - group_bytes);
+        AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_bytes);
+      }
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+    }
+
+    // Set last 'y_b_pad' rows of the group to zero
+    for(i=0;i<y_b_pad;i++)
+    {
+      for(k=0;k<planes_to_add;k++)
+      {
+        memset(p_dst, pad_val_8, plane_bytes);
+        AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_bytes);
+      }
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+    }
+  }
+  p_inp += copy_inp_width * pixel_bytes;
+  *pp_inp = (VOID *)p_inp;
+}
+
+// Add x_stride (but not more than kernel_width) x (input_height x input_channels) new planes to circular buffer
+VOID conv2d_grouped_update_cir_buf(
+    WORD32 input_channels,
+    WORD32 groups,
+    WORD32 group_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val)
+{
+  WORD32 g,i,k;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
+  WORD32 group_bytes = (input_channels / groups) * input_bytewidth;
+  WORD32 plane_bytes = group_channels_pad * input_bytewidth;
+  WORD32 pixel_bytes = input_channels * input_bytewidth;
+  WORD32 planes_to_add = x_stride > kernel_width ? kernel_width : x_stride;
+  WORD32 planes_to_keep = kernel_width - planes_to_add;
+  UWORD8 pad_val_8 = (UWORD8)pad_val;
+  WORD8* __restrict__ p_dst_temp;
+  WORD8* __restrict__ p_inp_temp;
+
+  if(idx_beg_inp_width_pad < 0)
+  {
+    /* x_stride > kernel_width case */
+    idx_beg_inp_width_pad = 0;
+  }
+
+  WORD32 to_skip_inp_width = x_stride - planes_to_add;     // Non-zero for x_stride > kernel_width
+
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_state->cir_buf.p_curr, planes_to_add * plane_bytes);
+  WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+
+  // Copy 'planes_to_add' planes of data to circular buffer
+  for(k = 0; k < planes_to_add; k++)
+  {
+    /* Walking down the rows of one plane crosses the sub-images of all
+     * groups, the last row of group g is followed by the first of g+1 */
+    p_dst_temp = p_dst;
+    if((idx_beg_inp_width_pad < x_padding) || (idx_beg_inp_width_pad >= x_padding + input_width))
+    {
+      /* Add a padding frame */
+      for(i = 0; i < groups * (y_padding + input_height + y_b_pad); i++)
+      {
+        memset(p_dst_temp, pad_val_8, plane_bytes);
+        AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * plane_bytes);
+      }
+    }
+    else
+    {
+      /* Add an input frame */
+      for(g = 0; g < groups; g++)
+      {
+        p_inp_temp = p_inp + g * group_bytes;
+
+        /* Top padding */
+        for(i = 0; i < y_padding; i++)
+        {
+          memset(p_dst_temp, pad_val_8, plane_bytes);
+          AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * plane_bytes);
+        }
+
+        /* Input height */
+        for(i = 0; i < input_height; i++)
+        {
+          memcpy(p_dst_temp, p_inp_temp, group_bytes);
+          p_inp_temp += input_width * pixel_bytes;
+          memset(&p_dst_temp[group_bytes], pad_val_8, plane_bytes - group_bytes);
+          AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * plane_bytes);
+        }
+
+        /* Bottom padding */
+        for(i = 0; i < y_b_pad; i++)
+        {
+          memset(p_dst_temp, pad_val_8, plane_bytes);
+          AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * plane_bytes);
+        }
+      }
+      p_inp += pixel_bytes;
+    }
+
+    /* Update the index and destination frame pointer */
+    idx_beg_inp_width_pad++;
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_bytes);
+  }
+
+  /* Skip required number of input frames */
+  p_inp += to_skip_inp_width * pixel_bytes;
+  *pp_inp = (VOID *)p_inp;
+}
@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv2d_std_state.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_err_chk.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_grouped_f32,(
+    FLOAT32 *p_out,
+    const FLOAT32 *p_inp,
+    const FLOAT32 *p_kernel,
+    const FLOAT32 *p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_handle))
+#else /* #if !HAVE_VFPU */
+
+/* Output columns whose receptive field lies in x-padding only: output is just
+ * the bias of every output channel */
+static VOID conv_x_pad_bias(
+    WORD32 out_width_beg,
+    WORD32 out_width_end,
+    WORD32 out_height,
+    WORD32 out_channels,
+    WORD32 out_channels_offset,
+    WORD32 out_width_offset,
+    WORD32 out_height_offset,
+    const FLOAT32 *p_bias,
+    FLOAT32 *p_out)
+{
+  WORD32 i,j,k;
+
+  for(i=0;i<out_height;i++)
+  {
+    for(j=out_width_beg;j<out_width_end;j++)
+    {
+      for(k=0;k<out_channels;k++)
+      {
+        p_out[i*out_height_offset+j*out_width_offset+k*out_channels_offset] = p_bias[k];
+      }
+    }
+  }
+}
+
+/* Grouped convolution, see xa_nn_conv2d_grouped_per_chan_sym8sxasym8s.
+ * As for xa_nn_conv2d_std_f32 the channels of the kernel are padded to a
+ * multiple of 2: kernel layout is
+ * [out_channels][kernel_height][kernel_width][PADDED_SIZE(input_channels / groups, 2)]. */
+WORD32 xa_nn_conv2d_grouped_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((groups <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_channels % groups) != 0 || (out_channels % groups) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  WORD32 j, g;
+  WORD32 input_bytewidth = sizeof(*p_inp);
+  VOID *pp_inp = (VOID *)p_inp;
+  WORD32 group_channels_pad = PADDED_SIZE(input_channels / groups, (ALIGNMENT>>2));
+  WORD32 group_out_channels = out_channels / groups;
+  WORD32 group_kernel_size = group_channels_pad * kernel_width * kernel_height;
+
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
+  xa_nn_conv2d_grouped_init_state((void*)p_state,(void*)p_kernel,input_height,input_channels,groups,kernel_height,kernel_width,y_stride,y_padding,out_height,-1);
+
+  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
+  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+  WORD32 x_padding_var = x_padding;
+
+  /* When kernel convolves over x-left pad region only */
+  WORD32 out_width_over_x_pad = 0;
+  if(x_padding_var >= kernel_width)
+  {
+    out_width_over_x_pad = (x_padding - kernel_width)/x_stride + 1;
+    out_width_over_x_pad = out_width_over_x_pad > out_width ? out_width : out_width_over_x_pad;
+    conv_x_pad_bias(0, out_width_over_x_pad, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out);
+    x_padding_var -= out_width_over_x_pad * x_stride;
+  }
+
+  /* When kernel convolves over x-right pad region only */
+  WORD32 out_width_over_x_r_pad = 0;
+  // Determine x-right padding
+  WORD32 x_r_pad = kernel_width + (out_width - 1) * x_stride - (x_padding + input_width);
+  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
+  if(x_r_pad >= kernel_width)
+  {
+    WORD32 idx_out_width_over_x_r_pad = (x_padding + input_width + x_stride - 1)/x_stride;
+    out_width_over_x_r_pad = out_width - idx_out_width_over_x_r_pad;
+    conv_x_pad_bias(idx_out_width_over_x_r_pad, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out);
+  }
+
+  /* When kernel convolves over input region */
+  p_out += out_width_over_x_pad * out_width_offset;
+  // Initialize circular buffer
+  // Determine y-bottom padding
+  WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
+  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+  // Rows of one group sub-image in the circular buffer
+  WORD32 group_rows_size = (y_padding + input_height + y_b_pad) * kernel_width * group_channels_pad * input_bytewidth;
+
+  conv2d_grouped_init_cir_buf(input_channels, groups, group_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, 0);
+
+  // Index to padded input width
+  WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+  idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
+
+  // Process Loop to compute one output plane [out_height x out_channels] per iteration
+  for(j=0;j<out_width-out_width_over_x_pad-out_width_over_x_r_pad;j++)
+  {
+    // Add x_stride x (input_height x input_channels) new planes to circular buffer
+    conv2d_grouped_update_cir_buf(input_channels, groups, group_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, 0);
+
+    // Update index to input width padded
+    idx_beg_inp_width_pad += x_stride;
+
+    FLOAT32 *p_mat = (FLOAT32 *)p_state->cir_buf.p_curr;
+    for(g=0;g<groups;g++)
+    {
+      WORD32 oc = g * group_out_channels;
+
+      // Convolution of group g using matXvec with matrix as circular buffer
+      xa_nn_matXvec_f32_circ
+        (&p_out[oc * out_channels_offset] /* output */
+         ,p_mat /* matrix: rows x cols */
+         ,(FLOAT32 *)&p_kernel[oc * group_kernel_size] /* vec: cols */
+         ,(FLOAT32 *)&p_bias[oc] /* bias */
+         ,out_height /* rows */
+         ,group_kernel_size /* cols */
+         ,group_channels_pad * kernel_width * y_stride/* row_offset */
+         ,group_out_channels /* vec_count */
+         ,group_kernel_size /* vec_offset */
+         ,out_channels_offset /* out_col_offset */
+         ,out_height_offset /* out_row_offset */
+        );
+
+      // Move to the sub-image of the next group
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat, group_rows_size);
+    }
+
+    p_out += out_width_offset;
+  }
+
+  return 0;
+}
+#endif /* #if !HAVE_VFPU */
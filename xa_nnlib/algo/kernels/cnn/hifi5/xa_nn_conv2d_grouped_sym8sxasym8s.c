@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_conv2d_std_state.h"
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Output columns whose receptive field lies in x-padding only: output is just
+ * the requantized bias of every output channel */
+static VOID conv_x_pad_bias(
+    WORD32 out_width_beg,
+    WORD32 out_width_end,
+    WORD32 out_height,
+    WORD32 out_channels,
+    WORD32 out_channels_offset,
+    WORD32 out_width_offset,
+    WORD32 out_height_offset,
+    const WORD32* __restrict__ p_bias,
+    WORD8 *p_out,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias)
+{
+  WORD32 i,j,k;
+  WORD32 left_shift, right_shift;
+
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+
+  for(i = 0; i < out_height; i++)
+  {
+    for(j = out_width_beg; j < out_width_end; j++)
+    {
+      for(k = 0; k < out_channels; k++)
+      {
+        left_shift  = p_out_shift[k] < 0 ? 0 : p_out_shift[k];
+        right_shift = p_out_shift[k] > 0 ? 0 : -p_out_shift[k];
+        ae_int32x2 acc = AE_MOVDA32(p_bias[k]);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc, p_out_multiplier[k], left_shift, right_shift);
+        acc = AE_ADD32S(acc, AE_MOVDA32(out_zero_bias));
+        AE_MINMAX32(acc, min_int8, max_int8);
+        p_out[i * out_height_offset + j * out_width_offset + k * out_channels_offset] = (UWORD8)AE_MOVAD32_L(acc);
+      }
+    }
+  }
+}
+
+/* Grouped convolution: input channel g * (input_channels / groups) + c feeds
+ * output channels [g * (out_channels / groups), (g + 1) * (out_channels / groups)).
+ * Kernel layout is [out_channels][kernel_height][kernel_width][input_channels / groups].
+ * One circular buffer holding the sub-images of all groups (see
+ * xa_nn_conv2d_grouped_circ_buf.c) is updated once per output column, the
+ * matXvec kernel is then called once per group on its part of the buffer,
+ * kernel, bias, quantization parameters and output. */
+WORD32 xa_nn_conv2d_grouped_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+   /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((groups <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_channels % groups) != 0 || (out_channels % groups) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  WORD32 j, g;
+  WORD32 input_bytewidth = 1;
+  VOID *pp_inp = (VOID *)p_inp;
+  WORD32 group_channels = input_channels / groups;
+  WORD32 group_out_channels = out_channels / groups;
+  WORD32 group_kernel_size = group_channels * kernel_width * kernel_height;
+
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
+  xa_nn_conv2d_grouped_init_state((void*)p_state,(void*)p_kernel,input_height,input_channels,groups,kernel_height,kernel_width,y_stride,y_padding,out_height,-4);
+
+  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
+  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+  WORD32 x_padding_var = x_padding;
+
+  /* When kernel convolves over x-left pad region only */
+  WORD32 out_width_over_x_pad = 0;
+  if(x_padding_var >= kernel_width)
+  {
+    out_width_over_x_pad = (x_padding - kernel_width)/x_stride + 1;
+    out_width_over_x_pad = out_width_over_x_pad > out_width ? out_width : out_width_over_x_pad;
+    conv_x_pad_bias(0, out_width_over_x_pad, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
+    x_padding_var -= out_width_over_x_pad * x_stride;
+  }
+
+  /* When kernel convolves over x-right pad region only */
+  WORD32 out_width_over_x_r_pad = 0;
+  // Determine x-right padding
+  WORD32 x_r_pad = kernel_width + (out_width - 1) * x_stride - (x_padding + input_width);
+  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
+  if(x_r_pad >= kernel_width)
+  {
+    WORD32 idx_out_width_over_x_r_pad = (x_padding + input_width + x_stride - 1)/x_stride;
+    out_width_over_x_r_pad = out_width - idx_out_width_over_x_r_pad;
+    conv_x_pad_bias(idx_out_width_over_x_r_pad, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
+  }
+
+  /* When kernel convolves over input region */
+  p_out += out_width_over_x_pad * out_width_offset;
+  // Initialize circular buffer
+  // Determine y-bottom padding
+  WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
+  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+  // Rows of one group sub-image in the circular buffer
+  WORD32 group_rows_size = (y_padding + input_height + y_b_pad) * kernel_width * group_channels;
+
+  conv2d_grouped_init_cir_buf(input_channels, groups, group_channels, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, -input_zero_bias);
+
+  // Index to padded input width
+  WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+  idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
+
+  // Process Loop to compute one output plane [out_height x out_channels] per iteration
+  for(j=0;j<out_width-out_width_over_x_pad-out_width_over_x_r_pad;j++)
+  {
+    // Add x_stride x (input_height x input_channels) new planes to circular buffer
+    conv2d_grouped_update_cir_buf(input_channels, groups, group_channels, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
+
+    // Update index to input width padded
+    idx_beg_inp_width_pad += x_stride;
+
+    WORD8 *p_mat = (WORD8 *)p_state->cir_buf.p_curr;
+    for(g=0;g<groups;g++)
+    {
+      WORD32 oc = g * group_out_channels;
+
+      // Convolution of group g using matXvec with matrix as circular buffer
+      xa_nn_matXvec_sym8sxasym8s_asym8s_circ
+        (&p_out[oc * out_channels_offset] /* output */
+         ,p_mat /* matrix: rows x cols */
+         ,&p_kernel[oc * group_kernel_size] /* vec: cols */
+         ,&p_bias[oc] /* bias */
+         ,out_height /* rows */
+         ,group_kernel_size /* cols */
+         ,group_channels * kernel_width * y_stride/* row_offset */
+         ,group_out_channels /* vec_count */
+         ,group_kernel_size /* vec_stride */
+         ,out_channels_offset /* out_col_offset */
+         ,out_height_offset /* out_row_offset */
+         ,input_zero_bias
+         ,&p_out_multiplier[oc]
+         ,&p_out_shift[oc]
+         ,out_zero_bias
+        );
+
+      // Move to the sub-image of the next group
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat, group_rows_size);
+    }
+
+    p_out += out_width_offset;
+  }
+
+  return 0;
+}
@@ -186,3 +186,168 @@ WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
   }
   return ret;
 }
+
+/* Pointwise convolution followed by the residual add of
+ * xa_nn_elm_add_asym8sxasym8s_asym8s, with the convolution output as the
+ * first input. The add is done in the requantization epilogue so the
+ * convolution output is never written to memory. With p_residual NULL this
+ * is xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s. */
+WORD32 xa_nn_conv2d_pointwise_per_chan_residual_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format,
+    const WORD8* __restrict__ p_residual,
+    WORD32  sum_zero_bias,
+    WORD32  sum_left_shift,
+    WORD32  sum_multiplier,
+    WORD32  sum_activation_min,
+    WORD32  sum_activation_max,
+    WORD32  out_inp_zero_bias,
+    WORD32  out_inp_left_shift,
+    WORD32  out_inp_multiplier,
+    WORD32  res_zero_bias,
+    WORD32  res_left_shift,
+    WORD32  res_multiplier,
+    WORD32  left_shift)
+{
+  if(p_residual == NULL)
+  {
+    return xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+        p_out,
+        p_kernel,
+        p_inp,
+        p_bias,
+        input_height,
+        input_width,
+        input_channels,
+        out_channels,
+        input_zero_bias,
+        p_out_multiplier,
+        p_out_shift,
+        out_zero_bias,
+        out_data_format);
+  }
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  /* Fused residual add is supported for NHWC output only */
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+
+  return xa_nn_matmul_per_chan_residual_sym8sxasym8s_asym8s(
+      p_out,
+      p_kernel,
+      p_inp,
+      p_bias,
+      out_channels,
+      input_channels,
+      input_channels,
+      input_height * input_width,
+      input_channels,
+      out_channels,
+      input_zero_bias,
+      p_out_multiplier,
+      p_out_shift,
+      out_zero_bias,
+      p_residual,
+      sum_zero_bias,
+      sum_left_shift,
+      sum_multiplier,
+      sum_activation_min,
+      sum_activation_max,
+      out_inp_zero_bias,
+      out_inp_left_shift,
+      out_inp_multiplier,
+      res_zero_bias,
+      res_left_shift,
+      res_multiplier,
+      left_shift);
+}
+
+WORD32 xa_nn_conv2d_pointwise_per_chan_sym4sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, 8, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias > 127 || out_zero_bias < -128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  int out_plane_size = input_height*input_width;
+  int out_offset, out_stride;
+
+  /* Kernel is packed with xa_nn_matXvec_sym4s_pack_sym8s, one row per output channel */
+  if(out_data_format == 0)
+  {
+    out_offset = out_channels;
+    out_stride = 1;
+  }
+  else
+  {
+    out_offset = 1;
+    out_stride = out_plane_size;
+  }
+
+  return xa_nn_matmul_per_chan_sym4sxasym8s_asym8s(p_out,
+                                                   p_kernel,
+                                                   p_inp,
+                                                   p_bias,
+                                                   out_channels,
+                                                   input_channels,
+                                                   out_plane_size,
+                                                   input_channels,
+                                                   out_offset,
+                                                   out_stride,
+                                                   input_zero_bias,
+                                                   p_out_multiplier,
+                                                   p_out_shift,
+                                                   out_zero_bias);
+}
@@ -68,6 +68,11 @@ WORD32 xa_nn_conv2d_std_getsize(
       input_size = sizeof(WORD32);
       align_size = ALIGNMENT>>2;
       break;
+    case -2:
+      /* Half precision kernel, 32-bit float input */
+      input_size = sizeof(FLOAT32);
+      align_size = ALIGNMENT>>2;
+      break;
     case -3:
       input_size = sizeof(UWORD8);
       align_size = ALIGNMENT>>1;
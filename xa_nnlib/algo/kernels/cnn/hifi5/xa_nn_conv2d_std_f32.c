@@ -24,6 +24,7 @@
 #include "common_fpu.h"
 #include "xa_nnlib_kernels_api.h"
 #include "xa_nn_conv2d_std_state.h"
+#include "xa_nnlib_common_macros_hifi5.h"
 #include "xa_nnlib_err_chk.h"
 
 #if !HAVE_VFPU
@@ -110,10 +111,14 @@ static WORD32 conv_x_right_pad(
   return out_width_over_x_r_pad;
 }
 
-WORD32 xa_nn_conv2d_std_f32(
+/* Convolution over 32-bit float input, the kernel is either 32-bit float or
+ * half precision (kernel_f16 != 0), in which case its values are widened as
+ * they are loaded by the circular-buffer matXvec. */
+static WORD32 conv2d_std_f32_core(
     FLOAT32* __restrict__ p_out,
     const FLOAT32* __restrict__ p_inp,
-    const FLOAT32* __restrict__ p_kernel,
+    const VOID* __restrict__ p_kernel,
+    WORD32 kernel_f16,
     const FLOAT32* __restrict__ p_bias,
     WORD32 input_height,
     WORD32 input_width,
@@ -130,30 +135,6 @@ WORD32 xa_nn_conv2d_std_f32(
     WORD32 out_data_format,
     VOID *p_scratch)
 {
-  /* NULL pointer checks */
-  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
-  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-  /* Pointer alignment checks */
-  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
-  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
-  /* Basic Parameter checks */
-  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
-  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
-  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
-
   WORD32 j;
   WORD32 input_bytewidth = sizeof(*p_inp);
   VOID *pp_inp = (VOID *)p_inp;
@@ -209,24 +190,168 @@ WORD32 xa_nn_conv2d_std_f32(
     idx_beg_inp_width_pad += x_stride;
 
     // Convolution using matXvec with matrix as circular buffer
-    xa_nn_matXvec_f32_circ
-      (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
-       ,(FLOAT32 *)p_kernel /* vec: cols */
-       ,(FLOAT32 *)p_bias /* bias */
-       ,out_height /* rows */
-       ,input_channels_pad * kernel_width * kernel_height /* cols */
-       ,input_channels_pad * kernel_width * y_stride/* row_offset */
-       ,out_channels /* vec_count */
-       ,input_channels_pad * kernel_width * kernel_height /* vec_offset */
-       ,out_channels_offset /* out_col_offset */
-       ,out_height_offset /* out_row_offset */
-      );
+    if(kernel_f16)
+    {
+      xa_nn_matXvec_f16xf32_circ
+        (p_out /* output */
+         ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+         ,(const WORD16 *)p_kernel /* vec: cols */
+         ,p_bias /* bias */
+         ,out_height /* rows */
+         ,input_channels_pad * kernel_width * kernel_height /* cols */
+         ,input_channels_pad * kernel_width * y_stride/* row_offset */
+         ,out_channels /* vec_count */
+         ,input_channels_pad * kernel_width * kernel_height /* vec_offset */
+         ,out_channels_offset /* out_col_offset */
+         ,out_height_offset /* out_row_offset */
+        );
+    }
+    else
+    {
+      xa_nn_matXvec_f32_circ
+        (p_out /* output */
+         ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+         ,(FLOAT32 *)p_kernel /* vec: cols */
+         ,(FLOAT32 *)p_bias /* bias */
+         ,out_height /* rows */
+         ,input_channels_pad * kernel_width * kernel_height /* cols */
+         ,input_channels_pad * kernel_width * y_stride/* row_offset */
+         ,out_channels /* vec_count */
+         ,input_channels_pad * kernel_width * kernel_height /* vec_offset */
+         ,out_channels_offset /* out_col_offset */
+         ,out_height_offset /* out_row_offset */
+        );
+    }
 
     p_out += out_width_offset;
   }
 
   return 0;
 }
+
+WORD32 xa_nn_conv2d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  return conv2d_std_f32_core(p_out, p_inp, (const VOID *)p_kernel, 0, p_bias,
+      input_height, input_width, input_channels, kernel_height, kernel_width,
+      out_channels, x_stride, y_stride, x_padding, y_padding,
+      out_height, out_width, out_data_format, p_scratch);
+}
 #endif /* #if !HAVE_VFPU */
 
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_f16xf32,(
+    FLOAT32 *p_out,
+    const FLOAT32 *p_inp,
+    const WORD16 *p_kernel,
+    const FLOAT32 *p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_handle))
+#else /* #if !HAVE_VFPU */
+/* Half precision kernel variant: the kernel has the same padded layout as
+ * for xa_nn_conv2d_std_f32 and holds 16-bit patterns, its values are
+ * converted to 32-bit float as they are loaded. Scratch size is given by
+ * xa_nn_conv2d_std_getsize with PREC_F16 input precision. */
+WORD32 xa_nn_conv2d_std_f16xf32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  return conv2d_std_f32_core(p_out, p_inp, (const VOID *)p_kernel, 1, p_bias,
+      input_height, input_width, input_channels, kernel_height, kernel_width,
+      out_channels, x_stride, y_stride, x_padding, y_padding,
+      out_height, out_width, out_data_format, p_scratch);
+}
+#endif /* #if !HAVE_VFPU */
@@ -153,6 +153,19 @@ WORD32 xa_nn_matXvec_f32_circ(
     WORD32 out_col_offset,
     WORD32 out_row_offset);
 
+WORD32 xa_nn_matXvec_f16xf32_circ(
+    FLOAT32 * __restrict__ p_out,
+    FLOAT32 * __restrict__ p_mat,
+    const WORD16 * __restrict__ p_vec,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_offset,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_col_offset,
+    WORD32 out_row_offset);
+
 WORD32 xa_nn_matXvec_asym8xasym8_asym8_circ(
     UWORD8 * __restrict__ p_out,
     UWORD8 * __restrict__ p_mat1,
@@ -188,6 +201,50 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
     WORD32 * p_out_shift,
     WORD32 out_offset);
 
+VOID conv2d_std_per_chan_sym8sxasym8s_exec(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    WORD32 direct_min_seg_cols,
+    VOID *p_scratch);
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_direct(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 seg_cols,
+    WORD32 seg_count,
+    WORD32 seg_stride,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_stride,
+    WORD32 out_col_offset,
+    WORD32 out_row_offset,
+    WORD32 mat1_offset,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias);
+
 VOID conv2d_std_init_cir_buf(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -273,5 +330,51 @@ VOID conv2d_std_update_cir_buf_asym8(
     xa_nn_conv_state_t *p_state,
     WORD32 pad_val);
 
+VOID xa_nn_conv2d_grouped_init_state(
+    VOID *p_scratch,
+    VOID *p_kernel,
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 groups,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_precision);
+
+VOID conv2d_grouped_init_cir_buf(
+    WORD32 input_channels,
+    WORD32 groups,
+    WORD32 group_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val);
+
+VOID conv2d_grouped_update_cir_buf(
+    WORD32 input_channels,
+    WORD32 groups,
+    WORD32 group_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val);
+
 #endif /* __XA_NN_CONV2D_STD_STATE_H__ */
 
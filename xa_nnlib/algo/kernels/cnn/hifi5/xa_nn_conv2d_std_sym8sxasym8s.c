@@ -378,6 +378,301 @@ WORD32 xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s(
 }
 
 
+/* Minimum kernel_width * input_channels (contiguous bytes per kernel row) for
+ * which output columns away from x-padding are computed in place from the
+ * input instead of through the circular buffer */
+#define CONV2D_STD_DIRECT_MIN_SEG_COLS 16
+
+/* Validated arguments and precomputed geometry of one per-channel conv2d_std
+ * layer, filled once by plan_create and reused by every plan_execute. */
+typedef struct _xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t
+{
+  const WORD8 *p_kernel;
+  const WORD32 *p_bias;
+  WORD32 *p_out_multiplier;
+  WORD32 *p_out_shift;
+  WORD32 input_height;
+  WORD32 input_width;
+  WORD32 input_channels;
+  WORD32 kernel_height;
+  WORD32 kernel_width;
+  WORD32 out_channels;
+  WORD32 x_stride;
+  WORD32 y_stride;
+  WORD32 x_padding;
+  WORD32 y_padding;
+  WORD32 out_height;
+  WORD32 out_width;
+  WORD32 input_zero_bias;
+  WORD32 out_zero_bias;
+  WORD32 out_channels_offset;
+  WORD32 out_height_offset;
+  WORD32 out_width_offset;
+  WORD32 y_b_pad;
+  WORD32 out_width_direct_beg;
+  WORD32 out_width_direct_end;
+} xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t;
+
+static void conv2d_std_per_chan_sym8sxasym8s_plan_init(
+    xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t *p_plan,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    WORD32 direct_min_seg_cols)
+{
+  p_plan->p_kernel = p_kernel;
+  p_plan->p_bias = p_bias;
+  p_plan->p_out_multiplier = p_out_multiplier;
+  p_plan->p_out_shift = p_out_shift;
+  p_plan->input_height = input_height;
+  p_plan->input_width = input_width;
+  p_plan->input_channels = input_channels;
+  p_plan->kernel_height = kernel_height;
+  p_plan->kernel_width = kernel_width;
+  p_plan->out_channels = out_channels;
+  p_plan->x_stride = x_stride;
+  p_plan->y_stride = y_stride;
+  p_plan->x_padding = x_padding;
+  p_plan->y_padding = y_padding;
+  p_plan->out_height = out_height;
+  p_plan->out_width = out_width;
+  p_plan->input_zero_bias = input_zero_bias;
+  p_plan->out_zero_bias = out_zero_bias;
+
+  p_plan->out_channels_offset = out_data_format ? out_height * out_width : 1;
+  p_plan->out_height_offset = out_data_format ? out_width : out_width * out_channels;
+  p_plan->out_width_offset = out_data_format ? 1 : out_channels;
+
+  WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
+  p_plan->y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+  /* Output columns whose kernel window lies inside the input width are read
+   * directly from the input, the others go through the circular buffer */
+  WORD32 out_width_direct_beg = (x_padding + x_stride - 1) / x_stride;
+  WORD32 out_width_direct_end = 0;
+  if(input_width + x_padding >= kernel_width)
+  {
+    out_width_direct_end = (input_width + x_padding - kernel_width) / x_stride + 1;
+    out_width_direct_end = out_width_direct_end > out_width ? out_width : out_width_direct_end;
+  }
+  if(direct_min_seg_cols < 0 || kernel_width * input_channels < direct_min_seg_cols || out_width_direct_end <= out_width_direct_beg)
+  {
+    out_width_direct_beg = out_width_direct_end = 0;
+  }
+  p_plan->out_width_direct_beg = out_width_direct_beg;
+  p_plan->out_width_direct_end = out_width_direct_end;
+}
+
+/* Circular buffer convolution of out_width output columns, the first of
+ * them having its window start at input column inp_col_beg (with x_padding
+ * columns of left padding when inp_col_beg is 0) */
+static void conv2d_std_per_chan_sym8sxasym8s_buffered(
+    const xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t *p_plan,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    WORD32 inp_col_beg,
+    WORD32 x_padding,
+    WORD32 out_width,
+    VOID *p_scratch)
+{
+  WORD32 j;
+  WORD32 input_bytewidth = 1;
+  VOID *pp_inp = (VOID *)&p_inp[inp_col_beg * p_plan->input_channels];
+  /* Input columns right of the window start, the row pitch stays input_width */
+  WORD32 input_width = p_plan->input_width - inp_col_beg;
+  WORD32 input_channels_pad = p_plan->input_channels;
+  WORD32 x_padding_var = x_padding;
+
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
+  xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_plan->p_kernel,p_plan->input_height,p_plan->input_channels,p_plan->kernel_height,p_plan->kernel_width,p_plan->x_stride,p_plan->y_stride,p_plan->y_padding,p_plan->out_height,-4);
+
+  /* When kernel convolves over x-left pad region only */
+  WORD32 out_width_over_x_pad = 0;
+  if(x_padding_var >= p_plan->kernel_width)
+  {
+    out_width_over_x_pad = conv_x_left_pad(x_padding, p_plan->kernel_width, p_plan->x_stride, out_width, p_plan->out_height, p_plan->out_channels, p_plan->out_channels_offset, p_plan->out_width_offset, p_plan->out_height_offset, p_plan->p_bias, p_out, p_plan->p_out_multiplier, p_plan->p_out_shift, p_plan->out_zero_bias);
+    x_padding_var -= out_width_over_x_pad * p_plan->x_stride;
+  }
+
+  /* When kernel convolves over x-right pad region only */
+  WORD32 out_width_over_x_r_pad = 0;
+  // Determine x-right padding
+  WORD32 x_r_pad = p_plan->kernel_width + (out_width - 1) * p_plan->x_stride - (x_padding + input_width);
+  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
+  if(x_r_pad >= p_plan->kernel_width)
+  {
+    out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, p_plan->x_stride, out_width, p_plan->out_height, p_plan->out_channels, p_plan->out_channels_offset, p_plan->out_width_offset, p_plan->out_height_offset, p_plan->p_bias, p_out, p_plan->p_out_multiplier, p_plan->p_out_shift, p_plan->out_zero_bias);
+  }
+
+  // Index to padded input width
+  WORD32 idx_beg_inp_width_pad = p_plan->kernel_width - p_plan->x_stride;
+  idx_beg_inp_width_pad = (idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad) + inp_col_beg;
+
+  /* When kernel convolves over input region */
+  p_out += out_width_over_x_pad * p_plan->out_width_offset;
+  // Initialize circular buffer
+  conv2d_std_init_cir_buf_asym8(p_plan->input_channels, input_channels_pad, input_bytewidth, p_plan->input_width, p_plan->input_height, p_plan->y_padding, p_plan->y_b_pad, x_padding_var, p_plan->kernel_width, p_plan->x_stride, (VOID**)&pp_inp, p_state, -p_plan->input_zero_bias);
+
+  // Process Loop to compute one output plane [out_height x out_channels] per iteration
+  for(j=0;j<out_width-out_width_over_x_pad-out_width_over_x_r_pad;j++)
+  {
+    // Add x_stride x (input_height x input_channels) new planes to circular buffer
+    conv2d_std_update_cir_buf_asym8(p_plan->input_channels, input_channels_pad, input_bytewidth, p_plan->input_width, p_plan->input_height, p_plan->y_padding, p_plan->y_b_pad, x_padding_var, p_plan->kernel_width, p_plan->x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -p_plan->input_zero_bias);
+
+    // Update index to input width padded
+    idx_beg_inp_width_pad += p_plan->x_stride;
+
+    // Convolution using matXvec with matrix as circular buffer
+    xa_nn_matXvec_sym8sxasym8s_asym8s_circ
+      (p_out /* output */
+       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+       ,p_plan->p_kernel /* vec: cols */
+       ,p_plan->p_bias /* bias */
+       ,p_plan->out_height /* rows */
+       ,input_channels_pad * p_plan->kernel_width * p_plan->kernel_height /* cols */
+       ,input_channels_pad * p_plan->kernel_width * p_plan->y_stride/* row_offset */
+       ,p_plan->out_channels /* vec_count */
+       ,input_channels_pad * p_plan->kernel_width * p_plan->kernel_height /* vec_stride */
+       ,p_plan->out_channels_offset /* out_col_offset */
+       ,p_plan->out_height_offset /* out_row_offset */
+       ,p_plan->input_zero_bias
+       ,p_plan->p_out_multiplier
+       ,p_plan->p_out_shift
+       ,p_plan->out_zero_bias
+      );
+
+    p_out += p_plan->out_width_offset;
+  }
+}
+
+/* Direct convolution of output columns [out_width_direct_beg,
+ * out_width_direct_end): for every output row the matXvec reads the kernel
+ * window rows in place from the NHWC input, rows of the window falling in
+ * y-padding are skipped (they contribute zero). */
+static void conv2d_std_per_chan_sym8sxasym8s_direct(
+    const xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t *p_plan,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp)
+{
+  WORD32 i;
+  WORD32 input_channels = p_plan->input_channels;
+  WORD32 kernel_row_size = p_plan->kernel_width * input_channels;
+  WORD32 inp_col_beg = p_plan->out_width_direct_beg * p_plan->x_stride - p_plan->x_padding;
+
+  for(i = 0; i < p_plan->out_height; i++)
+  {
+    WORD32 inp_row_beg = i * p_plan->y_stride - p_plan->y_padding;
+    WORD32 ker_row_beg = inp_row_beg < 0 ? -inp_row_beg : 0;
+    WORD32 ker_row_end = p_plan->input_height - inp_row_beg;
+    ker_row_end = ker_row_end > p_plan->kernel_height ? p_plan->kernel_height : ker_row_end;
+    ker_row_end = ker_row_end < ker_row_beg ? ker_row_beg : ker_row_end;
+
+    xa_nn_matXvec_sym8sxasym8s_asym8s_direct
+      (&p_out[i * p_plan->out_height_offset + p_plan->out_width_direct_beg * p_plan->out_width_offset] /* output */
+       ,&p_inp[((inp_row_beg + ker_row_beg) * p_plan->input_width + inp_col_beg) * input_channels] /* matrix: rows x cols */
+       ,&p_plan->p_kernel[ker_row_beg * kernel_row_size] /* vec: cols */
+       ,p_plan->p_bias /* bias */
+       ,p_plan->out_width_direct_end - p_plan->out_width_direct_beg /* rows */
+       ,kernel_row_size /* seg_cols */
+       ,ker_row_end - ker_row_beg /* seg_count */
+       ,p_plan->input_width * input_channels /* seg_stride */
+       ,p_plan->x_stride * input_channels /* row_stride */
+       ,p_plan->out_channels /* vec_count */
+       ,kernel_row_size * p_plan->kernel_height /* vec_stride */
+       ,p_plan->out_channels_offset /* out_col_offset */
+       ,p_plan->out_width_offset /* out_row_offset */
+       ,p_plan->input_zero_bias
+       ,p_plan->p_out_multiplier
+       ,p_plan->p_out_shift
+       ,p_plan->out_zero_bias
+      );
+  }
+}
+
+static void conv2d_std_per_chan_sym8sxasym8s_plan_run(
+    const xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t *p_plan,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    VOID *p_scratch)
+{
+  WORD32 out_width_direct_beg = p_plan->out_width_direct_beg;
+  WORD32 out_width_direct_end = p_plan->out_width_direct_end;
+
+  if(out_width_direct_end == 0)
+  {
+    conv2d_std_per_chan_sym8sxasym8s_buffered(p_plan, p_out, p_inp, 0, p_plan->x_padding, p_plan->out_width, p_scratch);
+    return;
+  }
+
+  /* Left border columns */
+  if(out_width_direct_beg > 0)
+  {
+    conv2d_std_per_chan_sym8sxasym8s_buffered(p_plan, p_out, p_inp, 0, p_plan->x_padding, out_width_direct_beg, p_scratch);
+  }
+
+  conv2d_std_per_chan_sym8sxasym8s_direct(p_plan, p_out, p_inp);
+
+  /* Right border columns */
+  if(out_width_direct_end < p_plan->out_width)
+  {
+    conv2d_std_per_chan_sym8sxasym8s_buffered(p_plan
+        ,&p_out[out_width_direct_end * p_plan->out_width_offset]
+        ,p_inp
+        ,out_width_direct_end * p_plan->x_stride - p_plan->x_padding
+        ,0
+        ,p_plan->out_width - out_width_direct_end
+        ,p_scratch);
+  }
+}
+
+/* Unchecked conv2d_std with the direct path taken for kernel rows of at least
+ * direct_min_seg_cols bytes, never when direct_min_seg_cols is negative */
+VOID conv2d_std_per_chan_sym8sxasym8s_exec(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    WORD32 direct_min_seg_cols,
+    VOID *p_scratch)
+{
+  xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t plan;
+  conv2d_std_per_chan_sym8sxasym8s_plan_init(&plan, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, direct_min_seg_cols);
+  conv2d_std_per_chan_sym8sxasym8s_plan_run(&plan, p_out, p_inp, p_scratch);
+}
+
 WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
@@ -433,84 +728,80 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
   }
 
+  conv2d_std_per_chan_sym8sxasym8s_exec(p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, CONV2D_STD_DIRECT_MIN_SEG_COLS, p_scratch);
 
-  WORD32 j;
-  WORD32 input_bytewidth = 1;
-  VOID *pp_inp = (VOID *)p_inp;
-
-  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
-  xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding,out_height,-4);
-
-  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
-  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
-  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+  return 0;
+}
 
-  WORD32 x_padding_var = x_padding;
-  WORD32 input_channels_pad = input_channels;
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_getsize(VOID)
+{
+  return (WORD32)ALIGNED_SIZE(sizeof(xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t), ALIGNMENT);
+}
 
-  /* When kernel convolves over x-left pad region only */
-  WORD32 out_width_over_x_pad = 0;
-  if(x_padding_var >= kernel_width)
-  {
-    out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
-    x_padding_var -= out_width_over_x_pad * x_stride;
-  }
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_create(
+    VOID *p_plan,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format)
+{
+  /* Checks are done once here regardless of DISABLE_ARG_CHK */
+  /* NULL pointer checks */
+  XA_NNLIB_CHK_PTR(p_plan, -1);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_CHK_PTR(p_bias, -1);
+  XA_NNLIB_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_CHK_ALIGN(p_plan, ALIGNMENT, -1);
+  XA_NNLIB_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
 
-  /* When kernel convolves over x-right pad region only */
-  WORD32 out_width_over_x_r_pad = 0;
-  // Determine x-right padding
-  WORD32 x_r_pad = kernel_width + (out_width - 1) * x_stride - (x_padding + input_width);
-  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
-  if(x_r_pad >= kernel_width)
-  {
-    out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
   }
 
-  /* When kernel convolves over input region */
-  p_out += out_width_over_x_pad * out_width_offset;
-  // Initialize circular buffer
-  // Determine y-bottom padding
-  WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
-  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
-
-  conv2d_std_init_cir_buf_asym8(input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, -input_zero_bias);
-
-  // Index to padded input width
-  WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
-  idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
-
-
-  // Process Loop to compute one output plane [out_height x out_channels] per iteration
-  for(j=0;j<out_width-out_width_over_x_pad-out_width_over_x_r_pad;j++)
-  {
-    // Add x_stride x (input_height x input_channels) new planes to circular buffer
-    conv2d_std_update_cir_buf_asym8(input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
-
-    // Update index to input width padded
-    idx_beg_inp_width_pad += x_stride;
+  conv2d_std_per_chan_sym8sxasym8s_plan_init((xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t *)p_plan, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, CONV2D_STD_DIRECT_MIN_SEG_COLS);
 
-    // Convolution using matXvec with matrix as circular buffer
-    xa_nn_matXvec_sym8sxasym8s_asym8s_circ
-      (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
-       ,p_kernel /* vec: cols */
-       ,p_bias /* bias */
-       ,out_height /* rows */
-       ,input_channels_pad * kernel_width * kernel_height /* cols */
-       ,input_channels_pad * kernel_width * y_stride/* row_offset */
-       ,out_channels /* vec_count */
-       ,input_channels_pad * kernel_width * kernel_height /* vec_stride */
-       ,out_channels_offset /* out_col_offset */
-       ,out_height_offset /* out_row_offset */
-       ,input_zero_bias
-       ,p_out_multiplier
-       ,p_out_shift
-       ,out_zero_bias
-      );
+  /* Scratch size needed by plan_execute */
+  return xa_nn_conv2d_std_getsize(input_height, input_channels, kernel_height, kernel_width, y_stride, y_padding, out_height, out_channels, PREC_ASYM8S);
+}
 
-    p_out += out_width_offset;
-  }
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_execute(
+    const VOID *p_plan,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    VOID *p_scratch)
+{
+  conv2d_std_per_chan_sym8sxasym8s_plan_run((const xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_t *)p_plan, p_out, p_inp, p_scratch);
 
   return 0;
 }
-
@@ -0,0 +1,443 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nn_conv2d_std_state.h"
+
+/* Decision table thresholds, can be overridden at build time */
+#ifndef CONV2D_DIRECT_MIN_SEG_COLS
+/* Minimum kernel_width * input_channels for reading windows in place */
+#define CONV2D_DIRECT_MIN_SEG_COLS 16
+#endif
+#ifndef CONV2D_DIRECT_1XN_MIN_SEG_COLS
+/* Same for kernel_height == 1, windows are then contiguous */
+#define CONV2D_DIRECT_1XN_MIN_SEG_COLS 8
+#endif
+#ifndef CONV2D_PATCHIFY_MIN_COLS
+/* Minimum kernel_height * kernel_width * input_channels for running a
+ * stride == kernel convolution as a matmul over the patches */
+#define CONV2D_PATCHIFY_MIN_COLS 8
+#endif
+
+typedef struct _conv2d_shape_t
+{
+  WORD32 input_height;
+  WORD32 input_width;
+  WORD32 input_channels;
+  WORD32 kernel_height;
+  WORD32 kernel_width;
+  WORD32 out_channels;
+  WORD32 groups;
+  WORD32 x_stride;
+  WORD32 y_stride;
+  WORD32 x_padding;
+  WORD32 y_padding;
+  WORD32 out_height;
+  WORD32 out_width;
+  WORD32 out_data_format;
+} conv2d_shape_t;
+
+static WORD32 conv2d_shape_init(
+    conv2d_shape_t *p_shape,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format)
+{
+  XA_NNLIB_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((groups <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels % groups != 0 || out_channels % groups != 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  p_shape->input_height = input_height;
+  p_shape->input_width = input_width;
+  p_shape->input_channels = input_channels;
+  p_shape->kernel_height = kernel_height;
+  p_shape->kernel_width = kernel_width;
+  p_shape->out_channels = out_channels;
+  p_shape->groups = groups;
+  p_shape->x_stride = x_stride;
+  p_shape->y_stride = y_stride;
+  p_shape->x_padding = x_padding;
+  p_shape->y_padding = y_padding;
+  p_shape->out_height = out_height;
+  p_shape->out_width = out_width;
+  p_shape->out_data_format = out_data_format;
+
+  return 0;
+}
+
+static WORD32 conv2d_algo_is_supported(WORD32 algo, const conv2d_shape_t *p_shape)
+{
+  switch(algo)
+  {
+    case XA_NN_CONV2D_ALGO_STD:
+    case XA_NN_CONV2D_ALGO_DIRECT:
+      return (p_shape->groups == 1);
+    case XA_NN_CONV2D_ALGO_POINTWISE:
+      return (p_shape->groups == 1) &&
+             (p_shape->kernel_height == 1) && (p_shape->kernel_width == 1) &&
+             (p_shape->y_stride == 1) && (p_shape->x_stride == 1) &&
+             (p_shape->y_padding == 0) && (p_shape->x_padding == 0) &&
+             (p_shape->out_height == p_shape->input_height) &&
+             (p_shape->out_width == p_shape->input_width);
+    case XA_NN_CONV2D_ALGO_PATCHIFY:
+      return (p_shape->groups == 1) &&
+             (p_shape->y_stride == p_shape->kernel_height) &&
+             (p_shape->x_stride == p_shape->kernel_width) &&
+             (p_shape->y_padding == 0) && (p_shape->x_padding == 0) &&
+             (p_shape->out_height * p_shape->kernel_height <= p_shape->input_height) &&
+             (p_shape->out_width * p_shape->kernel_width <= p_shape->input_width);
+    case XA_NN_CONV2D_ALGO_DEPTHWISE:
+      return (p_shape->groups > 1) &&
+             (p_shape->groups == p_shape->input_channels) &&
+             (p_shape->y_stride <= p_shape->kernel_height) &&
+             (p_shape->x_stride <= p_shape->kernel_width) &&
+             (p_shape->out_data_format == 0);
+    case XA_NN_CONV2D_ALGO_GROUPED:
+      return (p_shape->groups > 1);
+    default:
+      return 0;
+  }
+}
+
+static WORD32 conv2d_prefer_always(const conv2d_shape_t *p_shape)
+{
+  (VOID)p_shape;
+  return 1;
+}
+
+static WORD32 conv2d_prefer_patchify(const conv2d_shape_t *p_shape)
+{
+  return (p_shape->kernel_height * p_shape->kernel_width * p_shape->input_channels >= CONV2D_PATCHIFY_MIN_COLS);
+}
+
+static WORD32 conv2d_prefer_direct(const conv2d_shape_t *p_shape)
+{
+  WORD32 min_seg_cols = p_shape->kernel_height == 1 ? CONV2D_DIRECT_1XN_MIN_SEG_COLS : CONV2D_DIRECT_MIN_SEG_COLS;
+  return (p_shape->kernel_width * p_shape->input_channels >= min_seg_cols);
+}
+
+typedef struct _conv2d_algo_rule_t
+{
+  WORD32 algo;
+  WORD32 (*is_preferred)(const conv2d_shape_t *p_shape);
+} conv2d_algo_rule_t;
+
+/* Heuristic decision table: the first supported and preferred variant wins.
+ * STD, the circular buffer kernel with its small channel count (e.g.
+ * input_channels == 1) specializations, takes whatever is left. */
+static const conv2d_algo_rule_t conv2d_algo_rules[] =
+{
+  {XA_NN_CONV2D_ALGO_DEPTHWISE, conv2d_prefer_always},
+  {XA_NN_CONV2D_ALGO_GROUPED,   conv2d_prefer_always},
+  {XA_NN_CONV2D_ALGO_POINTWISE, conv2d_prefer_always},
+  {XA_NN_CONV2D_ALGO_PATCHIFY,  conv2d_prefer_patchify},
+  {XA_NN_CONV2D_ALGO_DIRECT,    conv2d_prefer_direct},
+  {XA_NN_CONV2D_ALGO_STD,       conv2d_prefer_always},
+};
+
+static WORD32 conv2d_algo_select(const conv2d_shape_t *p_shape)
+{
+  WORD32 i;
+  for(i = 0; i < (WORD32)(sizeof(conv2d_algo_rules) / sizeof(conv2d_algo_rules[0])); i++)
+  {
+    if(conv2d_algo_is_supported(conv2d_algo_rules[i].algo, p_shape) &&
+       conv2d_algo_rules[i].is_preferred(p_shape))
+    {
+      return conv2d_algo_rules[i].algo;
+    }
+  }
+  return -1;
+}
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s_select(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format)
+{
+  conv2d_shape_t shape;
+  if(conv2d_shape_init(&shape, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, groups, x_stride, y_stride, x_padding, y_padding, out_height, out_width, out_data_format) < 0)
+  {
+    return -1;
+  }
+  return conv2d_algo_select(&shape);
+}
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    WORD32 algo)
+{
+  conv2d_shape_t shape;
+  WORD32 scratch_size;
+
+  if(conv2d_shape_init(&shape, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, groups, x_stride, y_stride, x_padding, y_padding, out_height, out_width, out_data_format) < 0)
+  {
+    return -1;
+  }
+  if(algo == XA_NN_CONV2D_ALGO_AUTO)
+  {
+    algo = conv2d_algo_select(&shape);
+  }
+  if(!conv2d_algo_is_supported(algo, &shape))
+  {
+    return -1;
+  }
+
+  switch(algo)
+  {
+    case XA_NN_CONV2D_ALGO_STD:
+    case XA_NN_CONV2D_ALGO_DIRECT:
+      return xa_nn_conv2d_std_getsize(input_height, input_channels, kernel_height, kernel_width, y_stride, y_padding, out_height, out_channels, PREC_ASYM8S);
+    case XA_NN_CONV2D_ALGO_POINTWISE:
+      return 0;
+    case XA_NN_CONV2D_ALGO_PATCHIFY:
+      /* Patches of a single row kernel are read in place */
+      return kernel_height == 1 ? 0 : (WORD32)PADDED_SIZE(out_height * out_width * kernel_height * kernel_width * input_channels, ALIGNMENT);
+    case XA_NN_CONV2D_ALGO_DEPTHWISE:
+      scratch_size = xa_nn_conv2d_depthwise_getsize(input_height, input_width, input_channels, kernel_height, kernel_width, out_channels / input_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, PREC_ASYM8S, 0);
+      if(scratch_size < 0)
+      {
+        return -1;
+      }
+      /* Kernel rearranged to kernel_height x kernel_width x out_channels, at
+       * p_scratch aligned to 16 bytes, followed by the depthwise scratch */
+      scratch_size += ALIGNMENT_16;
+      scratch_size += PADDED_SIZE(kernel_height * kernel_width * out_channels, ALIGNMENT_16);
+      return scratch_size;
+    case XA_NN_CONV2D_ALGO_GROUPED:
+      return xa_nn_conv2d_grouped_getsize(input_height, input_channels, kernel_height, kernel_width, y_stride, y_padding, out_height, groups, PREC_ASYM8S);
+    default:
+      return -1;
+  }
+}
+
+/* stride == kernel without padding: windows do not overlap, the convolution is
+ * a matmul of the kernel with the patches */
+static WORD32 conv2d_patchify_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    const conv2d_shape_t *p_shape,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_scratch)
+{
+  WORD32 i, j, k;
+  WORD32 kernel_row_size = p_shape->kernel_width * p_shape->input_channels;
+  WORD32 patch_size = p_shape->kernel_height * kernel_row_size;
+  WORD32 input_row_size = p_shape->input_width * p_shape->input_channels;
+  WORD32 out_offset = p_shape->out_data_format ? 1 : p_shape->out_channels;
+  WORD32 out_stride = p_shape->out_data_format ? p_shape->out_height * p_shape->out_width : 1;
+  WORD32 ret = 0;
+
+  if(p_shape->kernel_height == 1)
+  {
+    /* Patches are contiguous along an input row */
+    if(p_shape->out_width * p_shape->kernel_width == p_shape->input_width)
+    {
+      return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(p_out, p_kernel, p_inp, p_bias, p_shape->out_channels, patch_size, patch_size, p_shape->out_height * p_shape->out_width, patch_size, out_offset, out_stride, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias);
+    }
+    for(i = 0; i < p_shape->out_height && ret == 0; i++)
+    {
+      ret = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(&p_out[i * p_shape->out_width * out_offset], p_kernel, &p_inp[i * input_row_size], p_bias, p_shape->out_channels, patch_size, patch_size, p_shape->out_width, patch_size, out_offset, out_stride, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias);
+    }
+    return ret;
+  }
+
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+
+  /* Gather the patches, kernel_height rows of kernel_row_size bytes each */
+  WORD8 *p_patch = (WORD8 *)p_scratch;
+  for(i = 0; i < p_shape->out_height; i++)
+  {
+    for(j = 0; j < p_shape->out_width; j++)
+    {
+      const WORD8 *p_src = &p_inp[i * p_shape->kernel_height * input_row_size + j * kernel_row_size];
+      for(k = 0; k < p_shape->kernel_height; k++)
+      {
+        memcpy(p_patch, &p_src[k * input_row_size], kernel_row_size);
+        p_patch += kernel_row_size;
+      }
+    }
+  }
+
+  return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(p_out, p_kernel, (WORD8 *)p_scratch, p_bias, p_shape->out_channels, patch_size, patch_size, p_shape->out_height * p_shape->out_width, patch_size, out_offset, out_stride, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias);
+}
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    WORD32 algo,
+    VOID *p_scratch)
+{
+  conv2d_shape_t shape;
+  WORD32 i;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  for(i = 0; i < out_channels; i++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[i] < -31 || p_out_shift[i] > 31), -1);
+  }
+
+  if(conv2d_shape_init(&shape, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, groups, x_stride, y_stride, x_padding, y_padding, out_height, out_width, out_data_format) < 0)
+  {
+    return -1;
+  }
+  if(algo == XA_NN_CONV2D_ALGO_AUTO)
+  {
+    algo = conv2d_algo_select(&shape);
+  }
+  if(!conv2d_algo_is_supported(algo, &shape))
+  {
+    return -1;
+  }
+
+  switch(algo)
+  {
+    case XA_NN_CONV2D_ALGO_STD:
+    case XA_NN_CONV2D_ALGO_DIRECT:
+    {
+      XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+      XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+      conv2d_std_per_chan_sym8sxasym8s_exec(p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, algo == XA_NN_CONV2D_ALGO_DIRECT ? 0 : -1, p_scratch);
+      return 0;
+    }
+    case XA_NN_CONV2D_ALGO_POINTWISE:
+      return xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(p_out, (WORD8 *)p_kernel, (WORD8 *)p_inp, (WORD32 *)p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format);
+    case XA_NN_CONV2D_ALGO_PATCHIFY:
+      return conv2d_patchify_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias, &shape, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, p_scratch);
+    case XA_NN_CONV2D_ALGO_DEPTHWISE:
+    {
+      WORD32 kernel_size = kernel_height * kernel_width;
+      const WORD8 *p_kernel_hwc = p_kernel;
+      XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+      /* getsize reserves ALIGNMENT_16 bytes for aligning p_scratch, the
+       * depthwise kernel needs its scratch 16 byte aligned */
+      p_scratch = (VOID *)ALIGNED_ADDR(p_scratch, ALIGNMENT_16);
+
+      /* Rearrange the kernel from out_channels x kernel_height x kernel_width
+       * to kernel_height x kernel_width x out_channels. This is done on every
+       * call; callers running the same weights repeatedly should keep an HWC
+       * copy and call xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s directly.
+       * Both layouts are the same for a 1x1 kernel. */
+      if(kernel_size > 1)
+      {
+        WORD8 *p_dst = (WORD8 *)p_scratch;
+        for(i = 0; i < out_channels; i++)
+        {
+          WORD32 k;
+          for(k = 0; k < kernel_size; k++)
+          {
+            p_dst[k * out_channels + i] = p_kernel[i * kernel_size + k];
+          }
+        }
+        p_kernel_hwc = p_dst;
+      }
+      p_scratch = (VOID *)((WORD8 *)p_scratch + PADDED_SIZE(kernel_size * out_channels, ALIGNMENT_16));
+
+      return xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s(p_out, p_kernel_hwc, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels / input_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, 0, out_data_format, p_scratch);
+    }
+    case XA_NN_CONV2D_ALGO_GROUPED:
+      return xa_nn_conv2d_grouped_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, groups, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch);
+    default:
+      return -1;
+  }
+}
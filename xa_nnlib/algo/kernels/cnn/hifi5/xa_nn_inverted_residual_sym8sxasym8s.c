@@ -0,0 +1,335 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nn_circ_buf.h"
+
+/* Fused MobileNetV2/V3 inverted residual block:
+ *   pointwise expand -> depthwise -> pointwise project
+ * Output rows are produced band_height rows at a time. Only the expanded
+ * input rows needed by one band of depthwise output and that band of
+ * depthwise output live in scratch, so the full expanded tensor is never
+ * allocated. The expanded rows are a rolling window: rows shared with the
+ * previous band are moved to the front, and only the new rows are expanded.
+ * A NULL p_expand_kernel skips the expand stage (expansion factor 1).
+ * The residual add, when present, is done by the caller. */
+
+static inline WORD32 inv_res_band_inp_rows
+  (WORD32 band_height
+   ,WORD32 kernel_height
+   ,WORD32 y_stride
+  )
+{
+  return (band_height - 1) * y_stride + kernel_height;
+}
+
+WORD32 xa_nn_inverted_residual_per_chan_sym8sxasym8s_getsize
+  (WORD32 input_width
+   ,WORD32 input_channels
+   ,WORD32 expanded_channels
+   ,WORD32 kernel_height
+   ,WORD32 kernel_width
+   ,WORD32 x_stride
+   ,WORD32 y_stride
+   ,WORD32 x_padding
+   ,WORD32 y_padding
+   ,WORD32 out_width
+   ,WORD32 band_height
+  )
+{
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((expanded_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0 || y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0 || y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((band_height <= 0), -1);
+
+  WORD32 band_inp_rows = inv_res_band_inp_rows(band_height, kernel_height, y_stride);
+
+  WORD32 dw_scratch_size = xa_nn_conv2d_depthwise_getsize
+    (band_inp_rows
+     ,input_width
+     ,expanded_channels
+     ,kernel_height
+     ,kernel_width
+     ,1
+     ,x_stride
+     ,y_stride
+     ,x_padding
+     ,y_padding
+     ,band_height
+     ,out_width
+     ,PREC_ASYM8S
+     ,0
+    );
+  if(dw_scratch_size < 0)
+  {
+    return -1;
+  }
+
+  WORD32 total_size = ALIGNMENT_16;
+  /* Expanded input rows of one band */
+  total_size += ALIGNED_SIZE(band_inp_rows * input_width * expanded_channels, ALIGNMENT_16);
+  /* Depthwise output of one band */
+  total_size += ALIGNED_SIZE(band_height * out_width * expanded_channels, ALIGNMENT_16);
+  /* Depthwise convolution scratch */
+  total_size += ALIGNED_SIZE(dw_scratch_size, ALIGNMENT_16);
+
+  return total_size;
+}
+
+WORD32 xa_nn_inverted_residual_per_chan_sym8sxasym8s
+  (WORD8 * __restrict__ p_out
+   ,const WORD8 * __restrict__ p_inp
+   ,WORD32 input_height
+   ,WORD32 input_width
+   ,WORD32 input_channels
+   ,WORD32 expanded_channels
+   ,WORD32 out_channels
+   ,WORD32 input_zero_bias
+   ,const WORD8 * __restrict__ p_expand_kernel
+   ,const WORD32 * __restrict__ p_expand_bias
+   ,const WORD32 * __restrict__ p_expand_out_multiplier
+   ,const WORD32 * __restrict__ p_expand_out_shift
+   ,WORD32 expand_out_zero_bias
+   ,WORD32 expand_activation_min
+   ,WORD32 expand_activation_max
+   ,const WORD8 * __restrict__ p_dw_kernel
+   ,const WORD32 * __restrict__ p_dw_bias
+   ,WORD32 kernel_height
+   ,WORD32 kernel_width
+   ,WORD32 x_stride
+   ,WORD32 y_stride
+   ,WORD32 x_padding
+   ,WORD32 y_padding
+   ,WORD32 out_height
+   ,WORD32 out_width
+   ,const WORD32 * __restrict__ p_dw_out_multiplier
+   ,const WORD32 * __restrict__ p_dw_out_shift
+   ,WORD32 dw_out_zero_bias
+   ,WORD32 dw_activation_min
+   ,WORD32 dw_activation_max
+   ,const WORD8 * __restrict__ p_project_kernel
+   ,const WORD32 * __restrict__ p_project_bias
+   ,const WORD32 * __restrict__ p_project_out_multiplier
+   ,const WORD32 * __restrict__ p_project_out_shift
+   ,WORD32 project_out_zero_bias
+   ,WORD32 band_height
+   ,VOID * __restrict__ p_scratch
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dw_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dw_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dw_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dw_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_project_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_project_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_project_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_project_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  if(p_expand_kernel != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_expand_bias, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_expand_out_multiplier, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_expand_out_shift, -1);
+  }
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((expanded_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_expand_kernel == NULL && expanded_channels != input_channels), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((expand_out_zero_bias < -128 || expand_out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((dw_out_zero_bias < -128 || dw_out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((project_out_zero_bias < -128 || project_out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((expand_activation_min < -128 || expand_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((expand_activation_max < -128 || expand_activation_max > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((expand_activation_max < expand_activation_min), -1);
+  XA_NNLIB_ARG_CHK_COND((dw_activation_min < -128 || dw_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((dw_activation_max < -128 || dw_activation_max > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((dw_activation_max < dw_activation_min), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || y_stride > kernel_height), -1);
+  XA_NNLIB_ARG_CHK_COND((x_stride <= 0 || x_stride > kernel_width), -1);
+  XA_NNLIB_ARG_CHK_COND((x_padding < 0 || y_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((band_height <= 0), -1);
+
+  WORD32 ret, oy;
+  /* Input rows [exp_start, exp_end) are expanded at p_exp_band */
+  WORD32 exp_start = 0, exp_end = 0;
+  WORD32 band_inp_rows = inv_res_band_inp_rows(band_height, kernel_height, y_stride);
+  WORD32 inp_row_size = input_width * input_channels;
+  WORD32 exp_row_size = input_width * expanded_channels;
+  /* Zero point of the depthwise input, used to pad short bands */
+  WORD32 dw_input_zero_bias = (p_expand_kernel != NULL) ? -expand_out_zero_bias : input_zero_bias;
+
+  /* Scratch allocation */
+  WORD8 *p_exp_band = (WORD8 *)ALIGN_PTR(p_scratch, ALIGNMENT_16);
+  WORD8 *p_dw_band = p_exp_band + ALIGNED_SIZE(band_inp_rows * exp_row_size, ALIGNMENT_16);
+  VOID *p_dw_scratch = (VOID *)(p_dw_band + ALIGNED_SIZE(band_height * out_width * expanded_channels, ALIGNMENT_16));
+
+  for(oy = 0; oy < out_height; oy += band_height)
+  {
+    WORD32 band_out_rows = XT_MIN(band_height, out_height - oy);
+    WORD32 inp_start = oy * y_stride - y_padding;
+    WORD32 inp_end = inp_start + inv_res_band_inp_rows(band_out_rows, kernel_height, y_stride);
+    WORD32 band_y_padding = 0;
+    if(inp_start < 0)
+    {
+      band_y_padding = -inp_start;
+      inp_start = 0;
+    }
+    /* Depthwise kernel needs at least kernel_height input rows, take extra
+     * real rows when available, these are not read for this band's output */
+    inp_end = XT_MAX(inp_end, inp_start + kernel_height);
+    inp_end = XT_MIN(inp_end, input_height);
+    WORD32 band_rows = XT_MAX(inp_end - inp_start, 0);
+
+    const WORD8 *p_dw_inp;
+    if(p_expand_kernel != NULL)
+    {
+      /* Bands move down monotonically, so the rows still needed from the
+       * previous band are its last ones */
+      WORD32 keep_rows = XT_MIN(XT_MAX(exp_end - inp_start, 0), band_rows);
+      WORD32 new_rows = band_rows - keep_rows;
+      WORD8 *p_exp_new = &p_exp_band[keep_rows * exp_row_size];
+      if(keep_rows > 0 && inp_start > exp_start)
+      {
+        memmove(p_exp_band, &p_exp_band[(inp_start - exp_start) * exp_row_size], keep_rows * exp_row_size);
+      }
+      if(new_rows > 0)
+      {
+        ret = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s
+          (p_exp_new
+           ,(WORD8 *)p_expand_kernel
+           ,(WORD8 *)&p_inp[(inp_start + keep_rows) * inp_row_size]
+           ,(WORD32 *)p_expand_bias
+           ,new_rows
+           ,input_width
+           ,input_channels
+           ,expanded_channels
+           ,input_zero_bias
+           ,(WORD32 *)p_expand_out_multiplier
+           ,(WORD32 *)p_expand_out_shift
+           ,expand_out_zero_bias
+           ,0
+          );
+        if(ret != 0)
+          return ret;
+
+        ret = xa_nn_vec_activation_min_max_8_8
+          (p_exp_new
+           ,p_exp_new
+           ,expand_activation_min
+           ,expand_activation_max
+           ,new_rows * exp_row_size
+          );
+        if(ret != 0)
+          return ret;
+      }
+      exp_start = inp_start;
+      exp_end = inp_start + band_rows;
+      p_dw_inp = p_exp_band;
+    }
+    else
+    {
+      p_dw_inp = &p_inp[inp_start * inp_row_size];
+    }
+
+    /* Input shorter than the kernel: pad the band with zero point rows */
+    if(band_rows < kernel_height)
+    {
+      if(p_dw_inp != p_exp_band && band_rows > 0)
+      {
+        memcpy(p_exp_band, p_dw_inp, band_rows * exp_row_size);
+      }
+      memset(&p_exp_band[band_rows * exp_row_size], (WORD8)(-dw_input_zero_bias), (kernel_height - band_rows) * exp_row_size);
+      p_dw_inp = p_exp_band;
+      band_rows = kernel_height;
+    }
+
+    ret = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
+      (p_dw_band
+       ,p_dw_kernel
+       ,p_dw_inp
+       ,p_dw_bias
+       ,band_rows
+       ,input_width
+       ,expanded_channels
+       ,kernel_height
+       ,kernel_width
+       ,1
+       ,x_stride
+       ,y_stride
+       ,x_padding
+       ,band_y_padding
+       ,band_out_rows
+       ,out_width
+       ,dw_input_zero_bias
+       ,p_dw_out_multiplier
+       ,p_dw_out_shift
+       ,dw_out_zero_bias
+       ,0
+       ,0
+       ,p_dw_scratch
+      );
+    if(ret != 0)
+      return ret;
+
+    ret = xa_nn_vec_activation_min_max_8_8
+      (p_dw_band
+       ,p_dw_band
+       ,dw_activation_min
+       ,dw_activation_max
+       ,band_out_rows * out_width * expanded_channels
+      );
+    if(ret != 0)
+      return ret;
+
+    ret = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s
+      (&p_out[oy * out_width * out_channels]
+       ,(WORD8 *)p_project_kernel
+       ,p_dw_band
+       ,(WORD32 *)p_project_bias
+       ,band_out_rows
+       ,out_width
+       ,expanded_channels
+       ,out_channels
+       ,-dw_out_zero_bias
+       ,(WORD32 *)p_project_out_multiplier
+       ,(WORD32 *)p_project_out_shift
+       ,project_out_zero_bias
+       ,0
+      );
+    if(ret != 0)
+      return ret;
+  }
+
+  return 0;
+}
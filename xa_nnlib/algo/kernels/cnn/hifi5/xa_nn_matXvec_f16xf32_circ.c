@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "common_fpu.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_matXvec_f16xf32_circ,(
+    FLOAT32 *__restrict__ p_out,
+    FLOAT32 *__restrict__ p_mat,
+    const WORD16 *__restrict__ p_vec,
+    const FLOAT32 *__restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_offset,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_col_offset,
+    WORD32 out_row_offset))
+#else /* #if !HAVE_VFPU */
+
+/* The vectors hold IEEE half precision weights stored as 16-bit patterns,
+ * they are widened to single precision in registers as they are loaded,
+ * the matrix is the 32-bit float circular buffer. cols is a multiple of 2
+ * (input_channels_pad is even). */
+
+/* Loads 4 half precision weights and widens them, elements 0,1 in v0 */
+#define LOAD_VEC_F16X4(v0, v1, p_v, align_v) \
+{ \
+  ae_int16x4 _d_h16; \
+  AE_LA16X4_IP(_d_h16, align_v, p_v); \
+  CVT_F16X4_F32X2X2(v0, v1, _d_h16); \
+}
+
+/* Loads the 2 trailing half precision weights of a vector */
+#define LOAD_VEC_F16X2(v0, p_v) \
+{ \
+  ae_int32x2 _d_h32 = AE_MOVDA32X2(((const WORD16 *)p_v)[0], ((const WORD16 *)p_v)[1]); \
+  CVT_F16_F32X2(v0, _d_h32); \
+}
+
+/* Dot product of one row of the circular matrix with one vector */
+static inline FLOAT32 dot_row_f16xf32_circ(FLOAT32 *p_mat,
+    const WORD16 *p_vec, WORD32 cols, WORD32 row_idx, WORD32 row_offset)
+{
+  xtfloatx4 *p_mat0 = (xtfloatx4 *)p_mat;
+  const ae_int16x4 *p_v0 = (const ae_int16x4 *)p_vec;
+  ae_valignx2 align_mat0;
+  ae_valign align_v0;
+  xtfloatx2 acc0, acc1, m0, m1, v0, v1;
+  int c_itr;
+
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat0, row_idx*row_offset*sizeof(FLOAT32));
+  AE_LASX2X2POS_PC(align_mat0, p_mat0);
+  align_v0 = AE_LA64_PP(p_v0);
+
+  acc0 = acc1 = (xtfloatx2)0.0f;
+  for(c_itr = 0; c_itr < (cols >> 2); c_itr++)
+  {
+    LOAD_VEC_F16X4(v0, v1, p_v0, align_v0);
+    AE_LASX2X2_IC(m0, m1, align_mat0, p_mat0);
+    XT_MADD_SX2(acc0, m0, v0);
+    XT_MADD_SX2(acc1, m1, v1);
+  }
+  if(cols & 2)
+  {
+    LOAD_VEC_F16X2(v0, p_v0);
+    XT_LSX2XC(m0, (xtfloatx2 *)p_mat0, 8);
+    XT_MADD_SX2(acc0, m0, v0);
+  }
+  acc0 = acc0 + acc1;
+  return XT_RADD_SX2(acc0);
+}
+
+WORD32 xa_nn_matXvec_f16xf32_circ(
+    FLOAT32 *__restrict__ p_out,            /* output pointer */
+    FLOAT32 *__restrict__ p_mat,            /* matrix: rows x cols */
+    const WORD16 *__restrict__ p_vec,       /* vec: cols x 1, half precision */
+    const FLOAT32 *__restrict__ p_bias,     /* bias */
+    WORD32 rows,                            /* Number of rows in matrix */
+    WORD32 cols,                            /* Number of columns in matrix */
+    WORD32 row_offset,                      /* row stride for matrix */
+    WORD32 vec_count,                       /* number of vectors */
+    WORD32 vec_offset,                      /* offset from current to next vector */
+    WORD32 out_col_offset,
+    WORD32 out_row_offset)
+{
+  int m_itr, c_itr, vec_itr;
+
+  /* Two rows times two vectors, each weight chunk is widened once and
+   * used for both rows */
+  for(vec_itr = 0; vec_itr < (vec_count & ~1); vec_itr += 2)
+  {
+    const WORD16 *p_vec0 = &p_vec[vec_itr*vec_offset];
+    const WORD16 *p_vec1 = p_vec0 + vec_offset;
+    FLOAT32 bias0 = p_bias[vec_itr];
+    FLOAT32 bias1 = p_bias[vec_itr + 1];
+
+    for(m_itr = 0; m_itr < (rows & ~1); m_itr += 2)
+    {
+      xtfloatx4 *p_mat0 = (xtfloatx4 *)p_mat;
+      xtfloatx4 *p_mat1 = (xtfloatx4 *)p_mat;
+      const ae_int16x4 *p_v0 = (const ae_int16x4 *)p_vec0;
+      const ae_int16x4 *p_v1 = (const ae_int16x4 *)p_vec1;
+      ae_valignx2 align_mat0, align_mat1;
+      ae_valign align_v0, align_v1;
+      xtfloatx2 acc_0_0, acc_0_1, acc_1_0, acc_1_1;
+      xtfloatx2 m00, m01, m10, m11;
+      xtfloatx2 v00, v01, v10, v11;
+
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat0, m_itr*row_offset*sizeof(FLOAT32));
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat1, (m_itr + 1)*row_offset*sizeof(FLOAT32));
+      AE_LASX2X2POS_PC(align_mat0, p_mat0);
+      AE_LASX2X2POS_PC(align_mat1, p_mat1);
+      align_v0 = AE_LA64_PP(p_v0);
+      align_v1 = AE_LA64_PP(p_v1);
+
+      acc_0_0 = acc_0_1 = acc_1_0 = acc_1_1 = (xtfloatx2)0.0f;
+      for(c_itr = 0; c_itr < (cols >> 2); c_itr++)
+      {
+        LOAD_VEC_F16X4(v00, v01, p_v0, align_v0);
+        LOAD_VEC_F16X4(v10, v11, p_v1, align_v1);
+        AE_LASX2X2_IC(m00, m01, align_mat0, p_mat0);
+        AE_LASX2X2_IC(m10, m11, align_mat1, p_mat1);
+
+        XT_MADD_SX2(acc_0_0, m00, v00);
+        XT_MADD_SX2(acc_0_0, m01, v01);
+        XT_MADD_SX2(acc_0_1, m00, v10);
+        XT_MADD_SX2(acc_0_1, m01, v11);
+        XT_MADD_SX2(acc_1_0, m10, v00);
+        XT_MADD_SX2(acc_1_0, m11, v01);
+        XT_MADD_SX2(acc_1_1, m10, v10);
+        XT_MADD_SX2(acc_1_1, m11, v11);
+      }
+      if(cols & 2)
+      {
+        LOAD_VEC_F16X2(v00, p_v0);
+        LOAD_VEC_F16X2(v10, p_v1);
+        XT_LSX2XC(m00, (xtfloatx2 *)p_mat0, 8);
+        XT_LSX2XC(m10, (xtfloatx2 *)p_mat1, 8);
+
+        XT_MADD_SX2(acc_0_0, m00, v00);
+        XT_MADD_SX2(acc_0_1, m00, v10);
+        XT_MADD_SX2(acc_1_0, m10, v00);
+        XT_MADD_SX2(acc_1_1, m10, v10);
+      }
+
+      p_out[vec_itr*out_col_offset + m_itr*out_row_offset] = XT_RADD_SX2(acc_0_0) + bias0;
+      p_out[(vec_itr + 1)*out_col_offset + m_itr*out_row_offset] = XT_RADD_SX2(acc_0_1) + bias1;
+      p_out[vec_itr*out_col_offset + (m_itr + 1)*out_row_offset] = XT_RADD_SX2(acc_1_0) + bias0;
+      p_out[(vec_itr + 1)*out_col_offset + (m_itr + 1)*out_row_offset] = XT_RADD_SX2(acc_1_1) + bias1;
+    }
+    for(; m_itr < rows; m_itr++)
+    {
+      p_out[vec_itr*out_col_offset + m_itr*out_row_offset] =
+        dot_row_f16xf32_circ(p_mat, p_vec0, cols, m_itr, row_offset) + bias0;
+      p_out[(vec_itr + 1)*out_col_offset + m_itr*out_row_offset] =
+        dot_row_f16xf32_circ(p_mat, p_vec1, cols, m_itr, row_offset) + bias1;
+    }
+  }
+
+  /* Tail vector */
+  for(; vec_itr < vec_count; vec_itr++)
+  {
+    for(m_itr = 0; m_itr < rows; m_itr++)
+    {
+      p_out[vec_itr*out_col_offset + m_itr*out_row_offset] =
+        dot_row_f16xf32_circ(p_mat, &p_vec[vec_itr*vec_offset], cols, m_itr, row_offset) + p_bias[vec_itr];
+    }
+  }
+
+  return 0;
+}
+#endif /* #if !HAVE_VFPU */
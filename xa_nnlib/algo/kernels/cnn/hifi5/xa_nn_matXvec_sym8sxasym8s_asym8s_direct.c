@@ -0,0 +1,260 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_conv2d_std_state.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Clears the bytes of d after the first (64 - rem_shift) / 8 ones */
+#define MASK_REM_COLS(d, rem_shift) \
+    d = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(d), rem_shift), rem_shift));
+
+/* Sum of vec * (-mat1_offset) over cols contiguous elements */
+static inline ae_int32x2 _xa_nn_vec_offset_sum
+    (const WORD8* p_vec_0
+    ,WORD32       cols
+    ,ae_int8x8    mat_z_b
+    )
+{
+  int c_itr;
+  int rem_cols_shift = 64 - (cols & 7) * 8;
+  ae_int8x8 vec0_batch_0;
+  ae_int32x2 acc_01 = ZERO32, acc_23 = ZERO32;
+  ae_valign align_p_vec0 = AE_LA64_PP(p_vec_0);
+
+  for(c_itr = 0; c_itr < (cols >> 3); c_itr++)
+  {
+    AE_LA8X8_IP(vec0_batch_0, align_p_vec0, (ae_int8x8 *)p_vec_0);
+    AE_MULA8Q8X8(acc_01, acc_23, mat_z_b, mat_z_b, mat_z_b, mat_z_b, vec0_batch_0);
+  }
+  if(cols & 7)
+  {
+    AE_LA8X8_IP(vec0_batch_0, align_p_vec0, (ae_int8x8 *)p_vec_0);
+    MASK_REM_COLS(vec0_batch_0, rem_cols_shift);
+    AE_MULA8Q8X8(acc_01, acc_23, mat_z_b, mat_z_b, mat_z_b, mat_z_b, vec0_batch_0);
+  }
+  return acc_01;
+}
+
+/* Accumulates 4 matrix rows x 2 vectors, each matrix row being seg_count
+ * segments of seg_cols contiguous elements, seg_stride apart. The segments of
+ * a vector are contiguous. */
+static inline void _xa_nn_dot_product_4_rows_2_vecs_seg
+    (ae_int32x2*   out_0_01
+    ,ae_int32x2*   out_0_23
+    ,ae_int32x2*   out_1_01
+    ,ae_int32x2*   out_1_23
+    ,const WORD8*  p_mat1_0
+    ,const WORD8*  p_mat1_1
+    ,const WORD8*  p_mat1_2
+    ,const WORD8*  p_mat1_3
+    ,const WORD8*  p_vec_0
+    ,const WORD8*  p_vec_1
+    ,WORD32        seg_cols
+    ,WORD32        seg_count
+    ,WORD32        seg_stride
+    )
+{
+  int s_itr, c_itr;
+  int rem_cols_shift = 64 - (seg_cols & 7) * 8;
+
+  ae_int8x8 mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0;
+  ae_int8x8 vec0_batch_0, vec1_batch_0;
+
+  ae_int32x2 acc_row01_vec0 = *out_0_01;
+  ae_int32x2 acc_row23_vec0 = *out_0_23;
+  ae_int32x2 acc_row01_vec1 = *out_1_01;
+  ae_int32x2 acc_row23_vec1 = *out_1_23;
+
+  for(s_itr = 0; s_itr < seg_count; s_itr++)
+  {
+    ae_int8x8 *p_mat_0 = (ae_int8x8 *)(p_mat1_0 + s_itr * seg_stride);
+    ae_int8x8 *p_mat_1 = (ae_int8x8 *)(p_mat1_1 + s_itr * seg_stride);
+    ae_int8x8 *p_mat_2 = (ae_int8x8 *)(p_mat1_2 + s_itr * seg_stride);
+    ae_int8x8 *p_mat_3 = (ae_int8x8 *)(p_mat1_3 + s_itr * seg_stride);
+    ae_int8x8 *p_vec_0_s = (ae_int8x8 *)(p_vec_0 + s_itr * seg_cols);
+    ae_int8x8 *p_vec_1_s = (ae_int8x8 *)(p_vec_1 + s_itr * seg_cols);
+
+    ae_valign align_p_mat_0 = AE_LA64_PP(p_mat_0);
+    ae_valign align_p_mat_1 = AE_LA64_PP(p_mat_1);
+    ae_valign align_p_mat_2 = AE_LA64_PP(p_mat_2);
+    ae_valign align_p_mat_3 = AE_LA64_PP(p_mat_3);
+    ae_valign align_p_vec_0 = AE_LA64_PP(p_vec_0_s);
+    ae_valign align_p_vec_1 = AE_LA64_PP(p_vec_1_s);
+
+#pragma no_unroll
+    for(c_itr = 0; c_itr < (seg_cols >> 3); c_itr++)
+    {
+      AE_LA8X8_IP(mat1_row0_0, align_p_mat_0, p_mat_0);
+      AE_LA8X8_IP(mat1_row1_0, align_p_mat_1, p_mat_1);
+      AE_LA8X8_IP(mat1_row2_0, align_p_mat_2, p_mat_2);
+      AE_LA8X8_IP(mat1_row3_0, align_p_mat_3, p_mat_3);
+
+      AE_LA8X8_IP(vec0_batch_0, align_p_vec_0, p_vec_0_s);
+      AE_LA8X8_IP(vec1_batch_0, align_p_vec_1, p_vec_1_s);
+
+      AE_MULA8Q8X8(acc_row01_vec0, acc_row23_vec0, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec0_batch_0);
+      AE_MULA8Q8X8(acc_row01_vec1, acc_row23_vec1, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec1_batch_0);
+    }
+
+    //Remainder loop for cols
+    if(seg_cols & 7)
+    {
+      AE_LA8X8_IP(mat1_row0_0, align_p_mat_0, p_mat_0);
+      AE_LA8X8_IP(mat1_row1_0, align_p_mat_1, p_mat_1);
+      AE_LA8X8_IP(mat1_row2_0, align_p_mat_2, p_mat_2);
+      AE_LA8X8_IP(mat1_row3_0, align_p_mat_3, p_mat_3);
+
+      AE_LA8X8_IP(vec0_batch_0, align_p_vec_0, p_vec_0_s);
+      AE_LA8X8_IP(vec1_batch_0, align_p_vec_1, p_vec_1_s);
+
+      MASK_REM_COLS(vec0_batch_0, rem_cols_shift);
+      MASK_REM_COLS(vec1_batch_0, rem_cols_shift);
+
+      AE_MULA8Q8X8(acc_row01_vec0, acc_row23_vec0, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec0_batch_0);
+      AE_MULA8Q8X8(acc_row01_vec1, acc_row23_vec1, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec1_batch_0);
+    }
+  }
+
+  *out_0_01 = acc_row01_vec0;
+  *out_0_23 = acc_row23_vec0;
+  *out_1_01 = acc_row01_vec1;
+  *out_1_23 = acc_row23_vec1;
+}
+
+static inline void _xa_nn_requantize_store_4_rows
+    (WORD8*     p_out
+    ,ae_int32x2 acc_01
+    ,ae_int32x2 acc_23
+    ,WORD32     valid_rows
+    ,WORD32     out_row_offset
+    ,WORD32     out_multiplier
+    ,WORD32     out_shift
+    ,WORD32     out_zero_bias
+    )
+{
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+  WORD32 left_shift  = out_shift < 0 ? 0 : out_shift;
+  WORD32 right_shift = out_shift > 0 ? 0 : -out_shift;
+
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_01, out_multiplier, left_shift, right_shift);
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_23, out_multiplier, left_shift, right_shift);
+  acc_01 = AE_ADD32S(acc_01, AE_MOVDA32(out_zero_bias));
+  acc_23 = AE_ADD32S(acc_23, AE_MOVDA32(out_zero_bias));
+  AE_MINMAX32(acc_01, min_int8, max_int8);
+  AE_MINMAX32(acc_23, min_int8, max_int8);
+
+  p_out[0] = (WORD8)AE_MOVAD32_H(acc_01);
+  if(valid_rows > 1) p_out[out_row_offset] = (WORD8)AE_MOVAD32_L(acc_01);
+  if(valid_rows > 2) p_out[2 * out_row_offset] = (WORD8)AE_MOVAD32_H(acc_23);
+  if(valid_rows > 3) p_out[3 * out_row_offset] = (WORD8)AE_MOVAD32_L(acc_23);
+}
+
+/* matXvec reading the matrix in place: row m is made of seg_count segments
+ * of seg_cols contiguous elements, starting at p_mat1 + m * row_stride1 +
+ * s * seg_stride. This is how a conv2d window of kernel_height rows is laid
+ * out in an NHWC input, so no staging copy is needed. Vector v is
+ * seg_count * seg_cols contiguous elements at p_vec1 + v * vec_stride. */
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_direct(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 seg_cols,
+    WORD32 seg_count,
+    WORD32 seg_stride,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_stride,
+    WORD32 out_col_offset,
+    WORD32 out_row_offset,
+    WORD32 mat1_offset,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias)
+{
+  int m_itr, vec_itr;
+  ae_int8x8 mat_z_b = AE_MOVDA8(-mat1_offset);
+
+  if (!p_bias)
+  {
+    return -1;
+  }
+
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr += 2)
+  {
+    /* Odd vec_count: last vector is processed twice, stored once */
+    WORD32 vec_itr_1 = (vec_itr + 1 < vec_count) ? vec_itr + 1 : vec_itr;
+    const WORD8 *p_vec_0 = p_vec1 + vec_itr * vec_stride;
+    const WORD8 *p_vec_1 = p_vec1 + vec_itr_1 * vec_stride;
+
+    /* (mat + mat1_offset) . vec = mat . vec - (-mat1_offset) . vec */
+    ae_int32x2 bias_0 = AE_SUB32S(AE_MOVDA32(p_bias[vec_itr]), _xa_nn_vec_offset_sum(p_vec_0, seg_cols * seg_count, mat_z_b));
+    ae_int32x2 bias_1 = AE_SUB32S(AE_MOVDA32(p_bias[vec_itr_1]), _xa_nn_vec_offset_sum(p_vec_1, seg_cols * seg_count, mat_z_b));
+
+    for(m_itr = 0; m_itr < rows; m_itr += 4)
+    {
+      WORD32 valid_rows = rows - m_itr < 4 ? rows - m_itr : 4;
+      /* Rows past the end alias the first one of the block */
+      const WORD8 *p_mat_0 = p_mat1 + m_itr * row_stride1;
+      const WORD8 *p_mat_1 = valid_rows > 1 ? p_mat_0 + row_stride1 : p_mat_0;
+      const WORD8 *p_mat_2 = valid_rows > 2 ? p_mat_1 + row_stride1 : p_mat_0;
+      const WORD8 *p_mat_3 = valid_rows > 3 ? p_mat_2 + row_stride1 : p_mat_0;
+
+      ae_int32x2 acc_row01_vec0 = bias_0;
+      ae_int32x2 acc_row23_vec0 = bias_0;
+      ae_int32x2 acc_row01_vec1 = bias_1;
+      ae_int32x2 acc_row23_vec1 = bias_1;
+
+      _xa_nn_dot_product_4_rows_2_vecs_seg
+        (&acc_row01_vec0
+         ,&acc_row23_vec0
+         ,&acc_row01_vec1
+         ,&acc_row23_vec1
+         ,p_mat_0
+         ,p_mat_1
+         ,p_mat_2
+         ,p_mat_3
+         ,p_vec_0
+         ,p_vec_1
+         ,seg_cols
+         ,seg_count
+         ,seg_stride
+        );
+
+      WORD8 *p_dst = p_out + m_itr * out_row_offset + vec_itr * out_col_offset;
+      _xa_nn_requantize_store_4_rows(p_dst, acc_row01_vec0, acc_row23_vec0, valid_rows, out_row_offset, p_out_multiplier[vec_itr], p_out_shift[vec_itr], out_zero_bias);
+      if(vec_itr_1 != vec_itr)
+      {
+        _xa_nn_requantize_store_4_rows(p_dst + out_col_offset, acc_row01_vec1, acc_row23_vec1, valid_rows, out_row_offset, p_out_multiplier[vec_itr_1], p_out_shift[vec_itr_1], out_zero_bias);
+      }
+    }
+  }
+
+  return 0;
+}
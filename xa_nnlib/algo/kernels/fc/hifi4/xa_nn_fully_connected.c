@@ -339,3 +339,184 @@ WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s
     );
   return ret;
 }
+
+/* Validated FC parameters, filled once by plan_create */
+typedef struct _xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t
+{
+  const WORD8 *p_weight;
+  const WORD32 *p_bias;
+  WORD32 weight_depth;
+  WORD32 out_depth;
+  WORD32 input_zero_bias;
+  WORD32 out_multiplier;
+  WORD32 out_shift;
+  WORD32 out_zero_bias;
+} xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t;
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_getsize(VOID)
+{
+  return (WORD32)((sizeof(xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t) + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+}
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_create
+  (VOID *p_plan
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* Checks are done once here regardless of DISABLE_ARG_CHK */
+  /* NULL pointer checks */
+  XA_NNLIB_CHK_PTR(p_plan, -1);
+  XA_NNLIB_CHK_PTR(p_weight, -1);
+  XA_NNLIB_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_CHK_ALIGN(p_plan, ALIGNMENT, -1);
+  XA_NNLIB_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t *p_fc_plan = (xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t *)p_plan;
+  p_fc_plan->p_weight = p_weight;
+  p_fc_plan->p_bias = p_bias;
+  p_fc_plan->weight_depth = weight_depth;
+  p_fc_plan->out_depth = out_depth;
+  p_fc_plan->input_zero_bias = input_zero_bias;
+  p_fc_plan->out_multiplier = out_multiplier;
+  p_fc_plan->out_shift = out_shift;
+  p_fc_plan->out_zero_bias = out_zero_bias;
+
+  /* No scratch needed by plan_execute */
+  return 0;
+}
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_execute
+  (const VOID *p_plan
+   ,WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_inp
+   ,VOID *p_scratch
+  )
+{
+  const xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t *p_fc_plan = (const xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_t *)p_plan;
+  (VOID)p_scratch;
+
+  return xa_nn_matXvec_sym8sxasym8s_asym8s
+    (p_out
+     ,p_fc_plan->p_weight
+     ,0
+     ,p_inp
+     ,0
+     ,p_fc_plan->p_bias
+     ,p_fc_plan->out_depth
+     ,p_fc_plan->weight_depth
+     ,0
+     ,p_fc_plan->weight_depth
+     ,0
+     ,p_fc_plan->input_zero_bias
+     ,0
+     ,p_fc_plan->out_multiplier
+     ,p_fc_plan->out_shift
+     ,p_fc_plan->out_zero_bias
+    );
+}
+
+WORD32 xa_nn_fully_connected_sparse_sym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_packed_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  block_size
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_packed_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed_weight, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sparse_sym8sxasym8s_asym8s
+    (p_out
+     ,p_packed_weight
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,block_size
+     ,input_zero_bias
+     ,p_out_multiplier
+     ,p_out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
+
+WORD32 xa_nn_fully_connected_sym4sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_packed_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_packed_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed_weight, 8, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sym4sxasym8s_asym8s
+    (p_out
+     ,p_packed_weight
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,input_zero_bias
+     ,p_out_multiplier
+     ,p_out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
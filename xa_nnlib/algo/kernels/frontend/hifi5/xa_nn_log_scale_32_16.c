@@ -0,0 +1,213 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+
+#define LOG_SEGMENTS_LOG2  7
+#define LOG_SCALE_LOG2     16
+#define LOG_SCALE          (1 << LOG_SCALE_LOG2)
+#define LOG_COEFF          45426
+
+/* Position of the most significant set bit (1 based) of an unsigned 32-bit value */
+#define MSB_U32(x) (((x) & 0x80000000) ? 32 : (31 - NSA((WORD32)(x))))
+
+/* Lane-wise low 32 bits of the 32x32 product */
+#define MUL32X2_LO(out, x, y) \
+  out = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_MUL32_HH(x, y)), \
+                    AE_MOVINT32X2_FROMINT64(AE_MUL32_LL(x, y)));
+
+/* Piecewise linear correction of log2 fraction, kLogSegments + 1 entries (padded) */
+static const UWORD16 log_lut_tbl[130] = {
+  0,    224,  442,  654,  861,  1063, 1259, 1450, 1636, 1817, 1992, 2163,
+  2329, 2490, 2646, 2797, 2944, 3087, 3224, 3358, 3487, 3611, 3732, 3848,
+  3960, 4068, 4172, 4272, 4368, 4460, 4549, 4633, 4714, 4791, 4864, 4934,
+  5001, 5063, 5123, 5178, 5231, 5280, 5326, 5368, 5408, 5444, 5477, 5507,
+  5533, 5557, 5578, 5595, 5610, 5622, 5631, 5637, 5640, 5641, 5638, 5633,
+  5626, 5615, 5602, 5586, 5568, 5547, 5524, 5498, 5470, 5439, 5406, 5370,
+  5332, 5291, 5249, 5203, 5156, 5106, 5054, 5000, 4944, 4885, 4825, 4762,
+  4697, 4630, 4561, 4490, 4416, 4341, 4264, 4184, 4103, 4020, 3935, 3848,
+  3759, 3668, 3575, 3481, 3384, 3286, 3186, 3084, 2981, 2875, 2768, 2659,
+  2549, 2437, 2323, 2207, 2090, 1971, 1851, 1729, 1605, 1480, 1353, 1224,
+  1094, 963,  830,  695,  559,  421,  282,  142,  0,    0
+};
+
+/* Integer part and table segment of log2(x) for one element, x > 1 */
+static inline void log2_segment(UWORD32 x,
+                                WORD32 *integer,
+                                WORD32 *frac,
+                                WORD32 *c0,
+                                WORD32 *c1)
+{
+  WORD32 log2x = MSB_U32(x) - 1;
+  WORD32 f = x - (1LL << log2x);
+  WORD32 base_seg;
+
+  if(log2x < LOG_SCALE_LOG2)
+  {
+    f <<= LOG_SCALE_LOG2 - log2x;
+  }
+  else
+  {
+    f >>= log2x - LOG_SCALE_LOG2;
+  }
+  base_seg = f >> (LOG_SCALE_LOG2 - LOG_SEGMENTS_LOG2);
+
+  *integer = log2x;
+  *frac = f;
+  *c0 = log_lut_tbl[base_seg];
+  *c1 = log_lut_tbl[base_seg + 1];
+}
+
+/* Scaled natural log of two elements (x > 1), same steps as the reference Log() */
+static inline ae_int32x2 log_scale_x2(ae_int32x2 d_inp, WORD32 scale_shift)
+{
+  WORD32 int_0, frac_0, c0_0, c1_0;
+  WORD32 int_1, frac_1, c0_1, c1_1;
+  ae_int32x2 d_int, d_frac, d_c0, d_c1, d_rel, d_log2, d_loge;
+  ae_int64 d_acc_h, d_acc_l;
+  ae_int32x2 d_coeff = AE_MOVDA32(LOG_COEFF);
+  ae_int32x2 d_round = AE_MOVDA32(LOG_SCALE / 2);
+  ae_int64 d_round64 = AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(0, LOG_SCALE / 2));
+  UWORD32 x0 = (UWORD32)AE_MOVAD32_H(d_inp);
+  UWORD32 x1 = (UWORD32)AE_MOVAD32_L(d_inp);
+
+  /* Values 0 and 1 are zeroed by the caller, keep the lookup in range */
+  log2_segment((x0 > 1) ? x0 : 2, &int_0, &frac_0, &c0_0, &c1_0);
+  log2_segment((x1 > 1) ? x1 : 2, &int_1, &frac_1, &c0_1, &c1_1);
+
+  d_int = AE_MOVDA32X2(int_0, int_1);
+  d_frac = AE_MOVDA32X2(frac_0, frac_1);
+  d_c0 = AE_MOVDA32X2(c0_0, c0_1);
+  d_c1 = AE_MOVDA32X2(c1_0, c1_1);
+
+  /* rel_pos = ((c1 - c0) * (frac - seg_base)) >> LOG_SCALE_LOG2 */
+  d_rel = AE_SUB32(d_frac, AE_SLAI32(AE_SRAI32(d_frac, LOG_SCALE_LOG2 - LOG_SEGMENTS_LOG2), LOG_SCALE_LOG2 - LOG_SEGMENTS_LOG2));
+  MUL32X2_LO(d_rel, AE_SUB32(d_c1, d_c0), d_rel);
+  d_rel = AE_SRAI32(d_rel, LOG_SCALE_LOG2);
+
+  d_log2 = AE_ADD32(AE_ADD32(d_frac, d_c0), d_rel);
+  d_log2 = AE_ADD32(AE_SLAI32(d_int, LOG_SCALE_LOG2), d_log2);
+
+  /* loge = (LOG_COEFF * log2 + round) >> LOG_SCALE_LOG2 */
+  d_acc_h = AE_MUL32U_LL(AE_SEL32_HH(d_log2, d_log2), d_coeff);
+  d_acc_l = AE_MUL32U_LL(d_log2, d_coeff);
+  d_acc_h = AE_SRLI64(AE_ADD64(d_acc_h, d_round64), LOG_SCALE_LOG2);
+  d_acc_l = AE_SRLI64(AE_ADD64(d_acc_l, d_round64), LOG_SCALE_LOG2);
+  d_loge = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(d_acc_h), AE_MOVINT32X2_FROMINT64(d_acc_l));
+
+  /* Scale to the output scale */
+  d_loge = AE_ADD32(AE_SLAA32(d_loge, scale_shift), d_round);
+  return AE_SRLI32(d_loge, LOG_SCALE_LOG2);
+}
+
+WORD32 xa_nn_vec_log_scale_32_16(UWORD16 * p_out,
+                                 const UWORD32 * p_inp,
+                                 WORD32  scale_shift,
+                                 WORD32  correction_bits,
+                                 WORD32  num_elm)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(UWORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(UWORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((scale_shift < 0) || (scale_shift > 15)), -1);
+  XA_NNLIB_ARG_CHK_COND(((correction_bits < -31) || (correction_bits > 31)), -1);
+
+  int i;
+  /* Output may overwrite the input, 16-bit writes trail the 32-bit reads */
+  const UWORD32 *p_i = p_inp;
+  UWORD16 *p_o = p_out;
+
+  ae_valign inp_align = AE_LA64_PP(p_i);
+  ae_valign out_align = AE_ZALIGN64();
+
+  ae_int32x2 d_one = AE_MOVDA32(1 - 0x80000000);
+  ae_int32x2 d_sign = AE_MOVDA32(0x80000000);
+  ae_int32x2 d_u16_max = AE_MOVDA32(0xFFFF);
+  ae_int32x2 d_u16_max_b = AE_MOVDA32(0xFFFF - 0x80000000);
+  ae_int32x2 d_zero = AE_ZERO32();
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    ae_int32x2 d_inp0, d_inp1, d_out0, d_out1;
+    ae_int16x4 d_out16;
+    xtbool2 b_small0, b_small1, b_big0, b_big1;
+
+    AE_LA32X2_IP(d_inp0, inp_align, (ae_int32x2 *)p_i);
+    AE_LA32X2_IP(d_inp1, inp_align, (ae_int32x2 *)p_i);
+
+    if(correction_bits < 0)
+    {
+      d_inp0 = AE_SRLA32(d_inp0, -correction_bits);
+      d_inp1 = AE_SRLA32(d_inp1, -correction_bits);
+    }
+    else
+    {
+      d_inp0 = AE_SLAA32(d_inp0, correction_bits);
+      d_inp1 = AE_SLAA32(d_inp1, correction_bits);
+    }
+
+    b_small0 = AE_LE32(AE_SUB32(d_inp0, d_sign), d_one);
+    b_small1 = AE_LE32(AE_SUB32(d_inp1, d_sign), d_one);
+
+    d_out0 = log_scale_x2(d_inp0, scale_shift);
+    d_out1 = log_scale_x2(d_inp1, scale_shift);
+
+    AE_MOVT32X2(d_out0, d_zero, b_small0);
+    AE_MOVT32X2(d_out1, d_zero, b_small1);
+
+    /* Saturate to the unsigned 16-bit range */
+    b_big0 = AE_LT32(d_u16_max_b, AE_SUB32(d_out0, d_sign));
+    b_big1 = AE_LT32(d_u16_max_b, AE_SUB32(d_out1, d_sign));
+    AE_MOVT32X2(d_out0, d_u16_max, b_big0);
+    AE_MOVT32X2(d_out1, d_u16_max, b_big1);
+
+    d_out16 = AE_SEL16_6420(AE_MOVINT16X4_FROMINT32X2(d_out0), AE_MOVINT16X4_FROMINT32X2(d_out1));
+    AE_SA16X4_IP(d_out16, out_align, (ae_int16x4 *)p_o);
+  }
+  AE_SA64POS_FP(out_align, p_o);
+
+  /* Remainder loop */
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    ae_int32x2 d_inp0, d_out0;
+    UWORD32 value = *p_i++;
+
+    value = (correction_bits < 0) ? (value >> -correction_bits) : (value << correction_bits);
+    if(value > 1)
+    {
+      d_inp0 = AE_MOVDA32(value);
+      d_out0 = log_scale_x2(d_inp0, scale_shift);
+      value = (UWORD32)AE_MOVAD32_L(d_out0);
+    }
+    else
+    {
+      value = 0;
+    }
+    *p_o++ = (value < 0xFFFF) ? value : 0xFFFF;
+  }
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+
+#define NOISE_REDUCTION_BITS 14
+
+/* Unsigned 32-bit compare on signed lanes: flip the sign bit of both operands */
+#define LT_U32(b, x, y) \
+  b = AE_LT32(AE_SUB32(x, AE_MOVDA32(0x80000000)), AE_SUB32(y, AE_MOVDA32(0x80000000)));
+
+/* Lane-wise (uint64)x * y >> NOISE_REDUCTION_BITS, truncated to 32 bits */
+#define MUL_U32_SHIFT(out, x_h, x_l, y_h, y_l) \
+{ \
+  ae_int64 _acc_h, _acc_l; \
+  _acc_h = AE_MUL32U_LL(x_h, y_h); \
+  _acc_l = AE_MUL32U_LL(x_l, y_l); \
+  _acc_h = AE_SRLI64(_acc_h, NOISE_REDUCTION_BITS); \
+  _acc_l = AE_SRLI64(_acc_l, NOISE_REDUCTION_BITS); \
+  out = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(_acc_h), AE_MOVINT32X2_FROMINT64(_acc_l)); \
+}
+
+WORD32 xa_nn_vec_noise_reduction_32_32(UWORD32 * p_signal,
+                                       UWORD32 * __restrict__ p_estimate,
+                                       WORD32  smoothing_bits,
+                                       WORD32  even_smoothing,
+                                       WORD32  odd_smoothing,
+                                       WORD32  min_signal_remaining,
+                                       WORD32  num_channels)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_signal, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_estimate, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_signal, sizeof(UWORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_estimate, sizeof(UWORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((smoothing_bits < 0) || (smoothing_bits > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND(((even_smoothing < 0) || (even_smoothing > (1 << NOISE_REDUCTION_BITS))), -1);
+  XA_NNLIB_ARG_CHK_COND(((odd_smoothing < 0) || (odd_smoothing > (1 << NOISE_REDUCTION_BITS))), -1);
+  XA_NNLIB_ARG_CHK_COND(((min_signal_remaining < 0) || (min_signal_remaining > (1 << NOISE_REDUCTION_BITS))), -1);
+
+  int i;
+  /* Signal and estimate are updated in place, reads always run ahead of writes */
+  UWORD32 *p_sig_rd = p_signal;
+  UWORD32 *p_sig_wr = p_signal;
+  UWORD32 *p_est_rd = p_estimate;
+  UWORD32 *p_est_wr = p_estimate;
+
+  ae_valign sig_rd_align = AE_LA64_PP(p_sig_rd);
+  ae_valign est_rd_align = AE_LA64_PP(p_est_rd);
+  ae_valign sig_wr_align = AE_ZALIGN64();
+  ae_valign est_wr_align = AE_ZALIGN64();
+
+  /* Channel pairs always start at an even index: H lane is even, L lane is odd */
+  ae_int32x2 d_even_smoothing = AE_MOVDA32(even_smoothing);
+  ae_int32x2 d_odd_smoothing = AE_MOVDA32(odd_smoothing);
+  ae_int32x2 d_even_one_minus = AE_MOVDA32((1 << NOISE_REDUCTION_BITS) - even_smoothing);
+  ae_int32x2 d_odd_one_minus = AE_MOVDA32((1 << NOISE_REDUCTION_BITS) - odd_smoothing);
+  ae_int32x2 d_min_signal_remaining = AE_MOVDA32(min_signal_remaining);
+
+  for(i = 0; i < (num_channels >> 1); i++)
+  {
+    ae_int32x2 d_sig, d_est, d_sig_up, d_sig_h, d_sig_up_h, d_est_h;
+    ae_int32x2 d_floor, d_sub;
+    ae_int64 d_acc_h, d_acc_l;
+    xtbool2 b_gt;
+
+    AE_LA32X2_IP(d_sig, sig_rd_align, (ae_int32x2 *)p_sig_rd);
+    AE_LA32X2_IP(d_est, est_rd_align, (ae_int32x2 *)p_est_rd);
+
+    d_sig_up = AE_SLAA32(d_sig, smoothing_bits);
+    d_sig_h = AE_SEL32_HH(d_sig, d_sig);
+    d_sig_up_h = AE_SEL32_HH(d_sig_up, d_sig_up);
+    d_est_h = AE_SEL32_HH(d_est, d_est);
+
+    /* Update the estimate of the noise */
+    d_acc_h = AE_MUL32U_LL(d_sig_up_h, d_even_smoothing);
+    d_acc_l = AE_MUL32U_LL(d_sig_up, d_odd_smoothing);
+    d_acc_h = AE_ADD64(d_acc_h, AE_MUL32U_LL(d_est_h, d_even_one_minus));
+    d_acc_l = AE_ADD64(d_acc_l, AE_MUL32U_LL(d_est, d_odd_one_minus));
+    d_acc_h = AE_SRLI64(d_acc_h, NOISE_REDUCTION_BITS);
+    d_acc_l = AE_SRLI64(d_acc_l, NOISE_REDUCTION_BITS);
+    d_est = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(d_acc_h), AE_MOVINT32X2_FROMINT64(d_acc_l));
+    AE_SA32X2_IP(d_est, est_wr_align, (ae_int32x2 *)p_est_wr);
+
+    /* Make sure that signal - estimate can not be negative */
+    LT_U32(b_gt, d_sig_up, d_est);
+    AE_MOVT32X2(d_est, d_sig_up, b_gt);
+
+    MUL_U32_SHIFT(d_floor, d_sig_h, d_sig, d_min_signal_remaining, d_min_signal_remaining);
+    d_sub = AE_SRLA32(AE_SUB32(d_sig_up, d_est), smoothing_bits);
+
+    LT_U32(b_gt, d_sub, d_floor);
+    AE_MOVT32X2(d_sub, d_floor, b_gt);
+    AE_SA32X2_IP(d_sub, sig_wr_align, (ae_int32x2 *)p_sig_wr);
+  }
+  AE_SA64POS_FP(est_wr_align, p_est_wr);
+  AE_SA64POS_FP(sig_wr_align, p_sig_wr);
+
+  /* Remainder channel, always even */
+  if(num_channels & 1)
+  {
+    UWORD32 signal = *p_sig_rd;
+    UWORD32 one_minus_smoothing = (1 << NOISE_REDUCTION_BITS) - even_smoothing;
+    UWORD32 signal_scaled_up = signal << smoothing_bits;
+    UWORD32 estimate, floor, subtracted;
+
+    estimate = (((UWORD64)signal_scaled_up * (UWORD32)even_smoothing) +
+                ((UWORD64)(*p_est_rd) * one_minus_smoothing)) >> NOISE_REDUCTION_BITS;
+    *p_est_wr = estimate;
+
+    estimate = (estimate > signal_scaled_up) ? signal_scaled_up : estimate;
+    floor = ((UWORD64)signal * (UWORD32)min_signal_remaining) >> NOISE_REDUCTION_BITS;
+    subtracted = (signal_scaled_up - estimate) >> smoothing_bits;
+    *p_sig_wr = (subtracted > floor) ? subtracted : floor;
+  }
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+
+#define PCAN_SNR_BITS     12
+#define PCAN_OUTPUT_BITS  6
+
+/* Position of the most significant set bit (1 based) of an unsigned 32-bit value */
+#define MSB_U32(x) (((x) & 0x80000000) ? 32 : (31 - NSA((WORD32)(x))))
+
+/* Lane-wise low 32 bits of the 32x32 product */
+#define MUL32X2_LO(out, x, y) \
+  out = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_MUL32_HH(x, y)), \
+                    AE_MOVINT32X2_FROMINT64(AE_MUL32_LL(x, y)));
+
+/* Interpolation coefficients of the wide dynamic function for one channel.
+ * Values 0..2 are read straight from the table, which the interpolation
+ * reproduces with zero slope terms. */
+static inline void wide_dynamic_coef(UWORD32 x,
+                                     const WORD16 *p_lut,
+                                     WORD32 *c0,
+                                     WORD32 *c1,
+                                     WORD32 *c2,
+                                     WORD32 *frac)
+{
+  if(x <= 2)
+  {
+    *c0 = p_lut[x];
+    *c1 = 0;
+    *c2 = 0;
+    *frac = 0;
+  }
+  else
+  {
+    WORD32 interval = MSB_U32(x);
+    p_lut += 4 * interval - 6;
+    *frac = ((interval < 11) ? (x << (11 - interval)) : (x >> (interval - 11))) & 0x3FF;
+    *c0 = p_lut[0];
+    *c1 = p_lut[1];
+    *c2 = p_lut[2];
+  }
+}
+
+WORD32 xa_nn_vec_pcan_gain_control_32_32(UWORD32 * p_signal,
+                                         const UWORD32 * __restrict__ p_noise_estimate,
+                                         const WORD16 * __restrict__ p_gain_lut,
+                                         WORD32  snr_shift,
+                                         WORD32  num_channels)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_signal, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_noise_estimate, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gain_lut, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_signal, sizeof(UWORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_noise_estimate, sizeof(UWORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gain_lut, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((snr_shift < 0) || (snr_shift > 63)), -1);
+
+  int i;
+  UWORD32 *p_sig_rd = p_signal;
+  UWORD32 *p_sig_wr = p_signal;
+  const UWORD32 *p_est = p_noise_estimate;
+
+  ae_valign sig_rd_align = AE_LA64_PP(p_sig_rd);
+  ae_valign sig_wr_align = AE_ZALIGN64();
+
+  ae_int32x2 d_round = AE_MOVDA32(1 << 14);
+  ae_int32x2 d_shrink_thr = AE_MOVDA32((2 << PCAN_SNR_BITS) - 0x80000000);
+  ae_int32x2 d_shrink_off = AE_MOVDA32(1 << PCAN_OUTPUT_BITS);
+
+  for(i = 0; i < (num_channels >> 1); i++)
+  {
+    WORD32 c0_0, c1_0, c2_0, frac_0;
+    WORD32 c0_1, c1_1, c2_1, frac_1;
+    ae_int32x2 d_c0, d_c1, d_c2, d_frac, d_gain;
+    ae_int32x2 d_sig, d_snr, d_sq, d_lin;
+    ae_int64 d_acc_h, d_acc_l;
+    xtbool2 b_small;
+
+    /* Table lookup is per channel, the interpolation runs on both lanes */
+    wide_dynamic_coef(p_est[0], p_gain_lut, &c0_0, &c1_0, &c2_0, &frac_0);
+    wide_dynamic_coef(p_est[1], p_gain_lut, &c0_1, &c1_1, &c2_1, &frac_1);
+    p_est += 2;
+
+    d_c0 = AE_MOVDA32X2(c0_0, c0_1);
+    d_c1 = AE_MOVDA32X2(c1_0, c1_1);
+    d_c2 = AE_MOVDA32X2(c2_0, c2_1);
+    d_frac = AE_MOVDA32X2(frac_0, frac_1);
+
+    MUL32X2_LO(d_gain, d_c2, d_frac);
+    d_gain = AE_SRAI32(d_gain, 5);
+    d_gain = AE_ADD32(d_gain, AE_SLAI32(d_c1, 5));
+    MUL32X2_LO(d_gain, d_gain, d_frac);
+    d_gain = AE_SRAI32(AE_ADD32(d_gain, d_round), 15);
+    d_gain = AE_ADD32(d_gain, d_c0);
+    /* Gain is a 16-bit quantity, sign extend as the reference does */
+    d_gain = AE_SRAI32(AE_SLAI32(d_gain, 16), 16);
+
+    /* snr = (signal * gain) >> snr_shift */
+    AE_LA32X2_IP(d_sig, sig_rd_align, (ae_int32x2 *)p_sig_rd);
+    d_acc_h = AE_MUL32U_LL(AE_SEL32_HH(d_sig, d_sig), AE_SEL32_HH(d_gain, d_gain));
+    d_acc_l = AE_MUL32U_LL(d_sig, d_gain);
+    d_acc_h = AE_SRLA64(d_acc_h, snr_shift);
+    d_acc_l = AE_SRLA64(d_acc_l, snr_shift);
+    d_snr = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(d_acc_h), AE_MOVINT32X2_FROMINT64(d_acc_l));
+
+    /* Shrink: quadratic below 2 in Q(PCAN_SNR_BITS), linear above */
+    MUL32X2_LO(d_sq, d_snr, d_snr);
+    d_sq = AE_SRLA32(d_sq, 2 + 2 * PCAN_SNR_BITS - PCAN_OUTPUT_BITS);
+    d_lin = AE_SUB32(AE_SRLI32(d_snr, PCAN_SNR_BITS - PCAN_OUTPUT_BITS), d_shrink_off);
+    b_small = AE_LT32(AE_SUB32(d_snr, AE_MOVDA32(0x80000000)), d_shrink_thr);
+    AE_MOVT32X2(d_lin, d_sq, b_small);
+
+    AE_SA32X2_IP(d_lin, sig_wr_align, (ae_int32x2 *)p_sig_wr);
+  }
+  AE_SA64POS_FP(sig_wr_align, p_sig_wr);
+
+  if(num_channels & 1)
+  {
+    WORD32 c0, c1, c2, frac, result;
+    UWORD32 gain, snr;
+
+    wide_dynamic_coef(*p_est, p_gain_lut, &c0, &c1, &c2, &frac);
+    result = (c2 * frac) >> 5;
+    result += (WORD32)((UWORD32)c1 << 5);
+    result *= frac;
+    result = (result + (1 << 14)) >> 15;
+    result += c0;
+    gain = (WORD16)result;
+
+    snr = ((UWORD64)(*p_sig_rd) * gain) >> snr_shift;
+    if(snr < (2 << PCAN_SNR_BITS))
+    {
+      snr = (snr * snr) >> (2 + 2 * PCAN_SNR_BITS - PCAN_OUTPUT_BITS);
+    }
+    else
+    {
+      snr = (snr >> (PCAN_SNR_BITS - PCAN_OUTPUT_BITS)) - (1 << PCAN_OUTPUT_BITS);
+    }
+    *p_sig_wr = snr;
+  }
+
+  return 0;
+}
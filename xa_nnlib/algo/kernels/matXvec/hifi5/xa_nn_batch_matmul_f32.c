@@ -0,0 +1,244 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_batch_matmul_f32,
+             (
+                FLOAT32 *p_out,
+                const FLOAT32 *p_mat1,
+                const FLOAT32 *p_mat2,
+                WORD32 batch,
+                WORD32 rows1,
+                WORD32 cols1,
+                WORD32 cols2,
+                WORD32 transpose_mat2
+              )
+           )
+#else
+/* p_out (rows1 x cols2) = p_mat1 (rows1 x cols1) * p_mat2 (cols1 x cols2),
+ * 8 output columns are accumulated in registers while walking down mat2 */
+static void batch_matmul_f32_nn(FLOAT32 * __restrict__ p_out,
+                                const FLOAT32 * __restrict__ p_mat1,
+                                const FLOAT32 * __restrict__ p_mat2,
+                                WORD32 rows1,
+                                WORD32 cols1,
+                                WORD32 cols2)
+{
+  int m_itr, n_itr, k_itr;
+  ae_valign b_a, out_a;
+  xtfloatx2 d_a, d_b0, d_b1, d_b2, d_b3;
+  xtfloatx2 acc0, acc1, acc2, acc3;
+
+  for(m_itr = 0; m_itr < rows1; m_itr++)
+  {
+    const FLOAT32 *p_a = &p_mat1[m_itr * cols1];
+    xtfloatx2 *pt_out = (xtfloatx2 *)&p_out[m_itr * cols2];
+    out_a = AE_ZALIGN64();
+
+    for(n_itr = 0; n_itr < (cols2 & ~7); n_itr += 8)
+    {
+      acc0 = acc1 = acc2 = acc3 = (xtfloatx2)0.0f;
+      for(k_itr = 0; k_itr < cols1; k_itr++)
+      {
+        xtfloatx2 *pt_b = (xtfloatx2 *)&p_mat2[k_itr * cols2 + n_itr];
+        b_a = XT_LASX2PP(pt_b);
+        XT_LASX2IP(d_b0, b_a, pt_b);
+        XT_LASX2IP(d_b1, b_a, pt_b);
+        XT_LASX2IP(d_b2, b_a, pt_b);
+        XT_LASX2IP(d_b3, b_a, pt_b);
+        d_a = (xtfloatx2)p_a[k_itr];
+        XT_MADD_SX2(acc0, d_a, d_b0);
+        XT_MADD_SX2(acc1, d_a, d_b1);
+        XT_MADD_SX2(acc2, d_a, d_b2);
+        XT_MADD_SX2(acc3, d_a, d_b3);
+      }
+      XT_SASX2IP(acc0, out_a, pt_out);
+      XT_SASX2IP(acc1, out_a, pt_out);
+      XT_SASX2IP(acc2, out_a, pt_out);
+      XT_SASX2IP(acc3, out_a, pt_out);
+    }
+    for(; n_itr < (cols2 & ~1); n_itr += 2)
+    {
+      acc0 = (xtfloatx2)0.0f;
+      for(k_itr = 0; k_itr < cols1; k_itr++)
+      {
+        xtfloatx2 *pt_b = (xtfloatx2 *)&p_mat2[k_itr * cols2 + n_itr];
+        b_a = XT_LASX2PP(pt_b);
+        XT_LASX2IP(d_b0, b_a, pt_b);
+        d_a = (xtfloatx2)p_a[k_itr];
+        XT_MADD_SX2(acc0, d_a, d_b0);
+      }
+      XT_SASX2IP(acc0, out_a, pt_out);
+    }
+    XT_SASX2POSFP(out_a, pt_out);
+    // Remainder column
+    if(cols2 & 1)
+    {
+      xtfloat acc = XT_CONST_S(0);
+      for(k_itr = 0; k_itr < cols1; k_itr++)
+      {
+        XT_MADD_S(acc, p_a[k_itr], p_mat2[k_itr * cols2 + n_itr]);
+      }
+      *(xtfloat *)pt_out = acc;
+    }
+  }
+}
+
+/* p_out (rows1 x cols2) = p_mat1 (rows1 x cols1) * p_mat2' where p_mat2 is
+ * (cols2 x cols1), 2 x 2 dot products at a time */
+static void batch_matmul_f32_nt(FLOAT32 * __restrict__ p_out,
+                                const FLOAT32 * __restrict__ p_mat1,
+                                const FLOAT32 * __restrict__ p_mat2,
+                                WORD32 rows1,
+                                WORD32 cols1,
+                                WORD32 cols2)
+{
+  int m_itr, n_itr, k_itr;
+  ae_valign a0_a, a1_a, b0_a, b1_a;
+  xtfloatx2 d_a0, d_a1, d_b0, d_b1;
+  xtfloatx2 acc00, acc01, acc10, acc11;
+  xtfloat out00, out01, out10, out11;
+
+  for(m_itr = 0; m_itr < (rows1 & ~1); m_itr += 2)
+  {
+    const FLOAT32 *p_a0 = &p_mat1[m_itr * cols1];
+    const FLOAT32 *p_a1 = p_a0 + cols1;
+    for(n_itr = 0; n_itr < (cols2 & ~1); n_itr += 2)
+    {
+      const FLOAT32 *p_b0 = &p_mat2[n_itr * cols1];
+      const FLOAT32 *p_b1 = p_b0 + cols1;
+      xtfloatx2 *pt_a0 = (xtfloatx2 *)p_a0;
+      xtfloatx2 *pt_a1 = (xtfloatx2 *)p_a1;
+      xtfloatx2 *pt_b0 = (xtfloatx2 *)p_b0;
+      xtfloatx2 *pt_b1 = (xtfloatx2 *)p_b1;
+      a0_a = XT_LASX2PP(pt_a0);
+      a1_a = XT_LASX2PP(pt_a1);
+      b0_a = XT_LASX2PP(pt_b0);
+      b1_a = XT_LASX2PP(pt_b1);
+      acc00 = acc01 = acc10 = acc11 = (xtfloatx2)0.0f;
+      for(k_itr = 0; k_itr < (cols1 >> 1); k_itr++)
+      {
+        XT_LASX2IP(d_a0, a0_a, pt_a0);
+        XT_LASX2IP(d_a1, a1_a, pt_a1);
+        XT_LASX2IP(d_b0, b0_a, pt_b0);
+        XT_LASX2IP(d_b1, b1_a, pt_b1);
+        XT_MADD_SX2(acc00, d_a0, d_b0);
+        XT_MADD_SX2(acc01, d_a0, d_b1);
+        XT_MADD_SX2(acc10, d_a1, d_b0);
+        XT_MADD_SX2(acc11, d_a1, d_b1);
+      }
+      out00 = XT_RADD_SX2(acc00);
+      out01 = XT_RADD_SX2(acc01);
+      out10 = XT_RADD_SX2(acc10);
+      out11 = XT_RADD_SX2(acc11);
+      // Remainder loop for cols1
+      if(cols1 & 1)
+      {
+        k_itr = cols1 - 1;
+        XT_MADD_S(out00, p_a0[k_itr], p_b0[k_itr]);
+        XT_MADD_S(out01, p_a0[k_itr], p_b1[k_itr]);
+        XT_MADD_S(out10, p_a1[k_itr], p_b0[k_itr]);
+        XT_MADD_S(out11, p_a1[k_itr], p_b1[k_itr]);
+      }
+      p_out[m_itr * cols2 + n_itr] = out00;
+      p_out[m_itr * cols2 + n_itr + 1] = out01;
+      p_out[(m_itr + 1) * cols2 + n_itr] = out10;
+      p_out[(m_itr + 1) * cols2 + n_itr + 1] = out11;
+    }
+  }
+
+  // Remaining outputs, one dot product at a time
+  for(m_itr = 0; m_itr < rows1; m_itr++)
+  {
+    n_itr = ((m_itr < (rows1 & ~1)) ? (cols2 & ~1) : 0);
+    for(; n_itr < cols2; n_itr++)
+    {
+      const FLOAT32 *p_a0 = &p_mat1[m_itr * cols1];
+      const FLOAT32 *p_b0 = &p_mat2[n_itr * cols1];
+      xtfloatx2 *pt_a0 = (xtfloatx2 *)p_a0;
+      xtfloatx2 *pt_b0 = (xtfloatx2 *)p_b0;
+      a0_a = XT_LASX2PP(pt_a0);
+      b0_a = XT_LASX2PP(pt_b0);
+      acc00 = (xtfloatx2)0.0f;
+      for(k_itr = 0; k_itr < (cols1 >> 1); k_itr++)
+      {
+        XT_LASX2IP(d_a0, a0_a, pt_a0);
+        XT_LASX2IP(d_b0, b0_a, pt_b0);
+        XT_MADD_SX2(acc00, d_a0, d_b0);
+      }
+      out00 = XT_RADD_SX2(acc00);
+      if(cols1 & 1)
+      {
+        XT_MADD_S(out00, p_a0[cols1 - 1], p_b0[cols1 - 1]);
+      }
+      p_out[m_itr * cols2 + n_itr] = out00;
+    }
+  }
+}
+
+WORD32 xa_nn_batch_matmul_f32(FLOAT32 * __restrict__ p_out,
+                              const FLOAT32 * __restrict__ p_mat1,
+                              const FLOAT32 * __restrict__ p_mat2,
+                              WORD32 batch,
+                              WORD32 rows1,
+                              WORD32 cols1,
+                              WORD32 cols2,
+                              WORD32 transpose_mat2)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat2, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat2, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((batch <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((rows1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+
+  int b_itr;
+  for(b_itr = 0; b_itr < batch; b_itr++)
+  {
+    if(transpose_mat2 == 0)
+    {
+      batch_matmul_f32_nn(p_out, p_mat1, p_mat2, rows1, cols1, cols2);
+    }
+    else
+    {
+      batch_matmul_f32_nt(p_out, p_mat1, p_mat2, rows1, cols1, cols2);
+    }
+    p_out += rows1 * cols2;
+    p_mat1 += rows1 * cols1;
+    p_mat2 += cols1 * cols2;
+  }
+
+  return 0;
+}
+#endif
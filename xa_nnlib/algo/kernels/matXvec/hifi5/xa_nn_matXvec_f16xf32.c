@@ -0,0 +1,326 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "common_fpu.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+/* Weights are IEEE half precision values stored as their 16-bit patterns,
+ * they are widened to single precision in registers and all multiplications
+ * and accumulations are done in single precision. */
+
+#if HAVE_VFPU
+
+/* Loads 4 half precision weights of a row and accumulates their products
+ * with 4 vector elements (y0, y1) into acc */
+#define MAC_ROW_F16X4(acc, p_row, y0, y1) \
+{ \
+  ae_int16x4 _d_h16; \
+  xtfloatx2 _d_x0, _d_x1; \
+  AE_L16X4_IP(_d_h16, p_row, 8); \
+  CVT_F16X4_F32X2X2(_d_x0, _d_x1, _d_h16); \
+  XT_MADD_SX2(acc, _d_x0, y0); \
+  XT_MADD_SX2(acc, _d_x1, y1); \
+}
+
+/* Dot products of 4 consecutive rows with the vector, added to p_acc[0..3] */
+static inline void dot_rows4_f16xf32(FLOAT32 *p_acc,
+    const WORD16 *p_mat, const FLOAT32 *p_vec, int cols, int row_stride)
+{
+  const ae_int16x4 *px0 = (const ae_int16x4 *)p_mat;
+  const ae_int16x4 *px1 = (const ae_int16x4 *)(p_mat + row_stride);
+  const ae_int16x4 *px2 = (const ae_int16x4 *)(p_mat + 2*row_stride);
+  const ae_int16x4 *px3 = (const ae_int16x4 *)(p_mat + 3*row_stride);
+  const xtfloatx2 *py = (const xtfloatx2 *)p_vec;
+  xtfloatx2 acc0, acc1, acc2, acc3;
+  xtfloatx2 y0, y1;
+  int k;
+
+  acc0 = acc1 = acc2 = acc3 = (xtfloatx2)0.0f;
+  for(k = 0; k < (cols >> 2); k++)
+  {
+    XT_LSX2IP(y0, py, 8);
+    XT_LSX2IP(y1, py, 8);
+    MAC_ROW_F16X4(acc0, px0, y0, y1);
+    MAC_ROW_F16X4(acc1, px1, y0, y1);
+    MAC_ROW_F16X4(acc2, px2, y0, y1);
+    MAC_ROW_F16X4(acc3, px3, y0, y1);
+  }
+  p_acc[0] += XT_RADD_SX2(acc0);
+  p_acc[1] += XT_RADD_SX2(acc1);
+  p_acc[2] += XT_RADD_SX2(acc2);
+  p_acc[3] += XT_RADD_SX2(acc3);
+}
+
+/* Dot product of a single row with the vector */
+static inline FLOAT32 dot_row_f16xf32(const WORD16 *p_mat,
+    const FLOAT32 *p_vec, int cols)
+{
+  const ae_int16x4 *px0 = (const ae_int16x4 *)p_mat;
+  const xtfloatx2 *py = (const xtfloatx2 *)p_vec;
+  xtfloatx2 acc0, y0, y1;
+  int k;
+
+  acc0 = (xtfloatx2)0.0f;
+  for(k = 0; k < (cols >> 2); k++)
+  {
+    XT_LSX2IP(y0, py, 8);
+    XT_LSX2IP(y1, py, 8);
+    MAC_ROW_F16X4(acc0, px0, y0, y1);
+  }
+  return XT_RADD_SX2(acc0);
+}
+
+#endif /* HAVE_VFPU */
+
+/*-------------------------------------------------------------------------
+  xa_nn_matXvec_f16xf32_f32
+  This function computes the dual matrix vector multiplication with added
+  bias vector value. Matrices hold half precision weights, vectors, bias
+  and output are 32 bit float numbers.
+
+  Precision:
+  f16xf32_f32  16-bit float matrices, 32-bit float vectors and output.
+
+  Input:
+  p_mat1         first matrix pointer,                16-bit float
+  p_mat2         second matrix pointer (optional),    16-bit float
+  p_vec1         first vector pointer,                32-bit float
+  p_vec2         second vector pointer (optional),    32-bit float
+  p_bias         bias vector pointer (optional),      32-bit float
+  rows           number of rows,                      32 bit integer
+  cols1          number of columns of first matrix,   32 bit integer
+  cols2          number of columns of second matrix,  32 bit integer
+  row_stride1    row offset of first matrix,          32 bit integer
+  row_stride2    row offset of second matrix,         32 bit integer
+  Output:
+  p_out          result vector pointer,               32-bit float
+
+  Restriction:
+  p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias should not overlap in the
+  memory space
+  p_mat1, p_mat2, p_vec1, p_vec2 should be 8 byte boundaries aligned
+  cols1, cols2, row_stride1, row_stride2 should be multiple of 4
+-------------------------------------------------------------------------*/
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matXvec_f16xf32_f32,(
+    FLOAT32 * p_out,
+    const WORD16 * p_mat1,
+    const WORD16 * p_mat2,
+    const FLOAT32 * p_vec1,
+    const FLOAT32 * p_vec2,
+    const FLOAT32 * p_bias,
+    WORD32 rows, WORD32 cols1, WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2))
+#else
+WORD32 xa_nn_matXvec_f16xf32_f32(
+    FLOAT32 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const FLOAT32 * __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_vec2,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows, WORD32 cols1, WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2)
+{
+  int m_itr, i;
+  FLOAT32 acc[4];
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, 8, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, 8, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0 || (cols1 & 3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1 || (row_stride1 & 3) != 0), -1);
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, 8, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, 8, -1);
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0 || (cols2 & 3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2 || (row_stride2 & 3) != 0), -1);
+  }
+
+  for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+  {
+    for(i = 0; i < 4; i++)
+    {
+      acc[i] = (p_bias != NULL) ? p_bias[m_itr + i] : 0.0f;
+    }
+    dot_rows4_f16xf32(acc, &p_mat1[m_itr * row_stride1], p_vec1, cols1, row_stride1);
+    if(p_mat2 != NULL)
+    {
+      dot_rows4_f16xf32(acc, &p_mat2[m_itr * row_stride2], p_vec2, cols2, row_stride2);
+    }
+    for(i = 0; i < 4; i++)
+    {
+      p_out[m_itr + i] = acc[i];
+    }
+  }
+
+  for(; m_itr < rows; m_itr++)
+  {
+    acc[0] = (p_bias != NULL) ? p_bias[m_itr] : 0.0f;
+    acc[0] += dot_row_f16xf32(&p_mat1[m_itr * row_stride1], p_vec1, cols1);
+    if(p_mat2 != NULL)
+    {
+      acc[0] += dot_row_f16xf32(&p_mat2[m_itr * row_stride2], p_vec2, cols2);
+    }
+    p_out[m_itr] = acc[0];
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU */
+
+/*-------------------------------------------------------------------------
+  xa_nn_matXvec_batch_f16xf32_f32
+  This function computes the matrix multiplication of a half precision
+  weight matrix with a batch of 32 bit float vectors, with added bias.
+  Each chunk of weights is converted once and reused across 4 vectors.
+
+  Restriction:
+  p_mat1 and all vectors should be 8 byte boundaries aligned
+  cols1, row_stride1 should be multiple of 4
+-------------------------------------------------------------------------*/
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matXvec_batch_f16xf32_f32,(
+    FLOAT32 ** __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    FLOAT32 ** __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count))
+#else
+WORD32 xa_nn_matXvec_batch_f16xf32_f32(
+    FLOAT32 ** __restrict__ p_out,          /* array of output pointers */
+    const WORD16 * __restrict__ p_mat1,     /* matrix1: rows x cols1 */
+    FLOAT32 ** __restrict__ p_vec1,         /* vec1: cols1 x 1 */
+    const FLOAT32 * __restrict__ p_bias,    /* bias: rows x 1 */
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,                     /* row stride for matrix1 */
+    WORD32 vec_count)                       /* number of vectors */
+{
+  int m_itr, c_itr, vec_itr;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, 8, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0 || (cols1 & 3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1 || (row_stride1 & 3) != 0), -1);
+
+  for(vec_itr = 0; vec_itr < (vec_count & ~3); vec_itr += 4)
+  {
+    for(m_itr = 0; m_itr < rows; m_itr += 2)
+    {
+      /* Last odd row is computed twice into the same output */
+      int row1 = (m_itr + 1 < rows) ? (m_itr + 1) : m_itr;
+      const ae_int16x4 *px0 = (const ae_int16x4 *)&p_mat1[m_itr * row_stride1];
+      const ae_int16x4 *px1 = (const ae_int16x4 *)&p_mat1[row1 * row_stride1];
+      const xtfloatx2 *py0 = (const xtfloatx2 *)p_vec1[vec_itr + 0];
+      const xtfloatx2 *py1 = (const xtfloatx2 *)p_vec1[vec_itr + 1];
+      const xtfloatx2 *py2 = (const xtfloatx2 *)p_vec1[vec_itr + 2];
+      const xtfloatx2 *py3 = (const xtfloatx2 *)p_vec1[vec_itr + 3];
+      xtfloatx2 acc00, acc01, acc02, acc03;
+      xtfloatx2 acc10, acc11, acc12, acc13;
+      xtfloatx2 x00, x01, x10, x11;
+      xtfloatx2 y0, y1;
+      ae_int16x4 d_h16;
+
+      acc00 = acc01 = acc02 = acc03 = (xtfloatx2)0.0f;
+      acc10 = acc11 = acc12 = acc13 = (xtfloatx2)0.0f;
+      for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+      {
+        AE_L16X4_IP(d_h16, px0, 8);
+        CVT_F16X4_F32X2X2(x00, x01, d_h16);
+        AE_L16X4_IP(d_h16, px1, 8);
+        CVT_F16X4_F32X2X2(x10, x11, d_h16);
+
+        XT_LSX2IP(y0, py0, 8); XT_LSX2IP(y1, py0, 8);
+        MADD_SX2X2(acc00, acc10, x00, x10, y0, y0);
+        MADD_SX2X2(acc00, acc10, x01, x11, y1, y1);
+        XT_LSX2IP(y0, py1, 8); XT_LSX2IP(y1, py1, 8);
+        MADD_SX2X2(acc01, acc11, x00, x10, y0, y0);
+        MADD_SX2X2(acc01, acc11, x01, x11, y1, y1);
+        XT_LSX2IP(y0, py2, 8); XT_LSX2IP(y1, py2, 8);
+        MADD_SX2X2(acc02, acc12, x00, x10, y0, y0);
+        MADD_SX2X2(acc02, acc12, x01, x11, y1, y1);
+        XT_LSX2IP(y0, py3, 8); XT_LSX2IP(y1, py3, 8);
+        MADD_SX2X2(acc03, acc13, x00, x10, y0, y0);
+        MADD_SX2X2(acc03, acc13, x01, x11, y1, y1);
+      }
+      p_out[vec_itr + 0][m_itr] = XT_RADD_SX2(acc00) + p_bias[m_itr];
+      p_out[vec_itr + 1][m_itr] = XT_RADD_SX2(acc01) + p_bias[m_itr];
+      p_out[vec_itr + 2][m_itr] = XT_RADD_SX2(acc02) + p_bias[m_itr];
+      p_out[vec_itr + 3][m_itr] = XT_RADD_SX2(acc03) + p_bias[m_itr];
+      p_out[vec_itr + 0][row1] = XT_RADD_SX2(acc10) + p_bias[row1];
+      p_out[vec_itr + 1][row1] = XT_RADD_SX2(acc11) + p_bias[row1];
+      p_out[vec_itr + 2][row1] = XT_RADD_SX2(acc12) + p_bias[row1];
+      p_out[vec_itr + 3][row1] = XT_RADD_SX2(acc13) + p_bias[row1];
+    }
+  }
+
+  /* Remaining vectors */
+  for(; vec_itr < vec_count; vec_itr++)
+  {
+    FLOAT32 *p_dst = p_out[vec_itr];
+    const FLOAT32 *p_src = p_vec1[vec_itr];
+    FLOAT32 acc[4];
+
+    for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+    {
+      acc[0] = p_bias[m_itr + 0];
+      acc[1] = p_bias[m_itr + 1];
+      acc[2] = p_bias[m_itr + 2];
+      acc[3] = p_bias[m_itr + 3];
+      dot_rows4_f16xf32(acc, &p_mat1[m_itr * row_stride1], p_src, cols1, row_stride1);
+      p_dst[m_itr + 0] = acc[0];
+      p_dst[m_itr + 1] = acc[1];
+      p_dst[m_itr + 2] = acc[2];
+      p_dst[m_itr + 3] = acc[3];
+    }
+    for(; m_itr < rows; m_itr++)
+    {
+      p_dst[m_itr] = p_bias[m_itr] + dot_row_f16xf32(&p_mat1[m_itr * row_stride1], p_src, cols1);
+    }
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU */
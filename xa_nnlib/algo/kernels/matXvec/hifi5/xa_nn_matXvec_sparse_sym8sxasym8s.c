@@ -0,0 +1,354 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include <string.h>
+
+/*
+ * Block-sparse weight format (all offsets in bytes from p_packed):
+ *
+ *   WORD32 row_sum[rows]                   sum of the weights of each row
+ *   UWORD8 mask[rows][mask_bytes]          bit j of a row set => block j is non-zero
+ *   WORD8  blocks[nnz_blocks][block_size]  non-zero blocks, row-major
+ *
+ * A block is block_size consecutive weights of a row, mask_bytes is
+ * ((cols / block_size) + 7) >> 3. row_sum lets the kernel apply vec1_zero_bias
+ * once per row instead of once per loaded vector element.
+ */
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+#define SPARSE_MASK_BYTES(cols, block_size) ((((cols) / (block_size)) + 7) >> 3)
+
+static WORD32 sparse_pack_chk_params
+    (WORD32 rows
+    ,WORD32 cols
+    ,WORD32 row_stride
+    ,WORD32 block_size
+    )
+{
+  if(rows <= 0 || cols <= 0 || row_stride < cols)
+    return -1;
+  if(block_size != 4 && block_size != 8 && block_size != 16)
+    return -1;
+  if(cols % block_size)
+    return -1;
+  return 0;
+}
+
+static inline WORD32 sparse_block_is_zero
+    (const WORD8 *p_blk
+    ,WORD32 block_size
+    )
+{
+  int i;
+  for(i = 0; i < block_size; i++)
+  {
+    if(p_blk[i] != 0)
+      return 0;
+  }
+  return 1;
+}
+
+WORD32 xa_nn_matXvec_sparse_pack_getsize_sym8s(
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 block_size)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((sparse_pack_chk_params(rows, cols, row_stride, block_size) != 0), -1);
+
+  int m_itr, b_itr;
+  int num_blocks = cols / block_size;
+  int nnz_blocks = 0;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const WORD8 *p_row = p_mat + m_itr * row_stride;
+    for(b_itr = 0; b_itr < num_blocks; b_itr++)
+    {
+      nnz_blocks += !sparse_block_is_zero(&p_row[b_itr * block_size], block_size);
+    }
+  }
+
+  return rows * (sizeof(WORD32) + SPARSE_MASK_BYTES(cols, block_size)) + nnz_blocks * block_size;
+}
+
+WORD32 xa_nn_matXvec_sparse_pack_sym8s(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 block_size)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((sparse_pack_chk_params(rows, cols, row_stride, block_size) != 0), -1);
+
+  int m_itr, b_itr, i;
+  int num_blocks = cols / block_size;
+  int mask_bytes = SPARSE_MASK_BYTES(cols, block_size);
+
+  WORD32 *p_row_sum = (WORD32 *)p_packed;
+  UWORD8 *p_mask = (UWORD8 *)(p_row_sum + rows);
+  WORD8 *p_blk = (WORD8 *)(p_mask + rows * mask_bytes);
+
+  memset(p_mask, 0, rows * mask_bytes);
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const WORD8 *p_row = p_mat + m_itr * row_stride;
+    WORD32 row_sum = 0;
+    for(b_itr = 0; b_itr < num_blocks; b_itr++)
+    {
+      const WORD8 *p_src = &p_row[b_itr * block_size];
+      if(sparse_block_is_zero(p_src, block_size))
+        continue;
+
+      p_mask[b_itr >> 3] |= (UWORD8)(1 << (b_itr & 7));
+      for(i = 0; i < block_size; i++)
+      {
+        row_sum += p_src[i];
+        *p_blk++ = p_src[i];
+      }
+    }
+    p_row_sum[m_itr] = row_sum;
+    p_mask += mask_bytes;
+  }
+
+  return (WORD32)(p_blk - p_packed);
+}
+
+/* Dot product of the non-zero blocks of one row with the vector, block_size = 4 */
+static inline ae_int64 sparse_dot_row_bs4
+    (const WORD8 **pp_blk
+    ,const UWORD8 *p_mask
+    ,const WORD8 *p_vec
+    ,WORD32 num_blocks
+    )
+{
+  int b_itr;
+  ae_int64 acc = AE_ZERO64();
+  ae_int16x4 d_mat, d_vec;
+  const WORD8 *p_blk = *pp_blk;
+  ae_valign blk_align = AE_LA64_PP(p_blk);
+
+  for(b_itr = 0; b_itr < num_blocks; b_itr += 8)
+  {
+    UWORD32 mask = p_mask[b_itr >> 3];
+    const WORD8 *p_v = p_vec + b_itr * 4;
+    /* Skip 8 zero blocks at once */
+    while(mask)
+    {
+      if(mask & 1)
+      {
+        const WORD8 *p_v0 = p_v;
+        ae_valign vec_align = AE_LA64_PP(p_v0);
+        AE_LA8X4S_IP(d_mat, blk_align, p_blk);
+        AE_LA8X4S_IP(d_vec, vec_align, p_v0);
+        AE_MULAAAAQ16(acc, d_vec, d_mat);
+      }
+      mask >>= 1;
+      p_v += 4;
+    }
+  }
+
+  *pp_blk = p_blk;
+  return acc;
+}
+
+/* Dot product of the non-zero blocks of one row with the vector, block_size = 8 */
+static inline ae_int64 sparse_dot_row_bs8
+    (const WORD8 **pp_blk
+    ,const UWORD8 *p_mask
+    ,const WORD8 *p_vec
+    ,WORD32 num_blocks
+    )
+{
+  int b_itr;
+  ae_int64 acc0 = AE_ZERO64();
+  ae_int64 acc1 = AE_ZERO64();
+  ae_int8x8 d_mat, d_vec;
+  ae_int8x8 *p_blk = (ae_int8x8 *)*pp_blk;
+  ae_valign blk_align = AE_LA64_PP(p_blk);
+
+  for(b_itr = 0; b_itr < num_blocks; b_itr += 8)
+  {
+    UWORD32 mask = p_mask[b_itr >> 3];
+    const WORD8 *p_v = p_vec + b_itr * 8;
+    while(mask)
+    {
+      if(mask & 1)
+      {
+        ae_int8x8 *p_v0 = (ae_int8x8 *)p_v;
+        ae_valign vec_align = AE_LA64_PP(p_v0);
+        AE_LA8X8_IP(d_mat, blk_align, p_blk);
+        AE_LA8X8_IP(d_vec, vec_align, p_v0);
+        AE_MULAAAA2Q8(acc0, acc1, d_vec, d_mat);
+      }
+      mask >>= 1;
+      p_v += 8;
+    }
+  }
+
+  *pp_blk = (const WORD8 *)p_blk;
+  return AE_ADD64(acc0, acc1);
+}
+
+/* Dot product of the non-zero blocks of one row with the vector, block_size = 16 */
+static inline ae_int64 sparse_dot_row_bs16
+    (const WORD8 **pp_blk
+    ,const UWORD8 *p_mask
+    ,const WORD8 *p_vec
+    ,WORD32 num_blocks
+    )
+{
+  int b_itr;
+  ae_int64 acc0 = AE_ZERO64();
+  ae_int64 acc1 = AE_ZERO64();
+  ae_int8x8 d_mat0, d_mat1, d_vec0, d_vec1;
+  ae_int8x16 *p_blk = (ae_int8x16 *)*pp_blk;
+  ae_valignx2 blk_align = AE_LA128_PP(p_blk);
+
+  for(b_itr = 0; b_itr < num_blocks; b_itr += 8)
+  {
+    UWORD32 mask = p_mask[b_itr >> 3];
+    const WORD8 *p_v = p_vec + b_itr * 16;
+    while(mask)
+    {
+      if(mask & 1)
+      {
+        ae_int8x16 *p_v0 = (ae_int8x16 *)p_v;
+        ae_valignx2 vec_align = AE_LA128_PP(p_v0);
+        AE_LA8X8X2_IP(d_mat0, d_mat1, blk_align, p_blk);
+        AE_LA8X8X2_IP(d_vec0, d_vec1, vec_align, p_v0);
+        AE_MULAAAA2Q8(acc0, acc1, d_vec0, d_mat0);
+        AE_MULAAAA2Q8(acc0, acc1, d_vec1, d_mat1);
+      }
+      mask >>= 1;
+      p_v += 16;
+    }
+  }
+
+  *pp_blk = (const WORD8 *)p_blk;
+  return AE_ADD64(acc0, acc1);
+}
+
+WORD32 xa_nn_matXvec_sparse_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 block_size,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((sparse_pack_chk_params(rows, cols1, cols1, block_size) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  int m_itr;
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[m_itr] < -31 || p_out_shift[m_itr] > 31), -1);
+  }
+
+  int num_blocks = cols1 / block_size;
+  int mask_bytes = SPARSE_MASK_BYTES(cols1, block_size);
+
+  const WORD32 *p_row_sum = (const WORD32 *)p_packed;
+  const UWORD8 *p_mask = (const UWORD8 *)(p_row_sum + rows);
+  const WORD8 *p_blk = (const WORD8 *)(p_mask + rows * mask_bytes);
+
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+  ae_int8x8 out8_0;
+  WORD8 *p_dst_0 = p_out;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    ae_int64 acc64;
+    ae_int32x2 acc_row0_vec0;
+    int left_shift, right_shift;
+
+    if(block_size == 16)
+    {
+      acc64 = sparse_dot_row_bs16(&p_blk, p_mask, p_vec1, num_blocks);
+    }
+    else if(block_size == 8)
+    {
+      acc64 = sparse_dot_row_bs8(&p_blk, p_mask, p_vec1, num_blocks);
+    }
+    else
+    {
+      acc64 = sparse_dot_row_bs4(&p_blk, p_mask, p_vec1, num_blocks);
+    }
+    p_mask += mask_bytes;
+
+    /* Zero blocks contribute nothing, the vector zero bias is applied through the row sum */
+    acc_row0_vec0 = AE_SAT32X2(acc64, acc64);
+    acc_row0_vec0 = AE_ADD32S(acc_row0_vec0, AE_MOVDA32(vec1_zero_bias * p_row_sum[m_itr]));
+    if(p_bias != NULL)
+    {
+      acc_row0_vec0 = AE_ADD32S(acc_row0_vec0, AE_MOVDA32(p_bias[m_itr]));
+    }
+
+    left_shift = p_out_shift[m_itr] < 0 ? 0 : p_out_shift[m_itr];
+    right_shift = p_out_shift[m_itr] > 0 ? 0 : -p_out_shift[m_itr];
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row0_vec0, p_out_multiplier[m_itr], left_shift, right_shift);
+    acc_row0_vec0 = AE_ADD32S(acc_row0_vec0, out_zero_bias);
+    AE_MINMAX32(acc_row0_vec0, min_int8, max_int8);
+    out8_0 = AE_MOVINT8X8_FROMINT32X2(acc_row0_vec0);
+    AE_S8_0_IP(out8_0, (ae_int8 *) p_dst_0, 1);
+  }
+
+  return 0;
+}
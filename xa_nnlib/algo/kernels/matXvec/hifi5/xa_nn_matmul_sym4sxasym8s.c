@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+/*
+ * Packed sym4s weight format:
+ * Every row is split into groups of 16 weights, the last group is zero padded.
+ * A group is stored in 8 bytes, byte j holds weight j in the low nibble and
+ * weight j+8 in the high nibble. With this layout the low and high nibbles of
+ * one 8 byte load line up with two consecutive 8 byte vector loads, so no
+ * shuffles are needed to unpack in registers. Row size in bytes is
+ * ((cols + 15) >> 4) * 8, rows are stored back to back.
+ */
+
+#define SYM4S_GROUP_SIZE 16
+#define SYM4S_ROW_BYTES(cols) ((((cols) + SYM4S_GROUP_SIZE - 1) >> 4) * (SYM4S_GROUP_SIZE / 2))
+
+/* Unpacks 16 int4 weights into two int8x8, each weight scaled by 16 */
+#define UNPACK_SYM4S_X16(lo, hi, packed) \
+{ \
+  ae_int32x2 _raw = AE_MOVINT32X2_FROMINT8X8(packed); \
+  hi = AE_MOVINT8X8_FROMINT32X2(AE_AND32(_raw, AE_MOVDA32(0xF0F0F0F0))); \
+  lo = AE_MOVINT8X8_FROMINT32X2(AE_AND32(AE_SLAI32(_raw, 4), AE_MOVDA32(0xF0F0F0F0))); \
+}
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+WORD32 xa_nn_matXvec_sym4s_pack_getsize_sym8s(
+    WORD32 rows,
+    WORD32 cols)
+{
+  XA_NNLIB_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_CHK_COND((cols <= 0), -1);
+
+  return rows * SYM4S_ROW_BYTES(cols);
+}
+
+WORD32 xa_nn_matXvec_sym4s_pack_sym8s(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, 8, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+
+  int m_itr, g_itr, j;
+  int num_groups = (cols + SYM4S_GROUP_SIZE - 1) >> 4;
+  UWORD8 *p_dst = (UWORD8 *)p_packed;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const WORD8 *p_row = p_mat + m_itr * row_stride;
+    for(g_itr = 0; g_itr < num_groups; g_itr++)
+    {
+      int col0 = g_itr * SYM4S_GROUP_SIZE;
+      for(j = 0; j < (SYM4S_GROUP_SIZE / 2); j++)
+      {
+        int lo = (col0 + j < cols) ? p_row[col0 + j] : 0;
+        int hi = (col0 + j + 8 < cols) ? p_row[col0 + j + 8] : 0;
+        /* Weights must already be quantized to the int4 range */
+        if(lo < -8 || lo > 7 || hi < -8 || hi > 7)
+          return -1;
+        *p_dst++ = (UWORD8)((lo & 0xF) | ((hi & 0xF) << 4));
+      }
+    }
+  }
+
+  return (WORD32)(p_dst - (UWORD8 *)p_packed);
+}
+
+WORD32 xa_nn_matmul_per_chan_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, 8, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count > 1 && vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count > 1 && out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((rows > 1 && out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  int itr = 0;
+  for(itr=0; itr<rows; itr++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  int m_itr, vec_itr, g_itr, ii;
+  int row_bytes = SYM4S_ROW_BYTES(cols1);
+  int num_groups = row_bytes >> 3;
+  ae_int8x8 neg_vec_bias = AE_MOVDA8((WORD8)-vec1_zero_bias);
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int p_left_mult[4], p_right_mult[4], p_out_mult[4], p_row_bias[4];
+    const ae_int8x8 *p_mat1_row[4];
+
+    /* Rows beyond the end are clamped to the last row, their outputs are not stored */
+    for(ii = 0; ii < 4; ii++)
+    {
+      int row = (m_itr + ii < rows) ? (m_itr + ii) : (rows - 1);
+      p_mat1_row[ii] = (const ae_int8x8 *)(p_mat1 + row * row_bytes);
+      p_row_bias[ii] = (p_bias != NULL) ? p_bias[row] : 0;
+      p_left_mult[ii] = p_out_shift[row] < 0 ? 1 : (1 << p_out_shift[row]);
+      p_right_mult[ii] = p_out_shift[row] > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + p_out_shift[row]));
+      p_out_mult[ii] = -p_out_multiplier[row];
+    }
+
+    ae_int32x2 l_mult_01 = AE_MOVDA32X2(p_left_mult[0], p_left_mult[1]);
+    ae_int32x2 l_mult_23 = AE_MOVDA32X2(p_left_mult[2], p_left_mult[3]);
+    ae_int32x2 r_mult_01 = AE_MOVDA32X2(p_right_mult[0], p_right_mult[1]);
+    ae_int32x2 r_mult_23 = AE_MOVDA32X2(p_right_mult[2], p_right_mult[3]);
+    ae_int32x2 out_multiplier_01 = AE_MOVDA32X2(p_out_mult[0], p_out_mult[1]);
+    ae_int32x2 out_multiplier_23 = AE_MOVDA32X2(p_out_mult[2], p_out_mult[3]);
+    ae_int32x2 d_bias_01 = AE_MOVDA32X2(p_row_bias[0], p_row_bias[1]);
+    ae_int32x2 d_bias_23 = AE_MOVDA32X2(p_row_bias[2], p_row_bias[3]);
+    int valid_rows = (rows - m_itr) < 4 ? (rows - m_itr) : 4;
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc_row0_vec0 = ZERO32;
+      ae_int32x2 acc_row1_vec0 = ZERO32;
+      const ae_int8x8 *p_mat1_0 = p_mat1_row[0];
+      const ae_int8x8 *p_mat1_1 = p_mat1_row[1];
+      const ae_int8x8 *p_mat1_2 = p_mat1_row[2];
+      const ae_int8x8 *p_mat1_3 = p_mat1_row[3];
+      ae_int8x16 *p_vec_0 = (ae_int8x16 *)(p_vec1 + vec_itr * vec_offset);
+      ae_valignx2 align_p_vec0 = AE_LA128_PP(p_vec_0);
+
+      for(g_itr = 0; g_itr < num_groups; g_itr++)
+      {
+        ae_int8x8 vec0_batch_0, vec0_batch_1;
+        ae_int16x4 wvec0_0_0, wvec0_0_1, wvec0_1_0, wvec0_1_1;
+        ae_int8x8 mat1_row0, mat1_row1, mat1_row2, mat1_row3;
+        ae_int8x8 mat1_row0_lo, mat1_row1_lo, mat1_row2_lo, mat1_row3_lo;
+        ae_int8x8 mat1_row0_hi, mat1_row1_hi, mat1_row2_hi, mat1_row3_hi;
+
+        /* Padded weights of the last group are zero, so the vector tail needs no masking */
+        AE_LA8X8X2_IP(vec0_batch_0, vec0_batch_1, align_p_vec0, p_vec_0);
+        AE_SUBW8(wvec0_0_0, wvec0_0_1, vec0_batch_0, neg_vec_bias);
+        AE_SUBW8(wvec0_1_0, wvec0_1_1, vec0_batch_1, neg_vec_bias);
+
+        AE_L8X8_IP(mat1_row0, p_mat1_0, 8);
+        AE_L8X8_IP(mat1_row1, p_mat1_1, 8);
+        AE_L8X8_IP(mat1_row2, p_mat1_2, 8);
+        AE_L8X8_IP(mat1_row3, p_mat1_3, 8);
+
+        UNPACK_SYM4S_X16(mat1_row0_lo, mat1_row0_hi, mat1_row0);
+        UNPACK_SYM4S_X16(mat1_row1_lo, mat1_row1_hi, mat1_row1);
+        UNPACK_SYM4S_X16(mat1_row2_lo, mat1_row2_hi, mat1_row2);
+        UNPACK_SYM4S_X16(mat1_row3_lo, mat1_row3_hi, mat1_row3);
+
+        AE_MULA8Q8X16(acc_row0_vec0, acc_row1_vec0, mat1_row0_lo, mat1_row1_lo, mat1_row2_lo, mat1_row3_lo, wvec0_0_0, wvec0_0_1);
+        AE_MULA8Q8X16(acc_row0_vec0, acc_row1_vec0, mat1_row0_hi, mat1_row1_hi, mat1_row2_hi, mat1_row3_hi, wvec0_1_0, wvec0_1_1);
+      }
+
+      /* Remove the x16 scaling of the unpacked weights, the sums are exact multiples of 16 */
+      acc_row0_vec0 = AE_ADD32S(AE_SRAI32(acc_row0_vec0, 4), d_bias_01);
+      acc_row1_vec0 = AE_ADD32S(AE_SRAI32(acc_row1_vec0, 4), d_bias_23);
+
+      ae_int16x4 out_0;
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+
+      WORD8 *p_dst_0 = p_out + vec_itr * out_offset + m_itr * out_stride;
+      p_dst_0[0] = (WORD8)AE_MOVAD16_3(out_0);
+      if(valid_rows > 1) p_dst_0[out_stride] = (WORD8)AE_MOVAD16_2(out_0);
+      if(valid_rows > 2) p_dst_0[2 * out_stride] = (WORD8)AE_MOVAD16_1(out_0);
+      if(valid_rows > 3) p_dst_0[3 * out_stride] = (WORD8)AE_MOVAD16_0(out_0);
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  return xa_nn_matmul_per_chan_sym4sxasym8s_asym8s(p_out,
+                                                   p_mat1,
+                                                   p_vec1,
+                                                   p_bias,
+                                                   rows,
+                                                   cols1,
+                                                   1,
+                                                   cols1,
+                                                   rows,
+                                                   1,
+                                                   vec1_zero_bias,
+                                                   p_out_multiplier,
+                                                   p_out_shift,
+                                                   out_zero_bias);
+}
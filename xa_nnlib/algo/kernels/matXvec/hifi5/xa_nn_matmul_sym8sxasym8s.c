@@ -21,6 +21,7 @@
 ******************************************************************************/
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include <string.h>
 
 #define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
   inp = AE_SLAA32(inp, left_shift); \
@@ -2460,3 +2461,625 @@ WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
   }
     return 0;
 }
+
+#define BATCH_MATMUL_ALIGNMENT    16
+#define BATCH_MATMUL_ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
+
+/* Scratch layout: ones vector (row sums via the dot-product kernels),
+ * per-row correction of mat1, per-column correction of mat2 and, when mat2
+ * is not transposed, a transposed copy of one mat2 batch. */
+WORD32 xa_nn_batch_matmul_asym8sxasym8s_asym8s_getsize(
+    WORD32 rows1,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 transpose_mat2)
+{
+  XA_NNLIB_CHK_COND((rows1 <= 0), -1);
+  XA_NNLIB_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_CHK_COND((cols2 <= 0), -1);
+
+  WORD32 scratch_size = 0;
+  scratch_size += BATCH_MATMUL_ALIGNED_SIZE(cols1 + 16, BATCH_MATMUL_ALIGNMENT);
+  scratch_size += BATCH_MATMUL_ALIGNED_SIZE(rows1 * sizeof(WORD32), BATCH_MATMUL_ALIGNMENT);
+  scratch_size += BATCH_MATMUL_ALIGNED_SIZE(cols2 * sizeof(WORD32), BATCH_MATMUL_ALIGNMENT);
+  if(transpose_mat2 == 0)
+  {
+    scratch_size += BATCH_MATMUL_ALIGNED_SIZE(cols1 * cols2, BATCH_MATMUL_ALIGNMENT);
+  }
+  return scratch_size + BATCH_MATMUL_ALIGNMENT;
+}
+
+/* Sum of each row of an int8 matrix, using a vector of ones as the second
+ * operand of the dot-product kernels */
+static inline void _xa_nn_batch_matmul_row_sums
+    (WORD32*      p_sum
+    ,const WORD8* p_mat
+    ,WORD8*       p_ones
+    ,WORD32       rows
+    ,WORD32       cols
+    )
+{
+  int m_itr;
+  for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+  {
+    ae_int32x2 sum_01 = AE_ZERO32();
+    ae_int32x2 sum_23 = AE_ZERO32();
+    _xa_nn_dot_product_4_rows_1_vecs_unaligned
+      (&sum_01
+       ,&sum_23
+       ,(ae_int8x8 *)&p_mat[m_itr * cols]
+       ,(ae_int8 *)p_ones
+       ,cols
+       ,cols
+      );
+    p_sum[m_itr + 0] = AE_MOVAD32_H(sum_01);
+    p_sum[m_itr + 1] = AE_MOVAD32_L(sum_01);
+    p_sum[m_itr + 2] = AE_MOVAD32_H(sum_23);
+    p_sum[m_itr + 3] = AE_MOVAD32_L(sum_23);
+  }
+  for(; m_itr < rows; m_itr++)
+  {
+    ae_int32x2 sum_0 = AE_ZERO32();
+    ae_int32x2 sum_1 = AE_ZERO32();
+    _xa_nn_dot_product_1_rows_1_vecs_unaligned
+      (&sum_0
+       ,&sum_1
+       ,(ae_int8x8 *)&p_mat[m_itr * cols]
+       ,(ae_int8 *)p_ones
+       ,cols
+      );
+    p_sum[m_itr] = AE_MOVAD32_H(sum_0);
+  }
+}
+
+WORD32 xa_nn_batch_matmul_asym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    WORD32 batch,
+    WORD32 rows1,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 transpose_mat2,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    VOID   * __restrict__ p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat2, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((batch <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((rows1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((mat1_zero_bias < -127 || mat1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((mat2_zero_bias < -127 || mat2_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  int b_itr, m_itr, n_itr, k_itr;
+
+  /* Scratch allocation */
+  WORD8 *p_ones = (WORD8 *)(((unsigned)p_scratch + (BATCH_MATMUL_ALIGNMENT - 1)) & ~(BATCH_MATMUL_ALIGNMENT - 1));
+  WORD32 *p_row_adj = (WORD32 *)(p_ones + BATCH_MATMUL_ALIGNED_SIZE(cols1 + 16, BATCH_MATMUL_ALIGNMENT));
+  WORD32 *p_col_adj = (WORD32 *)((WORD8 *)p_row_adj + BATCH_MATMUL_ALIGNED_SIZE(rows1 * sizeof(WORD32), BATCH_MATMUL_ALIGNMENT));
+  WORD8 *p_mat2_t = (WORD8 *)p_col_adj + BATCH_MATMUL_ALIGNED_SIZE(cols2 * sizeof(WORD32), BATCH_MATMUL_ALIGNMENT);
+
+  memset(p_ones, 1, cols1 + 16);
+
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 l_mult = AE_MOVDA32(1 << left_shift);
+
+  WORD32 zb_prod = cols1 * mat1_zero_bias * mat2_zero_bias;
+
+  for(b_itr = 0; b_itr < batch; b_itr++)
+  {
+    const WORD8 *p_mat1_b = p_mat1 + b_itr * rows1 * cols1;
+    const WORD8 *p_mat2_b = p_mat2 + b_itr * cols1 * cols2;
+    WORD8 *p_out_b = p_out + b_itr * rows1 * cols2;
+
+    /* Kernels below work on rows of mat2 transpose (cols2 x cols1) */
+    if(transpose_mat2 == 0)
+    {
+      for(k_itr = 0; k_itr < cols1; k_itr++)
+      {
+        for(n_itr = 0; n_itr < cols2; n_itr++)
+        {
+          p_mat2_t[n_itr * cols1 + k_itr] = p_mat2_b[k_itr * cols2 + n_itr];
+        }
+      }
+      p_mat2_b = p_mat2_t;
+    }
+
+    /* (a + za)(b + zb) summed over cols1 = a.b + zb*sum(a) + za*sum(b) + cols1*za*zb */
+    _xa_nn_batch_matmul_row_sums(p_row_adj, p_mat1_b, p_ones, rows1, cols1);
+    _xa_nn_batch_matmul_row_sums(p_col_adj, p_mat2_b, p_ones, cols2, cols1);
+    for(m_itr = 0; m_itr < rows1; m_itr++)
+    {
+      p_row_adj[m_itr] *= mat2_zero_bias;
+    }
+    for(n_itr = 0; n_itr < cols2; n_itr++)
+    {
+      p_col_adj[n_itr] = p_col_adj[n_itr] * mat1_zero_bias + zb_prod;
+    }
+
+    for(n_itr = 0; n_itr < (cols2 & ~3); n_itr += 4)
+    {
+      ae_int32x2 col_adj_01, col_adj_23;
+      AE_L32X2X2_I(col_adj_01, col_adj_23, (ae_int32x4 *)&p_col_adj[n_itr], 0);
+
+      ae_int8* p_vec_0 = (ae_int8 *)&p_mat2_b[n_itr * cols1];
+
+      for(m_itr = 0; m_itr < (rows1 & ~3); m_itr += 4)
+      {
+        ae_int32x2 acc_row0_vec0 = AE_ADD32(col_adj_01, AE_MOVDA32(p_row_adj[m_itr + 0]));
+        ae_int32x2 acc_row1_vec0 = AE_ADD32(col_adj_23, AE_MOVDA32(p_row_adj[m_itr + 0]));
+        ae_int32x2 acc_row0_vec1 = AE_ADD32(col_adj_01, AE_MOVDA32(p_row_adj[m_itr + 1]));
+        ae_int32x2 acc_row1_vec1 = AE_ADD32(col_adj_23, AE_MOVDA32(p_row_adj[m_itr + 1]));
+        ae_int32x2 acc_row0_vec2 = AE_ADD32(col_adj_01, AE_MOVDA32(p_row_adj[m_itr + 2]));
+        ae_int32x2 acc_row1_vec2 = AE_ADD32(col_adj_23, AE_MOVDA32(p_row_adj[m_itr + 2]));
+        ae_int32x2 acc_row0_vec3 = AE_ADD32(col_adj_01, AE_MOVDA32(p_row_adj[m_itr + 3]));
+        ae_int32x2 acc_row1_vec3 = AE_ADD32(col_adj_23, AE_MOVDA32(p_row_adj[m_itr + 3]));
+
+        ae_int8x8 *p_mat1_0 = (ae_int8x8 *)&p_mat1_b[m_itr * cols1];
+
+        /* Rows of mat1 are the matrix operand and rows of mat2 transpose the
+         * vectors, so each (acc_row0_vecX, acc_row1_vecX) pair holds four
+         * consecutive outputs of row m_itr + X */
+        _xa_nn_dot_product_4_rows_4_vecs_unaligned
+          (&acc_row0_vec0
+           ,&acc_row0_vec1
+           ,&acc_row0_vec2
+           ,&acc_row0_vec3
+           ,&acc_row1_vec0
+           ,&acc_row1_vec1
+           ,&acc_row1_vec2
+           ,&acc_row1_vec3
+           ,p_mat1_0
+           ,p_vec_0
+           ,cols1
+           ,cols1
+           ,cols1
+          );
+
+        ae_int16x4 out_0, out_1, out_2, out_3;
+
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier, l_mult, right_shift, out_zero_bias);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_1, acc_row0_vec1, acc_row1_vec1, out_multiplier, l_mult, right_shift, out_zero_bias);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_2, acc_row0_vec2, acc_row1_vec2, out_multiplier, l_mult, right_shift, out_zero_bias);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_3, acc_row0_vec3, acc_row1_vec3, out_multiplier, l_mult, right_shift, out_zero_bias);
+
+        WORD8 *p_dst_0 = p_out_b + (m_itr + 0) * cols2 + n_itr;
+        WORD8 *p_dst_1 = p_out_b + (m_itr + 1) * cols2 + n_itr;
+        WORD8 *p_dst_2 = p_out_b + (m_itr + 2) * cols2 + n_itr;
+        WORD8 *p_dst_3 = p_out_b + (m_itr + 3) * cols2 + n_itr;
+
+        AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_SW_S8_2_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_1), (ae_int8 *) p_dst_1, 1);
+        AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_1), (ae_int8 *) p_dst_1, 1);
+        AE_SW_S8_2_XP(AE_MOVINT8X8_FROMINT16X4(out_1), (ae_int8 *) p_dst_1, 1);
+        AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_1), (ae_int8 *) p_dst_1, 1);
+        AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_2), (ae_int8 *) p_dst_2, 1);
+        AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_2), (ae_int8 *) p_dst_2, 1);
+        AE_SW_S8_2_XP(AE_MOVINT8X8_FROMINT16X4(out_2), (ae_int8 *) p_dst_2, 1);
+        AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_2), (ae_int8 *) p_dst_2, 1);
+        AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_3), (ae_int8 *) p_dst_3, 1);
+        AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_3), (ae_int8 *) p_dst_3, 1);
+        AE_SW_S8_2_XP(AE_MOVINT8X8_FROMINT16X4(out_3), (ae_int8 *) p_dst_3, 1);
+        AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_3), (ae_int8 *) p_dst_3, 1);
+      }
+
+      // Remaining rows of mat1
+      for(; m_itr < rows1; m_itr++)
+      {
+        ae_int32x2 acc_row0_vec0 = AE_ADD32(col_adj_01, AE_MOVDA32(p_row_adj[m_itr]));
+        ae_int32x2 acc_row1_vec0 = AE_ADD32(col_adj_23, AE_MOVDA32(p_row_adj[m_itr]));
+
+        _xa_nn_dot_product_4_rows_1_vecs_unaligned
+          (&acc_row0_vec0
+           ,&acc_row1_vec0
+           ,(ae_int8x8 *)p_vec_0
+           ,(ae_int8 *)&p_mat1_b[m_itr * cols1]
+           ,cols1
+           ,cols1
+          );
+
+        ae_int16x4 out_0;
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier, l_mult, right_shift, out_zero_bias);
+
+        WORD8 *p_dst_0 = p_out_b + m_itr * cols2 + n_itr;
+        AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_SW_S8_2_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+        AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+      }
+    }
+
+    // Remaining columns of output
+    for(; n_itr < cols2; n_itr++)
+    {
+      for(m_itr = 0; m_itr < rows1; m_itr++)
+      {
+        ae_int32x2 acc_row0_vec0 = AE_MOVDA32(p_col_adj[n_itr] + p_row_adj[m_itr]);
+        ae_int32x2 acc_row1_vec0 = acc_row0_vec0;
+
+        _xa_nn_dot_product_1_rows_1_vecs_unaligned
+          (&acc_row0_vec0
+           ,&acc_row1_vec0
+           ,(ae_int8x8 *)&p_mat1_b[m_itr * cols1]
+           ,(ae_int8 *)&p_mat2_b[n_itr * cols1]
+           ,cols1
+          );
+
+        ae_int16x4 out_0;
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier, l_mult, right_shift, out_zero_bias);
+
+        WORD8 *p_dst_0 = p_out_b + m_itr * cols2 + n_itr;
+        AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* Rescaled add of four requantized outputs (e3..e0) and four residual values,
+ * same arithmetic as xa_nn_elm_add_asym8sxasym8s_asym8s */
+#define RESIDUAL_ADD_16X4(out, inp, res, inp_z_b, res_z_b, left_shift, inp_mult, inp_ls, res_mult, res_ls, sum_mult, sum_ls, sum_z_b, act_min, act_max) \
+{\
+  ae_int16x4 inp_16, res_16; \
+  ae_int32x2 inp_01, inp_23, res_01, res_23; \
+  inp_16 = AE_ADD16S(inp, AE_MOVDA16(inp_z_b)); \
+  res_16 = AE_ADD16S(res, AE_MOVDA16(res_z_b)); \
+  AE_CVTA32X4F16S(inp_01, inp_23, inp_16, left_shift); \
+  AE_CVTA32X4F16S(res_01, res_23, res_16, left_shift); \
+  AE_MULF2P32X4RAS(inp_01, inp_23, inp_01, inp_23, inp_mult, inp_mult); \
+  inp_01 = AE_SRAA32SYMS(inp_01, -(inp_ls)); \
+  inp_23 = AE_SRAA32SYMS(inp_23, -(inp_ls)); \
+  AE_MULF2P32X4RAS(res_01, res_23, res_01, res_23, res_mult, res_mult); \
+  res_01 = AE_SRAA32SYMS(res_01, -(res_ls)); \
+  res_23 = AE_SRAA32SYMS(res_23, -(res_ls)); \
+  inp_01 = AE_ADD32S(inp_01, res_01); \
+  inp_23 = AE_ADD32S(inp_23, res_23); \
+  AE_MULF2P32X4RAS(inp_01, inp_23, inp_01, inp_23, sum_mult, sum_mult); \
+  inp_01 = AE_SRAA32SYMS(inp_01, -(sum_ls)); \
+  inp_23 = AE_SRAA32SYMS(inp_23, -(sum_ls)); \
+  inp_01 = AE_ADD32S(inp_01, sum_z_b); \
+  inp_23 = AE_ADD32S(inp_23, sum_z_b); \
+  AE_MINMAX32(inp_01, act_min, act_max); \
+  AE_MINMAX32(inp_23, act_min, act_max); \
+  out = AE_SAT16X4(inp_01, inp_23); \
+}
+
+#define STORE_16X4_8X4_CONTIGUOUS(out, p_dst) \
+{\
+  AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out), (ae_int8 *) p_dst, 1); \
+  AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out), (ae_int8 *) p_dst, 1); \
+  AE_SW_S8_2_XP(AE_MOVINT8X8_FROMINT16X4(out), (ae_int8 *) p_dst, 1); \
+  AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out), (ae_int8 *) p_dst, 1); \
+}
+
+/* Sum of 4 rows multiplied by the (negated) zero bias held in a register */
+static inline void _xa_nn_dot_product_4_rows_zero_bias_unaligned
+    (ae_int32x2* out_0_0
+    ,ae_int32x2* out_1_0
+    ,ae_int8x8*  p_mat1_0
+    ,ae_int8x8   vec_z_b
+    ,WORD32      cols
+    ,WORD32      row_offset
+    )
+{
+  int c_itr = 0;
+
+  int rem_cols_shift = 64 - (cols & 7) * 8;
+
+  ae_int8x8 mat1_row0_0;
+  ae_int8x8 mat1_row1_0;
+  ae_int8x8 mat1_row2_0;
+  ae_int8x8 mat1_row3_0;
+
+  ae_int8x8 *p_mat1_1 = (ae_int8x8*)((WORD8 *)p_mat1_0 + row_offset);
+  ae_int8x8 *p_mat1_2 = (ae_int8x8*)((WORD8 *)p_mat1_1 + row_offset);
+  ae_int8x8 *p_mat1_3 = (ae_int8x8*)((WORD8 *)p_mat1_2 + row_offset);
+
+  ae_valign align_p_mat1_0 = AE_LA64_PP(p_mat1_0);
+  ae_valign align_p_mat1_1 = AE_LA64_PP(p_mat1_1);
+  ae_valign align_p_mat1_2 = AE_LA64_PP(p_mat1_2);
+  ae_valign align_p_mat1_3 = AE_LA64_PP(p_mat1_3);
+
+  ae_int32x2 acc_row0_vec0 = *out_0_0;
+  ae_int32x2 acc_row1_vec0 = *out_1_0;
+
+  int cols_count = cols - (cols & 7);
+
+  for(c_itr = 0; c_itr < cols_count >> 3; c_itr++)
+  {
+    AE_LA8X8_IP(mat1_row0_0, align_p_mat1_0, p_mat1_0);
+    AE_LA8X8_IP(mat1_row1_0, align_p_mat1_1, p_mat1_1);
+    AE_LA8X8_IP(mat1_row2_0, align_p_mat1_2, p_mat1_2);
+    AE_LA8X8_IP(mat1_row3_0, align_p_mat1_3, p_mat1_3);
+
+    AE_MULA8Q8X8(acc_row0_vec0 , acc_row1_vec0 , mat1_row0_0 , mat1_row1_0 , mat1_row2_0 , mat1_row3_0 , vec_z_b);
+  }
+
+  //Remainder loop for cols
+  if(cols_count != cols)
+  {
+    ae_int8x8 vec_z_b_rem = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(vec_z_b), rem_cols_shift), rem_cols_shift));
+
+    AE_LA8X8_IP(mat1_row0_0, align_p_mat1_0, p_mat1_0);
+    AE_LA8X8_IP(mat1_row1_0, align_p_mat1_1, p_mat1_1);
+    AE_LA8X8_IP(mat1_row2_0, align_p_mat1_2, p_mat1_2);
+    AE_LA8X8_IP(mat1_row3_0, align_p_mat1_3, p_mat1_3);
+
+    AE_MULA8Q8X8(acc_row0_vec0 , acc_row1_vec0 , mat1_row0_0 , mat1_row1_0 , mat1_row2_0 , mat1_row3_0 , vec_z_b_rem);
+  }
+
+  *out_0_0 = acc_row0_vec0;
+  *out_1_0 = acc_row1_vec0;
+}
+
+/* Per-channel matmul with a residual add fused into the requantization
+ * epilogue. Output and residual are laid out as vec_count x rows with rows
+ * contiguous (NHWC for pointwise convolution), out_offset apart. Vectors are
+ * used as the matrix operand of the dot-product kernels so that each
+ * accumulator pair holds four consecutive output channels. */
+WORD32 xa_nn_matmul_per_chan_residual_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const WORD8 * __restrict__ p_residual,
+    WORD32 sum_zero_bias,
+    WORD32 sum_left_shift,
+    WORD32 sum_multiplier,
+    WORD32 sum_activation_min,
+    WORD32 sum_activation_max,
+    WORD32 out_inp_zero_bias,
+    WORD32 out_inp_left_shift,
+    WORD32 out_inp_multiplier,
+    WORD32 res_zero_bias,
+    WORD32 res_left_shift,
+    WORD32 res_multiplier,
+    WORD32 left_shift)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_residual, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset < rows), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((sum_zero_bias < -128 || sum_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((sum_left_shift < -31 || sum_left_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_inp_zero_bias < -127 || out_inp_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_inp_left_shift < -31 || out_inp_left_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((res_zero_bias < -127 || res_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((res_left_shift < -31 || res_left_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((left_shift < 0 || left_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((sum_activation_min < -128 || sum_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((sum_activation_max < -128 || sum_activation_max > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((sum_activation_max < sum_activation_min), -1);
+
+  int itr = 0;
+  for(itr=0; itr<rows; itr++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  int m_itr, vec_itr;
+
+  ae_int8x8 vec_z_b = AE_MOVDA8(-vec1_zero_bias);
+
+  const ae_int32x2 inp_mult = AE_MOVDA32(out_inp_multiplier);
+  const ae_int32x2 res_mult = AE_MOVDA32(res_multiplier);
+  const ae_int32x2 sum_mult = AE_MOVDA32(sum_multiplier);
+  const ae_int32x2 sum_z_b = AE_MOVDA32(sum_zero_bias);
+  const ae_int32x2 act_min = AE_MOVDA32(sum_activation_min);
+  const ae_int32x2 act_max = AE_MOVDA32(sum_activation_max);
+
+  for(m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
+  {
+    /* bias + vec1_zero_bias * (sum of each row) for 4 output channels */
+    ae_int32x2 bias_01 = AE_ZERO32();
+    ae_int32x2 bias_23 = AE_ZERO32();
+    _xa_nn_dot_product_4_rows_zero_bias_unaligned
+      (&bias_01
+       ,&bias_23
+       ,(ae_int8x8 *)&p_mat1[m_itr * row_stride1]
+       ,vec_z_b
+       ,cols1
+       ,row_stride1
+      );
+    bias_01 = AE_SUB32S(AE_MOVDA32X2(p_bias[m_itr + 0], p_bias[m_itr + 1]), bias_01);
+    bias_23 = AE_SUB32S(AE_MOVDA32X2(p_bias[m_itr + 2], p_bias[m_itr + 3]), bias_23);
+
+    /* Shifts to match with Tensorflow, see xa_nn_matmul_per_chan_sym8sxasym8s_asym8s */
+    ae_int32x2 l_mult_01 = AE_MOVDA32X2(p_out_shift[m_itr + 0] < 0 ? 1 : (1 << p_out_shift[m_itr + 0]),
+                                        p_out_shift[m_itr + 1] < 0 ? 1 : (1 << p_out_shift[m_itr + 1]));
+    ae_int32x2 l_mult_23 = AE_MOVDA32X2(p_out_shift[m_itr + 2] < 0 ? 1 : (1 << p_out_shift[m_itr + 2]),
+                                        p_out_shift[m_itr + 3] < 0 ? 1 : (1 << p_out_shift[m_itr + 3]));
+    ae_int32x2 r_mult_01 = AE_MOVDA32X2(p_out_shift[m_itr + 0] > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + p_out_shift[m_itr + 0])),
+                                        p_out_shift[m_itr + 1] > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + p_out_shift[m_itr + 1])));
+    ae_int32x2 r_mult_23 = AE_MOVDA32X2(p_out_shift[m_itr + 2] > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + p_out_shift[m_itr + 2])),
+                                        p_out_shift[m_itr + 3] > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + p_out_shift[m_itr + 3])));
+    ae_int32x2 out_multiplier_01 = AE_NEG32(AE_MOVDA32X2(p_out_multiplier[m_itr + 0], p_out_multiplier[m_itr + 1]));
+    ae_int32x2 out_multiplier_23 = AE_NEG32(AE_MOVDA32X2(p_out_multiplier[m_itr + 2], p_out_multiplier[m_itr + 3]));
+
+    ae_int8* p_vec_0 = (ae_int8 *)&p_mat1[m_itr * row_stride1];
+
+    for(vec_itr = 0; vec_itr < (vec_count & ~(4 - 1)); vec_itr += 4)
+    {
+      ae_int32x2 acc_row0_vec0 = bias_01;
+      ae_int32x2 acc_row1_vec0 = bias_23;
+      ae_int32x2 acc_row0_vec1 = bias_01;
+      ae_int32x2 acc_row1_vec1 = bias_23;
+      ae_int32x2 acc_row0_vec2 = bias_01;
+      ae_int32x2 acc_row1_vec2 = bias_23;
+      ae_int32x2 acc_row0_vec3 = bias_01;
+      ae_int32x2 acc_row1_vec3 = bias_23;
+
+      /* Vectors are the matrix operand, rows of mat1 the 4 vectors */
+      _xa_nn_dot_product_4_rows_4_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row0_vec1
+         ,&acc_row0_vec2
+         ,&acc_row0_vec3
+         ,&acc_row1_vec0
+         ,&acc_row1_vec1
+         ,&acc_row1_vec2
+         ,&acc_row1_vec3
+         ,(ae_int8x8 *)&p_vec1[vec_itr * vec_offset]
+         ,p_vec_0
+         ,cols1
+         ,vec_offset
+         ,row_stride1
+        );
+
+      ae_int16x4 out_0, out_1, out_2, out_3;
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_1, acc_row0_vec1, acc_row1_vec1, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_2, acc_row0_vec2, acc_row1_vec2, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_3, acc_row0_vec3, acc_row1_vec3, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+
+      /* Load residual */
+      ae_int16x4 res_0, res_1, res_2, res_3;
+      ae_valign align_res;
+      const WORD8 *p_res_0 = p_residual + (vec_itr + 0) * out_offset + m_itr;
+      const WORD8 *p_res_1 = p_residual + (vec_itr + 1) * out_offset + m_itr;
+      const WORD8 *p_res_2 = p_residual + (vec_itr + 2) * out_offset + m_itr;
+      const WORD8 *p_res_3 = p_residual + (vec_itr + 3) * out_offset + m_itr;
+      align_res = AE_LA64_PP(p_res_0);
+      AE_LA8X4S_IP(res_0, align_res, p_res_0);
+      align_res = AE_LA64_PP(p_res_1);
+      AE_LA8X4S_IP(res_1, align_res, p_res_1);
+      align_res = AE_LA64_PP(p_res_2);
+      AE_LA8X4S_IP(res_2, align_res, p_res_2);
+      align_res = AE_LA64_PP(p_res_3);
+      AE_LA8X4S_IP(res_3, align_res, p_res_3);
+
+      RESIDUAL_ADD_16X4(out_0, out_0, res_0, out_inp_zero_bias, res_zero_bias, left_shift, inp_mult, out_inp_left_shift, res_mult, res_left_shift, sum_mult, sum_left_shift, sum_z_b, act_min, act_max);
+      RESIDUAL_ADD_16X4(out_1, out_1, res_1, out_inp_zero_bias, res_zero_bias, left_shift, inp_mult, out_inp_left_shift, res_mult, res_left_shift, sum_mult, sum_left_shift, sum_z_b, act_min, act_max);
+      RESIDUAL_ADD_16X4(out_2, out_2, res_2, out_inp_zero_bias, res_zero_bias, left_shift, inp_mult, out_inp_left_shift, res_mult, res_left_shift, sum_mult, sum_left_shift, sum_z_b, act_min, act_max);
+      RESIDUAL_ADD_16X4(out_3, out_3, res_3, out_inp_zero_bias, res_zero_bias, left_shift, inp_mult, out_inp_left_shift, res_mult, res_left_shift, sum_mult, sum_left_shift, sum_z_b, act_min, act_max);
+
+      /* Store output */
+      WORD8 *p_dst_0 = p_out + (vec_itr + 0) * out_offset + m_itr;
+      WORD8 *p_dst_1 = p_out + (vec_itr + 1) * out_offset + m_itr;
+      WORD8 *p_dst_2 = p_out + (vec_itr + 2) * out_offset + m_itr;
+      WORD8 *p_dst_3 = p_out + (vec_itr + 3) * out_offset + m_itr;
+      STORE_16X4_8X4_CONTIGUOUS(out_0, p_dst_0);
+      STORE_16X4_8X4_CONTIGUOUS(out_1, p_dst_1);
+      STORE_16X4_8X4_CONTIGUOUS(out_2, p_dst_2);
+      STORE_16X4_8X4_CONTIGUOUS(out_3, p_dst_3);
+    }
+
+    // Remaining vectors
+    for(; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc_row0_vec0 = bias_01;
+      ae_int32x2 acc_row1_vec0 = bias_23;
+
+      _xa_nn_dot_product_4_rows_1_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row1_vec0
+         ,(ae_int8x8 *)p_vec_0
+         ,(ae_int8 *)&p_vec1[vec_itr * vec_offset]
+         ,cols1
+         ,row_stride1
+        );
+
+      ae_int16x4 out_0, res_0;
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+
+      const WORD8 *p_res_0 = p_residual + vec_itr * out_offset + m_itr;
+      ae_valign align_res = AE_LA64_PP(p_res_0);
+      AE_LA8X4S_IP(res_0, align_res, p_res_0);
+
+      RESIDUAL_ADD_16X4(out_0, out_0, res_0, out_inp_zero_bias, res_zero_bias, left_shift, inp_mult, out_inp_left_shift, res_mult, res_left_shift, sum_mult, sum_left_shift, sum_z_b, act_min, act_max);
+
+      WORD8 *p_dst_0 = p_out + vec_itr * out_offset + m_itr;
+      STORE_16X4_8X4_CONTIGUOUS(out_0, p_dst_0);
+    }
+  }
+
+  // Remaining rows
+  for(; m_itr < rows; m_itr++)
+  {
+    ae_int32x2 bias_0 = AE_ZERO32();
+    ae_int32x2 bias_1 = AE_ZERO32();
+    _xa_nn_dot_product_4_rows_zero_bias_unaligned
+      (&bias_0
+       ,&bias_1
+       ,(ae_int8x8 *)&p_mat1[m_itr * row_stride1]
+       ,vec_z_b
+       ,cols1
+       ,0
+      );
+    bias_0 = AE_SUB32S(AE_MOVDA32(p_bias[m_itr]), bias_0);
+
+    ae_int32x2 l_mult = AE_MOVDA32(p_out_shift[m_itr] < 0 ? 1 : (1 << p_out_shift[m_itr]));
+    ae_int32x2 r_mult = AE_MOVDA32(p_out_shift[m_itr] > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + p_out_shift[m_itr])));
+    ae_int32x2 out_multiplier = AE_NEG32(AE_MOVDA32(p_out_multiplier[m_itr]));
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc_row0_vec0 = bias_0;
+      ae_int32x2 acc_row1_vec0 = bias_0;
+
+      _xa_nn_dot_product_1_rows_1_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row1_vec0
+         ,(ae_int8x8 *)&p_mat1[m_itr * row_stride1]
+         ,(ae_int8 *)&p_vec1[vec_itr * vec_offset]
+         ,cols1
+        );
+
+      ae_int16x4 out_0;
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, out_multiplier, out_multiplier, l_mult, l_mult, r_mult, r_mult, out_zero_bias);
+
+      ae_int16x4 res_0 = AE_MOVDA16(p_residual[vec_itr * out_offset + m_itr]);
+      RESIDUAL_ADD_16X4(out_0, out_0, res_0, out_inp_zero_bias, res_zero_bias, left_shift, inp_mult, out_inp_left_shift, res_mult, res_left_shift, sum_mult, sum_left_shift, sum_z_b, act_min, act_max);
+
+      WORD8 *p_dst_0 = p_out + vec_itr * out_offset + m_itr;
+      AE_S8_0_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, 1);
+    }
+  }
+
+  return 0;
+}
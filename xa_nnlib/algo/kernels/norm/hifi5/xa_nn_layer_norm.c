@@ -0,0 +1,424 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+//output: output_inv_sqrt (ae_int32x2), output_shift (int)
+//input:  input (ae_int32x2) , reverse_shift (int)
+#define GET_INV_SQRT_QUANTIZED_MULTIPLIER_EXP(output_inv_sqrt, output_shift, input, reverse_shift){\
+  ae_int32x2 CT_Q31_minus_1, CT_Q29, CT_ONE;\
+  CT_Q31_minus_1 = AE_MOVDA32(Q31_minus_1);\
+  CT_Q29 = AE_MOVDA32(Q29);\
+  CT_ONE = AE_MOVDA32(1);\
+\
+  xtbool2 b1, b2;\
+  b1 = AE_LE32(input, CT_ONE);\
+\
+  if(AE_MOVAB2(b1))\
+  {\
+    output_inv_sqrt = AE_MOV32(CT_Q31_minus_1);\
+    output_shift = 0;\
+  }\
+  else\
+  {\
+    output_shift = 11;\
+    b2 = AE_LT32(input, CT_Q29);\
+    while(!AE_MOVAB2(b2))\
+    {\
+      input = AE_SRAI32(input, 2);\
+      ++output_shift;\
+      b2 = AE_LT32(input, CT_Q29);\
+    }\
+\
+    int max_left_shift_bits, max_left_shift_bit_pairs, left_shift_bit_pairs;\
+    max_left_shift_bits = AE_NSA32_L(input);\
+    max_left_shift_bit_pairs = max_left_shift_bits / 2;\
+    left_shift_bit_pairs = max_left_shift_bit_pairs - 1;\
+    output_shift -= left_shift_bit_pairs;\
+    input = AE_SLAA32(input, (2*left_shift_bit_pairs));\
+\
+    ae_int32x2 fixedpoint_input, fixedpoint_half_input, fixedpoint_half_three, x, x2, x3, y1, y2;\
+    fixedpoint_input = AE_SRAI32(input, 1);\
+    fixedpoint_half_input = AE_SRAI32R(fixedpoint_input, 1);\
+    fixedpoint_half_three = AE_MOVDA32(FIXED_POINT_HALF_THREE);\
+    x = AE_MOVDA32(FIXED_POINT_ONE);\
+\
+    int i = 0;\
+    for(i=0; i<5; i++)\
+    {\
+      x2 = AE_MULFP32X2RS(x, x);\
+      x3 = AE_MULFP32X2RS(x2, x);\
+      x3 = AE_SLAI32S(x3, 6);\
+\
+      y1 = AE_MULFP32X2RS(fixedpoint_half_three, x);\
+      y2 = AE_MULFP32X2RS(fixedpoint_half_input, x3);\
+\
+      x = AE_SUB32S(y1, y2);\
+      x = AE_SLAI32S(x, 3);\
+    }\
+\
+    ae_int32x2 fixedpoint_half_sqrt_2;\
+    fixedpoint_half_sqrt_2 = AE_MOVDA32(FIXED_POINT_HALF_SQRT_2);\
+    output_inv_sqrt = AE_MULFP32X2RS(x, fixedpoint_half_sqrt_2);\
+    if(output_shift < 0)\
+    {\
+      output_inv_sqrt = AE_SLAA32S(output_inv_sqrt, -output_shift);\
+      output_shift = 0;\
+    }\
+    output_shift *= reverse_shift;\
+\
+  }\
+}
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32S(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, multiplier); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Normalizes two elements: (x*1024 - mean) / stddev in Q10, times gamma plus
+ * beta, rounded back by 1024 and requantized to the output scale. */
+#define LAYER_NORM_X2(out, inp, gamma, beta) \
+{ \
+  ae_int64 _v_h, _v_l; \
+  inp = AE_SUB32S(AE_SLAI32S(inp, 10), d_mean); \
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, d_inv_std, inv_std_left_shift, inv_std_right_shift); \
+  _v_h = AE_ADD64(AE_MUL32_HH(inp, gamma), AE_MUL32_HH(beta, d_one)); \
+  _v_l = AE_ADD64(AE_MUL32_LL(inp, gamma), AE_MUL32_LL(beta, d_one)); \
+  out = AE_ROUND32X2F64SSYM(AE_SLAI64S(_v_h, 22), AE_SLAI64S(_v_l, 22)); \
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(out, d_out_multiplier, out_left_shift, out_right_shift); \
+  out = AE_ADD32S(out, d_out_zb); \
+}
+
+static const int Q31_minus_1 = 0x7fffffff;
+static const int Q29         = 0x20000000;
+static const int FIXED_POINT_HALF_THREE = 0x18000000;
+static const int FIXED_POINT_ONE = 0x10000000;
+static const int FIXED_POINT_HALF_SQRT_2 = 0x5a82799a;
+
+static inline WORD64 layer_norm_int64_to_word64(ae_int64 a)
+{
+  ae_int32x2 t = AE_MOVINT32X2_FROMINT64(a);
+  return (((WORD64)AE_MOVAD32_H(t)) << 32) | (UWORD32)AE_MOVAD32_L(t);
+}
+
+/*
+ * Row statistics for the integer layer norm: mean in Q10 of the input and
+ * 1/stddev as a quantized multiplier. sum and sum_sq are taken over
+ * (x - offset), and the input is scaled by 2^inp_shift before normalization.
+ * The variance is the exact floor of (N*sum_sq - sum^2)/N^2, so it does not
+ * depend on the offset. variance_limit replaces a variance that rounds to zero.
+ */
+static void layer_norm_row_stats(WORD32 *p_mean,
+                                 ae_int32x2 *p_inv_std,
+                                 WORD32 *p_inv_std_shift,
+                                 WORD64 sum,
+                                 WORD64 sum_sq,
+                                 WORD32 offset,
+                                 WORD32 inp_shift,
+                                 WORD32 row_length,
+                                 WORD32 variance_limit)
+{
+  WORD64 sum_x = sum + (WORD64)offset * row_length;
+  WORD32 mean = (WORD32)((sum_x << (10 + inp_shift)) / row_length);
+  /* Non-negative by Cauchy-Schwarz; fits in 64 bit for row_length < 2^16 */
+  UWORD64 variance = (UWORD64)row_length * (UWORD64)sum_sq - (UWORD64)(sum * sum);
+  WORD32 variance2;
+  ae_int32x2 d_variance, d_inv_std;
+
+  variance = (variance << (2 * inp_shift)) / ((UWORD64)row_length * (UWORD64)row_length);
+  variance2 = (WORD32)variance;
+  int inv_std_shift;
+
+  if(variance2 < 1)
+  {
+    variance2 = variance_limit;
+  }
+  d_variance = AE_MOVDA32(variance2);
+  GET_INV_SQRT_QUANTIZED_MULTIPLIER_EXP(d_inv_std, inv_std_shift, d_variance, -1);
+
+  *p_mean = mean;
+  *p_inv_std = d_inv_std;
+  *p_inv_std_shift = inv_std_shift;
+}
+
+WORD32 xa_nn_layer_norm_sym16s_sym16s(WORD16 * __restrict__ p_out,
+                                const WORD16 * __restrict__ p_inp,
+                                const WORD16 * __restrict__ p_gamma,
+                                const WORD32 * __restrict__ p_beta,
+                                      WORD32 num_rows,
+                                      WORD32 row_length,
+                                      WORD32 out_multiplier,
+                                      WORD32 out_shift,
+                                      WORD32 variance_limit)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gamma, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_beta, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gamma, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_beta, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_length <= 0) || (row_length > 65535)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((variance_limit <= 0), -1);
+
+  int row, i;
+  int out_left_shift  = out_shift < 0 ? 0 : out_shift;
+  int out_right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 d_out_multiplier = AE_MOVDA32(out_multiplier);
+  ae_int32x2 d_out_zb = AE_ZERO32();
+  ae_int32x2 d_one = AE_MOVDA32(1);
+  ae_int16x4 one_16x4 = AE_MOVDA16(1);
+
+  for(row = 0; row < num_rows; row++)
+  {
+    const WORD16 *p_in_row = p_inp + row * row_length;
+    WORD16 *p_out_row = p_out + row * row_length;
+    ae_int16x4 *p_in, *p_o;
+    ae_int16x4 *p_g;
+    ae_int32x2 *p_b;
+    ae_valignx2 align_src, align_dst, align_g;
+    ae_valign align_b;
+    ae_int16x4 d0, d1;
+    ae_int64 acc_sum0 = AE_ZERO64(), acc_sum1 = AE_ZERO64();
+    ae_int64 acc_sq0 = AE_ZERO64(), acc_sq1 = AE_ZERO64();
+    WORD64 sum, sum_sq;
+    WORD32 mean;
+    ae_int32x2 d_mean, d_inv_std;
+    int inv_std_shift, inv_std_left_shift, inv_std_right_shift;
+
+    /* Pass 1: sum and sum of squares in 64 bit, the zero point is 0 */
+    p_in = (ae_int16x4 *)p_in_row;
+    align_src = AE_LA128_PP(p_in);
+    for(i = 0; i < (row_length >> 3); i++)
+    {
+      AE_LA16X4X2_IP(d0, d1, align_src, (ae_int16x8 *)p_in);
+      AE_MULAAAA2Q16(acc_sum0, acc_sum1, d0, d1, one_16x4, one_16x4);
+      AE_MULAAAA2Q16(acc_sq0, acc_sq1, d0, d1, d0, d1);
+    }
+    sum = layer_norm_int64_to_word64(AE_ADD64(acc_sum0, acc_sum1));
+    sum_sq = layer_norm_int64_to_word64(AE_ADD64(acc_sq0, acc_sq1));
+    for(i = (row_length & ~7); i < row_length; i++)
+    {
+      sum += p_in_row[i];
+      sum_sq += (WORD32)p_in_row[i] * p_in_row[i];
+    }
+
+    layer_norm_row_stats(&mean, &d_inv_std, &inv_std_shift, sum, sum_sq, 0, 0, row_length, variance_limit);
+    d_mean = AE_MOVDA32(mean);
+    inv_std_left_shift  = inv_std_shift < 0 ? 0 : inv_std_shift;
+    inv_std_right_shift = inv_std_shift > 0 ? 0 : -inv_std_shift;
+
+    /* Pass 2: normalize, scale/shift and requantize */
+    p_in = (ae_int16x4 *)p_in_row;
+    p_o = (ae_int16x4 *)p_out_row;
+    p_g = (ae_int16x4 *)p_gamma;
+    p_b = (ae_int32x2 *)p_beta;
+    align_src = AE_LA128_PP(p_in);
+    align_g = AE_LA128_PP(p_g);
+    align_b = AE_LA64_PP(p_b);
+    align_dst = AE_ZALIGN128();
+    for(i = 0; i < (row_length >> 3); i++)
+    {
+      ae_int16x4 g0, g1, o0, o1;
+      ae_int32x2 x0, x1, x2, x3, w0, w1, w2, w3, b0, b1, b2, b3;
+      ae_int32x2 y0, y1, y2, y3;
+
+      AE_LA16X4X2_IP(d0, d1, align_src, (ae_int16x8 *)p_in);
+      AE_LA16X4X2_IP(g0, g1, align_g, (ae_int16x8 *)p_g);
+      AE_LA32X2_IP(b0, align_b, p_b);
+      AE_LA32X2_IP(b1, align_b, p_b);
+      AE_LA32X2_IP(b2, align_b, p_b);
+      AE_LA32X2_IP(b3, align_b, p_b);
+      x0 = AE_SEXT32X2D16_32(d0); x1 = AE_SEXT32X2D16_10(d0);
+      x2 = AE_SEXT32X2D16_32(d1); x3 = AE_SEXT32X2D16_10(d1);
+      w0 = AE_SEXT32X2D16_32(g0); w1 = AE_SEXT32X2D16_10(g0);
+      w2 = AE_SEXT32X2D16_32(g1); w3 = AE_SEXT32X2D16_10(g1);
+
+      LAYER_NORM_X2(y0, x0, w0, b0);
+      LAYER_NORM_X2(y1, x1, w1, b1);
+      LAYER_NORM_X2(y2, x2, w2, b2);
+      LAYER_NORM_X2(y3, x3, w3, b3);
+
+      o0 = AE_SAT16X4(y0, y1);
+      o1 = AE_SAT16X4(y2, y3);
+      AE_SA16X4X2_IP(o0, o1, align_dst, (ae_int16x8 *)p_o);
+    }
+    AE_SA128POS_FP(align_dst, p_o);
+
+    for(i = (row_length & ~7); i < row_length; i++)
+    {
+      ae_int32x2 x0 = AE_MOVDA32(p_in_row[i]);
+      ae_int32x2 w0 = AE_MOVDA32(p_gamma[i]);
+      ae_int32x2 b0 = AE_MOVDA32(p_beta[i]);
+      ae_int32x2 y0;
+      LAYER_NORM_X2(y0, x0, w0, b0);
+      p_out_row[i] = (WORD16)AE_MOVAD16_0(AE_SAT16X4(y0, y0));
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_layer_norm_asym8s_asym8s(WORD8 * __restrict__ p_out,
+                                const WORD8 * __restrict__ p_inp,
+                                const WORD16 * __restrict__ p_gamma,
+                                const WORD32 * __restrict__ p_beta,
+                                      WORD32 num_rows,
+                                      WORD32 row_length,
+                                      WORD32 out_multiplier,
+                                      WORD32 out_shift,
+                                      WORD32 out_zero_bias,
+                                      WORD32 variance_limit)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gamma, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_beta, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_gamma, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_beta, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_length <= 0) || (row_length > 65535)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -128) || (out_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND((variance_limit <= 0), -1);
+
+  int row, i;
+  int out_left_shift  = out_shift < 0 ? 0 : out_shift;
+  int out_right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 d_out_multiplier = AE_MOVDA32(out_multiplier);
+  ae_int32x2 d_out_zb = AE_MOVDA32(out_zero_bias);
+  ae_int32x2 d_one = AE_MOVDA32(1);
+  ae_int16x4 one_16x4 = AE_MOVDA16(1);
+  ae_int8x8 zero_8x8 = AE_MOVDA8(0);
+
+  /* The input zero point cancels out in (x - mean). Inputs are scaled by 2^8
+   * so that mean and variance keep the same resolution as the 16 bit path.
+   * Row sums are taken around the first element of the row so that the
+   * differences stay within 16 bit. */
+  for(row = 0; row < num_rows; row++)
+  {
+    const WORD8 *p_in_row = p_inp + row * row_length;
+    WORD8 *p_out_row = p_out + row * row_length;
+    ae_int8x8 *p_in, *p_o;
+    ae_int16x4 *p_g;
+    ae_int32x2 *p_b;
+    ae_valign align_src, align_dst, align_b;
+    ae_valignx2 align_g;
+    ae_int8x8 d8, offset_8x8;
+    ae_int16x4 d0, d1;
+    ae_int64 acc_sum0 = AE_ZERO64(), acc_sum1 = AE_ZERO64();
+    ae_int64 acc_sq0 = AE_ZERO64(), acc_sq1 = AE_ZERO64();
+    WORD64 sum, sum_sq;
+    WORD32 mean, offset;
+    ae_int32x2 d_mean, d_inv_std;
+    int inv_std_shift, inv_std_left_shift, inv_std_right_shift;
+
+    /* Pass 1: sum and sum of squares of (x - x[0]) in 64 bit */
+    offset = p_in_row[0];
+    offset_8x8 = AE_MOVDA8(offset);
+    p_in = (ae_int8x8 *)p_in_row;
+    align_src = AE_LA64_PP(p_in);
+    for(i = 0; i < (row_length >> 3); i++)
+    {
+      AE_LA8X8_IP(d8, align_src, p_in);
+      AE_SUBW8(d0, d1, d8, offset_8x8);
+      AE_MULAAAA2Q16(acc_sum0, acc_sum1, d0, d1, one_16x4, one_16x4);
+      AE_MULAAAA2Q16(acc_sq0, acc_sq1, d0, d1, d0, d1);
+    }
+    sum = layer_norm_int64_to_word64(AE_ADD64(acc_sum0, acc_sum1));
+    sum_sq = layer_norm_int64_to_word64(AE_ADD64(acc_sq0, acc_sq1));
+    for(i = (row_length & ~7); i < row_length; i++)
+    {
+      WORD32 d = p_in_row[i] - offset;
+      sum += d;
+      sum_sq += d * d;
+    }
+
+    layer_norm_row_stats(&mean, &d_inv_std, &inv_std_shift, sum, sum_sq, offset, 8, row_length, variance_limit);
+    d_mean = AE_MOVDA32(mean);
+    inv_std_left_shift  = inv_std_shift < 0 ? 0 : inv_std_shift;
+    inv_std_right_shift = inv_std_shift > 0 ? 0 : -inv_std_shift;
+
+    /* Pass 2: normalize, scale/shift and requantize */
+    p_in = (ae_int8x8 *)p_in_row;
+    p_o = (ae_int8x8 *)p_out_row;
+    p_g = (ae_int16x4 *)p_gamma;
+    p_b = (ae_int32x2 *)p_beta;
+    align_src = AE_LA64_PP(p_in);
+    align_g = AE_LA128_PP(p_g);
+    align_b = AE_LA64_PP(p_b);
+    align_dst = AE_ZALIGN64();
+    for(i = 0; i < (row_length >> 3); i++)
+    {
+      ae_int16x4 g0, g1, o0, o1;
+      ae_int32x2 x0, x1, x2, x3, w0, w1, w2, w3, b0, b1, b2, b3;
+      ae_int32x2 y0, y1, y2, y3;
+
+      AE_LA8X8_IP(d8, align_src, p_in);
+      AE_SUBW8(d0, d1, d8, zero_8x8);
+      AE_LA16X4X2_IP(g0, g1, align_g, (ae_int16x8 *)p_g);
+      AE_LA32X2_IP(b0, align_b, p_b);
+      AE_LA32X2_IP(b1, align_b, p_b);
+      AE_LA32X2_IP(b2, align_b, p_b);
+      AE_LA32X2_IP(b3, align_b, p_b);
+      x0 = AE_SLAI32(AE_SEXT32X2D16_32(d0), 8); x1 = AE_SLAI32(AE_SEXT32X2D16_10(d0), 8);
+      x2 = AE_SLAI32(AE_SEXT32X2D16_32(d1), 8); x3 = AE_SLAI32(AE_SEXT32X2D16_10(d1), 8);
+      w0 = AE_SEXT32X2D16_32(g0); w1 = AE_SEXT32X2D16_10(g0);
+      w2 = AE_SEXT32X2D16_32(g1); w3 = AE_SEXT32X2D16_10(g1);
+
+      LAYER_NORM_X2(y0, x0, w0, b0);
+      LAYER_NORM_X2(y1, x1, w1, b1);
+      LAYER_NORM_X2(y2, x2, w2, b2);
+      LAYER_NORM_X2(y3, x3, w3, b3);
+
+      o0 = AE_SAT16X4(y0, y1);
+      o1 = AE_SAT16X4(y2, y3);
+      AE_SA8X8_IP(AE_SAT8X8X16(o0, o1), align_dst, p_o);
+    }
+    AE_SA64POS_FP(align_dst, p_o);
+
+    for(i = (row_length & ~7); i < row_length; i++)
+    {
+      ae_int32x2 x0 = AE_SLAI32(AE_MOVDA32(p_in_row[i]), 8);
+      ae_int32x2 w0 = AE_MOVDA32(p_gamma[i]);
+      ae_int32x2 b0 = AE_MOVDA32(p_beta[i]);
+      ae_int32x2 y0;
+      LAYER_NORM_X2(y0, x0, w0, b0);
+      y0 = AE_MAX32(y0, AE_MOVDA32(-128));
+      y0 = AE_MIN32(y0, AE_MOVDA32(127));
+      p_out_row[i] = (WORD8)AE_MOVAD32_L(y0);
+    }
+  }
+
+  return 0;
+}
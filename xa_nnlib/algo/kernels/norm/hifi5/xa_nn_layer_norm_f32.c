@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common_fpu.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_layer_norm_f32,
+             (
+                FLOAT32 *p_out,
+                const FLOAT32 *p_inp,
+                const FLOAT32 *p_gamma,
+                const FLOAT32 *p_beta,
+                WORD32 num_rows,
+                WORD32 row_length,
+                FLOAT32 epsilon
+              )
+           )
+#else
+WORD32 xa_nn_layer_norm_f32(FLOAT32 * __restrict__ p_out,
+                            const FLOAT32 * __restrict__ p_inp,
+                            const FLOAT32 * __restrict__ p_gamma,
+                            const FLOAT32 * __restrict__ p_beta,
+                            WORD32 num_rows,
+                            WORD32 row_length,
+                            FLOAT32 epsilon)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_gamma, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_beta, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_gamma, sizeof(FLOAT32), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_beta, sizeof(FLOAT32), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_length <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((epsilon < 0), -1);
+
+    int row, i;
+    xtfloatx2 *pt_inp, *pt_out, *pt_gamma, *pt_beta;
+    ae_valign inp_a, out_a, gamma_a, beta_a;
+    xtfloatx2 d_inpx2, d_outx2, d_gammax2, d_betax2;
+    xtfloatx2 sumx2, sum_sqx2, shiftx2, meanx2, inv_stdx2;
+    xtfloat d_inp, sum, sum_sq, shift, mean, var, inv_std, inv_len;
+    xtfloat zero = XT_CONST_S(0);
+
+    inv_len = XT_DIV_S(XT_CONST_S(1), XT_FLOAT_S(row_length, 0));
+
+    for(row = 0; row < num_rows; row++)
+    {
+        const FLOAT32 *p_in_row = p_inp + row * row_length;
+        FLOAT32 *p_out_row = p_out + row * row_length;
+
+        /* Mean and variance in one pass: sums are taken around the first
+         * element of the row to limit cancellation in E[x^2] - E[x]^2 */
+        shift = p_in_row[0];
+        shiftx2 = (xtfloatx2)shift;
+        sumx2 = XT_CONST_S(0);
+        sum_sqx2 = XT_CONST_S(0);
+        pt_inp = (xtfloatx2 *)p_in_row;
+        inp_a = XT_LASX2PP(pt_inp);
+        for(i = 0; i < (row_length >> 1); i++)
+        {
+            XT_LASX2IP(d_inpx2, inp_a, pt_inp);
+            d_inpx2 = XT_SUB_SX2(d_inpx2, shiftx2);
+            sumx2 = XT_ADD_SX2(sumx2, d_inpx2);
+            XT_MADD_SX2(sum_sqx2, d_inpx2, d_inpx2);
+        }
+        sum = XT_RADD_SX2(sumx2);
+        sum_sq = XT_RADD_SX2(sum_sqx2);
+        if(row_length & 1)
+        {
+            d_inp = XT_SUB_S(p_in_row[row_length - 1], shift);
+            sum = XT_ADD_S(sum, d_inp);
+            XT_MADD_S(sum_sq, d_inp, d_inp);
+        }
+        mean = XT_MUL_S(sum, inv_len);
+        var = XT_MUL_S(sum_sq, inv_len);
+        XT_MSUB_S(var, mean, mean);
+        var = XT_MAX_S(var, zero);
+        mean = XT_ADD_S(mean, shift);
+        inv_std = XT_DIV_S(XT_CONST_S(1), XT_SQRT_S(XT_ADD_S(var, epsilon)));
+        meanx2 = (xtfloatx2)mean;
+        inv_stdx2 = (xtfloatx2)inv_std;
+
+        /* (x - mean) * inv_std * gamma + beta */
+        pt_inp = (xtfloatx2 *)p_in_row;
+        pt_out = (xtfloatx2 *)p_out_row;
+        pt_gamma = (xtfloatx2 *)p_gamma;
+        pt_beta = (xtfloatx2 *)p_beta;
+        inp_a = XT_LASX2PP(pt_inp);
+        gamma_a = XT_LASX2PP(pt_gamma);
+        beta_a = XT_LASX2PP(pt_beta);
+        out_a = AE_ZALIGN64();
+        for(i = 0; i < (row_length >> 1); i++)
+        {
+            XT_LASX2IP(d_inpx2, inp_a, pt_inp);
+            XT_LASX2IP(d_gammax2, gamma_a, pt_gamma);
+            XT_LASX2IP(d_betax2, beta_a, pt_beta);
+            d_inpx2 = XT_MUL_SX2(XT_SUB_SX2(d_inpx2, meanx2), inv_stdx2);
+            d_outx2 = d_betax2;
+            XT_MADD_SX2(d_outx2, d_inpx2, d_gammax2);
+            XT_SASX2IP(d_outx2, out_a, pt_out);
+        }
+        XT_SASX2POSFP(out_a, pt_out);
+        if(row_length & 1)
+        {
+            d_inp = XT_MUL_S(XT_SUB_S(p_in_row[row_length - 1], mean), inv_std);
+            p_out_row[row_length - 1] = XT_ADD_S(XT_MUL_S(d_inp, p_gamma[row_length - 1]), p_beta[row_length - 1]);
+        }
+    }
+
+    return 0;
+}
+#endif
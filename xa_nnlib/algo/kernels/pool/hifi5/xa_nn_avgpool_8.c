@@ -342,7 +342,7 @@ const WORD8 *__restrict__ p_inp,
     }
 }
 
-WORD32 xa_nn_avgpool_8(
+static WORD32 avgpool_8_run(
       WORD8* __restrict__ p_out,
 const WORD8* __restrict__ p_inp,
       WORD32  input_height,
@@ -360,32 +360,6 @@ const WORD8* __restrict__ p_inp,
       WORD32  out_data_format,
       VOID *p_scratch)
 {
-    /* NULL pointer checks */
-    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
-    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
-    /* Pointer alignment checks */
-    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD8), -1);
-    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD8), -1);
-    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
-    /* Basic Parameter checks */
-    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
-    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
-    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
-    /* Implementation dependent checks */
-    XA_NNLIB_ARG_CHK_COND((kernel_height > 256), -1);
-    XA_NNLIB_ARG_CHK_COND((kernel_width > 256), -1);
-    
-    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
-    // Different I/O data formats (not supported!)
-    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
-
     if((input_channels == 1) || (out_data_format == 1))
     {
         xa_nn_avgpool_init(8,
@@ -550,3 +524,186 @@ const WORD8* __restrict__ p_inp,
     }
     return 0;
 }
+
+WORD32 xa_nn_avgpool_8(
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  inp_data_format,
+      WORD32  out_data_format,
+      VOID *p_scratch)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD8), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD8), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND((kernel_height > 256), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_width > 256), -1);
+    
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
+    // Different I/O data formats (not supported!)
+    XA_NNLIB_ARG_CHK_COND((out_data_format != inp_data_format), -1);
+
+    return avgpool_8_run(p_out
+            ,p_inp
+            ,input_height
+            ,input_width
+            ,input_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,inp_data_format
+            ,out_data_format
+            ,p_scratch);
+}
+
+/* Validated pooling parameters, filled once by plan_create */
+typedef struct _xa_nn_avgpool_8_plan_t
+{
+    WORD32 input_height;
+    WORD32 input_width;
+    WORD32 input_channels;
+    WORD32 kernel_height;
+    WORD32 kernel_width;
+    WORD32 x_stride;
+    WORD32 y_stride;
+    WORD32 x_padding;
+    WORD32 y_padding;
+    WORD32 out_height;
+    WORD32 out_width;
+    WORD32 inp_data_format;
+    WORD32 out_data_format;
+} xa_nn_avgpool_8_plan_t;
+
+WORD32 xa_nn_avgpool_8_plan_getsize(VOID)
+{
+    return (WORD32)ALIGNED_SIZE(sizeof(xa_nn_avgpool_8_plan_t), ALIGNMENT);
+}
+
+WORD32 xa_nn_avgpool_8_plan_create(
+      VOID   *p_plan,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  inp_data_format,
+      WORD32  out_data_format)
+{
+    /* Checks are done once here regardless of DISABLE_ARG_CHK */
+    /* NULL pointer checks */
+    XA_NNLIB_CHK_PTR(p_plan, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_CHK_ALIGN(p_plan, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_CHK_COND((kernel_height > input_height), -1);
+    XA_NNLIB_CHK_COND((kernel_width > input_width), -1);
+    XA_NNLIB_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_CHK_COND((out_data_format != 0) && (out_data_format != 1), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_CHK_COND((kernel_height > 256), -1);
+    XA_NNLIB_CHK_COND((kernel_width > 256), -1);
+
+    XA_NNLIB_CHK_COND((inp_data_format != 0) && (inp_data_format != 1), -1);
+    // Different I/O data formats (not supported!)
+    XA_NNLIB_CHK_COND((out_data_format != inp_data_format), -1);
+
+    xa_nn_avgpool_8_plan_t *p_pool_plan = (xa_nn_avgpool_8_plan_t *)p_plan;
+    p_pool_plan->input_height = input_height;
+    p_pool_plan->input_width = input_width;
+    p_pool_plan->input_channels = input_channels;
+    p_pool_plan->kernel_height = kernel_height;
+    p_pool_plan->kernel_width = kernel_width;
+    p_pool_plan->x_stride = x_stride;
+    p_pool_plan->y_stride = y_stride;
+    p_pool_plan->x_padding = x_padding;
+    p_pool_plan->y_padding = y_padding;
+    p_pool_plan->out_height = out_height;
+    p_pool_plan->out_width = out_width;
+    p_pool_plan->inp_data_format = inp_data_format;
+    p_pool_plan->out_data_format = out_data_format;
+
+    /* Scratch size needed by plan_execute */
+    return xa_nn_avgpool_getsize(input_channels
+            ,8
+            ,8
+            ,input_height
+            ,input_width
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,inp_data_format
+            ,out_data_format);
+}
+
+WORD32 xa_nn_avgpool_8_plan_execute(
+const VOID   *p_plan,
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      VOID   *p_scratch)
+{
+    const xa_nn_avgpool_8_plan_t *p_pool_plan = (const xa_nn_avgpool_8_plan_t *)p_plan;
+
+    return avgpool_8_run(p_out
+            ,p_inp
+            ,p_pool_plan->input_height
+            ,p_pool_plan->input_width
+            ,p_pool_plan->input_channels
+            ,p_pool_plan->kernel_height
+            ,p_pool_plan->kernel_width
+            ,p_pool_plan->x_stride
+            ,p_pool_plan->y_stride
+            ,p_pool_plan->x_padding
+            ,p_pool_plan->y_padding
+            ,p_pool_plan->out_height
+            ,p_pool_plan->out_width
+            ,p_pool_plan->inp_data_format
+            ,p_pool_plan->out_data_format
+            ,p_scratch);
+}
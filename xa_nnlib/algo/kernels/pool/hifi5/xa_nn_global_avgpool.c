@@ -0,0 +1,306 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include "common_fpu.h"
+
+/* Number of int8 positions that can be summed in int16 without overflow */
+#define GAP_BLK_8   256
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32S(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Requantizes 8 channel sums held in (w01, w23, w45, w67) and returns the
+ * int8 outputs; sums must already have input zero bias removed. */
+static inline ae_int8x8 gap_requant_8(ae_int32x2 w01, ae_int32x2 w23,
+                                      ae_int32x2 w45, ae_int32x2 w67,
+                                      WORD32 out_multiplier,
+                                      WORD32 left_shift,
+                                      WORD32 right_shift,
+                                      ae_int32x2 out_zb,
+                                      ae_int16x4 act_min,
+                                      ae_int16x4 act_max)
+{
+  ae_int16x4 out0, out1;
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(w01, out_multiplier, left_shift, right_shift);
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(w23, out_multiplier, left_shift, right_shift);
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(w45, out_multiplier, left_shift, right_shift);
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(w67, out_multiplier, left_shift, right_shift);
+  w01 = AE_ADD32S(w01, out_zb);
+  w23 = AE_ADD32S(w23, out_zb);
+  w45 = AE_ADD32S(w45, out_zb);
+  w67 = AE_ADD32S(w67, out_zb);
+  out0 = AE_SAT16X4(w01, w23);
+  out1 = AE_SAT16X4(w45, w67);
+  AE_MINMAX16(out0, act_min, act_max);
+  AE_MINMAX16(out1, act_min, act_max);
+  return AE_SAT8X8X16(out0, out1);
+}
+
+WORD32 xa_nn_global_avgpool_asym8s_asym8s(
+      WORD8 *__restrict__ p_out,
+const WORD8 *__restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  inp_zero_bias,
+      WORD32  out_multiplier,
+      WORD32  out_shift,
+      WORD32  out_zero_bias,
+      WORD32  out_activation_min,
+      WORD32  out_activation_max)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((inp_zero_bias < -128 || inp_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  int itr_c, itr_hw, itr_blk;
+  int num_pos = input_height * input_width;
+  int left_shift  = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+
+  /* Zero bias is removed once from the final sum instead of per element */
+  ae_int32x2 zb_sum = AE_MOVDA32(num_pos * inp_zero_bias);
+  ae_int32x2 out_zb = AE_MOVDA32(out_zero_bias);
+  ae_int16x4 act_min = AE_MOVDA16(out_activation_min);
+  ae_int16x4 act_max = AE_MOVDA16(out_activation_max);
+  ae_int16x4 one = AE_MOVDA16(1);
+  ae_int8x8 zero8 = AE_MOVDA8(0);
+
+  ae_int8x8 *p_dst = (ae_int8x8 *)p_out;
+  ae_valign align_dst = AE_ZALIGN64();
+
+  /* Channels outer, positions inner: each channel group keeps its sums in
+   * registers, so the whole HxW plane is reduced in one pass without scratch.
+   * Partial sums are kept in 16 bit for up to GAP_BLK_8 positions and then
+   * widened into 32 bit accumulators. */
+  for(itr_c = 0; itr_c < (input_channels & ~15); itr_c += 16)
+  {
+    ae_int32x2 w0, w1, w2, w3, w4, w5, w6, w7;
+    w0 = w1 = w2 = w3 = w4 = w5 = w6 = w7 = AE_ZERO32();
+    const WORD8 *p_src = p_inp + itr_c;
+
+    for(itr_hw = 0; itr_hw < num_pos; itr_hw += GAP_BLK_8)
+    {
+      int blk = XT_MIN(num_pos - itr_hw, GAP_BLK_8);
+      ae_int16x4 acc0, acc1, acc2, acc3;
+      acc0 = acc1 = acc2 = acc3 = AE_ZERO16();
+#pragma loop_count min=1
+      for(itr_blk = 0; itr_blk < blk; itr_blk++)
+      {
+        ae_int8x8 d0, d1;
+        ae_int8x16 *p_s = (ae_int8x16 *)p_src;
+        ae_valignx2 align_src = AE_LA128_PP(p_s);
+        AE_LA8X8X2_IP(d0, d1, align_src, p_s);
+        AE_ACCW8(acc0, acc1, d0, zero8);
+        AE_ACCW8(acc2, acc3, d1, zero8);
+        p_src += input_channels;
+      }
+      AE_MULA16X4(w0, w1, acc0, one);
+      AE_MULA16X4(w2, w3, acc1, one);
+      AE_MULA16X4(w4, w5, acc2, one);
+      AE_MULA16X4(w6, w7, acc3, one);
+    }
+    w0 = AE_SUB32S(w0, zb_sum); w1 = AE_SUB32S(w1, zb_sum);
+    w2 = AE_SUB32S(w2, zb_sum); w3 = AE_SUB32S(w3, zb_sum);
+    w4 = AE_SUB32S(w4, zb_sum); w5 = AE_SUB32S(w5, zb_sum);
+    w6 = AE_SUB32S(w6, zb_sum); w7 = AE_SUB32S(w7, zb_sum);
+
+    ae_int8x8 out0 = gap_requant_8(w0, w1, w2, w3, out_multiplier, left_shift, right_shift, out_zb, act_min, act_max);
+    ae_int8x8 out1 = gap_requant_8(w4, w5, w6, w7, out_multiplier, left_shift, right_shift, out_zb, act_min, act_max);
+    AE_SA8X8_IP(out0, align_dst, p_dst);
+    AE_SA8X8_IP(out1, align_dst, p_dst);
+  }
+
+  if(input_channels & 8)
+  {
+    ae_int32x2 w0, w1, w2, w3;
+    w0 = w1 = w2 = w3 = AE_ZERO32();
+    const WORD8 *p_src = p_inp + itr_c;
+
+    for(itr_hw = 0; itr_hw < num_pos; itr_hw += GAP_BLK_8)
+    {
+      int blk = XT_MIN(num_pos - itr_hw, GAP_BLK_8);
+      ae_int16x4 acc0, acc1;
+      acc0 = acc1 = AE_ZERO16();
+#pragma loop_count min=1
+      for(itr_blk = 0; itr_blk < blk; itr_blk++)
+      {
+        ae_int8x8 d0;
+        ae_int8x8 *p_s = (ae_int8x8 *)p_src;
+        ae_valign align_src = AE_LA64_PP(p_s);
+        AE_LA8X8_IP(d0, align_src, p_s);
+        AE_ACCW8(acc0, acc1, d0, zero8);
+        p_src += input_channels;
+      }
+      AE_MULA16X4(w0, w1, acc0, one);
+      AE_MULA16X4(w2, w3, acc1, one);
+    }
+    w0 = AE_SUB32S(w0, zb_sum); w1 = AE_SUB32S(w1, zb_sum);
+    w2 = AE_SUB32S(w2, zb_sum); w3 = AE_SUB32S(w3, zb_sum);
+
+    ae_int8x8 out0 = gap_requant_8(w0, w1, w2, w3, out_multiplier, left_shift, right_shift, out_zb, act_min, act_max);
+    AE_SA8X8_IP(out0, align_dst, p_dst);
+    itr_c += 8;
+  }
+  AE_SA64POS_FP(align_dst, p_dst);
+
+  /* Remaining (less than 8) channels */
+  for(; itr_c < input_channels; itr_c++)
+  {
+    const WORD8 *p_src = p_inp + itr_c;
+    WORD32 sum = 0;
+    for(itr_hw = 0; itr_hw < num_pos; itr_hw++)
+    {
+      sum += *p_src;
+      p_src += input_channels;
+    }
+    ae_int32x2 w0 = AE_SUB32S(AE_MOVDA32(sum), zb_sum);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(w0, out_multiplier, left_shift, right_shift);
+    w0 = AE_ADD32S(w0, out_zb);
+    w0 = AE_MAX32(w0, AE_MOVDA32(out_activation_min));
+    w0 = AE_MIN32(w0, AE_MOVDA32(out_activation_max));
+    p_out[itr_c] = (WORD8)AE_MOVAD32_L(w0);
+  }
+
+  return 0;
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_global_avgpool_f32,
+             (
+                FLOAT32 *__restrict__ p_out,
+                const FLOAT32 *__restrict__ p_inp,
+                WORD32  input_height,
+                WORD32  input_width,
+                WORD32  input_channels
+              )
+           )
+#else
+WORD32 xa_nn_global_avgpool_f32(
+      FLOAT32 *__restrict__ p_out,
+const FLOAT32 *__restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+
+  int itr_c, itr_hw;
+  int num_pos = input_height * input_width;
+  xtfloatx2 d_inp0, d_inp1, d_acc0, d_acc1;
+  xtfloatx2 *p_src, *p_acc, *p_dst;
+  ae_valign align_src, align_acc, align_dst;
+
+  /* Output row doubles as the accumulator, so the input is streamed
+   * contiguously one position (a full channel vector) at a time. */
+  p_src = (xtfloatx2 *)p_inp;
+  p_dst = (xtfloatx2 *)p_out;
+  align_src = XT_LASX2PP(p_src);
+  align_dst = AE_ZALIGN64();
+  for(itr_c = 0; itr_c < (input_channels >> 1); itr_c++)
+  {
+    XT_LASX2IP(d_inp0, align_src, p_src);
+    XT_SASX2IP(d_inp0, align_dst, p_dst);
+  }
+  XT_SASX2POSFP(align_dst, p_dst);
+  if(input_channels & 1)
+  {
+    p_out[input_channels - 1] = p_inp[input_channels - 1];
+  }
+
+  for(itr_hw = 1; itr_hw < num_pos; itr_hw++)
+  {
+    const FLOAT32 *p_pos = p_inp + itr_hw * input_channels;
+    p_src = (xtfloatx2 *)p_pos;
+    p_acc = (xtfloatx2 *)p_out;
+    p_dst = (xtfloatx2 *)p_out;
+    align_src = XT_LASX2PP(p_src);
+    align_acc = XT_LASX2PP(p_acc);
+    align_dst = AE_ZALIGN64();
+    for(itr_c = 0; itr_c < (input_channels >> 2); itr_c++)
+    {
+      XT_LASX2IP(d_inp0, align_src, p_src);
+      XT_LASX2IP(d_inp1, align_src, p_src);
+      XT_LASX2IP(d_acc0, align_acc, p_acc);
+      XT_LASX2IP(d_acc1, align_acc, p_acc);
+      d_acc0 = XT_ADD_SX2(d_acc0, d_inp0);
+      d_acc1 = XT_ADD_SX2(d_acc1, d_inp1);
+      XT_SASX2IP(d_acc0, align_dst, p_dst);
+      XT_SASX2IP(d_acc1, align_dst, p_dst);
+    }
+    if(input_channels & 2)
+    {
+      XT_LASX2IP(d_inp0, align_src, p_src);
+      XT_LASX2IP(d_acc0, align_acc, p_acc);
+      d_acc0 = XT_ADD_SX2(d_acc0, d_inp0);
+      XT_SASX2IP(d_acc0, align_dst, p_dst);
+    }
+    XT_SASX2POSFP(align_dst, p_dst);
+    if(input_channels & 1)
+    {
+      p_out[input_channels - 1] = XT_ADD_S(p_out[input_channels - 1], p_pos[input_channels - 1]);
+    }
+  }
+
+  /* Final scale by 1/(H*W) */
+  xtfloat inv_num_pos = XT_DIV_S(XT_CONST_S(1), XT_FLOAT_S(num_pos, 0));
+  xtfloatx2 inv_num_pos_x2 = (xtfloatx2)inv_num_pos;
+  p_acc = (xtfloatx2 *)p_out;
+  p_dst = (xtfloatx2 *)p_out;
+  align_acc = XT_LASX2PP(p_acc);
+  align_dst = AE_ZALIGN64();
+  for(itr_c = 0; itr_c < (input_channels >> 1); itr_c++)
+  {
+    XT_LASX2IP(d_acc0, align_acc, p_acc);
+    d_acc0 = XT_MUL_SX2(d_acc0, inv_num_pos_x2);
+    XT_SASX2IP(d_acc0, align_dst, p_dst);
+  }
+  XT_SASX2POSFP(align_dst, p_dst);
+  if(input_channels & 1)
+  {
+    p_out[input_channels - 1] = XT_MUL_S(p_out[input_channels - 1], inv_num_pos);
+  }
+
+  return 0;
+}
+#endif /* HAVE_VFPU */
@@ -30,9 +30,9 @@
 #define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
 #define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
 
-#define  IO_PRECISION_BITS(prec) ((prec == XA_NNLIB_CNN_16bx16b || prec == XA_NNLIB_CNN_8bx16b) ? 16 : ((prec == XA_NNLIB_CNN_8bx8b)   ?  8 : -1))
-#define KER_PRECISION_BITS(prec) ((prec == XA_NNLIB_CNN_8bx8b   || prec == XA_NNLIB_CNN_8bx16b) ?  8 : ((prec == XA_NNLIB_CNN_16bx16b) ? 16 : -1))
-#define IO_PRECISION_BYTES(prec) ((prec == XA_NNLIB_CNN_16bx16b || prec == XA_NNLIB_CNN_8bx16b) ?  2 : ((prec == XA_NNLIB_CNN_8bx8b)   ?  1 : 4))
+#define  IO_PRECISION_BITS(prec) ((prec == XA_NNLIB_CNN_16bx16b || prec == XA_NNLIB_CNN_8bx16b) ? 16 : ((prec == XA_NNLIB_CNN_8bx8b)   ?  8 : ((prec == XA_NNLIB_CNN_SYM8SxASYM8S) ? PREC_ASYM8S : -1)))
+#define KER_PRECISION_BITS(prec) ((prec == XA_NNLIB_CNN_8bx8b   || prec == XA_NNLIB_CNN_8bx16b) ?  8 : ((prec == XA_NNLIB_CNN_16bx16b) ? 16 : ((prec == XA_NNLIB_CNN_SYM8SxASYM8S) ? PREC_SYM8S : -1)))
+#define IO_PRECISION_BYTES(prec) ((prec == XA_NNLIB_CNN_16bx16b || prec == XA_NNLIB_CNN_8bx16b) ?  2 : ((prec == XA_NNLIB_CNN_8bx8b || prec == XA_NNLIB_CNN_SYM8SxASYM8S) ?  1 : 4))
 
 #define CHECK_CUBE_DIMS(shape, type, err)                                               \
 do {                                                                                    \
@@ -147,6 +147,15 @@ typedef struct _cnn_state_t
   void *bias_ds_depth;
   void *bias_ds_point;
 
+  /* Per-channel requantization, XA_NNLIB_CNN_SYM8SxASYM8S only */
+  WORD32 *out_multiplier_std;
+  WORD32 *out_multiplier_ds_depth;
+  WORD32 *out_multiplier_ds_point;
+
+  WORD32 *out_shift_std;
+  WORD32 *out_shift_ds_depth;
+  WORD32 *out_shift_ds_point;
+
 } cnn_state_t;
 
 typedef struct _temp_mem_t
@@ -172,13 +181,30 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
   if((config->precision != XA_NNLIB_CNN_16bx16b)
      && (config->precision != XA_NNLIB_CNN_8bx16b)
      && (config->precision != XA_NNLIB_CNN_8bx8b)
+     && (config->precision != XA_NNLIB_CNN_SYM8SxASYM8S)
 #if HAVE_VFPU
      && (config->precision != XA_NNLIB_CNN_f32xf32)
 #endif
     )
     return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PRECISION;
 
-  if(config->precision != XA_NNLIB_CNN_f32xf32)
+  if(config->precision == XA_NNLIB_CNN_SYM8SxASYM8S)
+  {
+    /* No per-channel 1D convolution kernel */
+    if(config->algo == XA_NNLIB_CNN_CONV1D_STD)
+      return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_COMBINATION;
+
+    if(config->input_zero_bias < -127 || config->input_zero_bias > 128)
+      return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_ZERO_BIAS;
+
+    if(config->out_zero_bias < -128 || config->out_zero_bias > 127)
+      return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_ZERO_BIAS;
+
+    if((config->algo == XA_NNLIB_CNN_CONV2D_DS) &&
+       (config->ds_depth_out_zero_bias < -128 || config->ds_depth_out_zero_bias > 127))
+      return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_ZERO_BIAS;
+  }
+  else if(config->precision != XA_NNLIB_CNN_f32xf32)
   {
     if(config->bias_shift < -31 || config->bias_shift > 31)
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_BIAS_SHIFT;
@@ -243,8 +269,13 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
     }
     else /* (config->algo == XA_NNLIB_CNN_CONV2D_STD) */
     {
-      /* kernel_std must be padded so as depth is multiple of 2 (float) or 4 (fixed) */
-      if(config->precision == XA_NNLIB_CNN_f32xf32)
+      /* kernel_std must be padded so as depth is multiple of 2 (float) or 4 (fixed), per-channel kernel is not padded */
+      if(config->precision == XA_NNLIB_CNN_SYM8SxASYM8S)
+      {
+        if(config->kernel_std_shape.dim.cube.depth != config->kernel_std_shape.dim.cube.width_offset)
+          return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_KERNEL_SHAPE;
+      }
+      else if(config->precision == XA_NNLIB_CNN_f32xf32)
       {
         if(((config->kernel_std_shape.dim.cube.depth+1)&(~1)) != config->kernel_std_shape.dim.cube.width_offset)
           return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_KERNEL_SHAPE;
@@ -279,7 +310,8 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_BIAS_SHAPE;
 
     /* input_channels * channels_multiplier must be multiple of 4 */
-    if((config->input_shape.dim.cube.depth * config->channels_multiplier) & 3)
+    if((config->precision != XA_NNLIB_CNN_SYM8SxASYM8S) &&
+       ((config->input_shape.dim.cube.depth * config->channels_multiplier) & 3))
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_INPUT_SHAPE;
 
     /* output_depth and bias_depth dimensions check */
@@ -294,8 +326,13 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
     if(config->y_stride > config->kernel_ds_depth_shape.dim.cube.height)
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_STRIDE;
 
-    /* kernel_ds_depth_width must be padded to be multiple of 4 */
-    if(((config->kernel_ds_depth_shape.dim.cube.width+3)&(~3)) != config->kernel_ds_depth_shape.dim.cube.height_offset)
+    /* kernel_ds_depth_width must be padded to be multiple of 4, per-channel kernel is not padded */
+    if(config->precision == XA_NNLIB_CNN_SYM8SxASYM8S)
+    {
+      if(config->kernel_ds_depth_shape.dim.cube.width != config->kernel_ds_depth_shape.dim.cube.height_offset)
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_KERNEL_SHAPE;
+    }
+    else if(((config->kernel_ds_depth_shape.dim.cube.width+3)&(~3)) != config->kernel_ds_depth_shape.dim.cube.height_offset)
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_KERNEL_SHAPE;
   }
 
@@ -338,6 +375,24 @@ Int32 xa_nnlib_cnn_get_scratch_fast(
                                              config->input_shape.dim.cube.depth,
                                              inp_precision);
   }
+  else if((config->algo == XA_NNLIB_CNN_CONV2D_STD) && (config->precision == XA_NNLIB_CNN_SYM8SxASYM8S))
+  {
+     scratch_size = xa_nn_conv2d_per_chan_sym8sxasym8s_getsize(config->input_shape.dim.cube.height,
+                                                               config->input_shape.dim.cube.width,
+                                                               config->input_shape.dim.cube.depth,
+                                                               config->kernel_std_shape.dim.cube.height,
+                                                               config->kernel_std_shape.dim.cube.width,
+                                                               config->output_channels,
+                                                               1,
+                                                               config->x_stride,
+                                                               config->y_stride,
+                                                               config->x_padding,
+                                                               config->y_padding,
+                                                               config->output_height,
+                                                               config->output_width,
+                                                               config->output_format,
+                                                               XA_NN_CONV2D_ALGO_AUTO);
+  }
   else if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
   {
      scratch_size = xa_nn_conv2d_std_getsize(config->input_shape.dim.cube.height,
@@ -475,6 +530,46 @@ int xa_nnlib_cnn_set_config(
     }
     break;
 
+    case XA_NNLIB_CNN_OUT_MULTIPLIER:
+    {
+      WORD32 **pp_out_multiplier = (WORD32 **) params;
+
+      if(config->precision != XA_NNLIB_CNN_SYM8SxASYM8S)
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      CHECK_PTR(pp_out_multiplier[0], XA_NNLIB_FATAL_MEM_ALLOC);
+      if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+      {
+        cnn->out_multiplier_std = pp_out_multiplier[0];
+      }
+      else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
+      {
+        cnn->out_multiplier_ds_depth = pp_out_multiplier[0];
+        cnn->out_multiplier_ds_point = pp_out_multiplier[1];
+      }
+    }
+    break;
+
+    case XA_NNLIB_CNN_OUT_SHIFT:
+    {
+      WORD32 **pp_out_shift = (WORD32 **) params;
+
+      if(config->precision != XA_NNLIB_CNN_SYM8SxASYM8S)
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      CHECK_PTR(pp_out_shift[0], XA_NNLIB_FATAL_MEM_ALLOC);
+      if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+      {
+        cnn->out_shift_std = pp_out_shift[0];
+      }
+      else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
+      {
+        cnn->out_shift_ds_depth = pp_out_shift[0];
+        cnn->out_shift_ds_point = pp_out_shift[1];
+      }
+    }
+    break;
+
     default:
     return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
   }
@@ -533,6 +628,44 @@ int xa_nnlib_cnn_get_config(
     }
     break;
 
+    case XA_NNLIB_CNN_OUT_MULTIPLIER:
+    {
+      WORD32 **pp_out_multiplier = (WORD32 **) params;
+
+      if(config->precision != XA_NNLIB_CNN_SYM8SxASYM8S)
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+      {
+        pp_out_multiplier[0] = cnn->out_multiplier_std;
+      }
+      else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
+      {
+        pp_out_multiplier[0] = cnn->out_multiplier_ds_depth;
+        pp_out_multiplier[1] = cnn->out_multiplier_ds_point;
+      }
+    }
+    break;
+
+    case XA_NNLIB_CNN_OUT_SHIFT:
+    {
+      WORD32 **pp_out_shift = (WORD32 **) params;
+
+      if(config->precision != XA_NNLIB_CNN_SYM8SxASYM8S)
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+      {
+        pp_out_shift[0] = cnn->out_shift_std;
+      }
+      else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
+      {
+        pp_out_shift[0] = cnn->out_shift_ds_depth;
+        pp_out_shift[1] = cnn->out_shift_ds_point;
+      }
+    }
+    break;
+
     case XA_NNLIB_CNN_INPUT_SHAPE:
     {
       xa_nnlib_shape_t *inp_shape = (xa_nnlib_shape_t *)params;
@@ -602,6 +735,28 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
     CHECK_PTR_ALIGN(cnn->bias_ds_point,   8, XA_NNLIB_FATAL_MEM_ALIGN);
   }
 
+  if(config->precision == XA_NNLIB_CNN_SYM8SxASYM8S)
+  {
+    if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
+    {
+      CHECK_PTR(cnn->out_multiplier_std, XA_NNLIB_FATAL_MEM_ALLOC);
+      CHECK_PTR(cnn->out_shift_std,      XA_NNLIB_FATAL_MEM_ALLOC);
+      CHECK_PTR_ALIGN(cnn->out_multiplier_std, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+      CHECK_PTR_ALIGN(cnn->out_shift_std,      4, XA_NNLIB_FATAL_MEM_ALIGN);
+    }
+    else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
+    {
+      CHECK_PTR(cnn->out_multiplier_ds_depth, XA_NNLIB_FATAL_MEM_ALLOC);
+      CHECK_PTR(cnn->out_shift_ds_depth,      XA_NNLIB_FATAL_MEM_ALLOC);
+      CHECK_PTR(cnn->out_multiplier_ds_point, XA_NNLIB_FATAL_MEM_ALLOC);
+      CHECK_PTR(cnn->out_shift_ds_point,      XA_NNLIB_FATAL_MEM_ALLOC);
+      CHECK_PTR_ALIGN(cnn->out_multiplier_ds_depth, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+      CHECK_PTR_ALIGN(cnn->out_shift_ds_depth,      4, XA_NNLIB_FATAL_MEM_ALIGN);
+      CHECK_PTR_ALIGN(cnn->out_multiplier_ds_point, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+      CHECK_PTR_ALIGN(cnn->out_shift_ds_point,      4, XA_NNLIB_FATAL_MEM_ALIGN);
+    }
+  }
+
   MATCH_CUBE_DIMS(p_in_shape, config->input_shape, XA_NNLIB_CNN_CONFIG_FATAL_INVALID_INPUT_SHAPE);
 
   inp_precision = IO_PRECISION_BITS(config->precision);
@@ -695,6 +850,11 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       }
       break;
 #endif
+      case XA_NNLIB_CNN_SYM8SxASYM8S:
+      {
+        //rejected by validate_config
+      }
+      break;
     }
   }
   else if(config->algo == XA_NNLIB_CNN_CONV2D_STD)
@@ -773,6 +933,34 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
                                    scratch);
       }
       break;
+      case XA_NNLIB_CNN_SYM8SxASYM8S:
+      {
+        err = xa_nn_conv2d_per_chan_sym8sxasym8s(output,
+                                                 input,
+                                                 cnn->kernel_std,
+                                                 cnn->bias_std,
+                                                 config->input_shape.dim.cube.height,
+                                                 config->input_shape.dim.cube.width,
+                                                 config->input_shape.dim.cube.depth,
+                                                 config->kernel_std_shape.dim.cube.height,
+                                                 config->kernel_std_shape.dim.cube.width,
+                                                 cnn->output_shape.dim.cube.depth,
+                                                 1,
+                                                 config->x_stride,
+                                                 config->y_stride,
+                                                 config->x_padding,
+                                                 config->y_padding,
+                                                 cnn->output_shape.dim.cube.height,
+                                                 cnn->output_shape.dim.cube.width,
+                                                 config->input_zero_bias,
+                                                 cnn->out_multiplier_std,
+                                                 cnn->out_shift_std,
+                                                 config->out_zero_bias,
+                                                 config->output_format,
+                                                 XA_NN_CONV2D_ALGO_AUTO,
+                                                 scratch);
+      }
+      break;
 #if HAVE_VFPU
       case XA_NNLIB_CNN_f32xf32:
       {
@@ -945,6 +1133,50 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
                                          config->output_format);
       }
       break;
+      case XA_NNLIB_CNN_SYM8SxASYM8S:
+      {
+        err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s(depthwise_out_scratch,
+                                                           cnn->kernel_ds_depth,
+                                                           input,
+                                                           cnn->bias_ds_depth,
+                                                           config->input_shape.dim.cube.height,
+                                                           config->input_shape.dim.cube.width,
+                                                           config->input_shape.dim.cube.depth,
+                                                           config->kernel_ds_depth_shape.dim.cube.height,
+                                                           config->kernel_ds_depth_shape.dim.cube.width,
+                                                           config->channels_multiplier,
+                                                           config->x_stride,
+                                                           config->y_stride,
+                                                           config->x_padding,
+                                                           config->y_padding,
+                                                           cnn->output_shape.dim.cube.height,
+                                                           cnn->output_shape.dim.cube.width,
+                                                           config->input_zero_bias,
+                                                           cnn->out_multiplier_ds_depth,
+                                                           cnn->out_shift_ds_depth,
+                                                           config->ds_depth_out_zero_bias,
+                                                           1, //must be WHD
+                                                           0, //must be DWH
+                                                           scratch);
+
+        if (err) break;
+
+        /* Pointwise input is the depthwise output, its zero bias is the negated depthwise output zero point */
+        err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(output,
+                                                           cnn->kernel_ds_point,
+                                                           depthwise_out_scratch,
+                                                           cnn->bias_ds_point,
+                                                           cnn->output_shape.dim.cube.height,
+                                                           cnn->output_shape.dim.cube.width,
+                                                           config->input_shape.dim.cube.depth*config->channels_multiplier,
+                                                           cnn->output_shape.dim.cube.depth,
+                                                           -config->ds_depth_out_zero_bias,
+                                                           cnn->out_multiplier_ds_point,
+                                                           cnn->out_shift_ds_point,
+                                                           config->out_zero_bias,
+                                                           config->output_format);
+      }
+      break;
 #if HAVE_VFPU
       case XA_NNLIB_CNN_f32xf32:
       {
@@ -75,6 +75,22 @@
   }                                                           \
 }
 
+/* n_shapes is the number of time steps and shape_offset the distance in
+   elements between consecutive steps */
+#define CHECK_SEQ_SHAPE(p_shape, feats)                       \
+{                                                             \
+  if(p_shape->n_shapes < 1)                                   \
+  {                                                           \
+    return XA_NNLIB_FATAL_INVALID_SHAPE;                      \
+  }                                                           \
+  if(p_shape->n_shapes > 1 &&                                 \
+     (p_shape->shape_offset < feats ||                        \
+      (p_shape->shape_offset & 3) != 0))                      \
+  {                                                           \
+    return XA_NNLIB_FATAL_INVALID_SHAPE;                      \
+  }                                                           \
+}
+
 extern void xa_nn_elm_mul_16x16_16(WORD16 * __restrict__ output, const WORD16 * __restrict__ input_1, const WORD16 * __restrict__ input_2, WORD32 num_elm);
 
 typedef struct _gru_state_t
@@ -423,67 +439,30 @@ int xa_nnlib_gru_get_config(
   return XA_NNLIB_NO_ERROR;
 }
 
-int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
-    void *scratch,
-    void *input,
-    void *output,
-    xa_nnlib_shape_t *p_in_shape,
-    xa_nnlib_shape_t *p_out_shape )
+static scratch_mem_t *setup_scratch(void *scratch, int out_feats)
 {
-  gru_state_t *gru;
   scratch_mem_t *scratch_mem;
+  char *sptr = (char *)scratch;
 
-  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
-
-  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
-
-  CHECK_IO_SHAPE(p_in_shape);
-  CHECK_IO_SHAPE(p_out_shape);
+  scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
 
-  gru = (gru_state_t *) handle;
-
-  if(p_out_shape->dim.vector.length < gru->out_feats)
-  {
-    return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
-  }
-
-  if(p_in_shape->dim.vector.length < gru->in_feats)
-  {
-    return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA;
-  }
-
-  p_in_shape->dim.vector.length = gru->in_feats;
-  p_out_shape->dim.vector.length = gru->out_feats;
-
-  //setup scratch
-  {
-    char *sptr = (char *)scratch;
-
-    scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
-
-    scratch_alloc(sptr, scratch_mem->z_or_r, vect_t, gru->out_feats);
-    scratch_alloc(sptr, scratch_mem->r_x_prev_h, vect_t, gru->out_feats);
-    scratch_alloc(sptr, scratch_mem->h, vect_t, gru->out_feats);
+  scratch_alloc(sptr, scratch_mem->z_or_r, vect_t, out_feats);
+  scratch_alloc(sptr, scratch_mem->r_x_prev_h, vect_t, out_feats);
+  scratch_alloc(sptr, scratch_mem->h, vect_t, out_feats);
 
 #ifdef MODEL_FLT64
-    scratch_mem->temp_mem.vec = NULL ;
+  scratch_mem->temp_mem.vec = NULL ;
 
 #elif MODEL_INT16
-    scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, gru->out_feats);
+  scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, out_feats);
 
 #endif
-  }
 
+  return scratch_mem;
+}
+
+static void gru_step(gru_state_t *gru, scratch_mem_t *scratch_mem, void *input, void *output)
+{
 #ifdef MODEL_INT16
   if(gru->precision == XA_NNLIB_GRU_16bx16b)
   {
@@ -615,6 +594,139 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         gru->out_feats);
   }
 #endif
+}
+
+int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape )
+{
+  gru_state_t *gru;
+  scratch_mem_t *scratch_mem;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  gru = (gru_state_t *) handle;
+
+  if(p_out_shape->dim.vector.length < gru->out_feats)
+  {
+    return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+
+  if(p_in_shape->dim.vector.length < gru->in_feats)
+  {
+    return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  p_in_shape->dim.vector.length = gru->in_feats;
+  p_out_shape->dim.vector.length = gru->out_feats;
+
+  scratch_mem = setup_scratch(scratch, gru->out_feats);
+
+  gru_step(gru, scratch_mem, input, output);
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+int xa_nnlib_gru_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape,
+    xa_nnlib_gru_direction_t direction)
+{
+  gru_state_t *gru;
+  scratch_mem_t *scratch_mem;
+  vect_t *p_in, *p_out;
+  int n_steps, in_stride, out_stride, t;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  gru = (gru_state_t *) handle;
+
+  if((direction != XA_NNLIB_GRU_FORWARD) && (direction != XA_NNLIB_GRU_BACKWARD))
+  {
+    return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_DIRECTION;
+  }
+
+  if(p_out_shape->dim.vector.length < gru->out_feats)
+  {
+    return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+
+  if(p_in_shape->dim.vector.length < gru->in_feats)
+  {
+    return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  CHECK_SEQ_SHAPE(p_in_shape, gru->in_feats);
+  CHECK_SEQ_SHAPE(p_out_shape, gru->out_feats);
+
+  if(p_in_shape->n_shapes != p_out_shape->n_shapes)
+  {
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+  }
+
+  p_in_shape->dim.vector.length = gru->in_feats;
+  p_out_shape->dim.vector.length = gru->out_feats;
+
+  n_steps = p_in_shape->n_shapes;
+  in_stride = (n_steps > 1) ? p_in_shape->shape_offset : 0;
+  out_stride = (n_steps > 1) ? p_out_shape->shape_offset : 0;
+  p_in = (vect_t *)input;
+  p_out = (vect_t *)output;
+
+  /* Backward direction walks the same buffers from the last step, so its
+     outputs land in the same time slots as the forward ones */
+  if(direction == XA_NNLIB_GRU_BACKWARD)
+  {
+    p_in += (n_steps - 1) * in_stride;
+    p_out += (n_steps - 1) * out_stride;
+    in_stride = -in_stride;
+    out_stride = -out_stride;
+  }
+
+  scratch_mem = setup_scratch(scratch, gru->out_feats);
+
+  for(t = 0; t < n_steps; t++)
+  {
+    gru_step(gru, scratch_mem, p_in, p_out);
+    p_in += in_stride;
+    p_out += out_stride;
+  }
 
   return XA_NNLIB_NO_ERROR;
 }
@@ -74,21 +74,54 @@
   }                                                           \
 }
 
+/* n_shapes is the number of time steps and shape_offset the distance in
+   elements between consecutive steps */
+#define CHECK_SEQ_SHAPE(p_shape, feats)                       \
+{                                                             \
+  if(p_shape->n_shapes < 1)                                   \
+  {                                                           \
+    return XA_NNLIB_FATAL_INVALID_SHAPE;                      \
+  }                                                           \
+  if(p_shape->n_shapes > 1 &&                                 \
+     (p_shape->shape_offset < feats ||                        \
+      (p_shape->shape_offset & 3) != 0))                      \
+  {                                                           \
+    return XA_NNLIB_FATAL_INVALID_SHAPE;                      \
+  }                                                           \
+}
+
+#define LSTM_IS_VARIANT(p) \
+  ((p)->use_cifg || (p)->use_peephole || (p)->use_layer_norm || (p)->proj_feats)
+
 typedef struct _lstm_state_t
 {
   vect_t *prev_h;
   int *prev_c;
   xa_nnlib_lstm_weights_t weights;
   xa_nnlib_lstm_biases_t biases;
+  xa_nnlib_lstm_peephole_t peephole;
+  xa_nnlib_lstm_projection_t projection;
+  xa_nnlib_lstm_layer_norm_t layer_norm;
+  coeff_t *zero_bias;
+  Int32 *ln_beta;
   int in_feats;
   int out_feats;
+  int h_feats;
   int pad;
   int precision;
+  int coeff_Qformat;
   int bias_shift;
   int matmul_lsh;
   int h_lsh;
   int fXprev_c_lsh;
   int iXc_hat_lsh;
+  int use_cifg;
+  int use_peephole;
+  int use_layer_norm;
+  int proj_feats;
+  int proj_clip;
+  int peep_lsh;
+  int ln_out_shift;
 } lstm_state_t;
 
 typedef struct _temp_mem_t
@@ -101,6 +134,8 @@ typedef struct _scratch_mem_t
   vect_t *f_f;
   vect_t *i_f_or_o_f;
   vect_t *c_hat_f_or_tanh_c_f;
+  vect_t *m;
+  Int16 *ln_buf;
   temp_mem_t temp_mem;
 } scratch_mem_t;
 
@@ -143,6 +178,77 @@ static void lstm_output_kernel_16x16_16(Int16 * __restrict__ output, Int16 * __r
   }
 }
 
+/* acc += (cell * peep) in Q6.25 */
+static void vec_peephole_acc_32x16(Int32 * __restrict__ acc, Int32 * __restrict__ cell, Int16 * __restrict__ peep, int lsh, int num_elm)
+{
+#pragma aligned(acc, 8)
+#pragma aligned(cell, 8)
+#pragma aligned(peep, 8)
+  int i;
+  ae_f32x2 *out = (ae_f32x2 *)acc, *inp1 = (ae_f32x2 *)cell;
+  ae_f16x4 *inp2 = (ae_f16x4 *)peep;
+  for(i=0;i<num_elm>>2;i++)
+  {
+    ae_f32x2 res1 = AE_SLAA32S(AE_MULFP32X16X2RS_H(inp1[2*i], inp2[i]), lsh);
+    ae_f32x2 res2 = AE_SLAA32S(AE_MULFP32X16X2RS_L_S2(inp1[2*i+1], inp2[i]), lsh);
+    out[2*i] = AE_ADD32S(out[2*i], res1);
+    out[2*i+1] = AE_ADD32S(out[2*i+1], res2);
+  }
+}
+
+static void vec_shift_32_16(Int16 * __restrict__ output, Int32 * __restrict__ input, int rsh, int num_elm)
+{
+#pragma aligned(output, 8)
+#pragma aligned(input, 8)
+  int i;
+  ae_int32x2 *inp = (ae_int32x2 *)input;
+  ae_int16x4 *out = (ae_int16x4 *)output;
+  for(i=0;i<num_elm>>2;i++)
+  {
+    out[i] = AE_SAT16X4(AE_SRAA32SYMS(inp[2*i], rsh), AE_SRAA32SYMS(inp[2*i+1], rsh));
+  }
+}
+
+static void vec_shift_16_32(Int32 * __restrict__ output, Int16 * __restrict__ input, int lsh, int num_elm)
+{
+#pragma aligned(output, 8)
+#pragma aligned(input, 8)
+  int i;
+  ae_int16x4 *inp = (ae_int16x4 *)input;
+  ae_int32x2 *out = (ae_int32x2 *)output;
+  for(i=0;i<num_elm>>2;i++)
+  {
+    out[2*i] = AE_SLAA32S(AE_SEXT32X2D16_32(inp[i]), lsh);
+    out[2*i+1] = AE_SLAA32S(AE_SEXT32X2D16_10(inp[i]), lsh);
+  }
+}
+
+/* CIFG input gate, i = 1 - f in Q15 */
+static void vec_one_minus_16(Int16 * __restrict__ output, Int16 * __restrict__ input, int num_elm)
+{
+#pragma aligned(output, 8)
+#pragma aligned(input, 8)
+  int i;
+  ae_int16x4 *inp = (ae_int16x4 *)input, *out = (ae_int16x4 *)output;
+  ae_int16x4 one = AE_MOVDA16(32767);
+  for(i=0;i<num_elm>>2;i++)
+  {
+    out[i] = AE_SUB16S(one, inp[i]);
+  }
+}
+
+static void vec_clip_16(Int16 * __restrict__ output, int clip, int num_elm)
+{
+#pragma aligned(output, 8)
+  int i;
+  ae_int16x4 *out = (ae_int16x4 *)output;
+  ae_int16x4 max = AE_MOVDA16(clip), min = AE_MOVDA16(-clip);
+  for(i=0;i<num_elm>>2;i++)
+  {
+    out[i] = AE_MIN16(AE_MAX16(out[i], min), max);
+  }
+}
+
 static Int32 validate_config(xa_nnlib_lstm_init_config_t *config)
 {
   if(config->in_feats < 4 || config->in_feats > 2048 || (config->in_feats&3) != 0)
@@ -166,23 +272,42 @@ static Int32 validate_config(xa_nnlib_lstm_init_config_t *config)
   if((config->pad !=0) && (config->pad != 1))
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING;
 
+  if((config->use_cifg != 0 && config->use_cifg != 1) ||
+     (config->use_peephole != 0 && config->use_peephole != 1) ||
+     (config->use_layer_norm != 0 && config->use_layer_norm != 1))
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_VARIANT;
+
+  if(config->proj_feats != 0 && (config->proj_feats < 4 || config->proj_feats > 2048 || (config->proj_feats&3) != 0))
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PROJ_FEATS;
+
+  if(config->proj_clip < 0 || (config->proj_feats == 0 && config->proj_clip != 0))
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_VARIANT;
+
   return XA_NNLIB_NO_ERROR;
 }
 
 Int32 xa_nnlib_lstm_get_persistent_fast(
      xa_nnlib_lstm_init_config_t *config )
 {
-  int persistent_size, ret;
+  int persistent_size, h_feats, ret;
   CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
 
   ret = validate_config(config);
   if(ret != XA_NNLIB_NO_ERROR)
     return ret;
 
+  h_feats = config->proj_feats ? config->proj_feats : config->out_feats;
+
   persistent_size  = ALIGN_SIZE(sizeof(lstm_state_t));
   // Size of prev_h and prev_c
-  persistent_size += ALIGN_SIZE(config->out_feats * sizeof(vect_t));
+  persistent_size += ALIGN_SIZE(h_feats * sizeof(vect_t));
   persistent_size += ALIGN_SIZE(config->out_feats * sizeof(int));
+  // Layer norm betas for the four gates
+  if(config->use_layer_norm)
+    persistent_size += ALIGN_SIZE(4 * config->out_feats * sizeof(Int32));
+  // Zero bias for bias-free matXvec calls
+  if(config->use_layer_norm || config->proj_feats)
+    persistent_size += ALIGN_SIZE(XT_MAX(config->out_feats, config->proj_feats) * sizeof(coeff_t));
 
   return persistent_size;
 }
@@ -204,6 +329,10 @@ Int32 xa_nnlib_lstm_get_scratch_fast(
 #elif MODEL_INT16
   scratch_size += ALIGN_SIZE(1 * config->out_feats * sizeof(Int32));    //vect scratch
 #endif
+  if(config->proj_feats)
+    scratch_size += ALIGN_SIZE(config->out_feats * sizeof(vect_t));    //projection input
+  if(config->use_layer_norm)
+    scratch_size += ALIGN_SIZE(config->out_feats * sizeof(Int16));     //layer norm input
 
   return scratch_size;
 }
@@ -213,6 +342,7 @@ int xa_nnlib_lstm_init(
     xa_nnlib_lstm_init_config_t *config )
 {
   lstm_state_t *lstm;
+  char *sptr;
   int ret;
 
   CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
@@ -236,12 +366,37 @@ int xa_nnlib_lstm_init(
   lstm->iXc_hat_lsh = config->cell_Qformat - (15 + 15);  // For Q15xQ15 to cell_Qformat conversion
   lstm->h_lsh = config->io_Qformat - 15;  // For Q15 to io_Qformat conversion
 
+  lstm->coeff_Qformat  = config->coeff_Qformat;
+  lstm->use_cifg       = config->use_cifg;
+  lstm->use_peephole   = config->use_peephole;
+  lstm->use_layer_norm = config->use_layer_norm;
+  lstm->proj_feats     = config->proj_feats;
+  lstm->proj_clip      = config->proj_clip;
+  lstm->h_feats        = config->proj_feats ? config->proj_feats : config->out_feats;
+  // For cell_QformatxQcoeff >> 15 to Q6.25 conversion
+  lstm->peep_lsh = XT_MIN(40 - (config->cell_Qformat + config->coeff_Qformat), 31);
+  // Layer norm output n*gamma in Qcoeff, times 0.5 in out_multiplier, to Q12
+  lstm->ln_out_shift = 13 - config->coeff_Qformat;
+
   lstm->prev_h = (vect_t *)ALIGN_MEM((char *)handle + sizeof(lstm_state_t));
-  memset(lstm->prev_h,0, config->out_feats * sizeof(vect_t));
+  memset(lstm->prev_h,0, lstm->h_feats * sizeof(vect_t));
 
-  lstm->prev_c = (int *)ALIGN_MEM((char *)lstm->prev_h + config->out_feats * sizeof(vect_t));
+  lstm->prev_c = (int *)ALIGN_MEM((char *)lstm->prev_h + lstm->h_feats * sizeof(vect_t));
   memset(lstm->prev_c,0, config->out_feats * sizeof(int));
 
+  sptr = (char *)lstm->prev_c + config->out_feats * sizeof(int);
+  if(config->use_layer_norm)
+  {
+    lstm->ln_beta = (Int32 *)ALIGN_MEM(sptr);
+    memset(lstm->ln_beta, 0, 4 * config->out_feats * sizeof(Int32));
+    sptr = (char *)lstm->ln_beta + 4 * config->out_feats * sizeof(Int32);
+  }
+  if(config->use_layer_norm || config->proj_feats)
+  {
+    lstm->zero_bias = (coeff_t *)ALIGN_MEM(sptr);
+    memset(lstm->zero_bias, 0, XT_MAX(config->out_feats, config->proj_feats) * sizeof(coeff_t));
+  }
+
   return XA_NNLIB_NO_ERROR;
 }
 
@@ -269,14 +424,18 @@ int xa_nnlib_lstm_set_config(
       if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
       {
           CHECK_MTX_SHAPE(p_weights->weights16.shape_w_xf, lstm->out_feats, lstm->in_feats)
-          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_xi, lstm->out_feats, lstm->in_feats)
           CHECK_MTX_SHAPE(p_weights->weights16.shape_w_xc, lstm->out_feats, lstm->in_feats)
           CHECK_MTX_SHAPE(p_weights->weights16.shape_w_xo, lstm->out_feats, lstm->in_feats)
 
-          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_hf, lstm->out_feats, lstm->out_feats)
-          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_hi, lstm->out_feats, lstm->out_feats)
-          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_hc, lstm->out_feats, lstm->out_feats)
-          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_ho, lstm->out_feats, lstm->out_feats)
+          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_hf, lstm->out_feats, lstm->h_feats)
+          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_hc, lstm->out_feats, lstm->h_feats)
+          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_ho, lstm->out_feats, lstm->h_feats)
+
+          if(!lstm->use_cifg)
+          {
+            CHECK_MTX_SHAPE(p_weights->weights16.shape_w_xi, lstm->out_feats, lstm->in_feats)
+            CHECK_MTX_SHAPE(p_weights->weights16.shape_w_hi, lstm->out_feats, lstm->h_feats)
+          }
 
           lstm->weights.weights16.w_xf = p_weights->weights16.w_xf;
           lstm->weights.weights16.w_xi = p_weights->weights16.w_xi;
@@ -291,14 +450,18 @@ int xa_nnlib_lstm_set_config(
       else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
       {
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xf, lstm->out_feats, lstm->in_feats)
-          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xi, lstm->out_feats, lstm->in_feats)
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xc, lstm->out_feats, lstm->in_feats)
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xo, lstm->out_feats, lstm->in_feats)
 
-          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_hf, lstm->out_feats, lstm->out_feats)
-          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_hi, lstm->out_feats, lstm->out_feats)
-          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_hc, lstm->out_feats, lstm->out_feats)
-          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_ho, lstm->out_feats, lstm->out_feats)
+          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_hf, lstm->out_feats, lstm->h_feats)
+          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_hc, lstm->out_feats, lstm->h_feats)
+          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_ho, lstm->out_feats, lstm->h_feats)
+
+          if(!lstm->use_cifg)
+          {
+            CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xi, lstm->out_feats, lstm->in_feats)
+            CHECK_MTX_SHAPE(p_weights->weights8.shape_w_hi, lstm->out_feats, lstm->h_feats)
+          }
 
           lstm->weights.weights8.w_xf = p_weights->weights8.w_xf;
           lstm->weights.weights8.w_xi = p_weights->weights8.w_xi;
@@ -319,14 +482,107 @@ int xa_nnlib_lstm_set_config(
       p_biases = (xa_nnlib_lstm_biases_t *)params;
 
       CHECK_VEC_SHAPE(p_biases->shape_b_f, lstm->out_feats)
-      CHECK_VEC_SHAPE(p_biases->shape_b_i, lstm->out_feats)
       CHECK_VEC_SHAPE(p_biases->shape_b_c, lstm->out_feats)
       CHECK_VEC_SHAPE(p_biases->shape_b_o, lstm->out_feats)
+      if(!lstm->use_cifg)
+      {
+        CHECK_VEC_SHAPE(p_biases->shape_b_i, lstm->out_feats)
+      }
 
       lstm->biases.b_f = p_biases->b_f;
       lstm->biases.b_i = p_biases->b_i;
       lstm->biases.b_c = p_biases->b_c;
       lstm->biases.b_o = p_biases->b_o;
+
+      /* With layer norm the biases are added after normalization, as
+         layer_norm betas in Q(coeff_Qformat+10) */
+      if(lstm->use_layer_norm)
+      {
+        coeff_t *p_b[4];
+        int g, k, lsh = lstm->coeff_Qformat - 5;
+
+        p_b[0] = lstm->biases.b_f;
+        p_b[1] = lstm->use_cifg ? NULL : lstm->biases.b_i;
+        p_b[2] = lstm->biases.b_c;
+        p_b[3] = lstm->biases.b_o;
+        for(g = 0; g < 4; g++)
+        {
+          Int32 *p_beta = lstm->ln_beta + g * lstm->out_feats;
+          for(k = 0; k < lstm->out_feats; k++)
+          {
+            Int32 b = p_b[g] ? p_b[g][k] : 0;
+            p_beta[k] = (lsh >= 0) ? (b << lsh) : (b >> -lsh);
+          }
+        }
+      }
+    }
+    break;
+
+    case XA_NNLIB_LSTM_PEEPHOLE:
+    {
+      xa_nnlib_lstm_peephole_t *p_peephole;
+      p_peephole = (xa_nnlib_lstm_peephole_t *)params;
+
+      if(!lstm->use_peephole)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      CHECK_VEC_SHAPE(p_peephole->shape_p_f, lstm->out_feats)
+      CHECK_VEC_SHAPE(p_peephole->shape_p_o, lstm->out_feats)
+      if(!lstm->use_cifg)
+      {
+        CHECK_VEC_SHAPE(p_peephole->shape_p_i, lstm->out_feats)
+      }
+
+      memcpy(&(lstm->peephole), p_peephole, sizeof(xa_nnlib_lstm_peephole_t));
+    }
+    break;
+
+    case XA_NNLIB_LSTM_PROJECTION:
+    {
+      xa_nnlib_lstm_projection_t *p_proj;
+      p_proj = (xa_nnlib_lstm_projection_t *)params;
+
+      if(!lstm->proj_feats)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+      {
+        CHECK_MTX_SHAPE(p_proj->proj16.shape_w_proj, lstm->proj_feats, lstm->out_feats)
+        if(p_proj->proj16.b_proj)
+        {
+          CHECK_VEC_SHAPE(p_proj->proj16.shape_b_proj, lstm->proj_feats)
+        }
+      }
+      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+      {
+        CHECK_MTX_SHAPE(p_proj->proj8.shape_w_proj, lstm->proj_feats, lstm->out_feats)
+        if(p_proj->proj8.b_proj)
+        {
+          CHECK_VEC_SHAPE(p_proj->proj8.shape_b_proj, lstm->proj_feats)
+        }
+      }
+
+      memcpy(&(lstm->projection), p_proj, sizeof(xa_nnlib_lstm_projection_t));
+    }
+    break;
+
+    case XA_NNLIB_LSTM_LAYER_NORM:
+    {
+      xa_nnlib_lstm_layer_norm_t *p_ln;
+      p_ln = (xa_nnlib_lstm_layer_norm_t *)params;
+
+      if(!lstm->use_layer_norm)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      CHECK_VEC_SHAPE(p_ln->shape_ln_f, lstm->out_feats)
+      CHECK_VEC_SHAPE(p_ln->shape_ln_c, lstm->out_feats)
+      CHECK_VEC_SHAPE(p_ln->shape_ln_o, lstm->out_feats)
+      if(!lstm->use_cifg)
+      {
+        CHECK_VEC_SHAPE(p_ln->shape_ln_i, lstm->out_feats)
+      }
+
+      memcpy(&(lstm->layer_norm), p_ln, sizeof(xa_nnlib_lstm_layer_norm_t));
     }
     break;
 
@@ -335,7 +591,7 @@ int xa_nnlib_lstm_set_config(
       vect_t *prev_h;
       prev_h = (vect_t *)params;
 
-      memcpy(lstm->prev_h,prev_h,lstm->out_feats * sizeof(vect_t));
+      memcpy(lstm->prev_h,prev_h,lstm->h_feats * sizeof(vect_t));
     }
     break;
 
@@ -441,6 +697,33 @@ int xa_nnlib_lstm_get_config(
     }
     break;
 
+    case XA_NNLIB_LSTM_PEEPHOLE:
+    {
+      if(!lstm->use_peephole)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      memcpy(params, &(lstm->peephole), sizeof(xa_nnlib_lstm_peephole_t));
+    }
+    break;
+
+    case XA_NNLIB_LSTM_PROJECTION:
+    {
+      if(!lstm->proj_feats)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      memcpy(params, &(lstm->projection), sizeof(xa_nnlib_lstm_projection_t));
+    }
+    break;
+
+    case XA_NNLIB_LSTM_LAYER_NORM:
+    {
+      if(!lstm->use_layer_norm)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      memcpy(params, &(lstm->layer_norm), sizeof(xa_nnlib_lstm_layer_norm_t));
+    }
+    break;
+
     case XA_NNLIB_LSTM_INPUT_SHAPE:
     {
       xa_nnlib_shape_t *inp_shape;
@@ -456,7 +739,7 @@ int xa_nnlib_lstm_get_config(
     {
       xa_nnlib_shape_t *out_shape;
       out_shape = (xa_nnlib_shape_t *)params;
-      out_shape->dim.vector.length = lstm->out_feats;
+      out_shape->dim.vector.length = lstm->h_feats;
       out_shape->shape_type = SHAPE_VECTOR_T;
       out_shape->n_shapes = 1;
       out_shape->shape_offset = -1;
@@ -468,7 +751,7 @@ int xa_nnlib_lstm_get_config(
       vect_t *prev_h;
       prev_h = (vect_t *)params;
 
-      memcpy(prev_h,lstm->prev_h,lstm->out_feats * sizeof(vect_t));
+      memcpy(prev_h,lstm->prev_h,lstm->h_feats * sizeof(vect_t));
     }
     break;
 
@@ -488,69 +771,246 @@ int xa_nnlib_lstm_get_config(
   return XA_NNLIB_NO_ERROR;
 }
 
-int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
-    void *scratch,
-    void *input,
-    void *output,
-    xa_nnlib_shape_t *p_in_shape,
-    xa_nnlib_shape_t *p_out_shape)
+static scratch_mem_t *setup_scratch(void *scratch, lstm_state_t *lstm)
 {
-  lstm_state_t *lstm;
   scratch_mem_t *scratch_mem;
+  char *sptr = (char *)scratch;
+  int out_feats = lstm->out_feats;
 
-  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
-  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
 
-  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
-  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  scratch_alloc(sptr, scratch_mem->f_f, vect_t, out_feats);
+  scratch_alloc(sptr, scratch_mem->i_f_or_o_f, vect_t, out_feats);
+  scratch_alloc(sptr, scratch_mem->c_hat_f_or_tanh_c_f, vect_t, out_feats);
 
-  CHECK_IO_SHAPE(p_in_shape);
-  CHECK_IO_SHAPE(p_out_shape);
+#ifdef MODEL_FLT64
+  scratch_mem->temp_mem.vec = NULL ;
 
-  lstm = (lstm_state_t *) handle;
+#elif MODEL_INT16
+  scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, out_feats);
+
+#endif
 
-  if(p_out_shape->dim.vector.length < lstm->out_feats)
+  scratch_mem->m = NULL;
+  scratch_mem->ln_buf = NULL;
+  if(lstm->proj_feats)
   {
-    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+    scratch_alloc(sptr, scratch_mem->m, vect_t, out_feats);
+  }
+  if(lstm->use_layer_norm)
+  {
+    scratch_alloc(sptr, scratch_mem->ln_buf, Int16, out_feats);
   }
 
-  if(p_in_shape->dim.vector.length < lstm->in_feats)
+  return scratch_mem;
+}
+
+#ifdef MODEL_INT16
+/* One gate of the CIFG/peephole/layer norm/projection cell. The fused
+   matXvec_*_sigmoid/tanh kernels are split into matXvec_*_32, which leaves
+   the Q6.25 pre-activation in temp_mem.vec for the peephole and layer
+   norm terms, and the 32-bit input activation kernels. */
+static void lstm_variant_gate(lstm_state_t *lstm,
+    scratch_mem_t *scratch_mem,
+    vect_t *output,
+    void *w_x,
+    void *w_h,
+    coeff_t *bias,
+    Int32 *ln_beta,
+    coeff_t *ln_gamma,
+    coeff_t *peep,
+    void *input,
+    int use_tanh)
+{
+  Int32 *acc = scratch_mem->temp_mem.vec;
+  coeff_t *p_bias = lstm->use_layer_norm ? lstm->zero_bias : bias;
+
+  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
   {
-    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
+    xa_nn_matXvec_16x16_32(
+        acc,
+        (coeff_t *)w_x,
+        (coeff_t *)w_h,
+        input,
+        lstm->prev_h,
+        p_bias,
+        lstm->out_feats,
+        lstm->in_feats,
+        lstm->h_feats,
+        lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+        lstm->h_feats + lstm->pad*XA_PAD_BYTES,
+        lstm->matmul_lsh,
+        lstm->bias_shift);
+  }
+  else
+  {
+    xa_nn_matXvec_8x16_32(
+        acc,
+        (coeff8_t *)w_x,
+        (coeff8_t *)w_h,
+        input,
+        lstm->prev_h,
+        p_bias,
+        lstm->out_feats,
+        lstm->in_feats,
+        lstm->h_feats,
+        lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+        lstm->h_feats + lstm->pad*XA_PAD_BYTES,
+        lstm->matmul_lsh,
+        lstm->bias_shift);
   }
 
-  p_in_shape->dim.vector.length = lstm->in_feats;
-  p_out_shape->dim.vector.length = lstm->out_feats;
+  if(peep != NULL)
+  {
+    vec_peephole_acc_32x16(acc, lstm->prev_c, peep, lstm->peep_lsh, lstm->out_feats);
+  }
 
-  //setup scratch
+  if(lstm->use_layer_norm)
   {
-    char *sptr = (char *)scratch;
+    /* Q6.25 to Q10 in, Q12 out, back to Q6.25 for the activation */
+    vec_shift_32_16(scratch_mem->ln_buf, acc, 15, lstm->out_feats);
+    xa_nn_layer_norm_sym16s_sym16s(
+        output,
+        scratch_mem->ln_buf,
+        ln_gamma,
+        ln_beta,
+        1,
+        lstm->out_feats,
+        0x40000000,
+        lstm->ln_out_shift,
+        1);
+    vec_shift_16_32(acc, output, 13, lstm->out_feats);
+  }
+
+  if(use_tanh)
+    xa_nn_vec_tanh_32_16(output, acc, lstm->out_feats);
+  else
+    xa_nn_vec_sigmoid_32_16(output, acc, lstm->out_feats);
+}
 
-    scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
+static void lstm_variant_step(lstm_state_t *lstm, scratch_mem_t *scratch_mem, void *input, void *output)
+{
+  int is16 = (lstm->precision == XA_NNLIB_LSTM_16bx16b);
+  int N = lstm->out_feats;
+  xa_nnlib_lstm_peephole_t *peep = lstm->use_peephole ? &lstm->peephole : NULL;
+  xa_nnlib_lstm_layer_norm_t *ln = &lstm->layer_norm;
 
-    scratch_alloc(sptr, scratch_mem->f_f, vect_t, lstm->out_feats);
-    scratch_alloc(sptr, scratch_mem->i_f_or_o_f, vect_t, lstm->out_feats);
-    scratch_alloc(sptr, scratch_mem->c_hat_f_or_tanh_c_f, vect_t, lstm->out_feats);
+#define GATE_W(g) (is16 ? (void *)lstm->weights.weights16.g : (void *)lstm->weights.weights8.g)
 
-#ifdef MODEL_FLT64
-    scratch_mem->temp_mem.vec = NULL ;
+  lstm_variant_gate(lstm, scratch_mem, scratch_mem->f_f,
+      GATE_W(w_xf), GATE_W(w_hf), lstm->biases.b_f,
+      lstm->ln_beta, ln->ln_f, peep ? peep->p_f : NULL, input, 0);
 
-#elif MODEL_INT16
-    scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
+  if(lstm->use_cifg)
+  {
+    vec_one_minus_16(scratch_mem->i_f_or_o_f, scratch_mem->f_f, N);
+  }
+  else
+  {
+    lstm_variant_gate(lstm, scratch_mem, scratch_mem->i_f_or_o_f,
+        GATE_W(w_xi), GATE_W(w_hi), lstm->biases.b_i,
+        lstm->ln_beta + N, ln->ln_i, peep ? peep->p_i : NULL, input, 0);
+  }
 
-#endif
+  lstm_variant_gate(lstm, scratch_mem, scratch_mem->c_hat_f_or_tanh_c_f,
+      GATE_W(w_xc), GATE_W(w_hc), lstm->biases.b_c,
+      lstm->ln_beta + 2*N, ln->ln_c, NULL, input, 1);
+
+  vec_elem_mul_16x32plus16x16_16(
+      lstm->prev_c,
+      scratch_mem->f_f,
+      lstm->prev_c,
+      scratch_mem->i_f_or_o_f,
+      scratch_mem->c_hat_f_or_tanh_c_f,
+      lstm->fXprev_c_lsh,
+      lstm->iXc_hat_lsh,
+      N);
+
+  /* Output gate peephole sees the updated cell state */
+  lstm_variant_gate(lstm, scratch_mem, scratch_mem->i_f_or_o_f,
+      GATE_W(w_xo), GATE_W(w_ho), lstm->biases.b_o,
+      lstm->ln_beta + 3*N, ln->ln_o, peep ? peep->p_o : NULL, input, 0);
+
+#undef GATE_W
+
+  xa_nn_vec_tanh_32_16(
+      scratch_mem->c_hat_f_or_tanh_c_f,
+      lstm->prev_c,
+      N);
+
+  if(!lstm->proj_feats)
+  {
+    lstm_output_kernel_16x16_16(
+        (vect_t*)output,
+        lstm->prev_h,
+        scratch_mem->i_f_or_o_f,
+        scratch_mem->c_hat_f_or_tanh_c_f,
+        lstm->h_lsh,
+        N);
+    return;
+  }
+
+  /* m = o * tanh(c) in io_Qformat; f_f is free and takes the unused copy */
+  lstm_output_kernel_16x16_16(
+      scratch_mem->m,
+      scratch_mem->f_f,
+      scratch_mem->i_f_or_o_f,
+      scratch_mem->c_hat_f_or_tanh_c_f,
+      lstm->h_lsh,
+      N);
+
+  if(is16)
+  {
+    xa_nn_matXvec_16x16_16(
+        (vect_t*)output,
+        lstm->projection.proj16.w_proj,
+        NULL,
+        scratch_mem->m,
+        NULL,
+        lstm->projection.proj16.b_proj ? lstm->projection.proj16.b_proj : lstm->zero_bias,
+        lstm->proj_feats,
+        N,
+        0,
+        N + lstm->pad*XA_PAD_BYTES,
+        0,
+        -lstm->coeff_Qformat,
+        lstm->bias_shift);
+  }
+  else
+  {
+    xa_nn_matXvec_8x16_16(
+        (vect_t*)output,
+        lstm->projection.proj8.w_proj,
+        NULL,
+        scratch_mem->m,
+        NULL,
+        lstm->projection.proj8.b_proj ? lstm->projection.proj8.b_proj : lstm->zero_bias,
+        lstm->proj_feats,
+        N,
+        0,
+        N + lstm->pad*XA_PAD_BYTES,
+        0,
+        -lstm->coeff_Qformat,
+        lstm->bias_shift);
+  }
+
+  if(lstm->proj_clip)
+  {
+    vec_clip_16((vect_t*)output, lstm->proj_clip, lstm->proj_feats);
   }
 
+  memcpy(lstm->prev_h, output, lstm->proj_feats * sizeof(vect_t));
+}
+#endif
+
+static void lstm_step(lstm_state_t *lstm, scratch_mem_t *scratch_mem, void *input, void *output)
+{
 #ifdef MODEL_INT16
-  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  if(LSTM_IS_VARIANT(lstm))
+  {
+    lstm_variant_step(lstm, scratch_mem, input, output);
+  }
+  else if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
   {
 
     xa_nn_matXvec_16x16_16_sigmoid(
@@ -741,6 +1201,139 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
 
   }
 #endif
+}
+
+int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape)
+{
+  lstm_state_t *lstm;
+  scratch_mem_t *scratch_mem;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  lstm = (lstm_state_t *) handle;
+
+  if(p_out_shape->dim.vector.length < lstm->h_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+
+  if(p_in_shape->dim.vector.length < lstm->in_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  p_in_shape->dim.vector.length = lstm->in_feats;
+  p_out_shape->dim.vector.length = lstm->h_feats;
+
+  scratch_mem = setup_scratch(scratch, lstm);
+
+  lstm_step(lstm, scratch_mem, input, output);
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+int xa_nnlib_lstm_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape,
+    xa_nnlib_lstm_direction_t direction)
+{
+  lstm_state_t *lstm;
+  scratch_mem_t *scratch_mem;
+  vect_t *p_in, *p_out;
+  int n_steps, in_stride, out_stride, t;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  lstm = (lstm_state_t *) handle;
+
+  if((direction != XA_NNLIB_LSTM_FORWARD) && (direction != XA_NNLIB_LSTM_BACKWARD))
+  {
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_DIRECTION;
+  }
+
+  if(p_out_shape->dim.vector.length < lstm->h_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+
+  if(p_in_shape->dim.vector.length < lstm->in_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  CHECK_SEQ_SHAPE(p_in_shape, lstm->in_feats);
+  CHECK_SEQ_SHAPE(p_out_shape, lstm->h_feats);
+
+  if(p_in_shape->n_shapes != p_out_shape->n_shapes)
+  {
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+  }
+
+  p_in_shape->dim.vector.length = lstm->in_feats;
+  p_out_shape->dim.vector.length = lstm->h_feats;
+
+  n_steps = p_in_shape->n_shapes;
+  in_stride = (n_steps > 1) ? p_in_shape->shape_offset : 0;
+  out_stride = (n_steps > 1) ? p_out_shape->shape_offset : 0;
+  p_in = (vect_t *)input;
+  p_out = (vect_t *)output;
+
+  /* Backward direction walks the same buffers from the last step, so its
+     outputs land in the same time slots as the forward ones */
+  if(direction == XA_NNLIB_LSTM_BACKWARD)
+  {
+    p_in += (n_steps - 1) * in_stride;
+    p_out += (n_steps - 1) * out_stride;
+    in_stride = -in_stride;
+    out_stride = -out_stride;
+  }
+
+  scratch_mem = setup_scratch(scratch, lstm);
+
+  for(t = 0; t < n_steps; t++)
+  {
+    lstm_step(lstm, scratch_mem, p_in, p_out);
+    p_in += in_stride;
+    p_out += out_stride;
+  }
 
   return XA_NNLIB_NO_ERROR;
 }
@@ -0,0 +1,442 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_model_api.h"
+
+#ifdef hifi4
+#define XA_PAD_BYTES   8
+#endif
+#ifdef hifi5
+#define XA_PAD_BYTES   16
+#endif
+
+#define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+
+#define SECTION_PTR(p_blob, p_tbl, idx) ((p_tbl)->section_size[idx] ? (void *)((const char *)(p_blob) + (p_tbl)->section_offset[idx]) : NULL)
+
+#define FILL_SHAPE_MATRIX(shape, rows_shape, cols_shape)  \
+{                                                         \
+  shape.shape_type = SHAPE_MATRIX_T;                      \
+  shape.dim.matrix.rows = rows_shape;                     \
+  shape.dim.matrix.cols = cols_shape;                     \
+  shape.dim.matrix.row_offset = cols_shape;               \
+  shape.n_shapes = 1;                                     \
+  shape.shape_offset = -1;                                \
+}
+
+#define FILL_SHAPE_VECTOR(shape, length_shape)            \
+{                                                         \
+  shape.shape_type = SHAPE_VECTOR_T;                      \
+  shape.dim.vector.length = length_shape;                 \
+  shape.n_shapes = 1;                                     \
+  shape.shape_offset = -1;                                \
+}
+
+#define BIND_MATRIX(ptr, shape, type, idx, rows, cols)                \
+{                                                                     \
+  ptr = (type *)SECTION_PTR(p_blob, p_tbl, idx);                      \
+  FILL_SHAPE_MATRIX(shape, rows, cols)                                \
+}
+
+#define BIND_VECTOR(ptr, shape, type, idx, length)                    \
+{                                                                     \
+  ptr = (type *)SECTION_PTR(p_blob, p_tbl, idx);                      \
+  FILL_SHAPE_VECTOR(shape, length)                                    \
+}
+
+#define BIND_GRU_WEIGHTS(w, type, in, out)                                          \
+{                                                                                   \
+  BIND_MATRIX(w.w_z, w.shape_w_z, type, XA_NNLIB_MODEL_GRU_W_Z, out, in)            \
+  BIND_MATRIX(w.u_z, w.shape_u_z, type, XA_NNLIB_MODEL_GRU_U_Z, out, out)           \
+  BIND_MATRIX(w.w_r, w.shape_w_r, type, XA_NNLIB_MODEL_GRU_W_R, out, in)            \
+  BIND_MATRIX(w.u_r, w.shape_u_r, type, XA_NNLIB_MODEL_GRU_U_R, out, out)           \
+  BIND_MATRIX(w.w_h, w.shape_w_h, type, XA_NNLIB_MODEL_GRU_W_H, out, in)            \
+  BIND_MATRIX(w.u_h, w.shape_u_h, type, XA_NNLIB_MODEL_GRU_U_H, out, out)           \
+}
+
+#define BIND_LSTM_WEIGHTS(w, type, in, out)                                         \
+{                                                                                   \
+  BIND_MATRIX(w.w_xf, w.shape_w_xf, type, XA_NNLIB_MODEL_LSTM_W_XF, out, in)        \
+  BIND_MATRIX(w.w_hf, w.shape_w_hf, type, XA_NNLIB_MODEL_LSTM_W_HF, out, out)       \
+  BIND_MATRIX(w.w_xi, w.shape_w_xi, type, XA_NNLIB_MODEL_LSTM_W_XI, out, in)        \
+  BIND_MATRIX(w.w_hi, w.shape_w_hi, type, XA_NNLIB_MODEL_LSTM_W_HI, out, out)       \
+  BIND_MATRIX(w.w_xc, w.shape_w_xc, type, XA_NNLIB_MODEL_LSTM_W_XC, out, in)        \
+  BIND_MATRIX(w.w_hc, w.shape_w_hc, type, XA_NNLIB_MODEL_LSTM_W_HC, out, out)       \
+  BIND_MATRIX(w.w_xo, w.shape_w_xo, type, XA_NNLIB_MODEL_LSTM_W_XO, out, in)        \
+  BIND_MATRIX(w.w_ho, w.shape_w_ho, type, XA_NNLIB_MODEL_LSTM_W_HO, out, out)       \
+}
+
+/* Expected size of a recurrent layer section, matrices rows are padded
+   by XA_PAD_BYTES elements when the config pad flag is set          */
+static Int32 rnn_section_size(Int32 idx, Int32 n_mat, Int32 in_feats, Int32 out_feats, Int32 pad, Int32 coeff_bytes)
+{
+  /* Sections alternate input (x) and recurrent (h) matrices, followed by biases */
+  if(idx >= n_mat)
+    return out_feats * sizeof(coeff_t);
+  if((idx & 1) == 0)
+    return out_feats * (in_feats + pad*XA_PAD_BYTES) * coeff_bytes;
+  return out_feats * (out_feats + pad*XA_PAD_BYTES) * coeff_bytes;
+}
+
+/* Expected size of a CNN layer section, kernels are stored with the padding
+   of their config shapes; sections of the second convolution are only used
+   by XA_NNLIB_CNN_CONV2D_DS, multipliers and shifts only by
+   XA_NNLIB_CNN_SYM8SxASYM8S                                              */
+static Int32 cnn_section_size(Int32 idx, const xa_nnlib_cnn_init_config_t *cfg)
+{
+  Int32 conv = idx & 1;
+  Int32 ker_bytes, bias_bytes, n_ch, ker_elems;
+
+  switch(cfg->precision)
+  {
+    case XA_NNLIB_CNN_16bx16b:      ker_bytes = 2; bias_bytes = 2; break;
+    case XA_NNLIB_CNN_8bx16b:       ker_bytes = 1; bias_bytes = 2; break;
+    case XA_NNLIB_CNN_8bx8b:        ker_bytes = 1; bias_bytes = 1; break;
+    case XA_NNLIB_CNN_SYM8SxASYM8S: ker_bytes = 1; bias_bytes = 4; break;
+    default:                        ker_bytes = 4; bias_bytes = 4; break;
+  }
+
+  if(cfg->algo != XA_NNLIB_CNN_CONV2D_DS)
+  {
+    if(conv)
+      return 0;
+    n_ch = cfg->output_channels;
+    ker_elems = n_ch * cfg->kernel_std_shape.dim.cube.height * cfg->kernel_std_shape.dim.cube.height_offset;
+  }
+  else if(conv == 0)
+  {
+    n_ch = cfg->kernel_ds_depth_shape.dim.cube.depth;
+    ker_elems = n_ch * cfg->kernel_ds_depth_shape.dim.cube.depth_offset;
+  }
+  else
+  {
+    n_ch = cfg->output_channels;
+    ker_elems = cfg->kernel_ds_point_shape.dim.matrix.rows * cfg->kernel_ds_point_shape.dim.matrix.cols;
+  }
+
+  switch(idx >> 1)
+  {
+    case 0:  return ker_elems * ker_bytes;
+    case 1:  return n_ch * bias_bytes;
+    default: return (cfg->precision == XA_NNLIB_CNN_SYM8SxASYM8S) ? n_ch * (Int32)sizeof(WORD32) : 0;
+  }
+}
+
+static Int32 check_sections(const xa_nnlib_model_layer_t *p_tbl, void *p_config)
+{
+  Int32 i;
+
+  switch(p_tbl->type)
+  {
+    case XA_NNLIB_NET_LAYER_GRU:
+    {
+      xa_nnlib_gru_init_config_t *cfg = (xa_nnlib_gru_init_config_t *)p_config;
+      Int32 coeff_bytes = (cfg->precision == XA_NNLIB_GRU_16bx16b) ? sizeof(coeff_t) : sizeof(coeff8_t);
+
+      for(i = 0; i < XA_NNLIB_MODEL_GRU_N_SECTIONS; i++)
+      {
+        if(p_tbl->section_size[i] != rnn_section_size(i, XA_NNLIB_MODEL_GRU_B_Z, cfg->in_feats, cfg->out_feats, cfg->pad, coeff_bytes))
+          return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_SECTION;
+      }
+    }
+    break;
+
+    case XA_NNLIB_NET_LAYER_LSTM:
+    {
+      xa_nnlib_lstm_init_config_t *cfg = (xa_nnlib_lstm_init_config_t *)p_config;
+      Int32 coeff_bytes = (cfg->precision == XA_NNLIB_LSTM_16bx16b) ? sizeof(coeff_t) : sizeof(coeff8_t);
+
+      /* Blob sections cover the basic cell only */
+      if(cfg->use_cifg || cfg->use_peephole || cfg->use_layer_norm || cfg->proj_feats)
+        return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_SECTION;
+
+      for(i = 0; i < XA_NNLIB_MODEL_LSTM_N_SECTIONS; i++)
+      {
+        if(p_tbl->section_size[i] != rnn_section_size(i, XA_NNLIB_MODEL_LSTM_B_F, cfg->in_feats, cfg->out_feats, cfg->pad, coeff_bytes))
+          return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_SECTION;
+      }
+    }
+    break;
+
+    case XA_NNLIB_NET_LAYER_CNN:
+    {
+      xa_nnlib_cnn_init_config_t *cfg = (xa_nnlib_cnn_init_config_t *)p_config;
+
+      /* Kernel, bias and (per-channel only) multiplier, shift for each convolution */
+      for(i = 0; i < XA_NNLIB_MODEL_CNN_N_SECTIONS; i++)
+      {
+        if(p_tbl->section_size[i] != cnn_section_size(i, cfg))
+          return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_SECTION;
+      }
+    }
+    break;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* Checks the blob and fills the network config, layer init configs are
+   used in place from the blob */
+static Int32 parse_model(const void *p_blob,
+    Int32 blob_size,
+    xa_nnlib_net_layer_config_t *p_layers,
+    xa_nnlib_net_init_config_t *p_net_cfg)
+{
+  const xa_nnlib_model_header_t *p_hdr;
+  const xa_nnlib_model_layer_t *p_tbl;
+  Int32 i, j, ret;
+
+  CHECK_PTR(p_blob, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(p_blob, XA_NNLIB_MODEL_ALIGNMENT, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  if(blob_size < (Int32)sizeof(xa_nnlib_model_header_t))
+    return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT;
+
+  p_hdr = (const xa_nnlib_model_header_t *)p_blob;
+
+  if(p_hdr->magic != XA_NNLIB_MODEL_MAGIC)
+    return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_MAGIC;
+
+  if(p_hdr->version != XA_NNLIB_MODEL_VERSION)
+    return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_VERSION;
+
+  if(p_hdr->blob_size > blob_size)
+    return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT;
+
+  if(p_hdr->n_layers <= 0 || p_hdr->n_layers > XA_NNLIB_NET_MAX_LAYERS)
+    return XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS;
+
+  if((p_hdr->layer_table_offset < (Int32)sizeof(xa_nnlib_model_header_t)) ||
+     (p_hdr->layer_table_offset & (sizeof(Int32) - 1)) ||
+     (p_hdr->layer_table_offset > p_hdr->blob_size - p_hdr->n_layers * (Int32)sizeof(xa_nnlib_model_layer_t)))
+    return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT;
+
+  p_tbl = (const xa_nnlib_model_layer_t *)((const char *)p_blob + p_hdr->layer_table_offset);
+
+  for(i = 0; i < p_hdr->n_layers; i++, p_tbl++)
+  {
+    Int32 config_size;
+
+    switch(p_tbl->type)
+    {
+      case XA_NNLIB_NET_LAYER_CNN:  config_size = sizeof(xa_nnlib_cnn_init_config_t);  break;
+      case XA_NNLIB_NET_LAYER_LSTM: config_size = sizeof(xa_nnlib_lstm_init_config_t); break;
+      case XA_NNLIB_NET_LAYER_GRU:  config_size = sizeof(xa_nnlib_gru_init_config_t);  break;
+      default: return XA_NNLIB_NET_CONFIG_FATAL_INVALID_LAYER_TYPE;
+    }
+
+    if((p_tbl->config_size != config_size) ||
+       (p_tbl->config_offset <= 0) ||
+       (p_tbl->config_offset & (XA_NNLIB_MODEL_ALIGNMENT - 1)) ||
+       (p_tbl->config_offset > p_hdr->blob_size - config_size))
+      return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT;
+
+    for(j = 0; j < XA_NNLIB_MODEL_MAX_SECTIONS; j++)
+    {
+      if(p_tbl->section_size[j] == 0)
+      {
+        if(p_tbl->section_offset[j] != 0)
+          return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT;
+      }
+      else if((p_tbl->section_size[j] < 0) ||
+              (p_tbl->section_offset[j] <= 0) ||
+              (p_tbl->section_offset[j] & (XA_NNLIB_MODEL_ALIGNMENT - 1)) ||
+              (p_tbl->section_offset[j] > p_hdr->blob_size - p_tbl->section_size[j]))
+        return XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT;
+    }
+
+    p_layers[i].type = (xa_nnlib_net_layer_type_t)p_tbl->type;
+    p_layers[i].p_config = (void *)((const char *)p_blob + p_tbl->config_offset);
+  }
+
+  p_net_cfg->n_layers = p_hdr->n_layers;
+  p_net_cfg->p_layers = p_layers;
+
+  /* Validates layer configs and layer chaining */
+  ret = xa_nnlib_net_get_persistent_fast(p_net_cfg);
+  if(ret < 0)
+    return ret;
+
+  p_tbl = (const xa_nnlib_model_layer_t *)((const char *)p_blob + p_hdr->layer_table_offset);
+  for(i = 0; i < p_hdr->n_layers; i++, p_tbl++)
+  {
+    ret = check_sections(p_tbl, p_layers[i].p_config);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+static Int32 bind_layer(xa_nnlib_handle_t layer_handle,
+    const void *p_blob,
+    const xa_nnlib_model_layer_t *p_tbl,
+    void *p_config)
+{
+  Int32 ret = XA_NNLIB_NO_ERROR;
+
+  switch(p_tbl->type)
+  {
+    case XA_NNLIB_NET_LAYER_GRU:
+    {
+      xa_nnlib_gru_init_config_t *cfg = (xa_nnlib_gru_init_config_t *)p_config;
+      xa_nnlib_gru_weights_t weights;
+      xa_nnlib_gru_biases_t biases;
+
+      if(cfg->precision == XA_NNLIB_GRU_16bx16b)
+      {
+        BIND_GRU_WEIGHTS(weights.weights16, coeff_t, cfg->in_feats, cfg->out_feats)
+      }
+      else
+      {
+        BIND_GRU_WEIGHTS(weights.weights8, coeff8_t, cfg->in_feats, cfg->out_feats)
+      }
+      BIND_VECTOR(biases.b_z, biases.shape_b_z, coeff_t, XA_NNLIB_MODEL_GRU_B_Z, cfg->out_feats)
+      BIND_VECTOR(biases.b_r, biases.shape_b_r, coeff_t, XA_NNLIB_MODEL_GRU_B_R, cfg->out_feats)
+      BIND_VECTOR(biases.b_h, biases.shape_b_h, coeff_t, XA_NNLIB_MODEL_GRU_B_H, cfg->out_feats)
+
+      ret = xa_nnlib_gru_set_config(layer_handle, XA_NNLIB_GRU_WEIGHT, &weights);
+      if(ret == XA_NNLIB_NO_ERROR)
+        ret = xa_nnlib_gru_set_config(layer_handle, XA_NNLIB_GRU_BIAS, &biases);
+    }
+    break;
+
+    case XA_NNLIB_NET_LAYER_LSTM:
+    {
+      xa_nnlib_lstm_init_config_t *cfg = (xa_nnlib_lstm_init_config_t *)p_config;
+      xa_nnlib_lstm_weights_t weights;
+      xa_nnlib_lstm_biases_t biases;
+
+      if(cfg->precision == XA_NNLIB_LSTM_16bx16b)
+      {
+        BIND_LSTM_WEIGHTS(weights.weights16, coeff_t, cfg->in_feats, cfg->out_feats)
+      }
+      else
+      {
+        BIND_LSTM_WEIGHTS(weights.weights8, coeff8_t, cfg->in_feats, cfg->out_feats)
+      }
+      BIND_VECTOR(biases.b_f, biases.shape_b_f, coeff_t, XA_NNLIB_MODEL_LSTM_B_F, cfg->out_feats)
+      BIND_VECTOR(biases.b_i, biases.shape_b_i, coeff_t, XA_NNLIB_MODEL_LSTM_B_I, cfg->out_feats)
+      BIND_VECTOR(biases.b_c, biases.shape_b_c, coeff_t, XA_NNLIB_MODEL_LSTM_B_C, cfg->out_feats)
+      BIND_VECTOR(biases.b_o, biases.shape_b_o, coeff_t, XA_NNLIB_MODEL_LSTM_B_O, cfg->out_feats)
+
+      ret = xa_nnlib_lstm_set_config(layer_handle, XA_NNLIB_LSTM_WEIGHT, &weights);
+      if(ret == XA_NNLIB_NO_ERROR)
+        ret = xa_nnlib_lstm_set_config(layer_handle, XA_NNLIB_LSTM_BIAS, &biases);
+    }
+    break;
+
+    case XA_NNLIB_NET_LAYER_CNN:
+    {
+      xa_nnlib_cnn_init_config_t *cfg = (xa_nnlib_cnn_init_config_t *)p_config;
+      void *pp_params[2];
+
+      pp_params[0] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_KERNEL_0);
+      pp_params[1] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_KERNEL_1);
+      ret = xa_nnlib_cnn_set_config(layer_handle, XA_NNLIB_CNN_KERNEL, pp_params);
+      if(ret != XA_NNLIB_NO_ERROR)
+        break;
+
+      pp_params[0] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_BIAS_0);
+      pp_params[1] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_BIAS_1);
+      ret = xa_nnlib_cnn_set_config(layer_handle, XA_NNLIB_CNN_BIAS, pp_params);
+      if(ret != XA_NNLIB_NO_ERROR || cfg->precision != XA_NNLIB_CNN_SYM8SxASYM8S)
+        break;
+
+      pp_params[0] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_OUT_MULTIPLIER_0);
+      pp_params[1] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_OUT_MULTIPLIER_1);
+      ret = xa_nnlib_cnn_set_config(layer_handle, XA_NNLIB_CNN_OUT_MULTIPLIER, pp_params);
+      if(ret != XA_NNLIB_NO_ERROR)
+        break;
+
+      pp_params[0] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_OUT_SHIFT_0);
+      pp_params[1] = SECTION_PTR(p_blob, p_tbl, XA_NNLIB_MODEL_CNN_OUT_SHIFT_1);
+      ret = xa_nnlib_cnn_set_config(layer_handle, XA_NNLIB_CNN_OUT_SHIFT, pp_params);
+    }
+    break;
+  }
+
+  return ret;
+}
+
+Int32 xa_nnlib_model_get_persistent_fast(const void *p_blob, Int32 blob_size)
+{
+  xa_nnlib_net_layer_config_t layers[XA_NNLIB_NET_MAX_LAYERS];
+  xa_nnlib_net_init_config_t net_cfg;
+  Int32 ret;
+
+  ret = parse_model(p_blob, blob_size, layers, &net_cfg);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  return xa_nnlib_net_get_persistent_fast(&net_cfg);
+}
+
+Int32 xa_nnlib_model_get_scratch_fast(const void *p_blob, Int32 blob_size)
+{
+  xa_nnlib_net_layer_config_t layers[XA_NNLIB_NET_MAX_LAYERS];
+  xa_nnlib_net_init_config_t net_cfg;
+  Int32 ret;
+
+  ret = parse_model(p_blob, blob_size, layers, &net_cfg);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  return xa_nnlib_net_get_scratch_fast(&net_cfg);
+}
+
+Int32 xa_nnlib_model_init(xa_nnlib_handle_t handle, const void *p_blob, Int32 blob_size)
+{
+  xa_nnlib_net_layer_config_t layers[XA_NNLIB_NET_MAX_LAYERS];
+  xa_nnlib_net_init_config_t net_cfg;
+  const xa_nnlib_model_layer_t *p_tbl;
+  xa_nnlib_net_layer_handle_t layer_handle;
+  Int32 ret, i;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = parse_model(p_blob, blob_size, layers, &net_cfg);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  ret = xa_nnlib_net_init(handle, &net_cfg);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  /* Weights are bound in place, nothing is copied out of the blob */
+  p_tbl = (const xa_nnlib_model_layer_t *)((const char *)p_blob + ((const xa_nnlib_model_header_t *)p_blob)->layer_table_offset);
+  for(i = 0; i < net_cfg.n_layers; i++, p_tbl++)
+  {
+    layer_handle.layer_idx = i;
+    ret = xa_nnlib_net_get_config(handle, XA_NNLIB_NET_LAYER_HANDLE, &layer_handle);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+
+    ret = bind_layer(layer_handle.handle, p_blob, p_tbl, layers[i].p_config);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
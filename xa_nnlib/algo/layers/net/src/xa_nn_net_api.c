@@ -0,0 +1,420 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_net_api.h"
+
+#define ALIGN_SIZE(n) (((n)+15)&(~15))
+#define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+
+#define CNN_IO_BYTES(prec) ((prec == XA_NNLIB_CNN_16bx16b || prec == XA_NNLIB_CNN_8bx16b) ?  2 : ((prec == XA_NNLIB_CNN_8bx8b || prec == XA_NNLIB_CNN_SYM8SxASYM8S) ?  1 : 4))
+
+typedef struct _net_layer_t
+{
+  Int32 type;
+  xa_nnlib_handle_t handle;
+
+  Int32 persistent_size;
+  Int32 scratch_size;
+
+  /* I/O sizes, used to check chaining and to size the activation buffers */
+  Int32 in_elems;
+  Int32 out_elems;
+  Int32 io_bytewidth;
+
+  /* Shapes passed to process for intermediate layers */
+  xa_nnlib_shape_t in_shape;
+  xa_nnlib_shape_t out_shape;
+
+} net_layer_t;
+
+typedef struct _net_state_t
+{
+  Int32 n_layers;
+  Int32 max_scratch_size;     /* Largest layer scratch, shared by all layers */
+  Int32 max_act_size;         /* Largest intermediate activation, size of each ping-pong buffer */
+
+  net_layer_t layers[XA_NNLIB_NET_MAX_LAYERS];
+
+} net_state_t;
+
+static Int32 get_layer_info(xa_nnlib_net_layer_config_t *p_layer_cfg, net_layer_t *p_layer)
+{
+  CHECK_PTR(p_layer_cfg->p_config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  memset(p_layer, 0, sizeof(net_layer_t));
+  p_layer->type = p_layer_cfg->type;
+
+  switch(p_layer_cfg->type)
+  {
+    case XA_NNLIB_NET_LAYER_CNN:
+    {
+      xa_nnlib_cnn_init_config_t *cfg = (xa_nnlib_cnn_init_config_t *)p_layer_cfg->p_config;
+
+      p_layer->persistent_size = xa_nnlib_cnn_get_persistent_fast(cfg);
+      p_layer->scratch_size    = xa_nnlib_cnn_get_scratch_fast(cfg);
+
+      memcpy(&p_layer->in_shape, &cfg->input_shape, sizeof(xa_nnlib_shape_t));
+      p_layer->in_elems     = cfg->input_shape.dim.cube.height * cfg->input_shape.dim.cube.width * cfg->input_shape.dim.cube.depth;
+      p_layer->out_elems    = cfg->output_height * cfg->output_width * cfg->output_channels;
+      p_layer->io_bytewidth = CNN_IO_BYTES(cfg->precision);
+    }
+    break;
+
+    case XA_NNLIB_NET_LAYER_LSTM:
+    {
+      xa_nnlib_lstm_init_config_t *cfg = (xa_nnlib_lstm_init_config_t *)p_layer_cfg->p_config;
+
+      p_layer->persistent_size = xa_nnlib_lstm_get_persistent_fast(cfg);
+      p_layer->scratch_size    = xa_nnlib_lstm_get_scratch_fast(cfg);
+
+      p_layer->in_elems     = cfg->in_feats;
+      p_layer->out_elems    = cfg->proj_feats ? cfg->proj_feats : cfg->out_feats;
+      p_layer->io_bytewidth = sizeof(vect_t);
+    }
+    break;
+
+    case XA_NNLIB_NET_LAYER_GRU:
+    {
+      xa_nnlib_gru_init_config_t *cfg = (xa_nnlib_gru_init_config_t *)p_layer_cfg->p_config;
+
+      p_layer->persistent_size = xa_nnlib_gru_get_persistent_fast(cfg);
+      p_layer->scratch_size    = xa_nnlib_gru_get_scratch_fast(cfg);
+
+      p_layer->in_elems     = cfg->in_feats;
+      p_layer->out_elems    = cfg->out_feats;
+      p_layer->io_bytewidth = sizeof(vect_t);
+    }
+    break;
+
+    default:
+    return XA_NNLIB_NET_CONFIG_FATAL_INVALID_LAYER_TYPE;
+  }
+
+  /* Layer config errors are returned as is */
+  if(p_layer->persistent_size < 0)
+    return p_layer->persistent_size;
+  if(p_layer->scratch_size < 0)
+    return p_layer->scratch_size;
+
+  if(p_layer->type != XA_NNLIB_NET_LAYER_CNN)
+  {
+    p_layer->in_shape.shape_type = SHAPE_VECTOR_T;
+    p_layer->in_shape.dim.vector.length = p_layer->in_elems;
+    p_layer->in_shape.n_shapes = 1;
+    p_layer->in_shape.shape_offset = -1;
+
+    p_layer->out_shape.shape_type = SHAPE_VECTOR_T;
+    p_layer->out_shape.dim.vector.length = p_layer->out_elems;
+    p_layer->out_shape.n_shapes = 1;
+    p_layer->out_shape.shape_offset = -1;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* Collects per layer sizes and checks that each layer output can be fed
+   as is to the next layer input */
+static Int32 plan_net(xa_nnlib_net_init_config_t *config, net_state_t *p_net)
+{
+  Int32 i, ret;
+
+  CHECK_PTR(config->p_layers, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  if(config->n_layers <= 0 || config->n_layers > XA_NNLIB_NET_MAX_LAYERS)
+    return XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS;
+
+  p_net->n_layers = config->n_layers;
+  p_net->max_scratch_size = 0;
+  p_net->max_act_size = 0;
+
+  for(i = 0; i < config->n_layers; i++)
+  {
+    net_layer_t *p_layer = &p_net->layers[i];
+
+    ret = get_layer_info(&config->p_layers[i], p_layer);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+
+    if(p_layer->scratch_size > p_net->max_scratch_size)
+      p_net->max_scratch_size = p_layer->scratch_size;
+
+    if(i > 0)
+    {
+      net_layer_t *p_prev = &p_net->layers[i-1];
+
+      if((p_prev->out_elems != p_layer->in_elems) ||
+         (p_prev->io_bytewidth != p_layer->io_bytewidth))
+        return XA_NNLIB_NET_CONFIG_FATAL_LAYER_MISMATCH;
+
+      /* 2D convolution output layout must match next convolution input layout */
+      if(p_prev->type == XA_NNLIB_NET_LAYER_CNN && p_layer->type == XA_NNLIB_NET_LAYER_CNN)
+      {
+        xa_nnlib_cnn_init_config_t *prev_cfg = (xa_nnlib_cnn_init_config_t *)config->p_layers[i-1].p_config;
+
+        if((prev_cfg->algo != XA_NNLIB_CNN_CONV1D_STD) &&
+           (p_layer->in_shape.shape_type != (prev_cfg->output_format == 0 ? SHAPE_CUBE_DWH_T : SHAPE_CUBE_WHD_T)))
+          return XA_NNLIB_NET_CONFIG_FATAL_LAYER_MISMATCH;
+      }
+
+      /* Output of layer i-1 lives in a ping-pong buffer */
+      if(p_prev->out_elems * p_prev->io_bytewidth > p_net->max_act_size)
+        p_net->max_act_size = p_prev->out_elems * p_prev->io_bytewidth;
+    }
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+static Int32 layer_process(net_layer_t *p_layer,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape)
+{
+  switch(p_layer->type)
+  {
+    case XA_NNLIB_NET_LAYER_CNN:
+      return xa_nnlib_cnn_process(p_layer->handle, scratch, input, output, p_in_shape, p_out_shape);
+    case XA_NNLIB_NET_LAYER_LSTM:
+      return xa_nnlib_lstm_process(p_layer->handle, scratch, input, output, p_in_shape, p_out_shape);
+    case XA_NNLIB_NET_LAYER_GRU:
+      return xa_nnlib_gru_process(p_layer->handle, scratch, input, output, p_in_shape, p_out_shape);
+    default:
+      return XA_NNLIB_NET_CONFIG_FATAL_INVALID_LAYER_TYPE;
+  }
+}
+
+Int32 xa_nnlib_net_get_persistent_fast(
+     xa_nnlib_net_init_config_t *config )
+{
+  net_state_t net;
+  int persistent_size, ret, i;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = plan_net(config, &net);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  /* Network state followed by the persistent memory of each layer */
+  persistent_size = ALIGN_SIZE(sizeof(net_state_t));
+  for(i = 0; i < net.n_layers; i++)
+  {
+    persistent_size += ALIGN_SIZE(net.layers[i].persistent_size);
+  }
+
+  return persistent_size;
+}
+
+Int32 xa_nnlib_net_get_scratch_fast(
+       xa_nnlib_net_init_config_t *config )
+{
+  net_state_t net;
+  int scratch_size, n_act_bufs, ret;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = plan_net(config, &net);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  /* One scratch shared by all layers followed by up to two ping-pong
+     activation buffers; network input and output are caller buffers */
+  n_act_bufs = (net.n_layers - 1) < 2 ? (net.n_layers - 1) : 2;
+
+  scratch_size  = ALIGN_SIZE(net.max_scratch_size);
+  scratch_size += n_act_bufs * ALIGN_SIZE(net.max_act_size);
+
+  return scratch_size;
+}
+
+Int32 xa_nnlib_net_init(
+    xa_nnlib_handle_t handle,
+    xa_nnlib_net_init_config_t *config )
+{
+  net_state_t *net;
+  char *p_persistent;
+  int ret, i;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  net = (net_state_t *) handle;
+  memset(net, 0, sizeof(net_state_t));
+
+  ret = plan_net(config, net);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  p_persistent = (char *)handle + ALIGN_SIZE(sizeof(net_state_t));
+  for(i = 0; i < net->n_layers; i++)
+  {
+    net_layer_t *p_layer = &net->layers[i];
+
+    p_layer->handle = (xa_nnlib_handle_t)p_persistent;
+    p_persistent += ALIGN_SIZE(p_layer->persistent_size);
+
+    switch(p_layer->type)
+    {
+      case XA_NNLIB_NET_LAYER_CNN:
+        ret = xa_nnlib_cnn_init(p_layer->handle, (xa_nnlib_cnn_init_config_t *)config->p_layers[i].p_config);
+        if(ret == XA_NNLIB_NO_ERROR)
+          ret = xa_nnlib_cnn_get_config(p_layer->handle, XA_NNLIB_CNN_OUTPUT_SHAPE, &p_layer->out_shape);
+        break;
+      case XA_NNLIB_NET_LAYER_LSTM:
+        ret = xa_nnlib_lstm_init(p_layer->handle, (xa_nnlib_lstm_init_config_t *)config->p_layers[i].p_config);
+        break;
+      case XA_NNLIB_NET_LAYER_GRU:
+        ret = xa_nnlib_gru_init(p_layer->handle, (xa_nnlib_gru_init_config_t *)config->p_layers[i].p_config);
+        break;
+    }
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_net_get_config(
+  xa_nnlib_handle_t handle,
+  xa_nnlib_net_param_id_t param_id,
+  void *params )
+{
+  net_state_t *net;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(params, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(params, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  net = (net_state_t *) handle;
+
+  switch(param_id)
+  {
+    case XA_NNLIB_NET_LAYER_HANDLE:
+    {
+      xa_nnlib_net_layer_handle_t *p_layer_handle = (xa_nnlib_net_layer_handle_t *)params;
+
+      if(p_layer_handle->layer_idx < 0 || p_layer_handle->layer_idx >= net->n_layers)
+        return XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS;
+
+      p_layer_handle->handle = net->layers[p_layer_handle->layer_idx].handle;
+    }
+    break;
+
+    case XA_NNLIB_NET_INPUT_SHAPE:
+    {
+      xa_nnlib_shape_t *inp_shape = (xa_nnlib_shape_t *)params;
+      memcpy(inp_shape, &net->layers[0].in_shape, sizeof(xa_nnlib_shape_t));
+    }
+    break;
+
+    case XA_NNLIB_NET_OUTPUT_SHAPE:
+    {
+      xa_nnlib_shape_t *out_shape = (xa_nnlib_shape_t *)params;
+      memcpy(out_shape, &net->layers[net->n_layers-1].out_shape, sizeof(xa_nnlib_shape_t));
+    }
+    break;
+
+    default:
+    return XA_NNLIB_NET_CONFIG_FATAL_INVALID_PARAM_ID;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_net_process(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape )
+{
+  net_state_t *net;
+  void *p_layer_scratch;
+  void *p_act[2];
+  void *p_inp, *p_out;
+  xa_nnlib_shape_t in_shape, out_shape;
+  xa_nnlib_shape_t *p_layer_in_shape, *p_layer_out_shape;
+  int ret, i;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  net = (net_state_t *) handle;
+
+  /* Layer scratch is reused by every layer, intermediate activations
+     alternate between the two buffers following it */
+  p_layer_scratch = scratch;
+  p_act[0] = (char *)scratch + ALIGN_SIZE(net->max_scratch_size);
+  p_act[1] = (char *)p_act[0] + ALIGN_SIZE(net->max_act_size);
+
+  p_inp = input;
+  for(i = 0; i < net->n_layers; i++)
+  {
+    net_layer_t *p_layer = &net->layers[i];
+
+    if(i == 0)
+    {
+      p_layer_in_shape = p_in_shape;
+    }
+    else
+    {
+      memcpy(&in_shape, &p_layer->in_shape, sizeof(xa_nnlib_shape_t));
+      p_layer_in_shape = &in_shape;
+    }
+
+    if(i == net->n_layers - 1)
+    {
+      p_out = output;
+      p_layer_out_shape = p_out_shape;
+    }
+    else
+    {
+      p_out = p_act[i & 1];
+      memcpy(&out_shape, &p_layer->out_shape, sizeof(xa_nnlib_shape_t));
+      p_layer_out_shape = &out_shape;
+    }
+
+    ret = layer_process(p_layer, p_layer_scratch, p_inp, p_out, p_layer_in_shape, p_layer_out_shape);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+
+    p_inp = p_out;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
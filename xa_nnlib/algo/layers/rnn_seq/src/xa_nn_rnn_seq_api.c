@@ -0,0 +1,423 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_rnn_seq_api.h"
+
+#define ALIGN_SIZE(n) (((n)+15)&(~15))
+#define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+
+typedef struct _rnn_seq_layer_t
+{
+  Int32 in_feats;
+  Int32 out_feats;
+
+  Int32 persistent_size;
+  Int32 scratch_size;
+
+  /* Forward and backward cells */
+  xa_nnlib_handle_t handle[2];
+
+} rnn_seq_layer_t;
+
+typedef struct _rnn_seq_state_t
+{
+  Int32 cell_type;
+  Int32 n_layers;
+  Int32 n_dirs;
+  Int32 max_steps;
+  Int32 max_scratch_size;     /* Largest cell scratch, shared by all cells */
+  Int32 max_seq_size;         /* Largest intermediate sequence, size of each ping-pong buffer */
+  Int32 max_out_feats;
+
+  /* Zero context loaded into every cell at the start of a sequence */
+  Int32 *p_zero_context;
+
+  rnn_seq_layer_t layers[XA_NNLIB_RNN_SEQ_MAX_LAYERS];
+
+} rnn_seq_state_t;
+
+/* Collects per layer sizes and checks that the (concatenated) output of
+   each layer matches the input of the next layer */
+static Int32 plan_rnn_seq(xa_nnlib_rnn_seq_init_config_t *config, rnn_seq_state_t *p_seq)
+{
+  Int32 i;
+
+  CHECK_PTR(config->p_cell_configs, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  if(config->n_layers <= 0 || config->n_layers > XA_NNLIB_RNN_SEQ_MAX_LAYERS)
+    return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_N_LAYERS;
+
+  if((config->cell_type != XA_NNLIB_RNN_SEQ_CELL_LSTM) && (config->cell_type != XA_NNLIB_RNN_SEQ_CELL_GRU))
+    return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_CELL_TYPE;
+
+  if((config->bidirectional != 0) && (config->bidirectional != 1))
+    return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_BIDIRECTIONAL;
+
+  if(config->max_steps <= 0)
+    return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_MAX_STEPS;
+
+  memset(p_seq, 0, sizeof(rnn_seq_state_t));
+  p_seq->cell_type = config->cell_type;
+  p_seq->n_layers  = config->n_layers;
+  p_seq->n_dirs    = config->bidirectional + 1;
+  p_seq->max_steps = config->max_steps;
+
+  for(i = 0; i < config->n_layers; i++)
+  {
+    rnn_seq_layer_t *p_layer = &p_seq->layers[i];
+
+    if(config->cell_type == XA_NNLIB_RNN_SEQ_CELL_LSTM)
+    {
+      xa_nnlib_lstm_init_config_t *cfg = (xa_nnlib_lstm_init_config_t *)config->p_cell_configs + i;
+
+      p_layer->persistent_size = xa_nnlib_lstm_get_persistent_fast(cfg);
+      p_layer->scratch_size    = xa_nnlib_lstm_get_scratch_fast(cfg);
+      p_layer->in_feats        = cfg->in_feats;
+      p_layer->out_feats       = cfg->proj_feats ? cfg->proj_feats : cfg->out_feats;
+
+      /* Cell state keeps out_feats when the output is projected */
+      if(cfg->out_feats > p_seq->max_out_feats)
+        p_seq->max_out_feats = cfg->out_feats;
+    }
+    else
+    {
+      xa_nnlib_gru_init_config_t *cfg = (xa_nnlib_gru_init_config_t *)config->p_cell_configs + i;
+
+      p_layer->persistent_size = xa_nnlib_gru_get_persistent_fast(cfg);
+      p_layer->scratch_size    = xa_nnlib_gru_get_scratch_fast(cfg);
+      p_layer->in_feats        = cfg->in_feats;
+      p_layer->out_feats       = cfg->out_feats;
+    }
+
+    /* Cell config errors are returned as is */
+    if(p_layer->persistent_size < 0)
+      return p_layer->persistent_size;
+    if(p_layer->scratch_size < 0)
+      return p_layer->scratch_size;
+
+    if(p_layer->scratch_size > p_seq->max_scratch_size)
+      p_seq->max_scratch_size = p_layer->scratch_size;
+
+    if(p_layer->out_feats > p_seq->max_out_feats)
+      p_seq->max_out_feats = p_layer->out_feats;
+
+    if(i > 0)
+    {
+      rnn_seq_layer_t *p_prev = &p_seq->layers[i-1];
+      Int32 seq_size = p_seq->max_steps * p_seq->n_dirs * p_prev->out_feats * sizeof(vect_t);
+
+      if(p_layer->in_feats != p_seq->n_dirs * p_prev->out_feats)
+        return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_LAYER_MISMATCH;
+
+      /* Output sequence of layer i-1 lives in a ping-pong buffer */
+      if(seq_size > p_seq->max_seq_size)
+        p_seq->max_seq_size = seq_size;
+    }
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* Runs one direction of a layer over the sequence; both directions
+   write into their own half of each output step */
+static Int32 cell_process_sequence(rnn_seq_state_t *p_seq,
+    rnn_seq_layer_t *p_layer,
+    Int32 dir,
+    void *scratch,
+    vect_t *p_inp,
+    vect_t *p_out,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape)
+{
+  xa_nnlib_shape_t in_shape, out_shape;
+  Int32 ret;
+
+  memcpy(&in_shape, p_in_shape, sizeof(xa_nnlib_shape_t));
+  memcpy(&out_shape, p_out_shape, sizeof(xa_nnlib_shape_t));
+  out_shape.dim.vector.length = p_layer->out_feats;
+
+  if(p_seq->cell_type == XA_NNLIB_RNN_SEQ_CELL_LSTM)
+  {
+    ret = xa_nnlib_lstm_set_config(p_layer->handle[dir], XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT, p_seq->p_zero_context);
+    if(ret == XA_NNLIB_NO_ERROR)
+      ret = xa_nnlib_lstm_set_config(p_layer->handle[dir], XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL, p_seq->p_zero_context);
+    if(ret == XA_NNLIB_NO_ERROR)
+      ret = xa_nnlib_lstm_process_sequence(p_layer->handle[dir], scratch, p_inp, p_out + dir * p_layer->out_feats,
+                                           &in_shape, &out_shape, (xa_nnlib_lstm_direction_t)dir);
+  }
+  else
+  {
+    ret = xa_nnlib_gru_set_config(p_layer->handle[dir], XA_NNLIB_GRU_RESTORE_CONTEXT, p_seq->p_zero_context);
+    if(ret == XA_NNLIB_NO_ERROR)
+      ret = xa_nnlib_gru_process_sequence(p_layer->handle[dir], scratch, p_inp, p_out + dir * p_layer->out_feats,
+                                          &in_shape, &out_shape, (xa_nnlib_gru_direction_t)dir);
+  }
+
+  return ret;
+}
+
+Int32 xa_nnlib_rnn_seq_get_persistent_fast(
+     xa_nnlib_rnn_seq_init_config_t *config )
+{
+  rnn_seq_state_t seq;
+  int persistent_size, ret, i;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = plan_rnn_seq(config, &seq);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  /* State, zero context, then the persistent memory of each cell */
+  persistent_size  = ALIGN_SIZE(sizeof(rnn_seq_state_t));
+  persistent_size += ALIGN_SIZE(seq.max_out_feats * sizeof(Int32));
+  for(i = 0; i < seq.n_layers; i++)
+  {
+    persistent_size += seq.n_dirs * ALIGN_SIZE(seq.layers[i].persistent_size);
+  }
+
+  return persistent_size;
+}
+
+Int32 xa_nnlib_rnn_seq_get_scratch_fast(
+       xa_nnlib_rnn_seq_init_config_t *config )
+{
+  rnn_seq_state_t seq;
+  int scratch_size, n_seq_bufs, ret;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = plan_rnn_seq(config, &seq);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  /* One scratch shared by all cells followed by up to two ping-pong
+     sequence buffers; first input and last output are caller buffers */
+  n_seq_bufs = (seq.n_layers - 1) < 2 ? (seq.n_layers - 1) : 2;
+
+  scratch_size  = ALIGN_SIZE(seq.max_scratch_size);
+  scratch_size += n_seq_bufs * ALIGN_SIZE(seq.max_seq_size);
+
+  return scratch_size;
+}
+
+Int32 xa_nnlib_rnn_seq_init(
+    xa_nnlib_handle_t handle,
+    xa_nnlib_rnn_seq_init_config_t *config )
+{
+  rnn_seq_state_t *seq;
+  char *p_persistent;
+  int ret, i, dir;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  seq = (rnn_seq_state_t *) handle;
+
+  ret = plan_rnn_seq(config, seq);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  p_persistent = (char *)handle + ALIGN_SIZE(sizeof(rnn_seq_state_t));
+  seq->p_zero_context = (Int32 *)p_persistent;
+  memset(seq->p_zero_context, 0, seq->max_out_feats * sizeof(Int32));
+  p_persistent += ALIGN_SIZE(seq->max_out_feats * sizeof(Int32));
+
+  for(i = 0; i < seq->n_layers; i++)
+  {
+    rnn_seq_layer_t *p_layer = &seq->layers[i];
+
+    for(dir = 0; dir < seq->n_dirs; dir++)
+    {
+      p_layer->handle[dir] = (xa_nnlib_handle_t)p_persistent;
+      p_persistent += ALIGN_SIZE(p_layer->persistent_size);
+
+      if(seq->cell_type == XA_NNLIB_RNN_SEQ_CELL_LSTM)
+        ret = xa_nnlib_lstm_init(p_layer->handle[dir], (xa_nnlib_lstm_init_config_t *)config->p_cell_configs + i);
+      else
+        ret = xa_nnlib_gru_init(p_layer->handle[dir], (xa_nnlib_gru_init_config_t *)config->p_cell_configs + i);
+      if(ret != XA_NNLIB_NO_ERROR)
+        return ret;
+    }
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_rnn_seq_get_config(
+  xa_nnlib_handle_t handle,
+  xa_nnlib_rnn_seq_param_id_t param_id,
+  void *params )
+{
+  rnn_seq_state_t *seq;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(params, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(params, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  seq = (rnn_seq_state_t *) handle;
+
+  switch(param_id)
+  {
+    case XA_NNLIB_RNN_SEQ_CELL_HANDLE:
+    {
+      xa_nnlib_rnn_seq_cell_handle_t *p_cell_handle = (xa_nnlib_rnn_seq_cell_handle_t *)params;
+
+      if(p_cell_handle->layer_idx < 0 || p_cell_handle->layer_idx >= seq->n_layers)
+        return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_N_LAYERS;
+
+      if(p_cell_handle->direction < 0 || p_cell_handle->direction >= seq->n_dirs)
+        return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_BIDIRECTIONAL;
+
+      p_cell_handle->handle = seq->layers[p_cell_handle->layer_idx].handle[p_cell_handle->direction];
+    }
+    break;
+
+    case XA_NNLIB_RNN_SEQ_INPUT_SHAPE:
+    {
+      xa_nnlib_shape_t *inp_shape = (xa_nnlib_shape_t *)params;
+      inp_shape->dim.vector.length = seq->layers[0].in_feats;
+      inp_shape->shape_type = SHAPE_VECTOR_T;
+      inp_shape->n_shapes = seq->max_steps;
+      inp_shape->shape_offset = seq->layers[0].in_feats;
+    }
+    break;
+
+    case XA_NNLIB_RNN_SEQ_OUTPUT_SHAPE:
+    {
+      xa_nnlib_shape_t *out_shape = (xa_nnlib_shape_t *)params;
+      out_shape->dim.vector.length = seq->n_dirs * seq->layers[seq->n_layers-1].out_feats;
+      out_shape->shape_type = SHAPE_VECTOR_T;
+      out_shape->n_shapes = seq->max_steps;
+      out_shape->shape_offset = out_shape->dim.vector.length;
+    }
+    break;
+
+    default:
+    return XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_PARAM_ID;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_rnn_seq_process(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape )
+{
+  rnn_seq_state_t *seq;
+  rnn_seq_layer_t *p_last;
+  void *p_cell_scratch;
+  vect_t *p_seq_buf[2];
+  vect_t *p_inp, *p_out;
+  xa_nnlib_shape_t in_shape, out_shape;
+  int n_steps, ret, i, dir;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  seq = (rnn_seq_state_t *) handle;
+  p_last = &seq->layers[seq->n_layers-1];
+
+  n_steps = p_in_shape->n_shapes;
+  if(n_steps <= 0 || n_steps > seq->max_steps || p_out_shape->n_shapes != n_steps)
+    return XA_NNLIB_RNN_SEQ_EXECUTE_FATAL_INVALID_N_STEPS;
+
+  /* Both directions of the last layer share each output step */
+  if(n_steps > 1 && p_out_shape->shape_offset < seq->n_dirs * p_last->out_feats)
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+
+  /* Cell scratch is reused by every cell, intermediate sequences
+     alternate between the two buffers following it */
+  p_cell_scratch = scratch;
+  p_seq_buf[0] = (vect_t *)((char *)scratch + ALIGN_SIZE(seq->max_scratch_size));
+  p_seq_buf[1] = (vect_t *)((char *)p_seq_buf[0] + ALIGN_SIZE(seq->max_seq_size));
+
+  p_inp = (vect_t *)input;
+  for(i = 0; i < seq->n_layers; i++)
+  {
+    rnn_seq_layer_t *p_layer = &seq->layers[i];
+
+    if(i == 0)
+    {
+      memcpy(&in_shape, p_in_shape, sizeof(xa_nnlib_shape_t));
+    }
+    else
+    {
+      in_shape.shape_type = SHAPE_VECTOR_T;
+      in_shape.dim.vector.length = p_layer->in_feats;
+      in_shape.n_shapes = n_steps;
+      in_shape.shape_offset = p_layer->in_feats;
+    }
+
+    if(i == seq->n_layers - 1)
+    {
+      p_out = (vect_t *)output;
+      memcpy(&out_shape, p_out_shape, sizeof(xa_nnlib_shape_t));
+    }
+    else
+    {
+      p_out = p_seq_buf[i & 1];
+      out_shape.shape_type = SHAPE_VECTOR_T;
+      out_shape.dim.vector.length = seq->n_dirs * p_layer->out_feats;
+      out_shape.n_shapes = n_steps;
+      out_shape.shape_offset = seq->n_dirs * p_layer->out_feats;
+    }
+
+    if(out_shape.dim.vector.length < seq->n_dirs * p_layer->out_feats)
+    {
+      return (seq->cell_type == XA_NNLIB_RNN_SEQ_CELL_LSTM) ?
+             XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE :
+             XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+    }
+
+    for(dir = 0; dir < seq->n_dirs; dir++)
+    {
+      ret = cell_process_sequence(seq, p_layer, dir, p_cell_scratch, p_inp, p_out, &in_shape, &out_shape);
+      if(ret != XA_NNLIB_NO_ERROR)
+        return ret;
+    }
+
+    p_inp = p_out;
+  }
+
+  p_in_shape->dim.vector.length = seq->layers[0].in_feats;
+  p_out_shape->dim.vector.length = seq->n_dirs * p_last->out_feats;
+
+  return XA_NNLIB_NO_ERROR;
+}
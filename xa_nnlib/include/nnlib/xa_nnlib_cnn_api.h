@@ -32,7 +32,9 @@ typedef enum _xa_nnlib_cnn_param_id_t
     XA_NNLIB_CNN_KERNEL              = 1,             // GET/SET kernel
     XA_NNLIB_CNN_BIAS                = 2,             // GET/SET bias
     XA_NNLIB_CNN_INPUT_SHAPE         = 3,             // GET input shape information
-    XA_NNLIB_CNN_OUTPUT_SHAPE        = 4              // GET output shape information
+    XA_NNLIB_CNN_OUTPUT_SHAPE        = 4,             // GET output shape information
+    XA_NNLIB_CNN_OUT_MULTIPLIER      = 5,             // GET/SET per-channel output multipliers (XA_NNLIB_CNN_SYM8SxASYM8S only)
+    XA_NNLIB_CNN_OUT_SHIFT           = 6              // GET/SET per-channel output shifts (XA_NNLIB_CNN_SYM8SxASYM8S only)
 } xa_nnlib_cnn_param_id_t;
 
 /* I/O Precision Settings */
@@ -41,7 +43,8 @@ typedef enum _xa_nnlib_cnn_precision_t
     XA_NNLIB_CNN_16bx16b             = 100,           // Coef: 16 bits, I/O: 16 bits Fixed Point
     XA_NNLIB_CNN_8bx16b              = 101,           // Coef: 8 bits, I/O: 16 bits Fixed Point
     XA_NNLIB_CNN_8bx8b               = 102,           // Coef: 8 bits, I/O: 8 bits Fixed Point
-    XA_NNLIB_CNN_f32xf32             = 103            // Coef: float32, I/O: float32 floating Point
+    XA_NNLIB_CNN_f32xf32             = 103,           // Coef: float32, I/O: float32 floating Point
+    XA_NNLIB_CNN_SYM8SxASYM8S        = 104            // Coef: 8 bits symmetric per-channel, I/O: 8 bits asymmetric (signed)
 } xa_nnlib_cnn_precision_t;
 
 /* Convolution Algorithm Settings */
@@ -73,6 +76,7 @@ typedef enum _xa_nnlib_fatal_config_cnn_error_code_t
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_BIAS_SHAPE        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 9),
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 10),
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_COMBINATION = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 11),
+    XA_NNLIB_CNN_CONFIG_FATAL_INVALID_ZERO_BIAS         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 12),
 } xa_nnlib_fatal_config_cnn_error_code_t;
 
 /************************************************************/
@@ -120,6 +124,11 @@ typedef struct _xa_nnlib_cnn_init_config_t
     /* Convolution algorithm */
     xa_nnlib_cnn_algo_t algo;
 
+    /* Quantization, XA_NNLIB_CNN_SYM8SxASYM8S only; per-channel multipliers/shifts are set with XA_NNLIB_CNN_OUT_MULTIPLIER/XA_NNLIB_CNN_OUT_SHIFT */
+    Int32 input_zero_bias;                  /* Negative of input zero point, range [-127, 128] */
+    Int32 out_zero_bias;                    /* Output zero point, range [-128, 127] */
+    Int32 ds_depth_out_zero_bias;           /* Depthwise Separable 2D Convolution - zero point of intermediate depthwise output, range [-128, 127] */
+
 } xa_nnlib_cnn_init_config_t;
 
 
@@ -45,6 +45,13 @@ typedef enum _xa_nnlib_gru_precision_t
   XA_NNLIB_GRU_flt16xflt16         = 103            // Not supported
 } xa_nnlib_gru_precision_t;
 
+/* Sequence direction for xa_nnlib_gru_process_sequence */
+typedef enum _xa_nnlib_gru_direction_t
+{
+  XA_NNLIB_GRU_FORWARD             = 0,             // Steps 0 to n-1
+  XA_NNLIB_GRU_BACKWARD            = 1              // Steps n-1 to 0
+} xa_nnlib_gru_direction_t;
+
 
 /************************************************************/
 /* Class 1: Configuration Errors                            */
@@ -61,7 +68,8 @@ typedef enum _xa_nnlib_fatal_config_gru_error_code_t
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_COEFF_QFORMAT    = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 3),
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 4),
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 5),
-  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 6)
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 6),
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_DIRECTION        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 7)
 } xa_nnlib_fatal_config_gru_error_code_t;
 
 /************************************************************/
@@ -162,6 +170,16 @@ Int32 xa_nnlib_gru_process(xa_nnlib_handle_t handle,
     xa_nnlib_shape_t *p_in_shape,
     xa_nnlib_shape_t *p_out_shape );
 
+/* Runs p_in_shape->n_shapes time steps; shape_offset of the input and
+   output shapes is the stride in elements between steps */
+Int32 xa_nnlib_gru_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape,
+    xa_nnlib_gru_direction_t direction);
+
 #if defined(__cplusplus)
 }
 #endif    /* __cplusplus */
@@ -107,7 +107,9 @@
  * expects value in Q16.15 format.
  *
  * Restriction,
- * - All pointers (p_out, p_vec) must be 32-bit aligned and should not overlap.
+ * - All pointers (p_out, p_vec) must be 32-bit aligned and should not overlap,
+ * except that p_out may be equal to p_vec for the kernels reported as
+ * in-place capable by xa_nn_get_inplace_capability().
  *
  * activation 32_32 kernels,
  * - Vector activation kernels: 6
@@ -649,8 +651,8 @@ WORD32 xa_nn_vec_relu_f32_f32(
     WORD32        vec_length                   /*!< [in] length of vectors */
   );
 WORD32 xa_nn_vec_relu_std_f32_f32(
-    FLOAT32       * __restrict__ p_out,        /*!< [out] result: vec_length x 1, floating point */
-    const FLOAT32 * __restrict__ p_vec,        /*!< [in] input data: vec_length x 1, floating point */
+    FLOAT32       *p_out,                      /*!< [out] result: vec_length x 1, floating point */
+    const FLOAT32 *p_vec,                      /*!< [in] input data: vec_length x 1, floating point */
     WORD32        vec_length                   /*!< [in] length of vectors */
   );
 
@@ -697,25 +699,25 @@ WORD32 xa_nn_vec_tanh_32_8(
   );
 
 WORD32 xa_nn_vec_relu_16_16(
-    WORD16       * __restrict__ p_out,
-    const WORD16 * __restrict__ p_vec,
+    WORD16       *p_out,
+    const WORD16 *p_vec,
     WORD16       threshold,
     WORD32       vec_length);
 
 WORD32 xa_nn_vec_relu_std_16_16(
-    WORD16       * __restrict__ p_out,
-    const WORD16 * __restrict__ p_vec,
+    WORD16       *p_out,
+    const WORD16 *p_vec,
     WORD32       vec_length);
 
 WORD32 xa_nn_vec_relu_8_8(
-    WORD8        * __restrict__ p_out,
-    const WORD8  * __restrict__ p_vec,
+    WORD8        *p_out,
+    const WORD8  *p_vec,
     WORD8       threshold,
     WORD32       vec_length);
 
 WORD32 xa_nn_vec_relu_std_8_8(
-    WORD8        * __restrict__ p_out,
-    const WORD8  * __restrict__ p_vec,
+    WORD8        *p_out,
+    const WORD8  *p_vec,
     WORD32       vec_length);
 
 WORD32 xa_nn_vec_interpolation_q15(
@@ -803,6 +805,76 @@ WORD32 xa_nn_conv1d_std_f32(
     WORD32 out_data_format,
     VOID *p_handle);
 
+/* Causal dilated conv1d for streaming: output frame t uses input frames
+ * t-(kernel_width-1-k)*dilation, k = 0..kernel_width-1. p_state keeps the
+ * last (kernel_width-1)*dilation input frames across calls, so each call
+ * computes only its num_frames new output frames. Input is
+ * num_frames x input_channels, output num_frames x out_channels and the
+ * kernel out_channels x kernel_width x input_channels. p_inp, p_kernel,
+ * p_state and p_scratch must be 16 byte aligned; the f32 variant also
+ * needs 16 byte aligned p_out and p_bias and input_channels, out_channels
+ * multiples of 4. */
+WORD32 xa_nn_conv1d_causal_state_getsize(
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 input_channels,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_causal_state_init(
+    VOID *p_state,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 input_channels,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_causal_getsize(
+    WORD32 kernel_width,
+    WORD32 input_channels,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_causal_8x8(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD8* __restrict__ p_bias,
+    WORD32 num_frames,
+    WORD32 input_channels,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_state,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv1d_causal_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 num_frames,
+    WORD32 input_channels,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    VOID *p_state,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv1d_causal_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 num_frames,
+    WORD32 input_channels,
+    WORD32 kernel_width,
+    WORD32 dilation,
+    WORD32 out_channels,
+    VOID *p_state,
+    VOID *p_scratch);
+
 
 WORD32 xa_nn_conv2d_std_getsize(
     WORD32 input_height,
@@ -827,6 +899,23 @@ WORD32 xa_nn_dilated_conv2d_std_getsize(
     WORD32 dilation_height
     );
 
+/* Grouped conv2d: groups must divide input_channels and out_channels, input
+ * channel group g feeds output channels
+ * [g * out_channels / groups, (g + 1) * out_channels / groups). The kernel is
+ * out_channels x kernel_height x kernel_width x (input_channels / groups),
+ * channels padded to a multiple of 2 for f32. input_precision is PREC_ASYM8S
+ * or PREC_F32. */
+WORD32 xa_nn_conv2d_grouped_getsize(
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 groups,
+    WORD32 input_precision);
+
 WORD32 xa_nn_conv2d_std_8x16(
     WORD16* __restrict__ p_out,
     WORD16* __restrict__ p_inp,
@@ -913,6 +1002,27 @@ WORD32 xa_nn_conv2d_std_f32(
     WORD32 out_data_format,
     VOID *p_handle);
 
+WORD32 xa_nn_conv2d_grouped_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
 WORD32 xa_nn_conv2d_pointwise_f32(
     FLOAT32* __restrict__ p_out,
     FLOAT32* __restrict__ p_kernel,
@@ -1148,6 +1258,26 @@ const UWORD8* __restrict__ p_inp,
       WORD32  out_data_format,
       VOID *p_scratch);
 
+WORD32 xa_nn_global_avgpool_asym8s_asym8s(
+      WORD8 *__restrict__ p_out,          /*!< [out] 8b result: input_channels */
+const WORD8 *__restrict__ p_inp,          /*!< [in] 8b input cube (NHWC): input_height x input_width x input_channels */
+      WORD32  input_height,               /*!< [in] input height */
+      WORD32  input_width,                /*!< [in] input width */
+      WORD32  input_channels,             /*!< [in] input channels */
+      WORD32  inp_zero_bias,              /*!< [in] input zero point */
+      WORD32  out_multiplier,             /*!< [in] output multiplier, with 1/(input_height*input_width) folded in */
+      WORD32  out_shift,                  /*!< [in] output shift */
+      WORD32  out_zero_bias,              /*!< [in] output zero point */
+      WORD32  out_activation_min,         /*!< [in] output activation min */
+      WORD32  out_activation_max);        /*!< [in] output activation max */
+
+WORD32 xa_nn_global_avgpool_f32(
+      FLOAT32 *__restrict__ p_out,        /*!< [out] f32b result: input_channels */
+const FLOAT32 *__restrict__ p_inp,        /*!< [in] f32b input cube (NHWC): input_height x input_width x input_channels */
+      WORD32  input_height,               /*!< [in] input height */
+      WORD32  input_width,                /*!< [in] input width */
+      WORD32  input_channels);            /*!< [in] input channels */
+
 WORD32 xa_nn_avgpool_getsize(
     WORD32 input_channels,
     WORD32 inp_precision,
@@ -1324,14 +1454,14 @@ WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s
   );
 
 WORD32 xa_nn_vec_activation_min_max_asym8u_asym8u(
-    UWORD8 * __restrict__ p_out,
-    const  UWORD8 * __restrict__ p_vec,
+    UWORD8 *p_out,
+    const  UWORD8 *p_vec,
     int    activation_min,
     int    activation_max,
     WORD32 vec_length);
 
-WORD32 xa_nn_vec_activation_min_max_f32_f32(FLOAT32 * __restrict__ p_out,
-           const  FLOAT32 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_f32_f32(FLOAT32 *p_out,
+           const  FLOAT32 *p_vec,
                   FLOAT32 activation_min,
                   FLOAT32 activation_max,
                   WORD32  vec_length);
@@ -1376,22 +1506,41 @@ WORD32 xa_nn_vec_sigmoid_asym8s_asym8s(WORD8 *p_out,
                             WORD32 input_left_shift,
                             WORD32 vec_length);
 
+WORD32 xa_nn_vec_softmax_sym16s_sym16s( WORD16 * __restrict__ p_out,
+                    const   WORD16 * __restrict__ p_vec,
+                            WORD32  input_beta_left_shift,
+                            WORD32  input_beta_multiplier,
+                            WORD32  vec_length,
+                            pVOID   p_scratch);
+
+WORD32 xa_nn_vec_sigmoid_sym16s_sym16s(WORD16 *p_out,
+                      const WORD16 *p_vec,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift,
+                            WORD32 vec_length);
+
+WORD32 xa_nn_vec_tanh_sym16s_sym16s(WORD16 *p_out,
+                      const WORD16 *p_vec,
+                            WORD32 input_multiplier,
+                            WORD32 input_left_shift,
+                            WORD32 vec_length);
+
 int get_softmax_scratch_size(int inp_precision, int out_precision, int length);
 
-WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 * __restrict__ p_out,
-                                      const  WORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 *p_out,
+                                      const  WORD8 *p_vec,
                                       int    activation_min,
                                       int    activation_max,
                                       WORD32 vec_length);
 
-WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 * __restrict__ p_out,
-                                      const  WORD16 * __restrict__ p_vec,
+WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 *p_out,
+                                      const  WORD16 *p_vec,
                                       int    activation_min,
                                       int    activation_max,
                                       WORD32 vec_length);
 
-WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 * __restrict__ p_out,
-                    const   UWORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 *p_out,
+                    const   UWORD8 *p_vec,
                             WORD32 inp_zero_bias,
                             WORD32 out_multiplier,
                             WORD32 out_shift,
@@ -1400,8 +1549,8 @@ WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 * __restrict__ p_out,
                             WORD32 quantized_activation_max,
                             WORD32 vec_length);
 
-WORD32 xa_nn_vec_relu_asym8s_asym8s( WORD8 * __restrict__ p_out,
-                    const   WORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_relu_asym8s_asym8s( WORD8 *p_out,
+                    const   WORD8 *p_vec,
                             WORD32 inp_zero_bias,
                             WORD32 out_multiplier,
                             WORD32 out_shift,
@@ -1410,9 +1559,9 @@ WORD32 xa_nn_vec_relu_asym8s_asym8s( WORD8 * __restrict__ p_out,
                             WORD32 quantized_activation_max,
                             WORD32 vec_length);
 
-WORD32 xa_nn_vec_prelu_asym8s_asym8s( WORD8 * __restrict__ p_out,
-                    const   WORD8 * __restrict__ p_vec,
-                    const   WORD8 * __restrict__ p_vec_alpha,
+WORD32 xa_nn_vec_prelu_asym8s_asym8s( WORD8 *p_out,
+                    const   WORD8 *p_vec,
+                    const   WORD8 *p_vec_alpha,
                             WORD32 inp_zero_bias,
                             WORD32 alpha_zero_bias,
                             WORD32 alpha_multiplier,
@@ -1422,8 +1571,8 @@ WORD32 xa_nn_vec_prelu_asym8s_asym8s( WORD8 * __restrict__ p_out,
                             WORD32 out_zero_bias,
                             WORD32 vec_length);
 
-WORD32 xa_nn_vec_hard_swish_asym8s_asym8s( WORD8 * __restrict__ p_out,
-                    const   WORD8 * __restrict__ p_vec,
+WORD32 xa_nn_vec_hard_swish_asym8s_asym8s( WORD8 *p_out,
+                    const   WORD8 *p_vec,
                             WORD32 inp_zero_bias,
                             WORD16 reluish_multiplier,
                             WORD32 reluish_shift,
@@ -1536,6 +1685,105 @@ WORD32 xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s(
     WORD32 dilation_height,
     WORD32 dilation_width);
 
+WORD32 xa_nn_conv2d_grouped_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+/* Shape-aware per-channel sym8sxasym8s conv2d. groups == 1 is a standard
+ * convolution, groups == input_channels a depthwise one and anything in
+ * between a grouped one, the kernel always being out_channels x kernel_height
+ * x kernel_width x (input_channels / groups). algo forces one of the
+ * XA_NN_CONV2D_ALGO_* variants, XA_NN_CONV2D_ALGO_AUTO takes the one returned
+ * by xa_nn_conv2d_per_chan_sym8sxasym8s_select. getsize and the kernel return
+ * -1 for a variant that does not support the shape. */
+#define XA_NN_CONV2D_ALGO_AUTO      0
+#define XA_NN_CONV2D_ALGO_STD       1 /* circular buffer */
+#define XA_NN_CONV2D_ALGO_DIRECT    2 /* windows read in place, x-border columns through the circular buffer */
+#define XA_NN_CONV2D_ALGO_POINTWISE 3 /* 1x1, unit stride, no padding */
+#define XA_NN_CONV2D_ALGO_PATCHIFY  4 /* stride equal to kernel size, no padding */
+#define XA_NN_CONV2D_ALGO_DEPTHWISE 5 /* groups == input_channels, kernel rearranged to HWC in scratch on each call */
+#define XA_NN_CONV2D_ALGO_GROUPED   6 /* groups > 1 */
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s_select(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format);
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    WORD32 algo);
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    WORD32 algo,
+    VOID *p_scratch);
+
 WORD32 xa_nn_matXvec_batch_asym8uxasym8u_asym8u(
     UWORD8 ** __restrict__ p_out,
     UWORD8 * __restrict__ p_mat1,
@@ -1586,6 +1834,67 @@ WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
     const WORD32* __restrict__ p_out_shift,
     WORD32 out_zero_bias);
 
+WORD32 xa_nn_matmul_per_chan_residual_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const WORD8 * __restrict__ p_residual,
+    WORD32 sum_zero_bias,
+    WORD32 sum_left_shift,
+    WORD32 sum_multiplier,
+    WORD32 sum_activation_min,
+    WORD32 sum_activation_max,
+    WORD32 out_inp_zero_bias,
+    WORD32 out_inp_left_shift,
+    WORD32 out_inp_multiplier,
+    WORD32 res_zero_bias,
+    WORD32 res_left_shift,
+    WORD32 res_multiplier,
+    WORD32 left_shift);
+
+WORD32 xa_nn_batch_matmul_asym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,                 /*!< [out] asym8s result: batch x rows1 x cols2 */
+    const WORD8 * __restrict__ p_mat1,          /*!< [in] asym8s mat1: batch x rows1 x cols1 */
+    const WORD8 * __restrict__ p_mat2,          /*!< [in] asym8s mat2: batch x cols1 x cols2, or batch x cols2 x cols1 if transposed */
+    WORD32 batch,                               /*!< [in] number of matrix pairs, e.g. attention heads */
+    WORD32 rows1,                               /*!< [in] number of rows of mat1 */
+    WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+    WORD32 cols2,                               /*!< [in] number of columns of the result */
+    WORD32 transpose_mat2,                      /*!< [in] non-zero if mat2 is stored transposed */
+    WORD32 mat1_zero_bias,                      /*!< [in] negated zero point of mat1 */
+    WORD32 mat2_zero_bias,                      /*!< [in] negated zero point of mat2 */
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    VOID   * __restrict__ p_scratch);           /*!< [in] scratch of size xa_nn_batch_matmul_asym8sxasym8s_asym8s_getsize */
+
+WORD32 xa_nn_batch_matmul_asym8sxasym8s_asym8s_getsize(
+    WORD32 rows1,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 transpose_mat2);
+
+WORD32 xa_nn_batch_matmul_f32(
+    FLOAT32 * __restrict__ p_out,               /*!< [out] f32 result: batch x rows1 x cols2 */
+    const FLOAT32 * __restrict__ p_mat1,        /*!< [in] f32 mat1: batch x rows1 x cols1 */
+    const FLOAT32 * __restrict__ p_mat2,        /*!< [in] f32 mat2: batch x cols1 x cols2, or batch x cols2 x cols1 if transposed */
+    WORD32 batch,
+    WORD32 rows1,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 transpose_mat2);
+
 WORD32 xa_nn_conv2d_depthwise_asym8uxasym8u(
     pUWORD8 __restrict__ p_out,
     const UWORD8 *__restrict__ p_kernel,
@@ -1668,14 +1977,240 @@ WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
     WORD32  out_zero_bias,
     WORD32  out_data_format);
 
-WORD32 xa_nn_elm_mul_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
+WORD32 xa_nn_conv2d_pointwise_per_chan_residual_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format,
+    const WORD8* __restrict__ p_residual,
+    WORD32  sum_zero_bias,
+    WORD32  sum_left_shift,
+    WORD32  sum_multiplier,
+    WORD32  sum_activation_min,
+    WORD32  sum_activation_max,
+    WORD32  out_inp_zero_bias,
+    WORD32  out_inp_left_shift,
+    WORD32  out_inp_multiplier,
+    WORD32  res_zero_bias,
+    WORD32  res_left_shift,
+    WORD32  res_multiplier,
+    WORD32  left_shift);
+
+WORD32 xa_nn_inverted_residual_per_chan_sym8sxasym8s_getsize
+  (WORD32 input_width
+   ,WORD32 input_channels
+   ,WORD32 expanded_channels
+   ,WORD32 kernel_height
+   ,WORD32 kernel_width
+   ,WORD32 x_stride
+   ,WORD32 y_stride
+   ,WORD32 x_padding
+   ,WORD32 y_padding
+   ,WORD32 out_width
+   ,WORD32 band_height
+  );
+
+WORD32 xa_nn_inverted_residual_per_chan_sym8sxasym8s
+  (WORD8 * __restrict__ p_out
+   ,const WORD8 * __restrict__ p_inp
+   ,WORD32 input_height
+   ,WORD32 input_width
+   ,WORD32 input_channels
+   ,WORD32 expanded_channels
+   ,WORD32 out_channels
+   ,WORD32 input_zero_bias
+   ,const WORD8 * __restrict__ p_expand_kernel
+   ,const WORD32 * __restrict__ p_expand_bias
+   ,const WORD32 * __restrict__ p_expand_out_multiplier
+   ,const WORD32 * __restrict__ p_expand_out_shift
+   ,WORD32 expand_out_zero_bias
+   ,WORD32 expand_activation_min
+   ,WORD32 expand_activation_max
+   ,const WORD8 * __restrict__ p_dw_kernel
+   ,const WORD32 * __restrict__ p_dw_bias
+   ,WORD32 kernel_height
+   ,WORD32 kernel_width
+   ,WORD32 x_stride
+   ,WORD32 y_stride
+   ,WORD32 x_padding
+   ,WORD32 y_padding
+   ,WORD32 out_height
+   ,WORD32 out_width
+   ,const WORD32 * __restrict__ p_dw_out_multiplier
+   ,const WORD32 * __restrict__ p_dw_out_shift
+   ,WORD32 dw_out_zero_bias
+   ,WORD32 dw_activation_min
+   ,WORD32 dw_activation_max
+   ,const WORD8 * __restrict__ p_project_kernel
+   ,const WORD32 * __restrict__ p_project_bias
+   ,const WORD32 * __restrict__ p_project_out_multiplier
+   ,const WORD32 * __restrict__ p_project_out_shift
+   ,WORD32 project_out_zero_bias
+   ,WORD32 band_height
+   ,VOID * __restrict__ p_scratch
+  );
+
+/* Plan/execute interface: plan_create validates the arguments once
+ * (independent of DISABLE_ARG_CHK), precomputes the layer geometry into
+ * p_plan of size given by plan_getsize and returns the scratch size needed
+ * by plan_execute, or -1 on invalid arguments. plan_execute performs no
+ * argument checks. Weights, bias and quantization arrays are referenced by
+ * the plan and must stay valid while it is in use. */
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_getsize(VOID);
+
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_create(
+    VOID *p_plan,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format);
+
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_execute(
+    const VOID *p_plan,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_getsize
+  (WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  inp_data_format
+  );
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_create
+  (pVOID p_plan
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  );
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_execute
+  (const VOID *p_plan
+  ,pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_inp
+  ,pVOID p_scratch
+  );
+
+WORD32 xa_nn_maxpool_8_plan_getsize(VOID);
+
+WORD32 xa_nn_maxpool_8_plan_create(
+      VOID   *p_plan,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  inp_data_format,
+      WORD32  out_data_format);
+
+WORD32 xa_nn_maxpool_8_plan_execute(
+const VOID   *p_plan,
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      VOID   *p_scratch);
+
+WORD32 xa_nn_avgpool_8_plan_getsize(VOID);
+
+WORD32 xa_nn_avgpool_8_plan_create(
+      VOID   *p_plan,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  inp_data_format,
+      WORD32  out_data_format);
+
+WORD32 xa_nn_avgpool_8_plan_execute(
+const VOID   *p_plan,
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      VOID   *p_scratch);
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_getsize(VOID);
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_create
+  (VOID *p_plan
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  );
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_execute
+  (const VOID *p_plan
+   ,WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_inp
+   ,VOID *p_scratch
+  );
+
+WORD32 xa_nn_elm_mul_f32xf32_f32(FLOAT32 *p_out,
+                               const FLOAT32 *p_inp1,
+                               const FLOAT32 *p_inp2,
                                WORD32 num_elm);
 
-WORD32 xa_nn_elm_add_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
+WORD32 xa_nn_elm_add_f32xf32_f32(FLOAT32 *p_out,
+                               const FLOAT32 *p_inp1,
+                               const FLOAT32 *p_inp2,
                                WORD32 num_elm);
 
 WORD32 xa_nn_elm_mul_acc_f32xf32_f32(FLOAT32 * __restrict__ p_out,
@@ -1683,18 +2218,18 @@ WORD32 xa_nn_elm_mul_acc_f32xf32_f32(FLOAT32 * __restrict__ p_out,
                                const FLOAT32 * __restrict__ p_inp2,
                                WORD32 num_elm);
 
-WORD32 xa_nn_elm_sub_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
+WORD32 xa_nn_elm_sub_f32xf32_f32(FLOAT32 *p_out,
+                               const FLOAT32 *p_inp1,
+                               const FLOAT32 *p_inp2,
                                WORD32 num_elm);
 
-WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
+WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 *p_out,
+                               const FLOAT32 *p_inp1,
+                               const FLOAT32 *p_inp2,
                                WORD32 num_elm);
 
-WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 * __restrict__ p_out,
-                           const FLOAT32 * __restrict__ p_inp,
+WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 *p_out,
+                           const FLOAT32 *p_inp,
                            WORD32 num_elm);
 
 WORD32 xa_nn_elm_add_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
@@ -1714,17 +2249,17 @@ WORD32 xa_nn_elm_add_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
                             WORD32  left_shift,
                             WORD32  num_elm);
 
-WORD32 xa_nn_elm_add_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+WORD32 xa_nn_elm_add_asym8sxasym8s_asym8s(WORD8 *p_out,
                             WORD32  out_zero_bias,
                             WORD32  out_left_shift,
                             WORD32  out_multiplier,
                             WORD32  out_activation_min,
                             WORD32  out_activation_max,
-                    const    WORD8 * __restrict__ p_inp1,
+                    const    WORD8 *p_inp1,
                             WORD32  inp1_zero_bias,
                             WORD32  inp1_left_shift,
                             WORD32  inp1_multiplier,
-                    const    WORD8 * __restrict__ p_inp2,
+                    const    WORD8 *p_inp2,
                             WORD32  inp2_zero_bias,
                             WORD32  inp2_left_shift,
                             WORD32  inp2_multiplier,
@@ -1748,17 +2283,17 @@ WORD32 xa_nn_elm_sub_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
                             WORD32  left_shift,
                             WORD32  num_elm);
 
-WORD32 xa_nn_elm_sub_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+WORD32 xa_nn_elm_sub_asym8sxasym8s_asym8s(WORD8 *p_out,
                             WORD32  out_zero_bias,
                             WORD32  out_left_shift,
                             WORD32  out_multiplier,
                             WORD32  out_activation_min,
                             WORD32  out_activation_max,
-                    const    WORD8 * __restrict__ p_inp1,
+                    const    WORD8 *p_inp1,
                             WORD32  inp1_zero_bias,
                             WORD32  inp1_left_shift,
                             WORD32  inp1_multiplier,
-                    const    WORD8 * __restrict__ p_inp2,
+                    const    WORD8 *p_inp2,
                             WORD32  inp2_zero_bias,
                             WORD32  inp2_left_shift,
                             WORD32  inp2_multiplier,
@@ -1777,15 +2312,15 @@ WORD32 xa_nn_elm_mul_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
                             WORD32  inp2_zero_bias,
                             WORD32  num_elm);
 
-WORD32 xa_nn_elm_mul_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+WORD32 xa_nn_elm_mul_asym8sxasym8s_asym8s(WORD8 *p_out,
                             WORD32  out_zero_bias,
                             WORD32  out_shift,
                             WORD32  out_multiplier,
                             WORD32  out_activation_min,
                             WORD32  out_activation_max,
-                    const    WORD8 * __restrict__ p_inp1,
+                    const    WORD8 *p_inp1,
                             WORD32  inp1_zero_bias,
-                    const    WORD8 * __restrict__ p_inp2,
+                    const    WORD8 *p_inp2,
                             WORD32  inp2_zero_bias,
                             WORD32  num_elm);
 
@@ -1805,14 +2340,148 @@ WORD32 xa_nn_elm_quantize_asym16s_asym32s(WORD32 * __restrict__ p_out,
                                     WORD32  out_multiplier,
                                     WORD32  num_elm);
 
-WORD32 xa_nn_elm_max_8x8_8(  WORD8* __restrict__ p_out,
-                       const WORD8* __restrict__ p_in1,
-                       const WORD8* __restrict__ p_in2,
+WORD32 xa_nn_elm_quantize_asym8s_asym8s(WORD8 *p_out,
+                                    const WORD8 *p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_asym8u_asym8s(WORD8 *p_out,
+                                    const UWORD8 *p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_asym8s_asym16s(WORD16 * __restrict__ p_out,
+                                    const WORD8 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_f32_asym8s(WORD8 * __restrict__ p_out,
+                                    const FLOAT32 * __restrict__ p_inp,
+                                    FLOAT32 out_scale,
+                                    WORD32  out_zero_bias,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_asym8s_f32(FLOAT32 * __restrict__ p_out,
+                                    const WORD8 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    FLOAT32 inp_scale,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_asym16s_f32(FLOAT32 * __restrict__ p_out,
+                                    const WORD16 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    FLOAT32 inp_scale,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_gather_8(WORD8 * __restrict__ p_out,
+                      const WORD8 * __restrict__ p_inp,
+                      const WORD32 * __restrict__ p_inp_shape,
+                      WORD32 num_inp_dims,
+                      const WORD32 * __restrict__ p_indices,
+                      WORD32 num_indices,
+                      WORD32 axis);
+
+WORD32 xa_nn_gather_16(WORD16 * __restrict__ p_out,
+                       const WORD16 * __restrict__ p_inp,
+                       const WORD32 * __restrict__ p_inp_shape,
+                       WORD32 num_inp_dims,
+                       const WORD32 * __restrict__ p_indices,
+                       WORD32 num_indices,
+                       WORD32 axis);
+
+WORD32 xa_nn_gather_32(WORD32 * __restrict__ p_out,
+                       const WORD32 * __restrict__ p_inp,
+                       const WORD32 * __restrict__ p_inp_shape,
+                       WORD32 num_inp_dims,
+                       const WORD32 * __restrict__ p_indices,
+                       WORD32 num_indices,
+                       WORD32 axis);
+
+WORD32 xa_nn_embedding_lookup_asym8s_asym8s(WORD8 * __restrict__ p_out,
+                                            const WORD8 * __restrict__ p_table,
+                                            const WORD32 * __restrict__ p_ids,
+                                            WORD32 num_ids,
+                                            WORD32 num_rows,
+                                            WORD32 row_length,
+                                            WORD32 inp_zero_bias,
+                                            const WORD32 * __restrict__ p_out_multiplier,
+                                            const WORD32 * __restrict__ p_out_shift,
+                                            WORD32 out_zero_bias);
+
+WORD32 xa_nn_embedding_lookup_asym8s_f32(FLOAT32 * __restrict__ p_out,
+                                         const WORD8 * __restrict__ p_table,
+                                         const WORD32 * __restrict__ p_ids,
+                                         WORD32 num_ids,
+                                         WORD32 num_rows,
+                                         WORD32 row_length,
+                                         WORD32 inp_zero_bias,
+                                         const FLOAT32 * __restrict__ p_scale);
+
+WORD32 xa_nn_argmax_asym8s(WORD32 * __restrict__ p_out,
+                           const WORD8 * __restrict__ p_inp,
+                           const WORD32 * __restrict__ p_inp_shape,
+                           WORD32 num_inp_dims,
+                           WORD32 axis);
+
+WORD32 xa_nn_argmin_asym8s(WORD32 * __restrict__ p_out,
+                           const WORD8 * __restrict__ p_inp,
+                           const WORD32 * __restrict__ p_inp_shape,
+                           WORD32 num_inp_dims,
+                           WORD32 axis);
+
+WORD32 xa_nn_argmax_asym8u(WORD32 * __restrict__ p_out,
+                           const UWORD8 * __restrict__ p_inp,
+                           const WORD32 * __restrict__ p_inp_shape,
+                           WORD32 num_inp_dims,
+                           WORD32 axis);
+
+WORD32 xa_nn_argmin_asym8u(WORD32 * __restrict__ p_out,
+                           const UWORD8 * __restrict__ p_inp,
+                           const WORD32 * __restrict__ p_inp_shape,
+                           WORD32 num_inp_dims,
+                           WORD32 axis);
+
+WORD32 xa_nn_argmax_16(WORD32 * __restrict__ p_out,
+                       const WORD16 * __restrict__ p_inp,
+                       const WORD32 * __restrict__ p_inp_shape,
+                       WORD32 num_inp_dims,
+                       WORD32 axis);
+
+WORD32 xa_nn_argmin_16(WORD32 * __restrict__ p_out,
+                       const WORD16 * __restrict__ p_inp,
+                       const WORD32 * __restrict__ p_inp_shape,
+                       WORD32 num_inp_dims,
+                       WORD32 axis);
+
+WORD32 xa_nn_argmax_f32(WORD32 * __restrict__ p_out,
+                        const FLOAT32 * __restrict__ p_inp,
+                        const WORD32 * __restrict__ p_inp_shape,
+                        WORD32 num_inp_dims,
+                        WORD32 axis);
+
+WORD32 xa_nn_argmin_f32(WORD32 * __restrict__ p_out,
+                        const FLOAT32 * __restrict__ p_inp,
+                        const WORD32 * __restrict__ p_inp_shape,
+                        WORD32 num_inp_dims,
+                        WORD32 axis);
+
+WORD32 xa_nn_elm_max_8x8_8(  WORD8* p_out,
+                       const WORD8* p_in1,
+                       const WORD8* p_in2,
                              WORD32              num_element);
 
-WORD32 xa_nn_elm_min_8x8_8(  WORD8* __restrict__ p_out,
-                       const WORD8* __restrict__ p_in1,
-                       const WORD8* __restrict__ p_in2,
+WORD32 xa_nn_elm_min_8x8_8(  WORD8* p_out,
+                       const WORD8* p_in1,
+                       const WORD8* p_in2,
                              WORD32              num_element);
 
 WORD32 xa_nn_elm_min_4D_Bcast_8x8_8(
@@ -1986,6 +2655,40 @@ WORD32 xa_nn_l2_norm_asym8s_asym8s(WORD8 *p_out,
                             WORD32 zero_point,
                             WORD32 num_elm);
 
+WORD32 xa_nn_layer_norm_f32(
+    FLOAT32 * __restrict__ p_out,          /* [num_rows x row_length] */
+    const FLOAT32 * __restrict__ p_inp,    /* [num_rows x row_length] */
+    const FLOAT32 * __restrict__ p_gamma,  /* [row_length] */
+    const FLOAT32 * __restrict__ p_beta,   /* [row_length] */
+    WORD32 num_rows,
+    WORD32 row_length,
+    FLOAT32 epsilon);
+
+/* gamma scale g: p_beta is in units of g/1024 and out_multiplier/out_shift
+ * quantize g/out_scale. TFLite integer LSTM passes its layer norm weights,
+ * bias, (layer_norm_scale_a, layer_norm_scale_b + 12) and variance_limit.
+ * The row variance is computed exactly; row_length must be below 65536. */
+WORD32 xa_nn_layer_norm_sym16s_sym16s(WORD16 * __restrict__ p_out,
+                                const WORD16 * __restrict__ p_inp,
+                                const WORD16 * __restrict__ p_gamma,
+                                const WORD32 * __restrict__ p_beta,
+                                      WORD32 num_rows,
+                                      WORD32 row_length,
+                                      WORD32 out_multiplier,
+                                      WORD32 out_shift,
+                                      WORD32 variance_limit);
+
+WORD32 xa_nn_layer_norm_asym8s_asym8s(WORD8 * __restrict__ p_out,
+                                const WORD8 * __restrict__ p_inp,
+                                const WORD16 * __restrict__ p_gamma,
+                                const WORD32 * __restrict__ p_beta,
+                                      WORD32 num_rows,
+                                      WORD32 row_length,
+                                      WORD32 out_multiplier,
+                                      WORD32 out_shift,
+                                      WORD32 out_zero_bias,
+                                      WORD32 variance_limit);
+
 WORD32 xa_nn_dot_prod_f32xf32_f32(
     FLOAT32 * __restrict__ p_out,          /* pointer to output */
     const FLOAT32 * __restrict__ p_inp1,   /* pointer to input1 */
@@ -2004,6 +2707,189 @@ WORD32 xa_nn_dot_prod_16x16_asym8s(
     WORD32 out_zero_bias,
     WORD32 vec_count);
 
+WORD32 xa_nn_vec_noise_reduction_32_32(UWORD32 * p_signal,
+                                       UWORD32 * __restrict__ p_estimate,
+                                       WORD32  smoothing_bits,
+                                       WORD32  even_smoothing,
+                                       WORD32  odd_smoothing,
+                                       WORD32  min_signal_remaining,
+                                       WORD32  num_channels);
+
+WORD32 xa_nn_vec_pcan_gain_control_32_32(UWORD32 * p_signal,
+                                         const UWORD32 * __restrict__ p_noise_estimate,
+                                         const WORD16 * __restrict__ p_gain_lut,
+                                         WORD32  snr_shift,
+                                         WORD32  num_channels);
+
+WORD32 xa_nn_vec_log_scale_32_16(UWORD16 * p_out,
+                                 const UWORD32 * p_inp,
+                                 WORD32  scale_shift,
+                                 WORD32  correction_bits,
+                                 WORD32  num_elm);
+
+WORD32 xa_nn_matXvec_sparse_pack_getsize_sym8s(
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 block_size);
+
+WORD32 xa_nn_matXvec_sparse_pack_sym8s(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 block_size);
+
+WORD32 xa_nn_matXvec_sparse_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 block_size,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_fully_connected_sparse_sym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_packed_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  block_size
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  );
+
+WORD32 xa_nn_matXvec_sym4s_pack_getsize_sym8s(
+    WORD32 rows,
+    WORD32 cols);
+
+WORD32 xa_nn_matXvec_sym4s_pack_sym8s(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride);
+
+WORD32 xa_nn_matXvec_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_per_chan_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_fully_connected_sym4sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_packed_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  );
+
+WORD32 xa_nn_conv2d_pointwise_per_chan_sym4sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format);
+
+WORD32 xa_nn_matXvec_f16xf32_f32(
+    FLOAT32 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const FLOAT32 * __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_vec2,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows, WORD32 cols1, WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2);
+
+WORD32 xa_nn_matXvec_batch_f16xf32_f32(
+    FLOAT32 ** __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    FLOAT32 ** __restrict__ p_vec1,
+    const FLOAT32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count);
+
+WORD32 xa_nn_conv2d_std_f16xf32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_handle);
+
+/* In-place execution contract: xa_nn_get_inplace_capability() returns a
+ * bitmask telling which inputs of the named kernel may be passed as the
+ * same pointer as p_out (exact aliasing only, partial overlap is never
+ * allowed). XA_NN_INPLACE_INP1 refers to the first input pointer after
+ * p_out (p_vec / p_inp / p_inp1), XA_NN_INPLACE_INP2 to the second one
+ * (p_vec_alpha / p_inp2). Unknown or non-certified kernels return
+ * XA_NN_INPLACE_NONE. */
+#define XA_NN_INPLACE_NONE 0
+#define XA_NN_INPLACE_INP1 1
+#define XA_NN_INPLACE_INP2 2
+
+WORD32 xa_nn_get_inplace_capability(const char *p_kernel_name);
+
 /* Mapping the functions names from previous naming convension for backward compatibility */
 #define xa_nn_matXvec_asym8xasym8_asym8 xa_nn_matXvec_asym8uxasym8u_asym8u
 #define xa_nn_matmul_asym8xasym8_asym8 xa_nn_matmul_asym8uxasym8u_asym8u
@@ -35,7 +35,10 @@ typedef enum _xa_nnlib_lstm_param_id_t
   XA_NNLIB_LSTM_BIAS                   = 3,             // GET/SET biases
   XA_NNLIB_LSTM_INPUT_SHAPE            = 4,             // GET input shape information
   XA_NNLIB_LSTM_OUTPUT_SHAPE           = 5,             // GET output shape information
-  XA_NNLIB_LSTM_CELL_SHAPE             = 6              // GET cell shape information
+  XA_NNLIB_LSTM_CELL_SHAPE             = 6,             // GET cell shape information
+  XA_NNLIB_LSTM_PEEPHOLE               = 7,             // GET/SET peephole weights
+  XA_NNLIB_LSTM_PROJECTION             = 8,             // GET/SET projection weights and bias
+  XA_NNLIB_LSTM_LAYER_NORM             = 9              // GET/SET layer norm weights
 } xa_nnlib_lstm_param_id_t;
 
 /* I/O Precision Settings */
@@ -47,6 +50,13 @@ typedef enum _xa_nnlib_lstm_precision_t
   XA_NNLIB_LSTM_flt16xflt16         = 103            // Not supported
 } xa_nnlib_lstm_precision_t;
 
+/* Sequence direction for xa_nnlib_lstm_process_sequence */
+typedef enum _xa_nnlib_lstm_direction_t
+{
+  XA_NNLIB_LSTM_FORWARD             = 0,             // Steps 0 to n-1
+  XA_NNLIB_LSTM_BACKWARD            = 1              // Steps n-1 to 0
+} xa_nnlib_lstm_direction_t;
+
 
 /************************************************************/
 /* Class 1: Configuration Errors                            */
@@ -64,7 +74,10 @@ typedef enum _xa_nnlib_fatal_config_lstm_error_code_t
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_CELL_QFORMAT     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 4),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 5),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 6),
-  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7)
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_DIRECTION        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 8),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_VARIANT          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 9),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PROJ_FEATS       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 10)
 } xa_nnlib_fatal_config_lstm_error_code_t;
 
 /************************************************************/
@@ -102,9 +115,21 @@ typedef struct _xa_nnlib_lstm_init_config_t
   Int16 cell_Qformat;
   /* Number of fractional bits for input and output; 0-15 */
   Int16 io_Qformat;
+  /* Coupled input-forget gate, i = 1 - f; 0 or 1 */
+  Int32 use_cifg;
+  /* Peephole connections from the cell state to i, f and o gates; 0 or 1 */
+  Int32 use_peephole;
+  /* Layer normalization of each gate pre-activation; 0 or 1 */
+  Int32 use_layer_norm;
+  /* Number of projected output features; 0 (no projection) or 4-2048 (in step of 4) */
+  Int32 proj_feats;
+  /* Projection output clip in io_Qformat; 0 for no clipping */
+  Int16 proj_clip;
 } xa_nnlib_lstm_init_config_t;
 
 /* Structure for getting/setting XA_NNLIB_LSTM_WEIGHT parameter
+. w_h* are out_feats x proj_feats when projection is enabled,
+ w_xi and w_hi are not used with CIFG.
 . All pointer needs to be 8 bytes aligned.                  */
 typedef union _xa_nnlib_lstm_weights_t
 {
@@ -142,6 +167,45 @@ typedef struct _xa_nnlib_lstm_biases_t
   coeff_t *b_o; xa_nnlib_shape_t shape_b_o;
 } xa_nnlib_lstm_biases_t;
 
+/* Structure for getting/setting XA_NNLIB_LSTM_PEEPHOLE parameter.
+ Vectors of out_feats elements in coeff_Qformat, p_i is not used with
+ CIFG. All pointer needs to be 8 bytes aligned.               */
+typedef struct _xa_nnlib_lstm_peephole_t
+{
+  coeff_t *p_i; xa_nnlib_shape_t shape_p_i;
+  coeff_t *p_f; xa_nnlib_shape_t shape_p_f;
+  coeff_t *p_o; xa_nnlib_shape_t shape_p_o;
+} xa_nnlib_lstm_peephole_t;
+
+/* Structure for getting/setting XA_NNLIB_LSTM_PROJECTION parameter.
+ w_proj is proj_feats x out_feats, b_proj (proj_feats) may be NULL.
+ All pointer needs to be 8 bytes aligned.                     */
+typedef union _xa_nnlib_lstm_projection_t
+{
+    struct
+    {
+        coeff_t *w_proj; xa_nnlib_shape_t shape_w_proj;
+        coeff_t *b_proj; xa_nnlib_shape_t shape_b_proj;
+    }proj16;
+    struct
+    {
+        coeff8_t *w_proj; xa_nnlib_shape_t shape_w_proj;
+        coeff_t *b_proj; xa_nnlib_shape_t shape_b_proj;
+    }proj8;
+} xa_nnlib_lstm_projection_t;
+
+/* Structure for getting/setting XA_NNLIB_LSTM_LAYER_NORM parameter.
+ Per-gate scales of out_feats elements in coeff_Qformat, the gate
+ biases are applied after normalization. ln_i is not used with CIFG.
+ All pointer needs to be 8 bytes aligned.                     */
+typedef struct _xa_nnlib_lstm_layer_norm_t
+{
+  coeff_t *ln_f; xa_nnlib_shape_t shape_ln_f;
+  coeff_t *ln_i; xa_nnlib_shape_t shape_ln_i;
+  coeff_t *ln_c; xa_nnlib_shape_t shape_ln_c;
+  coeff_t *ln_o; xa_nnlib_shape_t shape_ln_o;
+} xa_nnlib_lstm_layer_norm_t;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif    /* __cplusplus */
@@ -172,6 +236,16 @@ Int32 xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     xa_nnlib_shape_t *p_in_shape,
     xa_nnlib_shape_t *p_out_shape);
 
+/* Runs p_in_shape->n_shapes time steps; shape_offset of the input and
+   output shapes is the stride in elements between steps */
+Int32 xa_nnlib_lstm_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape,
+    xa_nnlib_lstm_direction_t direction);
+
 #if defined(__cplusplus)
 }
 #endif    /* __cplusplus */
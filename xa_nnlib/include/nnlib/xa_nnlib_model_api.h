@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_MODEL_API_H__
+#define __XA_MODEL_API_H__
+
+#include "xa_nnlib_standards.h"
+#include "xa_nnlib_net_api.h"
+
+#define XA_NNLIB_MODEL    5
+
+/* Blob format:
+   | header | layer table | config 0 | sections 0 | config 1 | sections 1 | ...
+   All offsets are in bytes from the start of the blob. Configs and weight
+   sections start at XA_NNLIB_MODEL_ALIGNMENT boundaries and hold the data
+   exactly as the layers consume it, so weights are bound in place (ROM,
+   flash or mapped file) without copy. The blob is native endian and is
+   generated with the library structure definitions, see
+   test/src/xa_nn_model_gen.c. */
+#define XA_NNLIB_MODEL_MAGIC          0x4D4E4E58      /* "XNNM" */
+#define XA_NNLIB_MODEL_VERSION        1
+#define XA_NNLIB_MODEL_ALIGNMENT      16
+#define XA_NNLIB_MODEL_MAX_SECTIONS   12
+
+/* Weight section indices of a GRU layer */
+typedef enum _xa_nnlib_model_gru_section_t
+{
+  XA_NNLIB_MODEL_GRU_W_Z = 0,
+  XA_NNLIB_MODEL_GRU_U_Z,
+  XA_NNLIB_MODEL_GRU_W_R,
+  XA_NNLIB_MODEL_GRU_U_R,
+  XA_NNLIB_MODEL_GRU_W_H,
+  XA_NNLIB_MODEL_GRU_U_H,
+  XA_NNLIB_MODEL_GRU_B_Z,
+  XA_NNLIB_MODEL_GRU_B_R,
+  XA_NNLIB_MODEL_GRU_B_H,
+  XA_NNLIB_MODEL_GRU_N_SECTIONS
+} xa_nnlib_model_gru_section_t;
+
+/* Weight section indices of a LSTM layer */
+typedef enum _xa_nnlib_model_lstm_section_t
+{
+  XA_NNLIB_MODEL_LSTM_W_XF = 0,
+  XA_NNLIB_MODEL_LSTM_W_HF,
+  XA_NNLIB_MODEL_LSTM_W_XI,
+  XA_NNLIB_MODEL_LSTM_W_HI,
+  XA_NNLIB_MODEL_LSTM_W_XC,
+  XA_NNLIB_MODEL_LSTM_W_HC,
+  XA_NNLIB_MODEL_LSTM_W_XO,
+  XA_NNLIB_MODEL_LSTM_W_HO,
+  XA_NNLIB_MODEL_LSTM_B_F,
+  XA_NNLIB_MODEL_LSTM_B_I,
+  XA_NNLIB_MODEL_LSTM_B_C,
+  XA_NNLIB_MODEL_LSTM_B_O,
+  XA_NNLIB_MODEL_LSTM_N_SECTIONS
+} xa_nnlib_model_lstm_section_t;
+
+/* Weight section indices of a CNN layer, index 0/1 follow the
+   XA_NNLIB_CNN_KERNEL/BIAS/OUT_MULTIPLIER/OUT_SHIFT params layout:
+   [0] - standard or depthwise, [1] - pointwise. Section sizes must
+   match the init config shapes (including their padding) exactly,
+   unused sections are empty.                                    */
+typedef enum _xa_nnlib_model_cnn_section_t
+{
+  XA_NNLIB_MODEL_CNN_KERNEL_0 = 0,
+  XA_NNLIB_MODEL_CNN_KERNEL_1,
+  XA_NNLIB_MODEL_CNN_BIAS_0,
+  XA_NNLIB_MODEL_CNN_BIAS_1,
+  XA_NNLIB_MODEL_CNN_OUT_MULTIPLIER_0,
+  XA_NNLIB_MODEL_CNN_OUT_MULTIPLIER_1,
+  XA_NNLIB_MODEL_CNN_OUT_SHIFT_0,
+  XA_NNLIB_MODEL_CNN_OUT_SHIFT_1,
+  XA_NNLIB_MODEL_CNN_N_SECTIONS
+} xa_nnlib_model_cnn_section_t;
+
+/* Blob header */
+typedef struct _xa_nnlib_model_header_t
+{
+  Int32 magic;                            /* XA_NNLIB_MODEL_MAGIC */
+  Int32 version;                          /* XA_NNLIB_MODEL_VERSION */
+  Int32 blob_size;                        /* Total blob size in bytes */
+  Int32 n_layers;                         /* Number of layers; 1-XA_NNLIB_NET_MAX_LAYERS */
+  Int32 layer_table_offset;               /* Offset of xa_nnlib_model_layer_t[n_layers] */
+} xa_nnlib_model_header_t;
+
+/* Layer table entry, unused sections have offset and size 0 */
+typedef struct _xa_nnlib_model_layer_t
+{
+  Int32 type;                             /* xa_nnlib_net_layer_type_t */
+  Int32 config_offset;                    /* Offset of the layer init config */
+  Int32 config_size;                      /* Size of the layer init config, must match the library */
+  Int32 section_offset[XA_NNLIB_MODEL_MAX_SECTIONS];
+  Int32 section_size[XA_NNLIB_MODEL_MAX_SECTIONS];
+} xa_nnlib_model_layer_t;
+
+/************************************************************/
+/* Class 1: Configuration Errors                            */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_config_model_error_code_t
+{
+  XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_MAGIC           = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_MODEL, 0),
+  XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_VERSION         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_MODEL, 1),
+  XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_MODEL, 2),
+  XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_SECTION         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_MODEL, 3)
+} xa_nnlib_fatal_config_model_error_code_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+/************************************************************/
+/* MODEL Query Functions                                    */
+/************************************************************/
+Int32 xa_nnlib_model_get_persistent_fast(const void *p_blob, Int32 blob_size);
+
+Int32 xa_nnlib_model_get_scratch_fast(const void *p_blob, Int32 blob_size);
+
+/************************************************************/
+/* MODEL Initialization Function                            */
+/************************************************************/
+/* Initializes a network handle (xa_nnlib_net_*) from the blob and
+   binds all layer weights to the blob in place. The blob must stay
+   valid and 16 byte aligned for the lifetime of the handle. The
+   network is run with xa_nnlib_net_process.                    */
+Int32 xa_nnlib_model_init(xa_nnlib_handle_t handle, const void *p_blob, Int32 blob_size);
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif  /* __XA_MODEL_API_H__ */
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NET_API_H__
+#define __XA_NET_API_H__
+
+#include "xa_nnlib_standards.h"
+#include "xa_nnlib_cnn_api.h"
+#include "xa_nnlib_lstm_api.h"
+#include "xa_nnlib_gru_api.h"
+
+#define XA_NNLIB_NET    4
+
+/* Maximum number of layers in a network */
+#define XA_NNLIB_NET_MAX_LAYERS   16
+
+/* GET Config Parameters                                    */
+typedef enum _xa_nnlib_net_param_id_t
+{
+  XA_NNLIB_NET_LAYER_HANDLE        = 0,             // GET layer handle, params: xa_nnlib_net_layer_handle_t *
+  XA_NNLIB_NET_INPUT_SHAPE         = 1,             // GET input shape information (first layer)
+  XA_NNLIB_NET_OUTPUT_SHAPE        = 2              // GET output shape information (last layer)
+} xa_nnlib_net_param_id_t;
+
+/* Layer types, same ids as the layer APIs */
+typedef enum _xa_nnlib_net_layer_type_t
+{
+  XA_NNLIB_NET_LAYER_GRU           = XA_NNLIB_GRU,
+  XA_NNLIB_NET_LAYER_LSTM          = XA_NNLIB_LSTM,
+  XA_NNLIB_NET_LAYER_CNN           = XA_NNLIB_CNN
+} xa_nnlib_net_layer_type_t;
+
+/************************************************************/
+/* Class 1: Configuration Errors                            */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_config_net_error_code_t
+{
+  XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_NET, 0),
+  XA_NNLIB_NET_CONFIG_FATAL_INVALID_LAYER_TYPE        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_NET, 1),
+  XA_NNLIB_NET_CONFIG_FATAL_LAYER_MISMATCH            = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_NET, 2),
+  XA_NNLIB_NET_CONFIG_FATAL_INVALID_PARAM_ID          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_NET, 3)
+} xa_nnlib_fatal_config_net_error_code_t;
+
+/************************************************************/
+/* Class 1: Execution Errors                                */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+/* None, errors of the failing layer are returned as is */
+
+
+/* Structure for a layer of the network */
+typedef struct _xa_nnlib_net_layer_config_t
+{
+  xa_nnlib_net_layer_type_t type;         /* Layer type */
+  void *p_config;                         /* Layer init config: xa_nnlib_cnn_init_config_t, xa_nnlib_lstm_init_config_t or xa_nnlib_gru_init_config_t */
+} xa_nnlib_net_layer_config_t;
+
+/* Structure for initial configuration */
+typedef struct _xa_nnlib_net_init_config_t
+{
+  Int32 n_layers;                         /* Number of layers; 1-XA_NNLIB_NET_MAX_LAYERS */
+  xa_nnlib_net_layer_config_t *p_layers;  /* Layers in execution order, output of layer i is input of layer i+1 */
+} xa_nnlib_net_init_config_t;
+
+/* Structure for getting XA_NNLIB_NET_LAYER_HANDLE parameter, the
+   returned handle is used with xa_nnlib_<layer>_set_config to set
+   weights, biases and context of the layer.                  */
+typedef struct _xa_nnlib_net_layer_handle_t
+{
+  Int32 layer_idx;                        /* [in] Layer index */
+  xa_nnlib_handle_t handle;               /* [out] Layer handle */
+} xa_nnlib_net_layer_handle_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+/************************************************************/
+/* NET Query Functions                                      */
+/************************************************************/
+Int32 xa_nnlib_net_get_persistent_fast( xa_nnlib_net_init_config_t *config);
+
+Int32 xa_nnlib_net_get_scratch_fast( xa_nnlib_net_init_config_t *config);
+
+/************************************************************/
+/* NET Initialization Function                              */
+/************************************************************/
+Int32 xa_nnlib_net_init(xa_nnlib_handle_t handle, xa_nnlib_net_init_config_t *config);
+
+/************************************************************/
+/* NET Execution Functions                                  */
+/************************************************************/
+Int32 xa_nnlib_net_get_config(xa_nnlib_handle_t handle, xa_nnlib_net_param_id_t param_id, void *params);
+
+Int32 xa_nnlib_net_process(xa_nnlib_handle_t handle,
+                           void *scratch,
+                           void *input,
+                           void *output,
+                           xa_nnlib_shape_t *p_in_shape,
+                           xa_nnlib_shape_t *p_out_shape );
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif  /* __XA_NET_API_H__ */
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_RNN_SEQ_API_H__
+#define __XA_RNN_SEQ_API_H__
+
+#include "xa_nnlib_standards.h"
+#include "xa_nnlib_lstm_api.h"
+#include "xa_nnlib_gru_api.h"
+
+#define XA_NNLIB_RNN_SEQ    6
+
+/* Maximum number of stacked layers */
+#define XA_NNLIB_RNN_SEQ_MAX_LAYERS   8
+
+/* GET Config Parameters                                    */
+typedef enum _xa_nnlib_rnn_seq_param_id_t
+{
+  XA_NNLIB_RNN_SEQ_CELL_HANDLE     = 0,             // GET cell handle, params: xa_nnlib_rnn_seq_cell_handle_t *
+  XA_NNLIB_RNN_SEQ_INPUT_SHAPE     = 1,             // GET input shape information (first layer, max_steps)
+  XA_NNLIB_RNN_SEQ_OUTPUT_SHAPE    = 2              // GET output shape information (last layer, max_steps)
+} xa_nnlib_rnn_seq_param_id_t;
+
+/* Cell types, same ids as the layer APIs */
+typedef enum _xa_nnlib_rnn_seq_cell_type_t
+{
+  XA_NNLIB_RNN_SEQ_CELL_GRU        = XA_NNLIB_GRU,
+  XA_NNLIB_RNN_SEQ_CELL_LSTM       = XA_NNLIB_LSTM
+} xa_nnlib_rnn_seq_cell_type_t;
+
+/* Cell directions */
+typedef enum _xa_nnlib_rnn_seq_direction_t
+{
+  XA_NNLIB_RNN_SEQ_FORWARD         = 0,
+  XA_NNLIB_RNN_SEQ_BACKWARD        = 1              // Only with bidirectional
+} xa_nnlib_rnn_seq_direction_t;
+
+/************************************************************/
+/* Class 1: Configuration Errors                            */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_config_rnn_seq_error_code_t
+{
+  XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_N_LAYERS      = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN_SEQ, 0),
+  XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_CELL_TYPE     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN_SEQ, 1),
+  XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_BIDIRECTIONAL = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN_SEQ, 2),
+  XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_MAX_STEPS     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN_SEQ, 3),
+  XA_NNLIB_RNN_SEQ_CONFIG_FATAL_LAYER_MISMATCH        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN_SEQ, 4),
+  XA_NNLIB_RNN_SEQ_CONFIG_FATAL_INVALID_PARAM_ID      = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN_SEQ, 5)
+} xa_nnlib_fatal_config_rnn_seq_error_code_t;
+
+/************************************************************/
+/* Class 1: Execution Errors                                */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_exec_rnn_seq_error_code_t
+{
+  XA_NNLIB_RNN_SEQ_EXECUTE_FATAL_INVALID_N_STEPS      = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_RNN_SEQ, 0)
+} xa_nnlib_fatal_exec_rnn_seq_error_code_t;
+
+
+/* Structure for initial configuration */
+typedef struct _xa_nnlib_rnn_seq_init_config_t
+{
+  xa_nnlib_rnn_seq_cell_type_t cell_type; /* Cell type of all layers */
+  Int32 n_layers;                         /* Number of stacked layers; 1-XA_NNLIB_RNN_SEQ_MAX_LAYERS */
+  Int32 bidirectional;                    /* 0: forward only, 1: forward and backward cell per layer */
+  Int32 max_steps;                        /* Maximum sequence length; sizes the inter-layer buffers */
+  void *p_cell_configs;                   /* n_layers xa_nnlib_lstm_init_config_t or xa_nnlib_gru_init_config_t;
+                                             both directions of a layer share its config. in_feats of layer k
+                                             must be (1 + bidirectional) * out_feats of layer k-1 */
+} xa_nnlib_rnn_seq_init_config_t;
+
+/* Structure for getting XA_NNLIB_RNN_SEQ_CELL_HANDLE parameter, the
+   returned handle is used with xa_nnlib_lstm_set_config or
+   xa_nnlib_gru_set_config to set weights and biases of the cell.  */
+typedef struct _xa_nnlib_rnn_seq_cell_handle_t
+{
+  Int32 layer_idx;                        /* [in] Layer index */
+  xa_nnlib_rnn_seq_direction_t direction; /* [in] Cell direction */
+  xa_nnlib_handle_t handle;               /* [out] Cell handle */
+} xa_nnlib_rnn_seq_cell_handle_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+/************************************************************/
+/* RNN_SEQ Query Functions                                  */
+/************************************************************/
+Int32 xa_nnlib_rnn_seq_get_persistent_fast( xa_nnlib_rnn_seq_init_config_t *config);
+
+Int32 xa_nnlib_rnn_seq_get_scratch_fast( xa_nnlib_rnn_seq_init_config_t *config);
+
+/************************************************************/
+/* RNN_SEQ Initialization Function                          */
+/************************************************************/
+Int32 xa_nnlib_rnn_seq_init(xa_nnlib_handle_t handle, xa_nnlib_rnn_seq_init_config_t *config);
+
+/************************************************************/
+/* RNN_SEQ Execution Functions                              */
+/************************************************************/
+Int32 xa_nnlib_rnn_seq_get_config(xa_nnlib_handle_t handle, xa_nnlib_rnn_seq_param_id_t param_id, void *params);
+
+/* Runs a whole sequence of p_in_shape->n_shapes steps (1-max_steps),
+   starting from zero context. shape_offset of the input and output
+   shapes is the stride in elements between steps. With bidirectional
+   each output step holds the forward outputs followed by the backward
+   outputs. */
+Int32 xa_nnlib_rnn_seq_process(xa_nnlib_handle_t handle,
+                               void *scratch,
+                               void *input,
+                               void *output,
+                               xa_nnlib_shape_t *p_in_shape,
+                               xa_nnlib_shape_t *p_out_shape );
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif  /* __XA_RNN_SEQ_API_H__ */
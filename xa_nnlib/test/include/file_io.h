@@ -28,6 +28,7 @@ int write_buf1D_to_file(FILE *fptr_write_data, buf1D_t *ptr_buf1D);
 int write_buf2D_to_file(FILE *fptr_write_data, buf2D_t *ptr_buf2D); 
 int load_matXvec_input_data(int write_file, FILE *fptr_inp, buf2D_t *p_mat1, buf1D_t *p_vec1, 
     buf2D_t *p_mat2, buf1D_t *p_vec2, buf1D_t *p_bias); 
+int load_batch_matmul_input_data(int write_file, FILE *fptr_inp, buf2D_t *p_mat1, buf2D_t *p_mat2); 
 int load_conv2d_std_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf2D_t *p_kernel,
     buf1D_t *p_bias, int input_channels, int input_channels_pad, int kernel_pad_val);
 int load_conv1d_std_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf2D_t *p_kernel, 
@@ -35,9 +36,14 @@ int load_conv1d_std_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, b
     int kernel_pad_val);
 int load_conv2d_ds_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf2D_t *p_kernel,
     buf1D_t *p_bias, buf1D_t *p_kernel_point, buf1D_t *p_bias_point, int kernel_pad_val);
+int load_inverted_residual_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_kernel_expand,
+    buf1D_t *p_bias_expand, buf2D_t *p_kernel, buf1D_t *p_bias, buf1D_t *p_kernel_point, buf1D_t *p_bias_point,
+    int kernel_pad_val);
 int load_activation_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp); 
 int load_pool_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp);
 int load_norm_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp);
+int load_layer_norm_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_gamma,
+    buf1D_t *p_beta);
 int load_basic_func_data(int write_file, FILE *fptr_inp1, FILE *fptr_inp2, buf1D_t *p_inp1, buf1D_t *p_inp2);
 int write_output_data(FILE *fptr_out, buf1D_t *p_out); 
 FILE* file_open(char *file_path, char *file_name, char *mode, int max_file_name_length);
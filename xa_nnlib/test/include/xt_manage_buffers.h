@@ -30,6 +30,7 @@
 #define ASYM8S_TYPE -4
 #define SYM8S_TYPE -5
 #define FLOAT_TYPE -1
+#define FLOAT16_TYPE -2
 
 typedef struct _buf1D_t{
   void *p;
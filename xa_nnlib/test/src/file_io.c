@@ -26,6 +26,7 @@
   switch(precision)                                \
   {                                                \
     case -1: size = sizeof(float);       break;    \
+    case FLOAT16_TYPE: size = sizeof(short int); break; \
     case ASYM8_TYPE: size = sizeof(char);       break;    \
     case ASYM8S_TYPE: size = sizeof(char);       break;    \
     case SYM8S_TYPE: size = sizeof(char);       break;    \
@@ -134,6 +135,27 @@ int load_matXvec_input_data(int write_file, FILE *fptr_inp, buf2D_t *p_mat1, buf
   return 0;
 }
 
+int load_batch_matmul_input_data(int write_file, FILE *fptr_inp, buf2D_t *p_mat1, buf2D_t *p_mat2) 
+{  
+  if(write_file)                                                                     
+  {                                                                                  
+    /* Set random input data */                                                      
+    set_rand_inp_buf2D(p_mat1);                                                      
+    set_rand_inp_buf2D(p_mat2);                                                      
+                                                                                     
+    /* Write input data into file */                                                 
+    write_buf2D_to_file(fptr_inp, p_mat1);                  
+    write_buf2D_to_file(fptr_inp, p_mat2);                  
+  }                                                           
+  else                                                        
+  {                                                           
+    /* Read input data from file */                           
+    read_buf2D_from_file(fptr_inp, p_mat1, 0);                  
+    read_buf2D_from_file(fptr_inp, p_mat2, 0);                  
+  }                                                                                  
+  return 0;
+}
+
 int load_activation_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp) 
 {  
   if(write_file)                                                                     
@@ -257,6 +279,44 @@ int load_conv2d_ds_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, bu
   return 0;
 }
 
+int load_inverted_residual_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_kernel_expand,
+    buf1D_t *p_bias_expand, buf2D_t *p_kernel, buf1D_t *p_bias, buf1D_t *p_kernel_point, buf1D_t *p_bias_point,
+    int kernel_pad_val)
+{  
+  if(write_file)                                                                     
+  {                                                                                  
+    /* Set random input data */                                                      
+    set_rand_inp_buf1D(p_inp);                                                      
+    set_rand_inp_buf1D(p_kernel_expand);                                                      
+    set_rand_inp_buf1D(p_bias_expand);                                                      
+    set_rand_inp_buf2D(p_kernel);                                                      
+    set_rand_inp_buf1D(p_bias);                                                      
+    set_rand_inp_buf1D(p_kernel_point);                                                      
+    set_rand_inp_buf1D(p_bias_point);                                                      
+                                                                                     
+    /* Write input data into file */                                                 
+    write_buf1D_to_file(fptr_inp, p_inp);                  
+    write_buf1D_to_file(fptr_inp, p_kernel_expand);                  
+    write_buf1D_to_file(fptr_inp, p_bias_expand);                  
+    write_buf2D_to_file(fptr_inp, p_kernel);                  
+    write_buf1D_to_file(fptr_inp, p_bias);                  
+    write_buf1D_to_file(fptr_inp, p_kernel_point);                  
+    write_buf1D_to_file(fptr_inp, p_bias_point);                  
+  }                                                           
+  else                                                        
+  {                                                           
+    /* Read input data from file */                           
+    read_buf1D_from_file(fptr_inp, p_inp);                  
+    read_buf1D_from_file(fptr_inp, p_kernel_expand);                  
+    read_buf1D_from_file(fptr_inp, p_bias_expand);                  
+    read_buf2D_from_file(fptr_inp, p_kernel, kernel_pad_val);                  
+    read_buf1D_from_file(fptr_inp, p_bias);                  
+    read_buf1D_from_file(fptr_inp, p_kernel_point);                  
+    read_buf1D_from_file(fptr_inp, p_bias_point);                  
+  }                                                                                  
+  return 0;
+}
+
 int load_pool_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp) 
 {  
   if(write_file)                                                                     
@@ -293,6 +353,31 @@ int load_norm_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp)
   return 0;
 }
 
+int load_layer_norm_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_gamma,
+    buf1D_t *p_beta)
+{
+  if(write_file)
+  {
+    /* Set random input data */
+    set_rand_inp_buf1D(p_inp);
+    set_rand_inp_buf1D(p_gamma);
+    set_rand_inp_buf1D(p_beta);
+
+    /* Write input data into file */
+    write_buf1D_to_file(fptr_inp, p_inp);
+    write_buf1D_to_file(fptr_inp, p_gamma);
+    write_buf1D_to_file(fptr_inp, p_beta);
+  }
+  else
+  {
+    /* Read input data from file */
+    read_buf1D_from_file(fptr_inp, p_inp);
+    read_buf1D_from_file(fptr_inp, p_gamma);
+    read_buf1D_from_file(fptr_inp, p_beta);
+  }
+  return 0;
+}
+
 int write_output_data(FILE *fptr_out, buf1D_t *p_out) 
 {  
   write_buf1D_to_file(fptr_out, p_out);                  
@@ -217,6 +217,11 @@ void show_usage(void)
     printf("\t-out_multiplier: Multiplier value for output Default=0x40000000\n");
     printf("\t-out_shift: Shift value for output Default=0\n");
     printf("\t-out_zero_bias: Zero bias value for output Default=0\n");
+    printf("\t =====================================\n ");
+    printf("\t ===== SYM16S specific parameters =====\n ");
+    printf("\t =====================================\n ");
+    printf("\t-inp_precision 16 -out_precision 16: sym16s sigmoid, tanh and softmax\n");
+    printf("\t-input_multiplier, -input_left_shift: input_scale * 2^11 (beta * input_scale * 2^11 for softmax)\n");
 }
 
 #define SIGMOID_ASYM8(KERNEL, IPREC, OPREC) \
@@ -267,6 +272,34 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define SIGMOID_SYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_sym16s_sym16s\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (WORD16 *) p_inp->p,\
+                    cfg.input_multiplier,\
+                    cfg.input_left_shift,\
+                    cfg.num_elements\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define TANH_SYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_sym16s_sym16s\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (WORD16 *) p_inp->p,\
+                    cfg.input_multiplier,\
+                    cfg.input_left_shift,\
+                    cfg.num_elements\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define ACTIVATION_MIN_MAX_ASYM8U_FN(IPREC, OPREC, ACTIVATION) \
     if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
       XTPWR_PROFILER_START(0);\
@@ -392,6 +425,21 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define SOFTMAX_SYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_sym16s_sym16s\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (WORD16 *) p_inp->p,\
+                    cfg.input_left_shift,\
+                    cfg.input_multiplier,\
+                    cfg.num_elements,\
+                    p_scratch->p\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #if HIFI_VFPU
 #define ACTIVATION_MIN_MAX_FN_F32(IPREC,OPREC, ACTIVATION) \
     if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
@@ -513,6 +561,9 @@ void show_usage(void)
     else SIGMOID_ASYM8(sigmoid, -3, -3) \
     else SIGMOID_ASYM8s(sigmoid, -4, -4) \
     else TANH_ASYM8s(tanh, -4, -4) \
+    else SIGMOID_SYM16S(sigmoid, 16, 16) \
+    else TANH_SYM16S(tanh, 16, 16) \
+    else SOFTMAX_SYM16S(softmax, 16, 16) \
     else {  printf("unsupported activation\n"); return -1;} 
 
 
@@ -639,6 +690,11 @@ int xa_nn_main_process(int argc, char *argv[])
       scratch_size = get_softmax_scratch_size(cfg.inp_precision, cfg.out_precision, cfg.num_elements);
       p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
   }
+  else if(!strcmp(cfg.activation,"softmax") && (cfg.inp_precision == 16) && (cfg.out_precision == 16))
+  {
+      scratch_size = get_softmax_scratch_size(PREC_SYM16S, PREC_SYM16S, cfg.num_elements);
+      p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
+  }
   
   
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, cfg.num_elements, "cyc/point", 0);
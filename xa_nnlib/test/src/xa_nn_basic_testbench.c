@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
 #include <xtensa/config/core-isa.h>
 #include "xa_type_def.h"
 #include "nnlib/xa_nnlib_api.h"
@@ -41,6 +42,7 @@
 #define XA_MAX_ARGS 100
 #define SHAPE_ARGS_LENGTH 80
 #define MAX_DIMS 8
+#define PCAN_GAIN_LUT_SIZE 125
 #define PARAMFILE "paramfilesimple_basic.txt"
 
 #define VALIDATE_PTR(ptr) if(NULL == ptr) { printf("%s: allocation failed\n", #ptr); return -1;}
@@ -115,6 +117,15 @@ typedef struct _test_config_t
   int input2_numElements;
   int input1_strides[MAX_DIMS];
   int input2_strides[MAX_DIMS];
+  // extra parameters for the audio frontend kernels
+  int smoothing_bits;
+  int even_smoothing;
+  int odd_smoothing;
+  int min_signal_remaining;
+  int snr_shift;
+  int scale_shift;
+  int correction_bits;
+  char read_lut_file_name[XA_MAX_CMD_LINE_LENGTH];
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -156,6 +167,14 @@ int default_config(test_config_t *p_cfg)
     p_cfg->write_inp2_file_name[0]='\0';
     p_cfg->write_out_file_name[0] = '\0';
     p_cfg->verify = 1;
+    p_cfg->smoothing_bits = 10;
+    p_cfg->even_smoothing = 409;
+    p_cfg->odd_smoothing = 983;
+    p_cfg->min_signal_remaining = 819;
+    p_cfg->snr_shift = 6;
+    p_cfg->scale_shift = 6;
+    p_cfg->correction_bits = 3;
+    p_cfg->read_lut_file_name[0] = '\0';
 
     int itr;
     for(itr = 0; itr < MAX_DIMS; itr++)
@@ -221,6 +240,9 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     if(argtype_string_to_array(argv, &argidx, "-read_out_shape_str", p_cfg->output_shape, p_cfg->num_out_dims)) {
         continue;
     }
+    if(argtype_string_to_array(argv, &argidx, "-input_shape", p_cfg->input_shape, p_cfg->num_inp_dims)) {
+        continue;
+    }
     
     ARGTYPE_STRING_TO_ARRAY("-read_axis_data_str", p_cfg->read_axis_data_str, SHAPE_ARGS_LENGTH, p_cfg->axis_data);
     
@@ -234,6 +256,16 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
         continue;
     }
     
+    // parsing extra parameters for the audio frontend kernels
+    ARGTYPE_ONETIME_CONFIG("-smoothing_bits", p_cfg->smoothing_bits);
+    ARGTYPE_ONETIME_CONFIG("-even_smoothing", p_cfg->even_smoothing);
+    ARGTYPE_ONETIME_CONFIG("-odd_smoothing", p_cfg->odd_smoothing);
+    ARGTYPE_ONETIME_CONFIG("-min_signal_remaining", p_cfg->min_signal_remaining);
+    ARGTYPE_ONETIME_CONFIG("-snr_shift", p_cfg->snr_shift);
+    ARGTYPE_ONETIME_CONFIG("-scale_shift", p_cfg->scale_shift);
+    ARGTYPE_ONETIME_CONFIG("-correction_bits", p_cfg->correction_bits);
+    ARGTYPE_STRING("-read_lut_file_name", p_cfg->read_lut_file_name, XA_MAX_CMD_LINE_LENGTH);
+    
     ARGTYPE_STRING("-write_inp1_file_name", p_cfg->write_inp1_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp2_file_name", p_cfg->write_inp2_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_out_file_name", p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -252,11 +284,11 @@ void show_usage(void)
     printf("\t-num_inp_dims: number of input dimensions; Default=4\n");
     printf("\t-num_axis_dims: number of axis dimensions; Default=4\n");
     printf("\t-num_out_dims: number of output dimensions; Default=4\n");
-    printf("\t-inp_precision: -4 (asym8s) -3 (asym8u),  -1 (single prec float); Default=-1\n");
-    printf("\t-out_precision: -4 (asym8s) -3 (asym8u),  -1 (single prec float); Default=-1\n");
+    printf("\t-inp_precision: 16 (asym16s), -4 (asym8s) -3 (asym8u),  -1 (single prec float); Default=-1\n");
+    printf("\t-out_precision: 16 (asym16s), -4 (asym8s) -3 (asym8u),  -1 (single prec float); Default=-1\n");
     printf("\t-vec_count: number of input vectors; Default=1\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D; Default=""elm_add""\n");
+    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_quantize, gather, embedding_lookup, argmax, argmin, noise_reduction, pcan_gain_control, log_scale; Default=""elm_add""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp1_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_inp2_file_name: Full filename for reading inputs (order - inp) \n");
@@ -268,6 +300,7 @@ void show_usage(void)
     printf("\t-read_inp_shape_str: Takes the input  shape dimensions(space ' ' separated) as a string \n");
     printf("\t-read_out_shape_str: Takes the output shape dimensions(space ' ' separated) as a string \n");
     printf("\t-read_axis_data_str: Takes the axis data(space ' ' separated) as a string \n");
+    printf("\t-input_shape: num_inp_dims input shape dimensions as separate arguments (set -num_inp_dims first) \n");
     printf("\t =========================================\n ");
     printf("\t ===== Broadcast specific parameters =====\n ");
     printf("\t =========================================\n ");
@@ -290,6 +323,46 @@ void show_usage(void)
     printf ("\t-input2_left_shift: input2_left_shift(Only needed in add_asym8); Default=0\n");          
     printf ("\t-input2_multiplier: input2_multiplier(Only needed in add_asym8); Default=0x7fff\n");   
     printf ("\t-left_shift: global left_shift(Only needed in add_asym8); Default=0\n");
+    printf("\t =============================================\n ");
+    printf("\t ===== elm_quantize specific parameters =====\n ");
+    printf("\t =============================================\n ");
+    printf ("\t-inp_precision/-out_precision: -4 -4, -3 -4, -4 16, -1 -4, -4 -1, 16 -1 \n");
+    printf ("\t-input1_zero_bias, -output_zero_bias: input and output zero points \n");
+    printf ("\t-output_multiplier, -output_left_shift: requantize multiplier and shift; float output scale is output_multiplier*2^(output_left_shift-31) \n");
+    printf ("\t-input1_multiplier, -input1_left_shift: float input scale is input1_multiplier*2^(input1_left_shift-31) \n");
+    printf("\t ===================================================\n ");
+    printf("\t ===== gather/embedding_lookup specific parameters =====\n ");
+    printf("\t ===================================================\n ");
+    printf ("\t-input_shape, -num_inp_dims: input (table) shape; embedding_lookup takes num_rows row_length \n");
+    printf ("\t-read_axis_data_str: gather axis; embedding_lookup gathers along axis 0 \n");
+    printf ("\t-io_length: number of indices/ids, read as 32 bit values from read_inp2_file_name \n");
+    printf ("\t-inp_precision/-out_precision: gather 8 8, 16 16, 32 32; embedding_lookup -4 -4, -4 -1 (quantize parameters as for elm_quantize, same for every row) \n");
+    printf("\t =========================================\n ");
+    printf("\t ===== argmax/argmin specific parameters =====\n ");
+    printf("\t =========================================\n ");
+    printf ("\t-input_shape, -num_inp_dims, -read_axis_data_str: input shape and the reduced axis \n");
+    printf ("\t-inp_precision/-out_precision: -4 32, -3 32, 16 32, -1 32 \n");
+    printf("\t =========================================\n ");
+    printf("\t ===== audio frontend specific parameters =====\n ");
+    printf("\t =========================================\n ");
+    printf ("\t-io_length: number of channels; inp1 is the signal, inp2 the noise estimate (noise_reduction, pcan_gain_control) \n");
+    printf ("\t-inp_precision/-out_precision: noise_reduction 32 32, pcan_gain_control 32 32, log_scale 32 16 \n");
+    printf ("\t-smoothing_bits, -even_smoothing, -odd_smoothing, -min_signal_remaining: noise_reduction state; Default=10, 409, 983, 819\n");
+    printf ("\t-snr_shift: pcan_gain_control snr shift; Default=6\n");
+    printf ("\t-read_lut_file_name: pcan_gain_control gain LUT, %d 16 bit values \n", PCAN_GAIN_LUT_SIZE);
+    printf ("\t-scale_shift, -correction_bits: log_scale parameters; Default=6, 3\n");
+}
+
+static const char *precision_str(int precision)
+{
+  switch(precision)
+  {
+    case -1: return "f32";
+    case -3: return "asym8u";
+    case -4: return "asym8s";
+    case 16: return "asym16s";
+    default: return "unknown";
+  }
 }
 
 #define REDUCE_MAX_ASYM8S(KERNEL, IPREC, OPREC) \
@@ -722,6 +795,174 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define QUANTIZE_ASYM(KERNEL, IPREC, OPREC, ITYPE, OTYPE, SUFFIX) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_##SUFFIX\
+                (\
+                    (OTYPE *) p_out->p,\
+                    (ITYPE *) p_inp1->p,\
+                    cfg.input1_zero_bias,\
+                    cfg.output_zero_bias,\
+                    cfg.output_left_shift,\
+                    cfg.output_multiplier,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+/* Float scales are passed as a Q31 multiplier and a power-of-two shift */
+#define QUANTIZE_F32_ASYM8S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_f32_asym8s\
+                (\
+                    (WORD8 *) p_out->p,\
+                    (FLOAT32 *) p_inp1->p,\
+                    (FLOAT32) ldexp((double)cfg.output_multiplier, cfg.output_left_shift - 31),\
+                    cfg.output_zero_bias,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define DEQUANTIZE_F32(KERNEL, IPREC, OPREC, ITYPE, SUFFIX) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_##SUFFIX\
+                (\
+                    (FLOAT32 *) p_out->p,\
+                    (ITYPE *) p_inp1->p,\
+                    cfg.input1_zero_bias,\
+                    (FLOAT32) ldexp((double)cfg.input1_multiplier, cfg.input1_left_shift - 31),\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define GATHER(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_##IPREC\
+                (\
+                    (WORD##IPREC *) p_out->p,\
+                    (WORD##IPREC *) p_inp1->p,\
+                    (WORD32 *) cfg.input_shape,\
+                    cfg.num_inp_dims,\
+                    (WORD32 *) p_inp2->p,\
+                    cfg.io_length,\
+                    cfg.axis_data[0]\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define EMBEDDING_LOOKUP_ASYM8S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym8s_asym8s\
+                (\
+                    (WORD8 *) p_out->p,\
+                    (WORD8 *) p_inp1->p,\
+                    (WORD32 *) p_inp2->p,\
+                    cfg.io_length,\
+                    cfg.input_shape[0],\
+                    inp_length / cfg.input_shape[0],\
+                    cfg.input1_zero_bias,\
+                    p_row_multiplier,\
+                    p_row_shift,\
+                    cfg.output_zero_bias\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define EMBEDDING_LOOKUP_F32(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym8s_f32\
+                (\
+                    (FLOAT32 *) p_out->p,\
+                    (WORD8 *) p_inp1->p,\
+                    (WORD32 *) p_inp2->p,\
+                    cfg.io_length,\
+                    cfg.input_shape[0],\
+                    inp_length / cfg.input_shape[0],\
+                    cfg.input1_zero_bias,\
+                    p_row_scale\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define ARG_MIN_MAX(KERNEL, IPREC, OPREC, ITYPE, SUFFIX) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_##SUFFIX\
+                (\
+                    (WORD32 *) p_out->p,\
+                    (ITYPE *) p_inp1->p,\
+                    (WORD32 *) cfg.input_shape,\
+                    cfg.num_inp_dims,\
+                    cfg.axis_data[0]\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+/* Frontend kernels work in place on the signal, which is copied into the output first */
+#define NOISE_REDUCTION(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    memcpy(p_out->p, p_inp1->p, cfg.io_length * sizeof(UWORD32));\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_32_32\
+                (\
+                    (UWORD32 *) p_out->p,\
+                    (UWORD32 *) p_inp2->p,\
+                    cfg.smoothing_bits,\
+                    cfg.even_smoothing,\
+                    cfg.odd_smoothing,\
+                    cfg.min_signal_remaining,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define PCAN_GAIN_CONTROL(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    memcpy(p_out->p, p_inp1->p, cfg.io_length * sizeof(UWORD32));\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_32_32\
+                (\
+                    (UWORD32 *) p_out->p,\
+                    (UWORD32 *) p_inp2->p,\
+                    (WORD16 *) p_gain_lut->p,\
+                    cfg.snr_shift,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define LOG_SCALE(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_vec_##KERNEL##_32_16\
+                (\
+                    (UWORD16 *) p_out->p,\
+                    (UWORD32 *) p_inp1->p,\
+                    cfg.scale_shift,\
+                    cfg.correction_bits,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #if HIFI_VFPU
 #define PROCESS_BASIC_FUNC \
     BASIC_FLOAT32(elm_mul, -1, -1) \
@@ -755,6 +996,28 @@ void show_usage(void)
 	else LOGICALAND_BOOL(elm_logicaland, 1, 1) \
 	else LOGICALOR_BOOL(elm_logicalor, 1, 1) \
 	else LOGICALNOT_BOOL(elm_logicalnot, 1, 1) \
+    else QUANTIZE_ASYM(elm_quantize, -4, -4, WORD8, WORD8, asym8s_asym8s) \
+    else QUANTIZE_ASYM(elm_quantize, -3, -4, UWORD8, WORD8, asym8u_asym8s) \
+    else QUANTIZE_ASYM(elm_quantize, -4, 16, WORD8, WORD16, asym8s_asym16s) \
+    else QUANTIZE_F32_ASYM8S(elm_quantize, -1, -4) \
+    else DEQUANTIZE_F32(elm_quantize, -4, -1, WORD8, asym8s_f32) \
+    else DEQUANTIZE_F32(elm_quantize, 16, -1, WORD16, asym16s_f32) \
+    else GATHER(gather, 8, 8) \
+    else GATHER(gather, 16, 16) \
+    else GATHER(gather, 32, 32) \
+    else EMBEDDING_LOOKUP_ASYM8S(embedding_lookup, -4, -4) \
+    else EMBEDDING_LOOKUP_F32(embedding_lookup, -4, -1) \
+    else ARG_MIN_MAX(argmax, -4, 32, WORD8, asym8s) \
+    else ARG_MIN_MAX(argmin, -4, 32, WORD8, asym8s) \
+    else ARG_MIN_MAX(argmax, -3, 32, UWORD8, asym8u) \
+    else ARG_MIN_MAX(argmin, -3, 32, UWORD8, asym8u) \
+    else ARG_MIN_MAX(argmax, 16, 32, WORD16, 16) \
+    else ARG_MIN_MAX(argmin, 16, 32, WORD16, 16) \
+    else ARG_MIN_MAX(argmax, -1, 32, FLOAT32, f32) \
+    else ARG_MIN_MAX(argmin, -1, 32, FLOAT32, f32) \
+    else NOISE_REDUCTION(noise_reduction, 32, 32) \
+    else PCAN_GAIN_CONTROL(pcan_gain_control, 32, 32) \
+    else LOG_SCALE(log_scale, 32, 16) \
     else {  printf("unsupported basic operation\n"); return -1;}
 #else
 #define PROCESS_BASIC_FUNC \
@@ -782,6 +1045,22 @@ void show_usage(void)
 	else LOGICALAND_BOOL(elm_logicaland, 1, 1) \
 	else LOGICALOR_BOOL(elm_logicalor, 1, 1) \
 	else LOGICALNOT_BOOL(elm_logicalnot, 1, 1) \
+    else QUANTIZE_ASYM(elm_quantize, -4, -4, WORD8, WORD8, asym8s_asym8s) \
+    else QUANTIZE_ASYM(elm_quantize, -3, -4, UWORD8, WORD8, asym8u_asym8s) \
+    else QUANTIZE_ASYM(elm_quantize, -4, 16, WORD8, WORD16, asym8s_asym16s) \
+    else GATHER(gather, 8, 8) \
+    else GATHER(gather, 16, 16) \
+    else GATHER(gather, 32, 32) \
+    else EMBEDDING_LOOKUP_ASYM8S(embedding_lookup, -4, -4) \
+    else ARG_MIN_MAX(argmax, -4, 32, WORD8, asym8s) \
+    else ARG_MIN_MAX(argmin, -4, 32, WORD8, asym8s) \
+    else ARG_MIN_MAX(argmax, -3, 32, UWORD8, asym8u) \
+    else ARG_MIN_MAX(argmin, -3, 32, UWORD8, asym8u) \
+    else ARG_MIN_MAX(argmax, 16, 32, WORD16, 16) \
+    else ARG_MIN_MAX(argmin, 16, 32, WORD16, 16) \
+    else NOISE_REDUCTION(noise_reduction, 32, 32) \
+    else PCAN_GAIN_CONTROL(pcan_gain_control, 32, 32) \
+    else LOG_SCALE(log_scale, 32, 16) \
     else {  printf("unsupported basic operation\n"); return -1;}
 #endif
 
@@ -810,6 +1089,13 @@ int xa_nn_main_process(int argc, char *argv[])
   WORD32 *p_inp_shape, *p_out_shape, *p_axis;
   pVOID p_scratch;
 
+  // Per row quantization parameters for embedding_lookup
+  WORD32 *p_row_multiplier = NULL, *p_row_shift = NULL;
+  FLOAT32 *p_row_scale = NULL;
+
+  // Gain LUT for pcan_gain_control
+  buf1D_t *p_gain_lut = NULL;
+
   if(default_config(&cfg))
   {
     return -1;
@@ -838,9 +1124,58 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     out_length *= cfg.output_shape[itr]; 
   }
+  /* Gather output is the input with the axis dimension replaced by io_length indices */
+  if(!strcmp(cfg.kernel_name, "gather"))
+  {
+    out_length = inp_length / cfg.input_shape[cfg.axis_data[0]] * cfg.io_length;
+  }
+  else if(!strcmp(cfg.kernel_name, "embedding_lookup"))
+  {
+    out_length = inp_length / cfg.input_shape[0] * cfg.io_length;
+  }
+  else if(!strcmp(cfg.kernel_name, "argmax") || !strcmp(cfg.kernel_name, "argmin"))
+  {
+    out_length = inp_length / cfg.input_shape[cfg.axis_data[0]];
+  }
 
   // Set profiler name 
-  if(cfg.inp_precision == -1)
+  if(!strcmp(cfg.kernel_name, "elm_quantize") || !strcmp(cfg.kernel_name, "embedding_lookup"))
+  {
+    sprintf(profiler_name, "%s_%s_%s", cfg.kernel_name,
+        precision_str(cfg.inp_precision), precision_str(cfg.out_precision));
+
+    // If VFPU is not supported, return
+    if(!HIFI_VFPU && (cfg.inp_precision == -1 || cfg.out_precision == -1))
+    {
+      printf("%s: NOT TESTED\n", profiler_name);
+      return 0;
+    }
+  }
+  else if(!strcmp(cfg.kernel_name, "gather"))
+  {
+    sprintf(profiler_name, "%s_%d", cfg.kernel_name, cfg.inp_precision);
+  }
+  else if(!strcmp(cfg.kernel_name, "argmax") || !strcmp(cfg.kernel_name, "argmin"))
+  {
+    if(cfg.inp_precision == 16)
+      sprintf(profiler_name, "%s_16", cfg.kernel_name);
+    else
+      sprintf(profiler_name, "%s_%s", cfg.kernel_name, precision_str(cfg.inp_precision));
+
+    // If VFPU is not supported, return
+    if(!HIFI_VFPU && cfg.inp_precision == -1)
+    {
+      printf("%s: NOT TESTED\n", profiler_name);
+      return 0;
+    }
+  }
+  else if(!strcmp(cfg.kernel_name, "noise_reduction") ||
+          !strcmp(cfg.kernel_name, "pcan_gain_control") ||
+          !strcmp(cfg.kernel_name, "log_scale"))
+  {
+    sprintf(profiler_name, "%s_%d_%d", cfg.kernel_name, cfg.inp_precision, cfg.out_precision);
+  }
+  else if(cfg.inp_precision == -1)
   {
     sprintf(profiler_name, "%s_f32", cfg.kernel_name);
     
@@ -925,7 +1260,11 @@ int xa_nn_main_process(int argc, char *argv[])
              !strcmp(cfg.kernel_name, "elm_min_4D_Bcast")   ||
              !strcmp(cfg.kernel_name, "elm_max_4D_Bcast")   ||
              !strcmp(cfg.kernel_name, "elm_min_8D_Bcast")   ||
-             !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")       )
+             !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")   ||
+             !strcmp(cfg.kernel_name, "gather")             ||
+             !strcmp(cfg.kernel_name, "embedding_lookup")   ||
+             !strcmp(cfg.kernel_name, "argmax")             ||
+             !strcmp(cfg.kernel_name, "argmin")                 )
     {
       ptr_ref =  create_buf1D(out_length, cfg.out_precision); 
     }
@@ -966,6 +1305,40 @@ int xa_nn_main_process(int argc, char *argv[])
     p_inp1 = create_buf1D(cfg.input1_numElements, cfg.inp_precision); VALIDATE_PTR(p_inp1);
     p_inp2 = create_buf1D(cfg.input2_numElements, cfg.inp_precision); VALIDATE_PTR(p_inp2);
   }
+  else if(!strcmp(cfg.kernel_name, "gather") || !strcmp(cfg.kernel_name, "embedding_lookup"))
+  {
+    /* inp1 is the input (table), inp2 the 32 bit indices (ids) */
+    p_inp1 = create_buf1D(inp_length, cfg.inp_precision); VALIDATE_PTR(p_inp1);
+    p_inp2 = create_buf1D(cfg.io_length, 32); VALIDATE_PTR(p_inp2);
+
+    if(!strcmp(cfg.kernel_name, "embedding_lookup"))
+    {
+      p_row_multiplier = (WORD32 *)malloc(cfg.input_shape[0] * sizeof(WORD32)); VALIDATE_PTR(p_row_multiplier);
+      p_row_shift = (WORD32 *)malloc(cfg.input_shape[0] * sizeof(WORD32)); VALIDATE_PTR(p_row_shift);
+      p_row_scale = (FLOAT32 *)malloc(cfg.input_shape[0] * sizeof(FLOAT32)); VALIDATE_PTR(p_row_scale);
+      for(itr = 0; itr < cfg.input_shape[0]; itr++)
+      {
+        p_row_multiplier[itr] = cfg.output_multiplier;
+        p_row_shift[itr] = cfg.output_left_shift;
+        p_row_scale[itr] = (FLOAT32) ldexp((double)cfg.input1_multiplier, cfg.input1_left_shift - 31);
+      }
+    }
+  }
+  else if(!strcmp(cfg.kernel_name, "argmax") || !strcmp(cfg.kernel_name, "argmin"))
+  {
+    p_inp1 = create_buf1D(inp_length, cfg.inp_precision); VALIDATE_PTR(p_inp1);
+  }
+  else if(!strcmp(cfg.kernel_name, "pcan_gain_control"))
+  {
+    /* inp1 is the signal, inp2 the noise estimate; the gain LUT is read once */
+    FILE *fptr_lut;
+    p_inp1 = create_buf1D(cfg.io_length, cfg.inp_precision); VALIDATE_PTR(p_inp1);
+    p_inp2 = create_buf1D(cfg.io_length, cfg.inp_precision); VALIDATE_PTR(p_inp2);
+    p_gain_lut = create_buf1D(PCAN_GAIN_LUT_SIZE, 16); VALIDATE_PTR(p_gain_lut);
+    fptr_lut = file_open(pb_input_file_path, cfg.read_lut_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
+    read_buf1D_from_file(fptr_lut, p_gain_lut);
+    fclose(fptr_lut);
+  }
   else
   {
     p_inp1 = create_buf1D(cfg.io_length * cfg.vec_count, cfg.inp_precision); VALIDATE_PTR(p_inp1);
@@ -984,7 +1357,11 @@ int xa_nn_main_process(int argc, char *argv[])
            !strcmp(cfg.kernel_name, "elm_min_4D_Bcast")  ||
            !strcmp(cfg.kernel_name, "elm_max_4D_Bcast")  ||
            !strcmp(cfg.kernel_name, "elm_min_8D_Bcast")  ||
-           !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")      )
+           !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")  ||
+           !strcmp(cfg.kernel_name, "gather")            ||
+           !strcmp(cfg.kernel_name, "embedding_lookup")  ||
+           !strcmp(cfg.kernel_name, "argmax")            ||
+           !strcmp(cfg.kernel_name, "argmin")                )
   {
     p_out = create_buf1D(out_length, cfg.out_precision); VALIDATE_PTR(p_out);
   }
@@ -1038,7 +1415,11 @@ int xa_nn_main_process(int argc, char *argv[])
   else if( !strcmp(cfg.kernel_name, "elm_min_4D_Bcast")  ||
            !strcmp(cfg.kernel_name, "elm_max_4D_Bcast")  ||
            !strcmp(cfg.kernel_name, "elm_min_8D_Bcast")  ||
-           !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")       )
+           !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")  ||
+           !strcmp(cfg.kernel_name, "gather")            ||
+           !strcmp(cfg.kernel_name, "embedding_lookup")  ||
+           !strcmp(cfg.kernel_name, "argmax")            ||
+           !strcmp(cfg.kernel_name, "argmin")                 )
   {
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, out_length, "cyc/point", 0);
   }
@@ -1086,6 +1467,14 @@ int xa_nn_main_process(int argc, char *argv[])
   if(p_inp2)
     free_buf1D(p_inp2);
   free_buf1D(p_out);
+  if(p_row_multiplier)
+    free(p_row_multiplier);
+  if(p_row_shift)
+    free(p_row_shift);
+  if(p_row_scale)
+    free(p_row_scale);
+  if(p_gain_lut)
+    free_buf1D(p_gain_lut);
 
   if(cfg.verify)
   {
@@ -151,6 +151,13 @@ typedef struct _test_config_t
   int kernel_precision;
   int out_precision;
   int bias_precision;
+  int input_zero_bias;
+  int out_multiplier;
+  int out_shift;
+  int *p_out_multiplier;
+  int *p_out_shift;
+  int out_zero_bias;
+  int ds_depth_out_zero_bias;
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
@@ -187,6 +194,13 @@ int default_config(test_config_t *p_cfg)
     p_cfg->kernel_precision = 8;
     p_cfg->out_precision = 16;
     p_cfg->bias_precision = 16;
+    p_cfg->input_zero_bias = 0;
+    p_cfg->out_multiplier = 0x40000000;
+    p_cfg->out_shift = -8;
+    p_cfg->p_out_multiplier = NULL;
+    p_cfg->p_out_shift = NULL;
+    p_cfg->out_zero_bias = 0;
+    p_cfg->ds_depth_out_zero_bias = 0;
     strcpy(p_cfg->kernel_name, "conv2d_std");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
@@ -239,6 +253,11 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-kernel_precision",p_cfg->kernel_precision);
     ARGTYPE_ONETIME_CONFIG("-out_precision",p_cfg->out_precision);
     ARGTYPE_ONETIME_CONFIG("-bias_precision",p_cfg->bias_precision);
+    ARGTYPE_ONETIME_CONFIG("-input_zero_bias",p_cfg->input_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-out_multiplier",p_cfg->out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-out_shift",p_cfg->out_shift);
+    ARGTYPE_ONETIME_CONFIG("-out_zero_bias",p_cfg->out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-ds_depth_out_zero_bias",p_cfg->ds_depth_out_zero_bias);
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
@@ -273,6 +292,10 @@ int map_test_cfg_to_cnn_cfg(test_config_t *p_cfg, xa_nnlib_cnn_init_config_t *cn
         
         cnn_cfg->bias_shift = p_cfg->bias_shift;
         cnn_cfg->acc_shift  = p_cfg->acc_shift;
+
+        cnn_cfg->input_zero_bias        = p_cfg->input_zero_bias;
+        cnn_cfg->out_zero_bias          = p_cfg->out_zero_bias;
+        cnn_cfg->ds_depth_out_zero_bias = p_cfg->ds_depth_out_zero_bias;
  
         cnn_cfg->output_height   = p_cfg->out_height;
         cnn_cfg->output_width    = p_cfg->out_width;
@@ -300,6 +323,8 @@ int map_test_cfg_to_cnn_cfg(test_config_t *p_cfg, xa_nnlib_cnn_init_config_t *cn
             int kernel_channels_pad;
             if(p_cfg->inp_precision == -1)
               kernel_channels_pad = ((p_cfg->input_channels + 1) & (~1));
+            else if(p_cfg->inp_precision == ASYM8S_TYPE)
+              kernel_channels_pad = p_cfg->input_channels;
             else
               kernel_channels_pad = ((p_cfg->input_channels + 3) & (~3));
 
@@ -311,6 +336,8 @@ int map_test_cfg_to_cnn_cfg(test_config_t *p_cfg, xa_nnlib_cnn_init_config_t *cn
         else if(!strcmp(p_cfg->kernel_name,"conv2d_depth"))
         {
             int kernel_width_pad = ((p_cfg->kernel_width + 3) & (~3)); 
+            if(p_cfg->inp_precision == ASYM8S_TYPE)
+              kernel_width_pad = p_cfg->kernel_width;
             FILL_KERNEL_SHAPE_CUBE_DIMS(cnn_cfg->kernel_ds_depth_shape, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->input_channels*p_cfg->channels_multiplier, SHAPE_CUBE_WHD_T, 1)
             FILL_KERNEL_SHAPE_CUBE_OFFSETS(cnn_cfg->kernel_ds_depth_shape, (kernel_width_pad), (1), (kernel_width_pad*p_cfg->kernel_height))
             FILL_SHAPE_VECTOR(cnn_cfg->bias_ds_depth_shape, p_cfg->input_channels*p_cfg->channels_multiplier) 
@@ -335,6 +362,10 @@ int map_test_cfg_to_cnn_cfg(test_config_t *p_cfg, xa_nnlib_cnn_init_config_t *cn
         {
             cnn_cfg->precision = XA_NNLIB_CNN_f32xf32;
         }
+        else if (p_cfg->kernel_precision == SYM8S_TYPE && p_cfg->inp_precision == ASYM8S_TYPE && p_cfg->out_precision == ASYM8S_TYPE && p_cfg->bias_precision == 32) 
+        {
+            cnn_cfg->precision = XA_NNLIB_CNN_SYM8SxASYM8S;
+        }
     }
  
     return 0;
@@ -359,10 +390,15 @@ void show_usage(void)
     printf("\t-bias_shift: bias left shift; Default=7\n");
     printf("\t-acc_shift: accumulator left shift; Default=-7\n");
     printf("\t-out_data_format: Output data format, 0 (DWH), 1 (WHD); Default=0 (DWH)\n");
-    printf("\t-inp_precision: 8, 16, -1(single prec float); Default=16\n");
-    printf("\t-kernel_precision: 8, 16, -1(single prec float); Default=8\n");
-    printf("\t-out_precision: 8, 16, -1(single prec float); Default=16\n");
-    printf("\t-bias_precision: 8, 16, -1(single prec float); Default=16\n");
+    printf("\t-inp_precision: 8, 16, -1(single prec float), -4(Asymmetric 8-bit signed); Default=16\n");
+    printf("\t-kernel_precision: 8, 16, -1(single prec float), -5(Symmetric 8-bit signed); Default=8\n");
+    printf("\t-out_precision: 8, 16, -1(single prec float), -4(Asymmetric 8-bit signed); Default=16\n");
+    printf("\t-bias_precision: 8, 16, -1(single prec float), 32(for sym8sxasym8s); Default=16\n");
+    printf("\t-input_zero_bias: input zero bias for sym8sxasym8s, -127 to 128; Default=0\n");
+    printf("\t-out_multiplier: per-channel output multiplier in Q31 format for sym8sxasym8s, same for all channels, 0x0 to 0x7fffffff; Default=0x40000000\n");
+    printf("\t-out_shift: per-channel output shift for sym8sxasym8s, same for all channels, 31 to -31; Default=-8\n");
+    printf("\t-out_zero_bias: output zero bias for sym8sxasym8s, -128 to 127; Default=0\n");
+    printf("\t-ds_depth_out_zero_bias: zero bias of the depthwise output of conv2d_depth for sym8sxasym8s, -128 to 127; Default=0\n");
     printf("\t-frames: Positive number; Default=2\n");
     printf("\t-kernel_name: conv2d_std, conv2d_depth, conv1d_std; Default="" : conv2d_std\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
@@ -380,6 +416,7 @@ int xa_nn_main_process(int argc, char *argv[])
   int frame;
   int err = 0;
   int pass_count=0;
+  int config_check_fail = 0;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   xa_nnlib_handle_t cnn_handle;
@@ -441,6 +478,10 @@ int xa_nn_main_process(int argc, char *argv[])
     {
       input_channels_pad = (cfg.input_channels + 2 - 1) & ~(2 - 1);
     }
+    else if(cfg.inp_precision == ASYM8S_TYPE)
+    {
+      input_channels_pad = cfg.input_channels;
+    }
     else
     {
       input_channels_pad = (cfg.input_channels + 4 - 1) & ~(4 - 1);
@@ -448,6 +489,17 @@ int xa_nn_main_process(int argc, char *argv[])
     kernel_size_pad = cfg.kernel_height * cfg.kernel_width * input_channels_pad;
     out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
     bias_size = cfg.out_channels;
+    if(cfg.inp_precision == ASYM8S_TYPE)
+    {
+      cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      int itr_c;
+      for(itr_c = 0; itr_c < cfg.out_channels; itr_c++)
+      {
+        cfg.p_out_multiplier[itr_c] = cfg.out_multiplier;
+        cfg.p_out_shift[itr_c] = cfg.out_shift;
+      }
+    }
   }
   else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
@@ -462,6 +514,20 @@ int xa_nn_main_process(int argc, char *argv[])
     out_size          = cfg.out_channels        * cfg.out_height          * cfg.out_width;
     bias_size = cfg.channels_multiplier * cfg.input_channels;
     bias_point_size = cfg.out_channels;
+    if(cfg.inp_precision == ASYM8S_TYPE)
+    {
+      //Depthwise and pointwise stages share p_out_multiplier and p_out_shift,
+      //allocate them for the larger of the two channel counts
+      int temp_channels = (cfg.out_channels > kernel_channels) ? cfg.out_channels : kernel_channels;
+      cfg.p_out_multiplier = (int *)malloc(temp_channels*(sizeof(WORD32)));
+      cfg.p_out_shift = (int *)malloc(temp_channels*(sizeof(WORD32)));
+      int itr_c;
+      for(itr_c = 0; itr_c < temp_channels; itr_c++)
+      {
+        cfg.p_out_multiplier[itr_c] = cfg.out_multiplier;
+        cfg.p_out_shift[itr_c] = cfg.out_shift;
+      }
+    }
   }
   else if(!strcmp(cfg.kernel_name,"conv1d_std"))
   {
@@ -499,6 +565,11 @@ int xa_nn_main_process(int argc, char *argv[])
       return 0;
     }
   }
+  else if((cfg.kernel_precision == SYM8S_TYPE) || (cfg.inp_precision == ASYM8S_TYPE))
+  {
+    sprintf(profiler_params, "_sym8sxasym8s");
+    strcat(profiler_name, profiler_params);
+  }
   else
   {
     sprintf(profiler_params, "_%dx%d", cfg.kernel_precision, cfg.inp_precision);
@@ -607,11 +678,29 @@ int xa_nn_main_process(int argc, char *argv[])
       fprintf(stdout, "Input size:            %8d bytes\n", inp_size*4);
       fprintf(stdout, "Output size:           %8d bytes\n\n", out_size*4);
     }
+    else if(cfg.inp_precision == ASYM8S_TYPE)
+    {
+      fprintf(stdout, "Input size:            %8d bytes\n", inp_size);
+      fprintf(stdout, "Output size:           %8d bytes\n\n", out_size);
+    }
     else
     {
       fprintf(stdout, "Input size:            %8d bytes\n", inp_size*(cfg.inp_precision>>3));
       fprintf(stdout, "Output size:           %8d bytes\n\n", out_size*(cfg.out_precision>>3));
     }
+    /* Zero biases outside the int8 range must be rejected */
+    if(cnn_cfg.precision == XA_NNLIB_CNN_SYM8SxASYM8S)
+    {
+      xa_nnlib_cnn_init_config_t invalid_cfg = cnn_cfg;
+      invalid_cfg.out_zero_bias = 128;
+      err = xa_nnlib_cnn_init(cnn_handle, &invalid_cfg);
+      if(XA_NNLIB_CNN_CONFIG_FATAL_INVALID_ZERO_BIAS != err)
+      {
+        fprintf(stderr, "Out of range out_zero_bias not rejected, error code: 0x%x \n", err);
+        config_check_fail = 1;
+      }
+    }
+
     /* Initialize CNN Layer with configurations */
     err =xa_nnlib_cnn_init(cnn_handle, &cnn_cfg);
 
@@ -641,6 +730,16 @@ int xa_nn_main_process(int argc, char *argv[])
     }
     xa_nnlib_cnn_set_config(cnn_handle, XA_NNLIB_CNN_KERNEL, &kernel[0]); 
     xa_nnlib_cnn_set_config(cnn_handle, XA_NNLIB_CNN_BIAS, &bias[0]); 
+
+    if(cnn_cfg.precision == XA_NNLIB_CNN_SYM8SxASYM8S)
+    {
+      /* Depthwise and pointwise stages of conv2d_depth use the same per-channel values */
+      WORD32 *out_multiplier[2] = {cfg.p_out_multiplier, cfg.p_out_multiplier};
+      WORD32 *out_shift[2] = {cfg.p_out_shift, cfg.p_out_shift};
+
+      xa_nnlib_cnn_set_config(cnn_handle, XA_NNLIB_CNN_OUT_MULTIPLIER, &out_multiplier[0]); 
+      xa_nnlib_cnn_set_config(cnn_handle, XA_NNLIB_CNN_OUT_SHIFT, &out_shift[0]); 
+    }
   }  
 
   /* Execution Loop */
@@ -691,7 +790,7 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
-  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames));
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames) && !config_check_fail);
 
   fclose(fptr_inp);
   fclose(fptr_out);
@@ -714,6 +813,12 @@ int xa_nn_main_process(int argc, char *argv[])
     free_buf1D(p_ref);
   }
 
+  if(cfg.inp_precision == ASYM8S_TYPE)
+  {
+    free(cfg.p_out_multiplier);
+    free(cfg.p_out_shift);
+  }
+
   free(cnn_handle);
   if (p_scratch) free(p_scratch);
 
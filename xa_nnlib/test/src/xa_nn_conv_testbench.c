@@ -92,6 +92,39 @@ typedef struct _test_config_t
   int verify;
   int dilation_height;
   int dilation_width;
+  int groups;
+  int algo;
+  int sym4s;
+  int residual;
+  int sum_zero_bias;
+  int sum_left_shift;
+  int sum_multiplier;
+  int sum_activation_min;
+  int sum_activation_max;
+  int out_inp_zero_bias;
+  int out_inp_left_shift;
+  int out_inp_multiplier;
+  int res_zero_bias;
+  int res_left_shift;
+  int res_multiplier;
+  int left_shift;
+  int expanded_channels;
+  int band_height;
+  int expand_out_multiplier;
+  int expand_out_shift;
+  int *p_expand_out_multiplier;
+  int *p_expand_out_shift;
+  int expand_out_zero_bias;
+  int expand_activation_min;
+  int expand_activation_max;
+  int dw_out_multiplier;
+  int dw_out_shift;
+  int *p_dw_out_multiplier;
+  int *p_dw_out_shift;
+  int dw_out_zero_bias;
+  int dw_activation_min;
+  int dw_activation_max;
+  int plan;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -138,6 +171,39 @@ int default_config(test_config_t *p_cfg)
     p_cfg->verify = 1;
     p_cfg->dilation_height = 1;
     p_cfg->dilation_width = 1;
+    p_cfg->groups = 1;
+    p_cfg->algo = XA_NN_CONV2D_ALGO_AUTO;
+    p_cfg->sym4s = 0;
+    p_cfg->residual = 0;
+    p_cfg->sum_zero_bias = 0;
+    p_cfg->sum_left_shift = 0;
+    p_cfg->sum_multiplier = 0x7fffffff;
+    p_cfg->sum_activation_min = -128;
+    p_cfg->sum_activation_max = 127;
+    p_cfg->out_inp_zero_bias = 0;
+    p_cfg->out_inp_left_shift = 0;
+    p_cfg->out_inp_multiplier = 0x7fffffff;
+    p_cfg->res_zero_bias = 0;
+    p_cfg->res_left_shift = 0;
+    p_cfg->res_multiplier = 0x7fffffff;
+    p_cfg->left_shift = 0;
+    p_cfg->expanded_channels = 24;
+    p_cfg->band_height = 2;
+    p_cfg->expand_out_multiplier = 0x40000000;
+    p_cfg->expand_out_shift = -8;
+    p_cfg->p_expand_out_multiplier = NULL;
+    p_cfg->p_expand_out_shift = NULL;
+    p_cfg->expand_out_zero_bias = 0;
+    p_cfg->expand_activation_min = -128;
+    p_cfg->expand_activation_max = 127;
+    p_cfg->dw_out_multiplier = 0x40000000;
+    p_cfg->dw_out_shift = -8;
+    p_cfg->p_dw_out_multiplier = NULL;
+    p_cfg->p_dw_out_shift = NULL;
+    p_cfg->dw_out_zero_bias = 0;
+    p_cfg->dw_activation_min = -128;
+    p_cfg->dw_activation_max = 127;
+    p_cfg->plan = 0;
 
     return 0;
   }
@@ -198,6 +264,35 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-dilation_height",p_cfg->dilation_height);
     ARGTYPE_ONETIME_CONFIG("-dilation_width",p_cfg->dilation_width);
+    ARGTYPE_ONETIME_CONFIG("-groups",p_cfg->groups);
+    ARGTYPE_ONETIME_CONFIG("-algo",p_cfg->algo);
+    ARGTYPE_ONETIME_CONFIG("-sym4s",p_cfg->sym4s);
+    ARGTYPE_ONETIME_CONFIG("-residual",p_cfg->residual);
+    ARGTYPE_ONETIME_CONFIG("-sum_zero_bias",p_cfg->sum_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-sum_left_shift",p_cfg->sum_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-sum_multiplier",p_cfg->sum_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-sum_activation_min",p_cfg->sum_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-sum_activation_max",p_cfg->sum_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-out_inp_zero_bias",p_cfg->out_inp_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-out_inp_left_shift",p_cfg->out_inp_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-out_inp_multiplier",p_cfg->out_inp_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-res_zero_bias",p_cfg->res_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-res_left_shift",p_cfg->res_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-res_multiplier",p_cfg->res_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-left_shift",p_cfg->left_shift);
+    ARGTYPE_ONETIME_CONFIG("-expanded_channels",p_cfg->expanded_channels);
+    ARGTYPE_ONETIME_CONFIG("-band_height",p_cfg->band_height);
+    ARGTYPE_ONETIME_CONFIG("-expand_out_multiplier",p_cfg->expand_out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-expand_out_shift",p_cfg->expand_out_shift);
+    ARGTYPE_ONETIME_CONFIG("-expand_out_zero_bias",p_cfg->expand_out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-expand_activation_min",p_cfg->expand_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-expand_activation_max",p_cfg->expand_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-dw_out_multiplier",p_cfg->dw_out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-dw_out_shift",p_cfg->dw_out_shift);
+    ARGTYPE_ONETIME_CONFIG("-dw_out_zero_bias",p_cfg->dw_out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-dw_activation_min",p_cfg->dw_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-dw_activation_max",p_cfg->dw_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-plan",p_cfg->plan);
 
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -221,6 +316,35 @@ void show_usage(void)
     printf("\t-y_padding: top padding in height dimension; Default=2\n");
     printf("\t-dilation_height: dilation in height dimension; Default=1\n");
     printf("\t-dilation_width: dilation in width dimension; Default=1\n");
+    printf("\t-groups: number of groups for conv2d_grouped and conv2d, divides input_channels and out_channels; Default=1\n");
+    printf("\t-algo: XA_NN_CONV2D_ALGO_* variant for conv2d, 0: auto, 1: std, 2: direct, 3: pointwise, 4: patchify, 5: depthwise, 6: grouped; Default=0\n");
+    printf("\t-sym4s: Flag for int4 kernel of conv2d_pointwise, values in [-8, 7] packed before the call; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-residual: Flag for conv2d_pointwise with residual add fused, residual read after bias (NHWC output only); 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-out_inp_zero_bias: zero bias of the conv output in the residual add; Default=0\n");
+    printf("\t-out_inp_left_shift: shift of the conv output in the residual add; Default=0\n");
+    printf("\t-out_inp_multiplier: multiplier of the conv output in the residual add; Default=0x7fffffff\n");
+    printf("\t-res_zero_bias: zero bias of the residual; Default=0\n");
+    printf("\t-res_left_shift: shift of the residual; Default=0\n");
+    printf("\t-res_multiplier: multiplier of the residual; Default=0x7fffffff\n");
+    printf("\t-sum_zero_bias: output zero bias of the residual add; Default=0\n");
+    printf("\t-sum_left_shift: output shift of the residual add; Default=0\n");
+    printf("\t-sum_multiplier: output multiplier of the residual add; Default=0x7fffffff\n");
+    printf("\t-sum_activation_min: output activation min of the residual add; Default=-128\n");
+    printf("\t-sum_activation_max: output activation max of the residual add; Default=127\n");
+    printf("\t-left_shift: residual add input left shift; Default=0\n");
+    printf("\t-expanded_channels: channels after the expand stage of inverted_residual; Default=24\n");
+    printf("\t-band_height: output rows computed per band by inverted_residual; Default=2\n");
+    printf("\t-expand_out_multiplier: expand stage output multiplier of inverted_residual; Default=0x40000000\n");
+    printf("\t-expand_out_shift: expand stage output shift of inverted_residual; Default=-8\n");
+    printf("\t-expand_out_zero_bias: expand stage output zero bias of inverted_residual; Default=0\n");
+    printf("\t-expand_activation_min: expand stage activation min of inverted_residual; Default=-128\n");
+    printf("\t-expand_activation_max: expand stage activation max of inverted_residual; Default=127\n");
+    printf("\t-dw_out_multiplier: depthwise stage output multiplier of inverted_residual; Default=0x40000000\n");
+    printf("\t-dw_out_shift: depthwise stage output shift of inverted_residual; Default=-8\n");
+    printf("\t-dw_out_zero_bias: depthwise stage output zero bias of inverted_residual; Default=0\n");
+    printf("\t-dw_activation_min: depthwise stage activation min of inverted_residual; Default=-128\n");
+    printf("\t-dw_activation_max: depthwise stage activation max of inverted_residual; Default=127\n");
+    printf("\t-plan: Flag to run conv2d_std or the depthwise part of conv2d_depth (sym8sxasym8s) through plan_create and plan_execute; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-out_height: output height; Default=16\n");
     printf("\t-out_width: output width; Default=16\n");
     printf("\t-bias_shift: bias left shift; Default=7\n");
@@ -228,7 +352,7 @@ void show_usage(void)
     printf("\t-inp_data_format: Input data format, 0 (DWH), 1 (WHD); Default=1 (WHD), ignored for conv2d_std and conv1d_std kernels \n");
     printf("\t-out_data_format: Output data format, 0 (DWH), 1 (WHD); Default=0 (DWH)\n");
     printf("\t-inp_precision: 8, 16, -1(single prec float), -3(Asymmetric 8-bit unsigned), -4(Asymmetric 8-bit signed); Default=16\n");
-    printf("\t-kernel_precision: 8, 16, -1(single prec float), -3(Asymmetric 8-bit), -5(Symmetric 8-bit signed); Default=8\n");
+    printf("\t-kernel_precision: 8, 16, -1(single prec float), -2(half prec float, conv2d_std with single prec float input), -3(Asymmetric 8-bit), -5(Symmetric 8-bit signed); Default=8\n");
     printf("\t-out_precision: 8, 16, -1(single prec float), -3(Asymmetric 8-bit), -4(Asymmetric 8-bit signed); Default=16\n");
     printf("\t-bias_precision: 8, 16, 32, -1(single prec float); Default=16\n");
     printf("\t-input_zero_bias: input zero zero bias for quantized 8-bit, -255 to 0 (for Asymmetric 8-bit unsigned), -127 to 128 (for Asymmetric 8-bit signed); Default=-128\n");
@@ -237,11 +361,11 @@ void show_usage(void)
     printf("\t-out_shift: output shift for asym8, 31 to -31; Default=-8\n");
     printf("\t-out_zero_bias: output zero bias for asym8, 0 to 255; Default=128\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: conv2d_std, dilated_conv2d_std, conv2d_depth, conv1d_std; Default="" : conv2d_std\n");
+    printf("\t-kernel_name: conv2d_std, dilated_conv2d_std, conv2d_depth, conv2d_grouped, conv2d, conv2d_pointwise, inverted_residual, conv1d_std, conv1d_causal; Default="" : conv2d_std\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
-    printf("\t-read_inp_file_name: Full filename for reading inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
+    printf("\t-read_inp_file_name: Full filename for reading inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable); input, expand kernel, expand bias, depthwise kernel, depthwise bias, project kernel, project bias for inverted_residual) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
-    printf("\t-write_inp_file_name: Full filename for writing inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
+    printf("\t-write_inp_file_name: Full filename for writing inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable); input, expand kernel, expand bias, depthwise kernel, depthwise bias, project kernel, project bias for inverted_residual) \n");
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
 }
@@ -270,7 +394,7 @@ void show_usage(void)
   }
 
 #define CONV_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
-  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && !cfg.plan) {\
     XTPWR_PROFILER_START(0);\
     err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s ( \
         (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
@@ -281,6 +405,23 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define CONV_PLAN_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && cfg.plan) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s_plan_create ( \
+        p_plan, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format);\
+    err = (err < 0 || err > scratch_size) ? -1 : 0;\
+    if(!err) { \
+        err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s_plan_execute ( \
+            p_plan, (WORD8 *)p_out->p, (WORD8 *) p_inp->p, p_scratch);\
+    } \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define CONV_DILATIONAL_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -293,6 +434,74 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define CONV_GROUPED_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.groups, cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_DISPATCH_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.groups, cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, cfg.algo, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_POINTWISE_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && !cfg.sym4s && !cfg.residual) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_kernel->p, (WORD8 *) p_inp->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_POINTWISE_RESIDUAL_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && !cfg.sym4s && cfg.residual) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_residual_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_kernel->p, (WORD8 *) p_inp->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, (WORD8 *) p_residual->p, \
+        cfg.sum_zero_bias, cfg.sum_left_shift, cfg.sum_multiplier, cfg.sum_activation_min, cfg.sum_activation_max, \
+        cfg.out_inp_zero_bias, cfg.out_inp_left_shift, cfg.out_inp_multiplier, \
+        cfg.res_zero_bias, cfg.res_left_shift, cfg.res_multiplier, cfg.left_shift);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_POINTWISE_KERNEL_SYM4S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && cfg.sym4s) {\
+    WORD8 *p_packed = NULL;\
+    WORD32 packed_size = xa_nn_matXvec_sym4s_pack_getsize_sym8s(cfg.out_channels, cfg.input_channels);\
+    if(packed_size > 0) p_packed = (WORD8 *)malloc(packed_size);\
+    err = (NULL == p_packed) || (packed_size != xa_nn_matXvec_sym4s_pack_sym8s( \
+        p_packed, (WORD8 *) p_kernel->p, cfg.out_channels, cfg.input_channels, p_kernel->row_offset));\
+    if(!err) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_per_chan_sym4sxasym8s ( \
+          (WORD8 *)p_out->p, p_packed, (WORD8 *) p_inp->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    free(p_packed);\
+  }
+
 #define CONV1D_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -327,6 +536,26 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define CONV1D_CAUSAL_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_##KPREC##x##IPREC ( \
+        (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_channels, cfg.kernel_width, cfg.dilation_width, cfg.out_channels, \
+        cfg.bias_shift, cfg.acc_shift, p_state, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV1D_CAUSAL_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_channels, cfg.kernel_width, cfg.dilation_width, cfg.out_channels, \
+        p_state, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define CONV_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -338,6 +567,28 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define CONV_GROUPED_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.groups, cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_KERNEL_F16_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f16xf32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (WORD16 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define CONV_DS_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -413,12 +664,27 @@ void show_usage(void)
 #define CONV_DS_KERNEL_SYM8_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
-    err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s ( \
-        (WORD8 *) p_dw_out->p, (const WORD8 *) p_kernel->p, (const WORD8 *) p_inp->p, (const WORD32 *)p_bias->p, \
-        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.channels_multiplier, \
-        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
-        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
-        cfg.inp_data_format, 0 /* out_data_format always DWH*/, p_scratch);\
+    if(cfg.plan) { \
+      err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_create ( \
+          p_plan, (const WORD8 *) p_kernel->p, (const WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.channels_multiplier, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.inp_data_format, 0 /* out_data_format always DWH*/);\
+      err = (err < 0 || err > scratch_size) ? -1 : 0;\
+      if(!err) { \
+        err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_execute ( \
+            p_plan, (WORD8 *) p_dw_out->p, (const WORD8 *) p_inp->p, p_scratch);\
+      } \
+    } \
+    else { \
+      err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_dw_out->p, (const WORD8 *) p_kernel->p, (const WORD8 *) p_inp->p, (const WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.channels_multiplier, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.inp_data_format, 0 /* out_data_format always DWH*/, p_scratch);\
+    } \
     XTPWR_PROFILER_STOP(0);\
     XTPWR_PROFILER_UPDATE(0); \
     XTPWR_PROFILER_PRINT(0); \
@@ -435,6 +701,22 @@ void show_usage(void)
     } \
   }
 
+#define CONV_INVERTED_RESIDUAL_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.expanded_channels, cfg.out_channels, cfg.input_zero_bias, \
+        (WORD8 *) p_kernel_expand->p, (WORD32 *) p_bias_expand->p, cfg.p_expand_out_multiplier, cfg.p_expand_out_shift, \
+        cfg.expand_out_zero_bias, cfg.expand_activation_min, cfg.expand_activation_max, \
+        (WORD8 *) p_kernel->p, (WORD32 *) p_bias->p, cfg.kernel_height, cfg.kernel_width, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.p_dw_out_multiplier, cfg.p_dw_out_shift, cfg.dw_out_zero_bias, cfg.dw_activation_min, cfg.dw_activation_max, \
+        (WORD8 *) p_kernel_point->p, (WORD32 *) p_bias_point->p, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.band_height, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 
 #if HIFI_VFPU
 #define PROCESS_CONV \
@@ -443,19 +725,31 @@ void show_usage(void)
     else if CONV_KERNEL_FN(conv2d_std, 16, 16, 16, 16) \
     else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
     else if CONV_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
+    else if CONV_PLAN_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
     else if CONV_DILATIONAL_KERNEL_SYM8S_PC_FN(dilated_conv2d_std,-5,-4,-4, 32) \
     else if CONV_KERNEL_F_FN(conv2d_std, -1, -1, -1, -1) \
+    else if CONV_KERNEL_F16_FN(conv2d_std, -2, -1, -1, -1) \
     else if CONV_DS_KERNEL_F_FN(conv2d_depth, -1, -1, -1, -1) \
+    else if CONV_GROUPED_KERNEL_F_FN(conv2d_grouped, -1, -1, -1, -1) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
     else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
     else if CONV_DS_KERNEL_SYM8_PC_FN(conv2d_depth,-5,-4,-4,32) \
+    else if CONV_GROUPED_KERNEL_SYM8S_PC_FN(conv2d_grouped,-5,-4,-4,32) \
+    else if CONV_DISPATCH_KERNEL_SYM8S_PC_FN(conv2d,-5,-4,-4,32) \
+    else if CONV_POINTWISE_KERNEL_SYM8S_PC_FN(conv2d_pointwise,-5,-4,-4,32) \
+    else if CONV_POINTWISE_RESIDUAL_KERNEL_SYM8S_PC_FN(conv2d_pointwise,-5,-4,-4,32) \
+    else if CONV_POINTWISE_KERNEL_SYM4S_PC_FN(conv2d_pointwise,-5,-4,-4,32) \
+    else if CONV_INVERTED_RESIDUAL_KERNEL_SYM8S_PC_FN(inverted_residual,-5,-4,-4,32) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 8, 8, 8) \
     else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
     else if CONV1D_KERNEL_F_FN(conv1d_std, -1, -1, -1, -1) \
+    else if CONV1D_CAUSAL_KERNEL_FN(conv1d_causal, 8, 8, 8, 8) \
+    else if CONV1D_CAUSAL_KERNEL_FN(conv1d_causal, 16, 16, 16, 16) \
+    else if CONV1D_CAUSAL_KERNEL_F_FN(conv1d_causal, -1, -1, -1, -1) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
 #else
 #define PROCESS_CONV \
@@ -464,15 +758,24 @@ void show_usage(void)
     else if CONV_KERNEL_FN(conv2d_std, 16, 16, 16, 16) \
     else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
     else if CONV_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
+    else if CONV_PLAN_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
     else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
     else if CONV_DS_KERNEL_SYM8_PC_FN(conv2d_depth,-5,-4,-4,32) \
+    else if CONV_GROUPED_KERNEL_SYM8S_PC_FN(conv2d_grouped,-5,-4,-4,32) \
+    else if CONV_DISPATCH_KERNEL_SYM8S_PC_FN(conv2d,-5,-4,-4,32) \
+    else if CONV_POINTWISE_KERNEL_SYM8S_PC_FN(conv2d_pointwise,-5,-4,-4,32) \
+    else if CONV_POINTWISE_RESIDUAL_KERNEL_SYM8S_PC_FN(conv2d_pointwise,-5,-4,-4,32) \
+    else if CONV_POINTWISE_KERNEL_SYM4S_PC_FN(conv2d_pointwise,-5,-4,-4,32) \
+    else if CONV_INVERTED_RESIDUAL_KERNEL_SYM8S_PC_FN(inverted_residual,-5,-4,-4,32) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 8, 8, 8) \
     else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
+    else if CONV1D_CAUSAL_KERNEL_FN(conv1d_causal, 8, 8, 8, 8) \
+    else if CONV1D_CAUSAL_KERNEL_FN(conv1d_causal, 16, 16, 16, 16) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
 #endif
 
@@ -486,8 +789,11 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name_1[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_scratch;
+  void *p_state = NULL;
+  void *p_plan = NULL;
   int inp_size=0, kernel_size, out_size;
   int kernel_size_pad, input_channels_pad;
+  int group_channels, group_channels_pad;
   int kernel_channels;
   int input_channelsXwidth_pad;
   int kernel_point_size, dw_out_size;
@@ -503,6 +809,9 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_dw_out;
   buf1D_t *p_out;
   buf1D_t *p_ref;
+  buf1D_t *p_residual = NULL;
+  buf1D_t *p_kernel_expand;
+  buf1D_t *p_bias_expand;
 
   FILE *fptr_inp;
   FILE *fptr_out;
@@ -582,6 +891,90 @@ int xa_nn_main_process(int argc, char *argv[])
       }
     }
   }
+  else if( (!strcmp(cfg.kernel_name,"conv2d_grouped")) || (!strcmp(cfg.kernel_name,"conv2d")) )
+  {
+    /* Kernel is out_channels x kernel_height x kernel_width x (input_channels / groups) */
+    group_channels = cfg.input_channels / cfg.groups;
+    if(cfg.inp_precision == -1)
+    {
+      group_channels_pad = (group_channels + 2 - 1) & ~(2 - 1);
+    }
+    else
+    {
+      group_channels_pad = group_channels;
+    }
+    inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
+    kernel_size = cfg.kernel_height * cfg.kernel_width * group_channels;
+    kernel_size_pad = cfg.kernel_height * cfg.kernel_width * group_channels_pad;
+    bias_size = cfg.out_channels;
+    out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
+    if(cfg.inp_precision == -4)
+    {
+      cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      int itr_c;
+      for(itr_c = 0; itr_c < cfg.out_channels; itr_c++)
+      {
+        cfg.p_out_multiplier[itr_c] = cfg.out_multiplier;
+        cfg.p_out_shift[itr_c] = cfg.out_shift;
+      }
+    }
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d_pointwise"))
+  {
+    /* Kernel is out_channels x input_channels, output plane is the input plane */
+    inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
+    kernel_size = cfg.input_channels;
+    kernel_size_pad = cfg.input_channels;
+    bias_size = cfg.out_channels;
+    out_size = cfg.input_height * cfg.input_width * cfg.out_channels;
+    if(cfg.inp_precision == -4)
+    {
+      cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      int itr_c;
+      for(itr_c = 0; itr_c < cfg.out_channels; itr_c++)
+      {
+        cfg.p_out_multiplier[itr_c] = cfg.out_multiplier;
+        cfg.p_out_shift[itr_c] = cfg.out_shift;
+      }
+    }
+  }
+  else if(!strcmp(cfg.kernel_name,"inverted_residual"))
+  {
+    /* Expand kernel is expanded_channels x input_channels, depthwise kernel is
+       kernel_height x kernel_width x expanded_channels, project kernel is
+       out_channels x expanded_channels */
+    inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
+    kernel_size = cfg.kernel_height * cfg.kernel_width;
+    kernel_size_pad = cfg.expanded_channels;
+    bias_size = cfg.expanded_channels;
+    bias_point_size = cfg.out_channels;
+    kernel_point_size = cfg.out_channels * cfg.expanded_channels;
+    out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
+    if(cfg.inp_precision == -4)
+    {
+      cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      cfg.p_expand_out_multiplier = (int *)malloc(cfg.expanded_channels*(sizeof(WORD32)));
+      cfg.p_expand_out_shift = (int *)malloc(cfg.expanded_channels*(sizeof(WORD32)));
+      cfg.p_dw_out_multiplier = (int *)malloc(cfg.expanded_channels*(sizeof(WORD32)));
+      cfg.p_dw_out_shift = (int *)malloc(cfg.expanded_channels*(sizeof(WORD32)));
+      int itr_c;
+      for(itr_c = 0; itr_c < cfg.out_channels; itr_c++)
+      {
+        cfg.p_out_multiplier[itr_c] = cfg.out_multiplier;
+        cfg.p_out_shift[itr_c] = cfg.out_shift;
+      }
+      for(itr_c = 0; itr_c < cfg.expanded_channels; itr_c++)
+      {
+        cfg.p_expand_out_multiplier[itr_c] = cfg.expand_out_multiplier;
+        cfg.p_expand_out_shift[itr_c] = cfg.expand_out_shift;
+        cfg.p_dw_out_multiplier[itr_c] = cfg.dw_out_multiplier;
+        cfg.p_dw_out_shift[itr_c] = cfg.dw_out_shift;
+      }
+    }
+  }
   else if(!strcmp(cfg.kernel_name,"conv1d_std"))
   {
     inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
@@ -598,6 +991,16 @@ int xa_nn_main_process(int argc, char *argv[])
     bias_size = cfg.out_channels;
     out_size = cfg.out_height * cfg.out_channels;
   }
+  else if(!strcmp(cfg.kernel_name,"conv1d_causal"))
+  {
+    /* input_height is the number of frames per call, the state carries the
+       history from one -frames iteration to the next */
+    inp_size = cfg.input_height * cfg.input_channels;
+    kernel_size = cfg.kernel_width * cfg.input_channels;
+    kernel_size_pad = kernel_size;
+    bias_size = cfg.out_channels;
+    out_size = cfg.input_height * cfg.out_channels;
+  }
 
   // Set profiler name 
   if(cfg.kernel_name[0])
@@ -607,8 +1010,27 @@ int xa_nn_main_process(int argc, char *argv[])
     {
       strcpy(profiler_name_1,"conv2d_point");
     }
+    if(!strcmp(cfg.kernel_name,"conv2d_pointwise") && cfg.residual)
+    {
+      strcat(profiler_name_0,"_residual");
+    }
+    if(cfg.plan)
+    {
+      strcat(profiler_name_0,"_plan");
+    }
   }
-  if((cfg.kernel_precision == -1) || (cfg.inp_precision == -1))
+  if(cfg.kernel_precision == -2)
+  {
+    sprintf(profiler_params, "_f16xf32");
+    strcat(profiler_name_0, profiler_params);
+    // If VFPU is not supported, return
+    if(!HIFI_VFPU)
+    {
+      printf("%s: NOT TESTED\n", profiler_name_0);
+      return 0;
+    }
+  }
+  else if((cfg.kernel_precision == -1) || (cfg.inp_precision == -1))
   {
     sprintf(profiler_params, "_f32xf32");
     strcat(profiler_name_0, profiler_params);
@@ -635,7 +1057,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   else if((cfg.kernel_precision == -5) || (cfg.inp_precision == -4))
   {
-    sprintf(profiler_params, "_sym8sxasym8s");
+    sprintf(profiler_params, (cfg.sym4s) ? "_sym4sxasym8s" : "_sym8sxasym8s");
     strcat(profiler_name_0, profiler_params);
     if(!strcmp(cfg.kernel_name,"conv2d_depth"))
     {
@@ -659,6 +1081,33 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, out_channels=%d, out_height=%d", 
       cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, cfg.out_height);
   }
+  else if(!strcmp(cfg.kernel_name,"conv2d_grouped"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, groups=%d, out_height=%d, out_width=%d", 
+      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.groups, cfg.out_height, cfg.out_width);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, groups=%d, out_height=%d, out_width=%d, algo=%d", 
+      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.groups, cfg.out_height, cfg.out_width,
+      cfg.algo == XA_NN_CONV2D_ALGO_AUTO ? xa_nn_conv2d_per_chan_sym8sxasym8s_select(cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width,
+        cfg.out_channels, cfg.groups, cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, cfg.out_data_format) : cfg.algo);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d_pointwise"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, out_channels=%d", 
+      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels);
+  }
+  else if(!strcmp(cfg.kernel_name,"inverted_residual"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, expanded_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, out_height=%d, out_width=%d, band_height=%d", 
+      cfg.input_height, cfg.input_width, cfg.input_channels, cfg.expanded_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.out_height, cfg.out_width, cfg.band_height);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv1d_causal"))
+  {
+    sprintf(profiler_params, "input_height=%d, input_channels=%d, kernel_width=%d, dilation_width=%d, out_channels=%d", 
+      cfg.input_height, cfg.input_channels, cfg.kernel_width, cfg.dilation_width, cfg.out_channels);
+  }
   else
   {
     sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, out_height=%d, out_width=%d", 
@@ -710,6 +1159,47 @@ int xa_nn_main_process(int argc, char *argv[])
 
     XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
   }
+  else if( (!strcmp(cfg.kernel_name,"conv2d_grouped")) || (!strcmp(cfg.kernel_name,"conv2d")) )
+  {
+    p_kernel = create_buf2D(cfg.out_channels * cfg.kernel_height * cfg.kernel_width, group_channels, group_channels_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
+    p_bias = create_buf1D(bias_size, cfg.bias_precision);                            VALIDATE_PTR(p_bias);
+
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d_pointwise"))
+  {
+    p_kernel = create_buf2D(cfg.out_channels, cfg.input_channels, cfg.input_channels, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
+    p_bias = create_buf1D(bias_size, cfg.bias_precision);                            VALIDATE_PTR(p_bias);
+    if(cfg.residual)
+    {
+      p_residual = create_buf1D(out_size, cfg.out_precision);                        VALIDATE_PTR(p_residual);
+    }
+
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
+  }
+  else if(!strcmp(cfg.kernel_name,"inverted_residual"))
+  {
+    p_kernel_expand = create_buf1D(cfg.expanded_channels * cfg.input_channels, cfg.kernel_precision);    VALIDATE_PTR(p_kernel_expand);
+    p_bias_expand = create_buf1D(cfg.expanded_channels, cfg.bias_precision);                              VALIDATE_PTR(p_bias_expand);
+    p_kernel = create_buf2D(cfg.kernel_height * cfg.kernel_width, cfg.expanded_channels, cfg.expanded_channels, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
+    p_bias = create_buf1D(bias_size, cfg.bias_precision);                      VALIDATE_PTR(p_bias);
+    p_kernel_point = create_buf1D(kernel_point_size, cfg.kernel_precision);    VALIDATE_PTR(p_kernel_point);
+    p_bias_point = create_buf1D(bias_point_size, cfg.bias_precision);          VALIDATE_PTR(p_bias_point);
+
+    int total_inverted_residual_MACS = (
+       (cfg.expanded_channels * cfg.input_channels * cfg.input_height * cfg.input_width)                     /* MACs in expand */
+       + (cfg.expanded_channels * cfg.out_height * cfg.out_width * cfg.kernel_height * cfg.kernel_width)     /* MACs in depthwise */
+       + (cfg.out_channels * cfg.expanded_channels * cfg.out_height * cfg.out_width)                        /* MACs in project */
+       );
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, total_inverted_residual_MACS, "MACs/cyc", 1);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv1d_causal"))
+  {
+    p_kernel = create_buf2D(cfg.out_channels * cfg.kernel_width, cfg.input_channels, cfg.input_channels, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
+    p_bias = create_buf1D(bias_size, cfg.bias_precision);                            VALIDATE_PTR(p_bias);
+
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
+  }
   else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
     if(cfg.inp_data_format == 0)
@@ -742,7 +1232,7 @@ int xa_nn_main_process(int argc, char *argv[])
   if(!strcmp(cfg.kernel_name,"conv2d_std"))
   {
     scratch_size = xa_nn_conv2d_std_getsize(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.y_stride,cfg.y_padding,
-        cfg.out_height, cfg.out_channels, cfg.inp_precision); PRINT_VAR(scratch_size)
+        cfg.out_height, cfg.out_channels, (cfg.kernel_precision == -2) ? PREC_F16 : cfg.inp_precision); PRINT_VAR(scratch_size)
   }
   else if(!strcmp(cfg.kernel_name,"dilated_conv2d_std"))
   {
@@ -769,13 +1259,52 @@ int xa_nn_main_process(int argc, char *argv[])
       );
     PRINT_VAR(scratch_size)
   }
+  else if(!strcmp(cfg.kernel_name,"conv2d_grouped"))
+  {
+    scratch_size = xa_nn_conv2d_grouped_getsize(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.y_stride,cfg.y_padding,
+        cfg.out_height, cfg.groups, cfg.inp_precision); PRINT_VAR(scratch_size)
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d"))
+  {
+    scratch_size = xa_nn_conv2d_per_chan_sym8sxasym8s_getsize(cfg.input_height,cfg.input_width,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,
+        cfg.out_channels,cfg.groups,cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,cfg.out_height,cfg.out_width,cfg.out_data_format,cfg.algo); PRINT_VAR(scratch_size)
+  }
+  else if(!strcmp(cfg.kernel_name,"inverted_residual"))
+  {
+    scratch_size = xa_nn_inverted_residual_per_chan_sym8sxasym8s_getsize(cfg.input_width,cfg.input_channels,cfg.expanded_channels,cfg.kernel_height,cfg.kernel_width,
+        cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,cfg.out_width,cfg.band_height); PRINT_VAR(scratch_size)
+  }
   else if(!strcmp(cfg.kernel_name,"conv1d_std"))
   {
     scratch_size = xa_nn_conv1d_std_getsize(cfg.kernel_height,cfg.input_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(scratch_size)
   }
+  else if(!strcmp(cfg.kernel_name,"conv1d_causal"))
+  {
+    WORD32 state_size;
+    scratch_size = xa_nn_conv1d_causal_getsize(cfg.kernel_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(scratch_size)
+    state_size = xa_nn_conv1d_causal_state_getsize(cfg.kernel_width,cfg.dilation_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(state_size)
+    p_state = malloc(state_size); VALIDATE_PTR(p_state);
+    /* Initialised once: all -frames iterations are one continuous stream */
+    xa_nn_conv1d_causal_state_init(p_state,cfg.kernel_width,cfg.dilation_width,cfg.input_channels,cfg.inp_precision);
+  }
 
   p_scratch = (xa_nnlib_handle_t)malloc(scratch_size); PRINT_PTR(p_scratch)
 
+  if(cfg.plan)
+  {
+    WORD32 plan_size = 0;
+    if(!strcmp(cfg.kernel_name,"conv2d_std"))
+    {
+      plan_size = xa_nn_conv2d_std_per_chan_sym8sxasym8s_plan_getsize(); PRINT_VAR(plan_size)
+    }
+    else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
+    {
+      plan_size = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_plan_getsize(cfg.input_channels,cfg.kernel_height,cfg.kernel_width,
+          cfg.channels_multiplier,cfg.inp_data_format); PRINT_VAR(plan_size)
+    }
+    p_plan = malloc(plan_size); VALIDATE_PTR(p_plan);
+  }
+
   fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
 
   // Frame processing loop
@@ -786,8 +1315,20 @@ int xa_nn_main_process(int argc, char *argv[])
       load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, input_channels_pad, -cfg.kernel_zero_bias);
     else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
       load_conv2d_ds_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, p_kernel_point, p_bias_point, -cfg.kernel_zero_bias);
+    else if( (!strcmp(cfg.kernel_name,"conv2d_grouped")) || (!strcmp(cfg.kernel_name,"conv2d")) )
+      load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, group_channels, group_channels_pad, -cfg.kernel_zero_bias);
+    else if(!strcmp(cfg.kernel_name,"conv2d_pointwise"))
+    {
+      load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, cfg.input_channels, -cfg.kernel_zero_bias);
+      if(cfg.residual)
+        load_activation_input_data(cfg.write_file, fptr_inp, p_residual);
+    }
+    else if(!strcmp(cfg.kernel_name,"inverted_residual"))
+      load_inverted_residual_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel_expand, p_bias_expand, p_kernel, p_bias, p_kernel_point, p_bias_point, -cfg.kernel_zero_bias);
     else if(!strcmp(cfg.kernel_name,"conv1d_std"))
       load_conv1d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, cfg.input_width, input_channelsXwidth_pad, -cfg.kernel_zero_bias);
+    else if(!strcmp(cfg.kernel_name,"conv1d_causal"))
+      load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, cfg.input_channels, -cfg.kernel_zero_bias);
 
     // Call the cnn kernel_name specified on command line
     PROCESS_CONV;
@@ -841,6 +1382,21 @@ int xa_nn_main_process(int argc, char *argv[])
     free_buf1D(p_bias_point);
     free_buf1D(p_dw_out);
   }
+  if(p_residual)
+  {
+    free_buf1D(p_residual);
+  }
+  if(!strcmp(cfg.kernel_name,"inverted_residual"))
+  {
+    free_buf1D(p_kernel_expand);
+    free_buf1D(p_bias_expand);
+    free_buf1D(p_kernel_point);
+    free_buf1D(p_bias_point);
+    free(cfg.p_expand_out_multiplier);
+    free(cfg.p_expand_out_shift);
+    free(cfg.p_dw_out_multiplier);
+    free(cfg.p_dw_out_shift);
+  }
   if(cfg.inp_precision == -4)
   {
     free(cfg.p_out_multiplier);
@@ -854,6 +1410,14 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   free(p_scratch);
+  if(p_state)
+  {
+    free(p_state);
+  }
+  if(p_plan)
+  {
+    free(p_plan);
+  }
 
   return 0;
 }
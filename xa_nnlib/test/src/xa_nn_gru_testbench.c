@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #include "xa_type_def.h"
 #include "xa_nnlib_gru_api.h"
+#include "xa_nnlib_rnn_seq_api.h"
 #include "cmdline_parser.h"
 #include "xt_profiler.h"
 #ifdef hifi4
@@ -119,6 +120,9 @@ void show_usage(void)
   printf("--membank_padding:\t Memory bank padding (Default=1)           \t  Must be 0 or 1\n");
   printf("--mat_prec:    \t Coefficient precision (Default=16)                        \t  Must be 8 or 16\n");
   printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 16\n");
+  printf("--sequence:    \t Process all frames in one call (Default=0)   \t  Supported values: 0:-Per frame  1:-Forward  2:-Backward\n");
+  printf("--rnn_seq_layers:\t Stacked GRU layers through rnn_seq, 0 disables (Default=0)\t  Range: 0-8\n");
+  printf("--bidirectional:\t Forward and backward cell per rnn_seq layer (Default=0)\t  Must be 0 or 1\n");
   printf("--verify:      \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
   printf("--input_file:  \t File containing input shape\n");
   printf("--filter_path: \t Path where file containing filter are stored\n");
@@ -316,6 +320,9 @@ int compare(vect_t *p_dut, vect_t *p_ref, int len)
 
 int default_config(xa_nnlib_gru_init_config_t *config, 
                     int *verify_flag,
+                    int *sequence,
+                    int *rnn_seq_layers,
+                    int *bidirectional,
                     char *input_file_name, 
                     char *filter_path, 
                     char *output_file_name, 
@@ -333,6 +340,9 @@ int default_config(xa_nnlib_gru_init_config_t *config,
     config->coeff_Qformat = 15;
     config->io_Qformat = 12;
     *verify_flag=1;
+    *sequence=0;
+    *rnn_seq_layers=0;
+    *bidirectional=0;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
     output_file_name[0] = '\0';
@@ -350,6 +360,9 @@ void parse_arguments(int argc, char** argv,
                       xa_nnlib_gru_init_config_t *config, 
                       int *show_help,
                       int *verify_flag,
+                      int *sequence,
+                      int *rnn_seq_layers,
+                      int *bidirectional,
                       char *input_file_name, 
                       char *filter_path, 
                       char *output_file_name, 
@@ -371,6 +384,9 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--membank_padding",config->pad);
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
+    ARGTYPE_ONETIME_CONFIG("--sequence",*sequence);
+    ARGTYPE_ONETIME_CONFIG("--rnn_seq_layers",*rnn_seq_layers);
+    ARGTYPE_ONETIME_CONFIG("--bidirectional",*bidirectional);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
@@ -390,6 +406,230 @@ void parse_arguments(int argc, char** argv,
 
 #define N_FRAMES 5
 
+/* Runs N_FRAMES input frames as one sequence through rnn_seq with GRU
+   cells, starting from zero context. Weights of layer k are read from
+   <filter_path>/layer<k>_fwd and, with bidirectional, <filter_path>/layer<k>_bwd */
+int xa_nn_rnn_seq_process(xa_nnlib_gru_init_config_t *config,
+                          int n_layers,
+                          int bidirectional,
+                          int verify_flag,
+                          char *input_file_name,
+                          char *filter_path,
+                          char *output_file_name,
+                          char *ref_file_name)
+{
+  int i, dir;
+  int err = 0;
+  int verify_pass = 1;
+  char profiler_name[MAX_PROFILER_NAME_LENGTH];
+  char profiler_params[MAX_PROFILER_PARAMS_LENGTH];
+  char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  xa_nnlib_gru_init_config_t cell_configs[XA_NNLIB_RNN_SEQ_MAX_LAYERS];
+  xa_nnlib_rnn_seq_init_config_t seq_config;
+  void *p_weights_biases[XA_NNLIB_RNN_SEQ_MAX_LAYERS][2];
+  xa_nnlib_handle_t seq_handle;
+  void *p_scratch;
+  FILE *input_file;
+  FILE *output_file;
+  vect_t *p_input;
+  vect_t *p_output;
+  xa_nnlib_shape_t input_shape;
+  xa_nnlib_shape_t output_shape;
+  int input_length, output_length;
+  int persistent_size;
+  int scratch_size;
+#ifdef VERIFY
+  FILE *output_ref_file;
+  vect_t *output_ref;
+#endif
+
+  if(n_layers < 1 || n_layers > XA_NNLIB_RNN_SEQ_MAX_LAYERS)
+  {
+    fprintf(stderr, "Invalid number of rnn_seq layers: %d\n", n_layers);
+    return -1;
+  }
+
+  /* Layers after the first take the (concatenated) outputs of the previous one */
+  for(i = 0; i < n_layers; i++)
+  {
+    cell_configs[i] = *config;
+    if(i > 0)
+      cell_configs[i].in_feats = (1 + bidirectional) * config->out_feats;
+  }
+
+  seq_config.cell_type = XA_NNLIB_RNN_SEQ_CELL_GRU;
+  seq_config.n_layers = n_layers;
+  seq_config.bidirectional = bidirectional;
+  seq_config.max_steps = N_FRAMES;
+  seq_config.p_cell_configs = cell_configs;
+
+  fprintf(stdout, "Use Case:\nRNN_SEQ GRU_%dx%d: In Feats: %d, Out Feats: %d, Layers: %d, Bidirectional: %d, Steps: %d\n",
+          config->mat_prec, config->vec_prec, config->in_feats, config->out_feats, n_layers, bidirectional, N_FRAMES);
+
+  persistent_size = xa_nnlib_rnn_seq_get_persistent_fast(&seq_config);  PRINT_VAR(persistent_size)
+  if(persistent_size < 0)
+  {
+    fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", persistent_size);
+    return persistent_size;
+  }
+  scratch_size = xa_nnlib_rnn_seq_get_scratch_fast(&seq_config);   PRINT_VAR(scratch_size)
+  if(scratch_size < 0)
+  {
+    fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", scratch_size);
+    return scratch_size;
+  }
+
+  seq_handle = (xa_nnlib_handle_t)malloc(persistent_size); PRINT_PTR(seq_handle)
+  CHECK_PTR(seq_handle, "Allocation for seq_handle");
+  p_scratch  = malloc(scratch_size);    PRINT_PTR(p_scratch)
+  CHECK_PTR(p_scratch, "Allocation for p_scratch");
+
+  fprintf(stdout, "\nPersistent(fast) size: %8d bytes\n", persistent_size);
+  fprintf(stdout, "Scratch(fast) size:    %8d bytes\n", scratch_size);
+
+  err = xa_nnlib_rnn_seq_init(seq_handle, &seq_config);
+  if(XA_NNLIB_NO_ERROR != err)
+  {
+    fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+    return err;
+  }
+
+  /* Set weights and biases of every cell */
+  for(i = 0; i < n_layers; i++)
+  {
+    for(dir = 0; dir < 1 + bidirectional; dir++)
+    {
+      xa_nnlib_gru_weights_t weights;
+      xa_nnlib_gru_biases_t biases;
+      xa_nnlib_rnn_seq_cell_handle_t cell;
+      char cell_path[XA_MAX_FULL_FILE_NAME_LENGTH];
+
+      sprintf(cell_path, "%s/layer%d_%s", filter_path, i, dir ? "bwd" : "fwd");
+      p_weights_biases[i][dir] = setup_weights_and_biases(
+          &weights,
+          &biases,
+          cell_configs[i].in_feats,
+          cell_configs[i].out_feats,
+          cell_configs[i].pad,
+          cell_path,
+          cell_configs[i].precision);
+
+      CHECK_PTR(p_weights_biases[i][dir], "Allocation for p_weights_biases");
+
+      cell.layer_idx = i;
+      cell.direction = dir ? XA_NNLIB_RNN_SEQ_BACKWARD : XA_NNLIB_RNN_SEQ_FORWARD;
+      err = xa_nnlib_rnn_seq_get_config(seq_handle, XA_NNLIB_RNN_SEQ_CELL_HANDLE, &cell);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      xa_nnlib_gru_set_config(cell.handle, XA_NNLIB_GRU_WEIGHT, &weights);
+      xa_nnlib_gru_set_config(cell.handle, XA_NNLIB_GRU_BIAS,   &biases);
+    }
+  }
+
+  xa_nnlib_rnn_seq_get_config(seq_handle, XA_NNLIB_RNN_SEQ_INPUT_SHAPE, &input_shape);PRINT_VAR(input_shape.dim.vector.length);
+  xa_nnlib_rnn_seq_get_config(seq_handle, XA_NNLIB_RNN_SEQ_OUTPUT_SHAPE, &output_shape);PRINT_VAR(output_shape.dim.vector.length);
+
+  input_length = input_shape.n_shapes * input_shape.shape_offset;
+  output_length = output_shape.n_shapes * output_shape.shape_offset;
+
+  strcpy(file_name, pb_input_file_path);
+  strcat(file_name, input_file_name);
+  input_file  = fopen(file_name,"rb");
+  CHECK_PTR(input_file, "Allocation for input_file");
+
+  strcpy(file_name, pb_output_file_path);
+  strcat(file_name, output_file_name);
+  output_file = fopen(file_name,"wb");
+  CHECK_PTR(output_file, "Allocation for output_file");
+
+  p_input = malloc(input_length * sizeof(vect_t)); PRINT_VAR(input_length);
+  CHECK_PTR(p_input, "Allocation for p_input");
+
+  p_output = malloc(output_length * sizeof(vect_t)); PRINT_VAR(output_length);
+  CHECK_PTR(p_output, "Allocation for p_output");
+
+  fprintf(stdout, "Input size:            %8d bytes\n", (int)(input_length * sizeof(vect_t)));
+  fprintf(stdout, "Output size:           %8d bytes\n\n", (int)(output_length * sizeof(vect_t)));
+
+  if(fread(p_input, sizeof(vect_t), input_length, input_file) < (size_t)input_length)
+  {
+    printf("File end / partial sequence \n");
+    return -1;
+  }
+
+  sprintf(profiler_name, "rnn_seq_gru_%dx%d", config->mat_prec, config->vec_prec);
+  sprintf(profiler_params, "in_feats=%d, out_feats=%d, n_layers=%d, bidirectional=%d, steps=%d",
+      config->in_feats, config->out_feats, n_layers, bidirectional, N_FRAMES);
+
+  XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, output_length, NULL, 0);
+
+  XTPWR_PROFILER_START(0);
+  err = xa_nnlib_rnn_seq_process(
+            seq_handle,
+            p_scratch,
+            p_input,
+            p_output,
+            &input_shape,
+            &output_shape);
+  XTPWR_PROFILER_STOP(0);
+
+  if(XA_NNLIB_NO_ERROR != err)
+  {
+    fprintf(stderr, "Runtime Error, failed with error code: 0x%x \n", err);
+    return err;
+  }
+
+  fwrite(p_output, sizeof(vect_t), output_length, output_file);
+
+#ifdef VERIFY
+  if(verify_flag)
+  {
+    strcpy(file_name, pb_ref_file_path);
+    strcat(file_name, ref_file_name);
+    output_ref_file = fopen(file_name,"rb");
+    CHECK_PTR(output_ref_file, "Allocation for output_ref_file");
+
+    output_ref = malloc(output_length * sizeof(vect_t));
+    CHECK_PTR(output_ref, "Allocation for output_ref");
+
+    fread(output_ref, sizeof(vect_t), output_length, output_ref_file);
+    if(XA_NNLIB_NO_ERROR != compare(p_output, output_ref, output_length))
+    {
+      verify_pass = 0;
+    }
+
+    fclose(output_ref_file);
+    free(output_ref);
+  }
+#endif
+
+  XTPWR_PROFILER_UPDATE(0);
+  XTPWR_PROFILER_PRINT(0);
+  XTPWR_PROFILER_CLOSE(0, verify_pass);
+
+  fclose(output_file);
+  fclose(input_file);
+
+  free(p_output);
+  free(p_input);
+  free(p_scratch);
+  free(seq_handle);
+
+  for(i = 0; i < n_layers; i++)
+  {
+    for(dir = 0; dir < 1 + bidirectional; dir++)
+    {
+      free(p_weights_biases[i][dir]);
+    }
+  }
+
+  return 0;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
   int i;
@@ -412,6 +652,9 @@ int xa_nn_main_process(int argc, char *argv[])
   char prev_h_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
   int show_help = 0;
   int verify_pass = 1;
+  int sequence;
+  int rnn_seq_layers;
+  int bidirectional;
 #ifdef VERIFY
   FILE *output_ref_file;
   vect_t *output_ref;
@@ -422,6 +665,9 @@ int xa_nn_main_process(int argc, char *argv[])
   /* Set default configurations */
   if(default_config(&config,
                     &verify_flag,
+                    &sequence,
+                    &rnn_seq_layers,
+                    &bidirectional,
                     input_file_name, 
                     filter_path, 
                     output_file_name, 
@@ -447,6 +693,9 @@ int xa_nn_main_process(int argc, char *argv[])
                     &config,
                     &show_help,
                     &verify_flag,
+                    &sequence,
+                    &rnn_seq_layers,
+                    &bidirectional,
                     input_file_name, 
                     filter_path, 
                     output_file_name, 
@@ -472,6 +721,18 @@ int xa_nn_main_process(int argc, char *argv[])
   if(config.mat_prec == 8)
     config.coeff_Qformat = 7;
 
+  if(rnn_seq_layers)
+  {
+    return xa_nn_rnn_seq_process(&config,
+                                 rnn_seq_layers,
+                                 bidirectional,
+                                 verify_flag,
+                                 input_file_name,
+                                 filter_path,
+                                 output_file_name,
+                                 ref_file_name);
+  }
+
   fprintf(stdout, "Use Case:\nGRU_%dx%d: In Feats: %d, Out Feats: %d, Qformats- Weights and Biases: Q%d, Input and Output: Q%d\n",
           config.mat_prec, config.vec_prec, config.in_feats, config.out_feats, config.coeff_Qformat, config.io_Qformat);
   PRINT_STR("Init Loop ");
@@ -574,12 +835,12 @@ int xa_nn_main_process(int argc, char *argv[])
     output_file = fopen(file_name,"wb");
     CHECK_PTR(output_file, "Allocation for output_file");
 
-    /* Allocate input and output buffer */
-    input_buffer_size = input_shape.dim.vector.length * sizeof(vect_t);
+    /* Allocate input and output buffer, whole sequence with --sequence */
+    input_buffer_size = (sequence ? N_FRAMES : 1) * input_shape.dim.vector.length * sizeof(vect_t);
     p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
     CHECK_PTR(p_input, "Allocation for p_input");
 
-    output_buffer_size = output_shape.dim.vector.length * sizeof(vect_t);
+    output_buffer_size = (sequence ? N_FRAMES : 1) * output_shape.dim.vector.length * sizeof(vect_t);
     p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
     CHECK_PTR(p_output, "Allocation for p_output");
 
@@ -609,15 +870,87 @@ int xa_nn_main_process(int argc, char *argv[])
       sprintf(profiler_name, "gru_%dx%d", 
           config.mat_prec, config.vec_prec);
     }
+    if(sequence)
+    {
+      strcat(profiler_name, (sequence == 2) ? "_seq_bwd" : "_seq");
+    }
  
     // Set profiler parameters
     sprintf(profiler_params, "in_feats=%d, out_feats=%d", config.in_feats, config.out_feats);
         
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, config.out_feats, NULL, 0);
 
+    if(sequence)
+    {
+      /* All frames in one call. The backward pass is given the frames in
+         reverse order so that it steps through them in file order and the
+         per-frame reference still applies; frame i is then in slot N_FRAMES-1-i */
+      xa_nnlib_shape_t output_length;
+      xa_nnlib_shape_t input_length;
+      xa_nnlib_gru_direction_t direction = (sequence == 2) ? XA_NNLIB_GRU_BACKWARD : XA_NNLIB_GRU_FORWARD;
+      int in_len = input_shape.dim.vector.length;
+      int out_len = output_shape.dim.vector.length;
+      int slot;
+
+      for(i = 0; i < N_FRAMES; i++)
+      {
+        slot = (direction == XA_NNLIB_GRU_BACKWARD) ? (N_FRAMES - 1 - i) : i;
+        if(fread(p_input + slot * in_len, sizeof(vect_t), in_len, input_file) < (size_t)in_len)
+        {
+          printf("File end / partial frame \n");
+          return -1;
+        }
+      }
+
+      input_length.shape_type = input_shape.shape_type;
+      input_length.dim.vector.length = in_len;
+      input_length.n_shapes = N_FRAMES;
+      input_length.shape_offset = in_len;
+      output_length.shape_type = output_shape.shape_type;
+      output_length.dim.vector.length = out_len;
+      output_length.n_shapes = N_FRAMES;
+      output_length.shape_offset = out_len;
+
+      XTPWR_PROFILER_START(0);
+      err = xa_nnlib_gru_process_sequence(
+                gru_handle,
+                p_scratch,
+                p_input,
+                p_output,
+                &input_length,
+                &output_length,
+                direction);
+      XTPWR_PROFILER_STOP(0);
+
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Runtime Error, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      for(i = 0; i < N_FRAMES; i++)
+      {
+        slot = (direction == XA_NNLIB_GRU_BACKWARD) ? (N_FRAMES - 1 - i) : i;
+        fwrite(p_output + slot * out_len, sizeof(vect_t), out_len, output_file);
+#ifdef VERIFY
+        if(verify_flag)
+        {
+          fread(output_ref,sizeof(vect_t),out_len,output_ref_file);
+          if(XA_NNLIB_NO_ERROR != compare(p_output + slot * out_len, output_ref, out_len))
+          {
+            verify_pass = 0;
+          }
+        }
+#endif
+      }
+
+      XTPWR_PROFILER_UPDATE(0);
+      XTPWR_PROFILER_PRINT(0);
+    }
+
     /* Execution Loop */
     PRINT_STR("GRU Process loop starts")
-    for(i = 0;i < N_FRAMES; i++)
+    for(i = 0;(i < N_FRAMES) && !sequence; i++)
     {
       xa_nnlib_shape_t output_length;
       xa_nnlib_shape_t input_length;  
@@ -42,7 +42,7 @@
 #define XA_MAX_FILE_PATH_LENGTH 200
 #define XA_MAX_FILE_NAME_LENGTH  80
 #define XA_MAX_FULL_FILE_NAME_LENGTH (XA_MAX_FILE_PATH_LENGTH + XA_MAX_FILE_NAME_LENGTH)
-#define XA_MAX_ARGS 30
+#define XA_MAX_ARGS 40
 #define PARAMFILE "paramfilesimple_lstm.txt"
 
 char pb_input_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
@@ -114,6 +114,27 @@ const char *coef_files[12] =
   "/b_o.bin"
 };
 
+const char *peephole_files[3] =
+{
+  "/p_i.bin",
+  "/p_f.bin",
+  "/p_o.bin"
+};
+
+const char *layer_norm_files[4] =
+{
+  "/ln_f.bin",
+  "/ln_i.bin",
+  "/ln_c.bin",
+  "/ln_o.bin"
+};
+
+const char *projection_files[2] =
+{
+  "/w_proj.bin",
+  "/b_proj.bin"
+};
+
 
 
 void show_usage(void)
@@ -124,6 +145,12 @@ void show_usage(void)
   printf("--membank_padding:\t Memory bank padding (Default=1)           \t  Must be 0 or 1\n");
   printf("--mat_prec:    \t Coefficient precision (Default=16)                        \t  Must be 8 or 16\n");
   printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 16\n");
+  printf("--use_cifg:    \t Couple input and forget gates (Default=0)    \t  Must be 0 or 1\n");
+  printf("--use_peephole:\t Peephole connections (Default=0)             \t  Must be 0 or 1\n");
+  printf("--use_layer_norm:\t Layer normalization of gates (Default=0)   \t  Must be 0 or 1\n");
+  printf("--proj_feats:  \t Projection length, 0 disables (Default=0)    \t  Range: 0-2048 NOTE:-Projection length must be multiple of 4\n");
+  printf("--proj_clip:   \t Projection clip in io_Qformat, 0 disables (Default=0)\n");
+  printf("--sequence:    \t Process all frames in one call (Default=0)   \t  Supported values: 0:-Per frame  1:-Forward  2:-Backward\n");
   printf("--verify:      \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
   printf("--input_file:  \t File containing input shape\n");
   printf("--filter_path: \t Path where file containing filter are stored\n");
@@ -138,7 +165,7 @@ void show_usage(void)
 
 void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     xa_nnlib_lstm_biases_t *biases,
-    int in_feats, int out_feats, int pad_flag,
+    int in_feats, int out_feats, int h_feats, int use_cifg, int pad_flag,
     char *filter_path,
     xa_nnlib_lstm_precision_t precision)
 {
@@ -150,7 +177,7 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     int pad = XA_PAD_BYTES*pad_flag;  //Width of mem bank for HiFi4/5
 
     size  = 4 * (in_feats + pad) * out_feats;
-    size += 4 * (out_feats + pad) * out_feats;
+    size += 4 * (h_feats + pad) * out_feats;
     size += 4 * out_feats ;
 
     CHECK_PTR_RETURN_NULL(weights, "Allocation for weights");
@@ -162,26 +189,26 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     weights->weights16.w_xf = ptr; ptr += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights16.shape_w_xf, out_feats, in_feats);
 
-    weights->weights16.w_hf = ptr; ptr += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights16.shape_w_hf, out_feats, out_feats);
+    weights->weights16.w_hf = ptr; ptr += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights16.shape_w_hf, out_feats, h_feats);
 
     weights->weights16.w_xi = ptr; ptr += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights16.shape_w_xi, out_feats, in_feats);
 
-    weights->weights16.w_hi = ptr; ptr += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights16.shape_w_hi, out_feats, out_feats);
+    weights->weights16.w_hi = ptr; ptr += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights16.shape_w_hi, out_feats, h_feats);
 
     weights->weights16.w_xc = ptr; ptr += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights16.shape_w_xc, out_feats, in_feats);
 
-    weights->weights16.w_hc = ptr; ptr += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights16.shape_w_hc, out_feats, out_feats);
+    weights->weights16.w_hc = ptr; ptr += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights16.shape_w_hc, out_feats, h_feats);
 
     weights->weights16.w_xo = ptr; ptr += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights16.shape_w_xo, out_feats, in_feats);
 
-    weights->weights16.w_ho = ptr; ptr += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights16.shape_w_ho, out_feats, out_feats);
+    weights->weights16.w_ho = ptr; ptr += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights16.shape_w_ho, out_feats, h_feats);
 
 
     biases->b_f  = ptr; ptr += out_feats;
@@ -199,16 +226,22 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
 #ifdef FILE_IO
     // Read from file
     READ_FILE(coef_file_name, filter_path, coef_files[0] , weights->weights16.w_xf, 2, in_feats  , out_feats, pad, "Allocation for w_xf");
-    READ_FILE(coef_file_name, filter_path, coef_files[1] , weights->weights16.w_hf, 2, out_feats , out_feats, pad, "Allocation for w_hf");
-    READ_FILE(coef_file_name, filter_path, coef_files[2] , weights->weights16.w_xi, 2, in_feats  , out_feats, pad, "Allocation for w_xi");
-    READ_FILE(coef_file_name, filter_path, coef_files[3] , weights->weights16.w_hi, 2, out_feats , out_feats, pad, "Allocation for w_hi");
+    READ_FILE(coef_file_name, filter_path, coef_files[1] , weights->weights16.w_hf, 2, h_feats   , out_feats, pad, "Allocation for w_hf");
+    if(!use_cifg)
+    {
+      READ_FILE(coef_file_name, filter_path, coef_files[2] , weights->weights16.w_xi, 2, in_feats  , out_feats, pad, "Allocation for w_xi");
+      READ_FILE(coef_file_name, filter_path, coef_files[3] , weights->weights16.w_hi, 2, h_feats   , out_feats, pad, "Allocation for w_hi");
+    }
     READ_FILE(coef_file_name, filter_path, coef_files[4] , weights->weights16.w_xc, 2, in_feats  , out_feats, pad, "Allocation for w_xc");
-    READ_FILE(coef_file_name, filter_path, coef_files[5] , weights->weights16.w_hc, 2, out_feats , out_feats, pad, "Allocation for w_hc");
+    READ_FILE(coef_file_name, filter_path, coef_files[5] , weights->weights16.w_hc, 2, h_feats   , out_feats, pad, "Allocation for w_hc");
     READ_FILE(coef_file_name, filter_path, coef_files[6] , weights->weights16.w_xo, 2, in_feats  , out_feats, pad, "Allocation for w_xo");
-    READ_FILE(coef_file_name, filter_path, coef_files[7] , weights->weights16.w_ho, 2, out_feats , out_feats, pad, "Allocation for w_ho");
+    READ_FILE(coef_file_name, filter_path, coef_files[7] , weights->weights16.w_ho, 2, h_feats   , out_feats, pad, "Allocation for w_ho");
 
     READ_FILE(coef_file_name, filter_path, coef_files[8] , biases->b_f , 2,  out_feats, 1, 0     , "Allocation for b_f");
-    READ_FILE(coef_file_name, filter_path, coef_files[9] , biases->b_i , 2,  out_feats, 1, 0     , "Allocation for b_i");
+    if(!use_cifg)
+    {
+      READ_FILE(coef_file_name, filter_path, coef_files[9] , biases->b_i , 2,  out_feats, 1, 0     , "Allocation for b_i");
+    }
     READ_FILE(coef_file_name, filter_path, coef_files[10], biases->b_c , 2,  out_feats, 1, 0     , "Allocation for b_c");
     READ_FILE(coef_file_name, filter_path, coef_files[11], biases->b_o , 2,  out_feats, 1, 0     , "Allocation for b_o");
 #else
@@ -233,7 +266,7 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     int pad = XA_PAD_BYTES*pad_flag;  //Width of mem bank for HiFi4/5
 
     size   = 4 * (in_feats + pad) * out_feats;
-    size  += 4 * (out_feats + pad) * out_feats;
+    size  += 4 * (h_feats + pad) * out_feats;
     size_b = 4 * out_feats ;
 
     CHECK_PTR_RETURN_NULL(weights, "Allocation for weights");
@@ -260,40 +293,46 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     weights->weights8.w_xf = ptr8; ptr8 += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights8.shape_w_xf, out_feats, in_feats);
 
-    weights->weights8.w_hf = ptr8; ptr8 += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hf, out_feats, out_feats);
+    weights->weights8.w_hf = ptr8; ptr8 += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hf, out_feats, h_feats);
 
     weights->weights8.w_xi = ptr8; ptr8 += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights8.shape_w_xi, out_feats, in_feats);
 
-    weights->weights8.w_hi = ptr8; ptr8 += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hi, out_feats, out_feats);
+    weights->weights8.w_hi = ptr8; ptr8 += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hi, out_feats, h_feats);
 
     weights->weights8.w_xc = ptr8; ptr8 += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights8.shape_w_xc, out_feats, in_feats);
 
-    weights->weights8.w_hc = ptr8; ptr8 += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hc, out_feats, out_feats);
+    weights->weights8.w_hc = ptr8; ptr8 += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hc, out_feats, h_feats);
 
     weights->weights8.w_xo = ptr8; ptr8 += (in_feats + pad) * out_feats;
     FILL_SHAPE_MATRIX(weights->weights8.shape_w_xo, out_feats, in_feats);
 
-    weights->weights8.w_ho = ptr8; ptr8 += (out_feats + pad) * out_feats;
-    FILL_SHAPE_MATRIX(weights->weights8.shape_w_ho, out_feats, out_feats);
+    weights->weights8.w_ho = ptr8; ptr8 += (h_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_ho, out_feats, h_feats);
 
 #ifdef FILE_IO
     // Read from file
     READ_FILE(coef_file_name, filter_path, coef_files[0] , weights->weights8.w_xf, 1, in_feats  , out_feats, pad, "Allocation for w_xf");
-    READ_FILE(coef_file_name, filter_path, coef_files[1] , weights->weights8.w_hf, 1, out_feats , out_feats, pad, "Allocation for w_hf");
-    READ_FILE(coef_file_name, filter_path, coef_files[2] , weights->weights8.w_xi, 1, in_feats  , out_feats, pad, "Allocation for w_xi");
-    READ_FILE(coef_file_name, filter_path, coef_files[3] , weights->weights8.w_hi, 1, out_feats , out_feats, pad, "Allocation for w_hi");
+    READ_FILE(coef_file_name, filter_path, coef_files[1] , weights->weights8.w_hf, 1, h_feats   , out_feats, pad, "Allocation for w_hf");
+    if(!use_cifg)
+    {
+      READ_FILE(coef_file_name, filter_path, coef_files[2] , weights->weights8.w_xi, 1, in_feats  , out_feats, pad, "Allocation for w_xi");
+      READ_FILE(coef_file_name, filter_path, coef_files[3] , weights->weights8.w_hi, 1, h_feats   , out_feats, pad, "Allocation for w_hi");
+    }
     READ_FILE(coef_file_name, filter_path, coef_files[4] , weights->weights8.w_xc, 1, in_feats  , out_feats, pad, "Allocation for w_xc");
-    READ_FILE(coef_file_name, filter_path, coef_files[5] , weights->weights8.w_hc, 1, out_feats , out_feats, pad, "Allocation for w_hc");
+    READ_FILE(coef_file_name, filter_path, coef_files[5] , weights->weights8.w_hc, 1, h_feats   , out_feats, pad, "Allocation for w_hc");
     READ_FILE(coef_file_name, filter_path, coef_files[6] , weights->weights8.w_xo, 1, in_feats  , out_feats, pad, "Allocation for w_xo");
-    READ_FILE(coef_file_name, filter_path, coef_files[7] , weights->weights8.w_ho, 1, out_feats , out_feats, pad, "Allocation for w_ho");
+    READ_FILE(coef_file_name, filter_path, coef_files[7] , weights->weights8.w_ho, 1, h_feats   , out_feats, pad, "Allocation for w_ho");
 
     READ_FILE(coef_file_name, filter_path, coef_files[8] , biases->b_f , 2,  out_feats, 1, 0     , "Allocation for b_f");
-    READ_FILE(coef_file_name, filter_path, coef_files[9] , biases->b_i , 2,  out_feats, 1, 0     , "Allocation for b_i");
+    if(!use_cifg)
+    {
+      READ_FILE(coef_file_name, filter_path, coef_files[9] , biases->b_i , 2,  out_feats, 1, 0     , "Allocation for b_i");
+    }
     READ_FILE(coef_file_name, filter_path, coef_files[10], biases->b_c , 2,  out_feats, 1, 0     , "Allocation for b_c");
     READ_FILE(coef_file_name, filter_path, coef_files[11], biases->b_o , 2,  out_feats, 1, 0     , "Allocation for b_o");
 
@@ -314,6 +353,99 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
   return NULL;
 }
 
+void *setup_variant_params(xa_nnlib_lstm_peephole_t *peephole,
+    xa_nnlib_lstm_projection_t *projection,
+    xa_nnlib_lstm_layer_norm_t *layer_norm,
+    xa_nnlib_lstm_init_config_t *config,
+    char *filter_path)
+{
+  coeff_t *weights_and_biases, *ptr;
+  size_t size;
+  char coef_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  int out_feats = config->out_feats;
+  int proj_feats = config->proj_feats;
+  int pad = XA_PAD_BYTES*config->pad;  //Width of mem bank for HiFi4/5
+
+  CHECK_PTR_RETURN_NULL(peephole, "Allocation for peephole");
+  CHECK_PTR_RETURN_NULL(projection, "Allocation for projection");
+  CHECK_PTR_RETURN_NULL(layer_norm, "Allocation for layer_norm");
+
+  /* coeff_t sized for both precisions; w_proj rows are padded like the gate weights */
+  size  = (out_feats + pad) * proj_feats + proj_feats;
+  size += 3 * out_feats;
+  size += 4 * out_feats;
+
+  weights_and_biases = ptr = malloc(size * sizeof(coeff_t));
+  CHECK_PTR_RETURN_NULL(ptr, "Allocation for variant parameters");
+
+  memset(peephole, 0, sizeof(xa_nnlib_lstm_peephole_t));
+  memset(projection, 0, sizeof(xa_nnlib_lstm_projection_t));
+  memset(layer_norm, 0, sizeof(xa_nnlib_lstm_layer_norm_t));
+
+  if(proj_feats)
+  {
+    if(config->precision == XA_NNLIB_LSTM_16bx16b)
+    {
+      projection->proj16.w_proj = ptr;
+      FILL_SHAPE_MATRIX(projection->proj16.shape_w_proj, proj_feats, out_feats);
+      READ_FILE(coef_file_name, filter_path, projection_files[0], projection->proj16.w_proj, 2, out_feats, proj_feats, pad, "Allocation for w_proj");
+    }
+    else
+    {
+      projection->proj8.w_proj = (coeff8_t *)ptr;
+      FILL_SHAPE_MATRIX(projection->proj8.shape_w_proj, proj_feats, out_feats);
+      READ_FILE(coef_file_name, filter_path, projection_files[0], projection->proj8.w_proj, 1, out_feats, proj_feats, pad, "Allocation for w_proj");
+    }
+    ptr += (out_feats + pad) * proj_feats;
+
+    /* b_proj sits at the same offset in proj16 and proj8 */
+    projection->proj16.b_proj = ptr; ptr += proj_feats;
+    FILL_SHAPE_VECTOR(projection->proj16.shape_b_proj, proj_feats);
+    READ_FILE(coef_file_name, filter_path, projection_files[1], projection->proj16.b_proj, 2, proj_feats, 1, 0, "Allocation for b_proj");
+  }
+
+  if(config->use_peephole)
+  {
+    if(!config->use_cifg)
+    {
+      peephole->p_i = ptr; ptr += out_feats;
+      FILL_SHAPE_VECTOR(peephole->shape_p_i, out_feats);
+      READ_FILE(coef_file_name, filter_path, peephole_files[0], peephole->p_i, 2, out_feats, 1, 0, "Allocation for p_i");
+    }
+    peephole->p_f = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(peephole->shape_p_f, out_feats);
+    READ_FILE(coef_file_name, filter_path, peephole_files[1], peephole->p_f, 2, out_feats, 1, 0, "Allocation for p_f");
+
+    peephole->p_o = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(peephole->shape_p_o, out_feats);
+    READ_FILE(coef_file_name, filter_path, peephole_files[2], peephole->p_o, 2, out_feats, 1, 0, "Allocation for p_o");
+  }
+
+  if(config->use_layer_norm)
+  {
+    layer_norm->ln_f = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(layer_norm->shape_ln_f, out_feats);
+    READ_FILE(coef_file_name, filter_path, layer_norm_files[0], layer_norm->ln_f, 2, out_feats, 1, 0, "Allocation for ln_f");
+
+    if(!config->use_cifg)
+    {
+      layer_norm->ln_i = ptr; ptr += out_feats;
+      FILL_SHAPE_VECTOR(layer_norm->shape_ln_i, out_feats);
+      READ_FILE(coef_file_name, filter_path, layer_norm_files[1], layer_norm->ln_i, 2, out_feats, 1, 0, "Allocation for ln_i");
+    }
+
+    layer_norm->ln_c = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(layer_norm->shape_ln_c, out_feats);
+    READ_FILE(coef_file_name, filter_path, layer_norm_files[2], layer_norm->ln_c, 2, out_feats, 1, 0, "Allocation for ln_c");
+
+    layer_norm->ln_o = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(layer_norm->shape_ln_o, out_feats);
+    READ_FILE(coef_file_name, filter_path, layer_norm_files[3], layer_norm->ln_o, 2, out_feats, 1, 0, "Allocation for ln_o");
+  }
+
+  return weights_and_biases;
+}
+
 #ifdef VERIFY
 #define ABS(A) (((A) < 0) ? -(A):(A))
 
@@ -383,6 +515,7 @@ int compare_cell(int *p_dut, int *p_ref, int len)
 
 int default_config(xa_nnlib_lstm_init_config_t *config, 
     int *verify_flag,
+    int *sequence,
     char *input_file_name, 
     char *filter_path, 
     char *output_file_name, 
@@ -403,7 +536,13 @@ int default_config(xa_nnlib_lstm_init_config_t *config,
     config->coeff_Qformat = 15;
     config->io_Qformat = 12;
     config->cell_Qformat = 25;
+    config->use_cifg = 0;
+    config->use_peephole = 0;
+    config->use_layer_norm = 0;
+    config->proj_feats = 0;
+    config->proj_clip = 0;
     *verify_flag=1;
+    *sequence=0;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
     output_file_name[0] = '\0';
@@ -424,6 +563,7 @@ void parse_arguments(int argc, char** argv,
     xa_nnlib_lstm_init_config_t *config, 
     int *show_help,
     int *verify_flag,
+    int *sequence,
     char *input_file_name, 
     char *filter_path, 
     char *output_file_name, 
@@ -448,6 +588,12 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--membank_padding",config->pad);
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
+    ARGTYPE_ONETIME_CONFIG("--use_cifg",config->use_cifg);
+    ARGTYPE_ONETIME_CONFIG("--use_peephole",config->use_peephole);
+    ARGTYPE_ONETIME_CONFIG("--use_layer_norm",config->use_layer_norm);
+    ARGTYPE_ONETIME_CONFIG("--proj_feats",config->proj_feats);
+    ARGTYPE_ONETIME_CONFIG("--proj_clip",config->proj_clip);
+    ARGTYPE_ONETIME_CONFIG("--sequence",*sequence);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
@@ -478,6 +624,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name[MAX_PROFILER_NAME_LENGTH];
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_weights_biases;
+  void *p_variant_params;
   xa_nnlib_handle_t lstm_handle;
   void *p_scratch;
   FILE *input_file;
@@ -497,6 +644,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char prev_c_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
   int show_help = 0;
   int verify_pass = 1;
+  int sequence;
 #ifdef VERIFY
   FILE *output_ref_file;
   FILE *cell_ref_file;
@@ -510,6 +658,7 @@ int xa_nn_main_process(int argc, char *argv[])
   /* Set default configurations */
   if(default_config(&config,
         &verify_flag,
+        &sequence,
         input_file_name, 
         filter_path, 
         output_file_name, 
@@ -538,6 +687,7 @@ int xa_nn_main_process(int argc, char *argv[])
         &config,
         &show_help,
         &verify_flag,
+        &sequence,
         input_file_name, 
         filter_path, 
         output_file_name, 
@@ -614,6 +764,8 @@ int xa_nn_main_process(int argc, char *argv[])
         &biases, 
         config.in_feats,
         config.out_feats,
+        config.proj_feats ? config.proj_feats : config.out_feats,
+        config.use_cifg,
         config.pad,
         filter_path,
         config.precision);
@@ -627,10 +779,34 @@ int xa_nn_main_process(int argc, char *argv[])
     xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_BIAS,   &biases);
   }
 
+  /* Set peephole, projection and layer norm parameters for the enabled variants */
+  {
+    xa_nnlib_lstm_peephole_t peephole;
+    xa_nnlib_lstm_projection_t projection;
+    xa_nnlib_lstm_layer_norm_t layer_norm;
+
+    p_variant_params = setup_variant_params(
+        &peephole,
+        &projection,
+        &layer_norm,
+        &config,
+        filter_path);
+
+    CHECK_PTR(p_variant_params, "Allocation for p_variant_params");
+
+    if(config.use_peephole)
+      xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_PEEPHOLE, &peephole);
+    if(config.proj_feats)
+      xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_PROJECTION, &projection);
+    if(config.use_layer_norm)
+      xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_LAYER_NORM, &layer_norm);
+  }
+
 
   xa_nnlib_lstm_get_config(lstm_handle, XA_NNLIB_LSTM_INPUT_SHAPE, &input_shape);PRINT_VAR(input_shape.dim.vector.length);
   xa_nnlib_lstm_get_config(lstm_handle, XA_NNLIB_LSTM_OUTPUT_SHAPE, &output_shape);PRINT_VAR(output_shape.dim.vector.length);
-  xa_nnlib_lstm_get_config(lstm_handle, XA_NNLIB_LSTM_OUTPUT_SHAPE, &cell_shape);PRINT_VAR(cell_shape.dim.vector.length);
+  /* Cell state has out_feats elements, output is proj_feats long with projection */
+  FILL_SHAPE_VECTOR(cell_shape, config.out_feats);PRINT_VAR(cell_shape.dim.vector.length);
 
   //Restore context for lstm state. This restores the 
   // reference context so that we can match output
@@ -693,12 +869,12 @@ int xa_nn_main_process(int argc, char *argv[])
     output_cell_file = fopen(file_name,"wb");
     CHECK_PTR(output_cell_file, "Allocation for output_cell_file");
 
-    /* Allocate input and output buffer */
-    input_buffer_size = input_shape.dim.vector.length * sizeof(vect_t);
+    /* Allocate input and output buffer, whole sequence with --sequence */
+    input_buffer_size = (sequence ? N_FRAMES : 1) * input_shape.dim.vector.length * sizeof(vect_t);
     p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
     CHECK_PTR(p_input, "Allocation for p_input");
 
-    output_buffer_size = output_shape.dim.vector.length * sizeof(vect_t);
+    output_buffer_size = (sequence ? N_FRAMES : 1) * output_shape.dim.vector.length * sizeof(vect_t);
     p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
     CHECK_PTR(p_output, "Allocation for p_output");
 
@@ -740,18 +916,89 @@ int xa_nn_main_process(int argc, char *argv[])
       sprintf(profiler_name, "lstm_%dx%d", 
           config.mat_prec, config.vec_prec);
     }
+    if(sequence)
+    {
+      strcat(profiler_name, (sequence == 2) ? "_seq_bwd" : "_seq");
+    }
 
     // Set profiler parameters
-    sprintf(profiler_params, "in_feats=%d, out_feats=%d", config.in_feats, config.out_feats);
+    sprintf(profiler_params, "in_feats=%d, out_feats=%d, cifg=%d, peephole=%d, layer_norm=%d, proj_feats=%d",
+        config.in_feats, config.out_feats, config.use_cifg, config.use_peephole, config.use_layer_norm, config.proj_feats);
 
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, config.out_feats, NULL, 0);
 
     xa_nnlib_shape_t output_length;
     xa_nnlib_shape_t input_length;  
     
+    if(sequence)
+    {
+      /* All frames in one call. The backward pass is given the frames in
+         reverse order so that it steps through them in file order and the
+         per-frame reference still applies; frame i is then in slot N_FRAMES-1-i */
+      xa_nnlib_lstm_direction_t direction = (sequence == 2) ? XA_NNLIB_LSTM_BACKWARD : XA_NNLIB_LSTM_FORWARD;
+      int in_len = input_shape.dim.vector.length;
+      int out_len = output_shape.dim.vector.length;
+      int slot;
+
+      for(i = 0; i < N_FRAMES; i++)
+      {
+        slot = (direction == XA_NNLIB_LSTM_BACKWARD) ? (N_FRAMES - 1 - i) : i;
+        if(fread(p_input + slot * in_len, sizeof(vect_t), in_len, input_file) < (size_t)in_len)
+        {
+          printf("File end / partial frame \n");
+          return -1;
+        }
+      }
+
+      input_length.shape_type = input_shape.shape_type;
+      input_length.dim.vector.length = in_len;
+      input_length.n_shapes = N_FRAMES;
+      input_length.shape_offset = in_len;
+      output_length.shape_type = output_shape.shape_type;
+      output_length.dim.vector.length = out_len;
+      output_length.n_shapes = N_FRAMES;
+      output_length.shape_offset = out_len;
+
+      XTPWR_PROFILER_START(0);
+      err = xa_nnlib_lstm_process_sequence(
+              lstm_handle,
+              p_scratch,
+              p_input,
+              p_output,
+              &input_length,
+              &output_length,
+              direction);
+      XTPWR_PROFILER_STOP(0);
+
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Runtime Error, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      for(i = 0; i < N_FRAMES; i++)
+      {
+        slot = (direction == XA_NNLIB_LSTM_BACKWARD) ? (N_FRAMES - 1 - i) : i;
+        fwrite(p_output + slot * out_len, sizeof(vect_t), out_len, output_file);
+#ifdef VERIFY
+        if(verify_flag)
+        {
+          fread(output_ref,sizeof(vect_t),out_len,output_ref_file);
+          if(XA_NNLIB_NO_ERROR != compare(p_output + slot * out_len, output_ref, out_len))
+          {
+            verify_pass = 0;
+          }
+        }
+#endif
+      }
+
+      XTPWR_PROFILER_UPDATE(0);
+      XTPWR_PROFILER_PRINT(0);
+    }
+
     /* Execution Loop */
     PRINT_STR("LSTM Process loop starts");
-    for(i = 0;i < N_FRAMES; i++)
+    for(i = 0;(i < N_FRAMES) && !sequence; i++)
     {
       output_length.dim.vector.length = output_shape.dim.vector.length; 
       output_length.shape_type = output_shape.shape_type; 
@@ -850,6 +1097,7 @@ int xa_nn_main_process(int argc, char *argv[])
 #ifndef CONSTANT_WEIGHTS  
   free(p_weights_biases);
 #endif
+  free(p_variant_params);
 
   return 0;
 }
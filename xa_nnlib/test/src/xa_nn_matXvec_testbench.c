@@ -37,7 +37,7 @@
 #define MAX_ACTIVATION_NAME_LENGTH 20
 
 #define XA_MAX_CMD_LINE_LENGTH 1000
-#define XA_MAX_ARGS 40
+#define XA_MAX_ARGS 100
 #define PARAMFILE "paramfilesimple_matXvec.txt"
 
 #define VALIDATE_PTR(ptr) if(NULL == ptr) { printf("%s: allocation failed\n", #ptr); return -1;}
@@ -68,6 +68,8 @@ typedef struct _test_config_t
   int out_multiplier;
   int out_shift;
   int out_zero_bias;
+  int *p_out_multiplier;
+  int *p_out_shift;
   char activation[MAX_ACTIVATION_NAME_LENGTH];
   int membank_padding;
   int frames;
@@ -79,6 +81,11 @@ typedef struct _test_config_t
   int verify;
   int batch;
   int fc;
+  int block_size;
+  int sym4s;
+  int batch_matmul;
+  int transpose_mat2;
+  int plan;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -106,6 +113,8 @@ int default_config(test_config_t *p_cfg)
     p_cfg->out_multiplier = 0x40000000;
     p_cfg->out_shift = -8;
     p_cfg->out_zero_bias = 128;
+    p_cfg->p_out_multiplier = NULL;
+    p_cfg->p_out_shift = NULL;
     p_cfg->activation[0] = '\0';  
     p_cfg->membank_padding = 1;
     p_cfg->frames   = 2;  
@@ -117,6 +126,11 @@ int default_config(test_config_t *p_cfg)
     p_cfg->verify = 1;
     p_cfg->batch = 0;
     p_cfg->fc = 0;
+    p_cfg->block_size = 0;
+    p_cfg->sym4s = 0;
+    p_cfg->batch_matmul = 0;
+    p_cfg->transpose_mat2 = 0;
+    p_cfg->plan = 0;
 
     return 0;
   }
@@ -171,6 +185,11 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-batch",p_cfg->batch);
     ARGTYPE_ONETIME_CONFIG("-fc",p_cfg->fc);
+    ARGTYPE_ONETIME_CONFIG("-block_size",p_cfg->block_size);
+    ARGTYPE_ONETIME_CONFIG("-sym4s",p_cfg->sym4s);
+    ARGTYPE_ONETIME_CONFIG("-batch_matmul",p_cfg->batch_matmul);
+    ARGTYPE_ONETIME_CONFIG("-transpose_mat2",p_cfg->transpose_mat2);
+    ARGTYPE_ONETIME_CONFIG("-plan",p_cfg->plan);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -189,7 +208,7 @@ void show_usage(void)
     printf("\t-vec_count : vec count for time batching; Default=1\n");
     printf("\t-acc_shift : Accumulator left shift; Default=0\n");
     printf("\t-bias_shift : Bias left shift; Default=0\n");
-    printf("\t-mat_precision : 8, 16 or -1(single prec float); Default=16\n");
+    printf("\t-mat_precision : 8, 16, -1(single prec float) or -2(half prec float, with single prec float input); Default=16\n");
     printf("\t-inp_precision : 8, 16 or -1(single prec float); Default=16\n");
     printf("\t-out_precision : 8, 16, 32, 64 or -1(single prec float); Default=16\n");
     printf("\t-bias_precision : 16, 64 or -1(single prec float); Default=16\n");
@@ -211,6 +230,11 @@ void show_usage(void)
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
     printf("\t-batch: Flag to check time batching; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-fc: Flag for fully connected; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-block_size: Block size of block-sparse sym8s mat1, 4, 8 or 16; 0: Dense mat1; Default=0\n");
+    printf("\t-sym4s: Flag for int4 mat1, values in [-8, 7] packed before the call; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-batch_matmul: Number of matrix pairs for batch matmul, mat1 rows x cols1 times mat2 cols1 x cols2 (order in input file - mat1, mat2); 0: Disable; Default=0\n");
+    printf("\t-transpose_mat2: Flag for batch matmul mat2 stored as cols2 x cols1; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-plan: Flag to run fully connected (sym8sxasym8s) through plan_create and plan_execute; 0: Disable, 1: Enable; Default=0\n");
 }
 
 #define MAT_VEC_MUL_FN(MPREC, VPREC, OPREC) \
@@ -267,14 +291,118 @@ void show_usage(void)
 #define MAT_VEC_MUL_FC_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       XTPWR_PROFILER_START(0);\
-      err = xa_nn_fully_connected_sym8sxasym8s_asym8s ( \
-          (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
-          cfg.cols1, cfg.rows, \
-          cfg.inp1_zero_bias, \
-          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      if(cfg.plan) {\
+        err = xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_create ( \
+            p_plan, (WORD8 *) p_mat1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.inp1_zero_bias, \
+            cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+        err = (err < 0 || err > scratch_size) ? -1 : 0;\
+        if(!err) {\
+          err = xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_execute ( \
+              p_plan, (WORD8 *)p_out->p, (WORD8 *)p_vec1->p, p_scratch->p);\
+        }\
+      }\
+      else {\
+        err = xa_nn_fully_connected_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.inp1_zero_bias, \
+            cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_VEC_MUL_SPARSE_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      WORD8 *p_packed = NULL;\
+      WORD32 packed_size = xa_nn_matXvec_sparse_pack_getsize_sym8s( \
+          (WORD8 *) p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.block_size);\
+      if(packed_size > 0) p_packed = (WORD8 *)malloc(packed_size);\
+      err = (NULL == p_packed) || (packed_size != xa_nn_matXvec_sparse_pack_sym8s( \
+          p_packed, (WORD8 *) p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.block_size));\
+      if(!err) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matXvec_sparse_sym8sxasym8s_asym8s ( \
+            (WORD8 *) p_out->p, p_packed, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, cfg.block_size, \
+            cfg.inp1_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      free(p_packed);\
+    }
+
+#define MAT_VEC_MUL_FC_SPARSE_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      WORD8 *p_packed = NULL;\
+      WORD32 packed_size = xa_nn_matXvec_sparse_pack_getsize_sym8s( \
+          (WORD8 *) p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.block_size);\
+      if(packed_size > 0) p_packed = (WORD8 *)malloc(packed_size);\
+      err = (NULL == p_packed) || (packed_size != xa_nn_matXvec_sparse_pack_sym8s( \
+          p_packed, (WORD8 *) p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.block_size));\
+      if(!err) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_fully_connected_sparse_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, p_packed, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, cfg.block_size, \
+            cfg.inp1_zero_bias, \
+            cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      free(p_packed);\
+    }
+
+#define PACK_SYM4S_MAT1 \
+      WORD8 *p_packed = NULL;\
+      WORD32 packed_size = xa_nn_matXvec_sym4s_pack_getsize_sym8s(cfg.rows, cfg.cols1);\
+      if(packed_size > 0) p_packed = (WORD8 *)malloc(packed_size);\
+      err = (NULL == p_packed) || (packed_size != xa_nn_matXvec_sym4s_pack_sym8s( \
+          p_packed, (WORD8 *) p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset));
+
+#define MAT_VEC_MUL_FN_SYM4SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      PACK_SYM4S_MAT1 \
+      if(!err) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matXvec_sym4sxasym8s_asym8s ( \
+            (WORD8 *) p_out->p, p_packed, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, \
+            cfg.inp1_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      free(p_packed);\
+    }
+
+#define MAT_VEC_MUL_FC_FN_SYM4SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      PACK_SYM4S_MAT1 \
+      if(!err) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_fully_connected_sym4sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, p_packed, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.inp1_zero_bias, \
+            cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      free(p_packed);\
+    }
+
+#define MAT_VEC_MUL_FN_SYM4SXASYM8S_BATCH(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      PACK_SYM4S_MAT1 \
+      if(!err) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matmul_per_chan_sym4sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, p_packed, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, \
+            cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      free(p_packed);\
+    }
+
 #define MAT_VEC_MUL_OUT_STRIDE_FN_SYM8SXASYM8S_16(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       memset(p_out->p, 0xca, cfg.rows*cfg.out_stride*sizeof(WORD16)); \
@@ -386,6 +514,35 @@ void show_usage(void)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_VEC_MUL_FN_F16(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matXvec_f16xf32_f32 ( \
+          (FLOAT32 *)p_out->p, (WORD16 *) p_mat1->p, (WORD16 *) p_mat2->p, (FLOAT32 *)p_vec1->p, (FLOAT32 *)p_vec2->p, (FLOAT32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset); \
+      XTPWR_PROFILER_STOP(0);\
+    }
+
+#define MAT_VEC_MUL_FN_F16_BATCH(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      int i;\
+      FLOAT32 **pp_vec1; FLOAT32 **pp_out;\
+      pp_vec1 = (FLOAT32 **)malloc(sizeof(FLOAT32 *)*cfg.vec_count);\
+      pp_out = (FLOAT32 **)malloc(sizeof(FLOAT32 *)*cfg.vec_count);\
+      for (i=0; i<cfg.vec_count; i++){\
+        *((FLOAT32 **) pp_vec1 + i) =  ((FLOAT32 *)p_vec1->p + i*cfg.cols1);\
+        *((FLOAT32 **) pp_out + i) = ((FLOAT32 *)p_out->p + i*cfg.rows);\
+      }\
+      err = xa_nn_matXvec_batch_f16xf32_f32( \
+          (FLOAT32 **)pp_out, (WORD16 *) p_mat1->p, (FLOAT32 **)pp_vec1, (FLOAT32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, \
+          cfg.vec_count);\
+      free(pp_vec1);\
+      free(pp_out);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #define MAT_VEC_MUL_ACTIVATION_FN_F32(MPREC, VPREC, OPREC, ACTIVATION) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
       XTPWR_PROFILER_START(0);\
@@ -396,6 +553,27 @@ void show_usage(void)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define BATCH_MATMUL_FN_ASYM8S(MPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (MPREC == p_mat2->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_batch_matmul_asym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *) p_mat2->p, \
+          cfg.batch_matmul, cfg.rows, cfg.cols1, cfg.cols2, cfg.transpose_mat2, \
+          cfg.mat1_zero_bias, cfg.mat2_zero_bias, \
+          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+          (VOID *)p_scratch->p);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
+#define BATCH_MATMUL_FN_F32(MPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (MPREC == p_mat2->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_batch_matmul_f32 ( \
+          (FLOAT32 *)p_out->p, (FLOAT32 *) p_mat1->p, (FLOAT32 *) p_mat2->p, \
+          cfg.batch_matmul, cfg.rows, cfg.cols1, cfg.cols2, cfg.transpose_mat2);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #if HIFI_VFPU 
 #define PROCESS_MATXVEC \
     MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, sigmoid) \
@@ -418,6 +596,7 @@ void show_usage(void)
     else MAT_VEC_MUL_ACTIVATION_FN_F32(-1, -1, -1, sigmoid) \
     else MAT_VEC_MUL_ACTIVATION_FN_F32(-1, -1, -1, tanh) \
     else MAT_VEC_MUL_FN_F32(-1, -1, -1) \
+    else MAT_VEC_MUL_FN_F16(-2, -1, -1) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #else
 #define PROCESS_MATXVEC \
@@ -467,6 +646,7 @@ void show_usage(void)
     else MAT_VEC_MUL_FN_BATCH(8, 8, 32) \
     else MAT_VEC_MUL_FN_ASYM8_BATCH(-3, -3, -3) \
     else MAT_VEC_MUL_FN_F32_BATCH(-1, -1, -1) \
+    else MAT_VEC_MUL_FN_F16_BATCH(-2, -1, -1) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #else
 #define PROCESS_MATXVEC_BATCH \
@@ -476,6 +656,38 @@ void show_usage(void)
     else MAT_VEC_MUL_FN_ASYM8_BATCH(-3, -3, -3) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #endif
+
+#define PROCESS_MATXVEC_SPARSE \
+    MAT_VEC_MUL_SPARSE_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_FC_SPARSE \
+    MAT_VEC_MUL_FC_SPARSE_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_SYM4S \
+    MAT_VEC_MUL_FN_SYM4SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_FC_SYM4S \
+    MAT_VEC_MUL_FC_FN_SYM4SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_BATCH_SYM4S \
+    MAT_VEC_MUL_FN_SYM4SXASYM8S_BATCH(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#if HIFI_VFPU 
+#define PROCESS_BATCH_MATMUL \
+    BATCH_MATMUL_FN_ASYM8S(-4, -4) \
+    else BATCH_MATMUL_FN_F32(-1, -1) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+#else
+#define PROCESS_BATCH_MATMUL \
+    BATCH_MATMUL_FN_ASYM8S(-4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+#endif
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -495,8 +707,10 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_bias;
   buf1D_t *p_out;
   buf1D_t *p_scratch;
+  void *p_plan = NULL;
   buf1D_t *ptr_ref;
   int scratch_size = 0;
+  int out_length;
 
   FILE *fptr_inp;
   FILE *fptr_out;
@@ -527,7 +741,32 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Set profiler name 
-  if((cfg.mat_precision == -1) || (cfg.inp_precision == -1) || (cfg.out_precision == -1))
+  if(cfg.batch_matmul)
+  {
+    if(cfg.mat_precision == -1){
+      sprintf(profiler_name,"batch_matmul_f32");
+      // If VFPU is not supported, return
+      if(!HIFI_VFPU)
+      {
+        printf("%s: NOT TESTED\n", profiler_name);
+        return 0;
+      }
+    }
+    else{
+      sprintf(profiler_name,"batch_matmul_asym8sxasym8s_asym8s");
+    }
+  }
+  else if(cfg.mat_precision == -2)
+  {
+    sprintf(profiler_name,"matXvec%s_f16xf32_f32",(cfg.batch)? "_batch": "");
+    // If VFPU is not supported, return
+    if(!HIFI_VFPU)
+    {
+      printf("%s: NOT TESTED\n", profiler_name);
+      return 0;
+    }
+  }
+  else if((cfg.mat_precision == -1) || (cfg.inp_precision == -1) || (cfg.out_precision == -1))
   {
     if(cfg.fc == 1){
       sprintf(profiler_name,"fully_connected_f32");
@@ -553,11 +792,14 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   else if((cfg.mat_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4))
   {
-    if(cfg.fc == 1){
-      sprintf(profiler_name,"fully_connected_sym8sxasym8s_asym8s");
+    if(cfg.sym4s == 1 && cfg.batch == 1){
+      sprintf(profiler_name,"matmul_per_chan_sym4sxasym8s_asym8s");
+    }
+    else if(cfg.fc == 1){
+      sprintf(profiler_name,"fully_connected%s_%sxasym8s_asym8s%s",(cfg.block_size)? "_sparse": "",(cfg.sym4s)? "sym4s": "sym8s",(cfg.plan)? "_plan": "");
     }
     else{
-      sprintf(profiler_name,"matXvec%s_sym8sxasym8s_asym8s",(cfg.batch)? "_batch": "");
+      sprintf(profiler_name,"matXvec%s%s_%sxasym8s_asym8s",(cfg.batch)? "_batch": "",(cfg.block_size)? "_sparse": "",(cfg.sym4s)? "sym4s": "sym8s");
     }
   }
   else
@@ -575,15 +817,25 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   
   // Set profiler parameters
-  if(cfg.batch == 1){
+  if(cfg.batch_matmul){
+    sprintf(profiler_params, "batch=%d, rows=%d, cols1=%d, cols2=%d, transpose_mat2=%d", 
+      cfg.batch_matmul, cfg.rows, cfg.cols1, cfg.cols2, cfg.transpose_mat2);
+  }
+  else if(cfg.batch == 1){
     sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, vec_count=%d", 
       cfg.rows, cfg.cols1, cfg.bias_precision,cfg.vec_count);
   }
+  else if(cfg.block_size){
+    sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, block_size=%d", 
+      cfg.rows, cfg.cols1, cfg.bias_precision, cfg.block_size);
+  }
   else{
     sprintf(profiler_params, "rows=%d, cols1=%d, cols2=%d, bias_prec=%d", 
       cfg.rows, cfg.cols1, cfg.cols2, cfg.bias_precision);
   }
 
+  out_length = (cfg.batch_matmul)? (cfg.batch_matmul * cfg.rows * cfg.cols2): (cfg.rows * cfg.vec_count);
+
   // Open input file
   if(cfg.write_file)
   {
@@ -606,30 +858,68 @@ int xa_nn_main_process(int argc, char *argv[])
   // Open reference file if verify flag is enabled
   if(cfg.verify)
   {
-    ptr_ref =  create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision); 
+    ptr_ref =  create_buf1D(out_length, cfg.out_precision); 
     
     fptr_ref = file_open(pb_ref_file_path, cfg.read_ref_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
   }
 
   // scratch size required for matXvec activation kernels
   scratch_size = cfg.rows*4;
+  if(cfg.batch_matmul && cfg.mat_precision == -4)
+  {
+    scratch_size = xa_nn_batch_matmul_asym8sxasym8s_asym8s_getsize(cfg.rows, cfg.cols1, cfg.cols2, cfg.transpose_mat2);
+  }
 
   // Allocate Memory
-  p_mat1 = create_buf2D(cfg.rows, cfg.cols1, cfg.row_stride1, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat1);
+  if(cfg.batch_matmul)
+  {
+    /* Batch matmul matrices are contiguous, one rows x cols1 mat1 and one
+     * cols1 x cols2 (or cols2 x cols1 if transposed) mat2 per batch. */
+    p_mat1 = create_buf2D(cfg.batch_matmul*cfg.rows, cfg.cols1, cfg.cols1, cfg.mat_precision, 0);        VALIDATE_PTR(p_mat1);
+    if(cfg.transpose_mat2){
+      p_mat2 = create_buf2D(cfg.batch_matmul*cfg.cols2, cfg.cols1, cfg.cols1, cfg.mat_precision, 0);      VALIDATE_PTR(p_mat2);
+    }
+    else{
+      p_mat2 = create_buf2D(cfg.batch_matmul*cfg.cols1, cfg.cols2, cfg.cols2, cfg.mat_precision, 0);      VALIDATE_PTR(p_mat2);
+    }
+  }
+  else
+  {
+    p_mat1 = create_buf2D(cfg.rows, cfg.cols1, cfg.row_stride1, cfg.mat_precision, cfg.membank_padding);  VALIDATE_PTR(p_mat1);
+    p_mat2 = create_buf2D(cfg.rows, cfg.cols2, cfg.row_stride2, cfg.mat_precision, cfg.membank_padding);  VALIDATE_PTR(p_mat2);
+  }
   p_vec1 = create_buf1D(cfg.cols1*cfg.vec_count, cfg.inp_precision);                                      VALIDATE_PTR(p_vec1);
-  p_mat2 = create_buf2D(cfg.rows, cfg.cols2, cfg.row_stride2, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat2);
   p_vec2 = create_buf1D(cfg.cols2, cfg.inp_precision);                                                    VALIDATE_PTR(p_vec2);
   p_bias = create_buf1D(cfg.rows, cfg.bias_precision);                                                    VALIDATE_PTR(p_bias);
-  p_out = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                                        VALIDATE_PTR(p_out);
+  p_out = create_buf1D(out_length, cfg.out_precision);                                                    VALIDATE_PTR(p_out);
   p_scratch = create_buf1D(scratch_size, 8);                                                              VALIDATE_PTR(p_scratch);
+  if(cfg.plan && cfg.fc == 1)
+  {
+    p_plan = malloc(xa_nn_fully_connected_sym8sxasym8s_asym8s_plan_getsize());                            VALIDATE_PTR(p_plan);
+  }
+
+  // Per row requantization parameters for the per channel kernels
+  cfg.p_out_multiplier = (int *)malloc(cfg.rows*(sizeof(WORD32)));                                       VALIDATE_PTR(cfg.p_out_multiplier);
+  cfg.p_out_shift = (int *)malloc(cfg.rows*(sizeof(WORD32)));                                            VALIDATE_PTR(cfg.p_out_shift);
+  {
+    int itr_r;
+    for(itr_r = 0; itr_r < cfg.rows; itr_r++)
+    {
+      cfg.p_out_multiplier[itr_r] = cfg.out_multiplier;
+      cfg.p_out_shift[itr_r] = cfg.out_shift;
+    }
+  }
 
   if(cfg.inp_precision == cfg.out_precision && (!strcmp(cfg.activation, "sigmoid") || !strcmp(cfg.activation, "tanh"))){
     fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
   }
-  if(cfg.batch == 1){
+  if(cfg.batch_matmul){
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.batch_matmul * cfg.rows * cfg.cols1 * cfg.cols2), "MACs/cyc", 1);
+  }
+  else if(cfg.batch == 1){
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1 * cfg.vec_count), "MACs/cyc", 1);
   }
-  else if(cfg.fc == 1){
+  else if((cfg.fc == 1) || (cfg.block_size != 0) || (cfg.sym4s == 1)){
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1), "MACs/cyc", 1);
   }
   else {
@@ -641,10 +931,33 @@ int xa_nn_main_process(int argc, char *argv[])
   for(frame = 0; frame < cfg.frames; frame++)
   {
     // If write_file enabled, generate random data for input, else read from file
-    load_matXvec_input_data(cfg.write_file, fptr_inp, p_mat1, p_vec1, p_mat2, p_vec2, p_bias);
+    if(cfg.batch_matmul){
+      load_batch_matmul_input_data(cfg.write_file, fptr_inp, p_mat1, p_mat2);
+    }
+    else{
+      load_matXvec_input_data(cfg.write_file, fptr_inp, p_mat1, p_vec1, p_mat2, p_vec2, p_bias);
+    }
 
     // Call the matXvec kernel specified on command line
-    if(cfg.batch == 1){
+    if(cfg.batch_matmul){
+        PROCESS_BATCH_MATMUL;
+    }
+    else if(cfg.block_size != 0 && cfg.fc == 1){
+        PROCESS_MATXVEC_FC_SPARSE;
+    }
+    else if(cfg.block_size != 0){
+        PROCESS_MATXVEC_SPARSE;
+    }
+    else if(cfg.sym4s == 1 && cfg.fc == 1){
+        PROCESS_MATXVEC_FC_SYM4S;
+    }
+    else if(cfg.sym4s == 1 && cfg.batch == 1){
+        PROCESS_MATXVEC_BATCH_SYM4S;
+    }
+    else if(cfg.sym4s == 1){
+        PROCESS_MATXVEC_SYM4S;
+    }
+    else if(cfg.batch == 1){
         PROCESS_MATXVEC_BATCH;
     }
     else if(cfg.fc == 1){
@@ -694,6 +1007,12 @@ int xa_nn_main_process(int argc, char *argv[])
   free_buf1D(p_bias);
   free_buf1D(p_out);
   free_buf1D(p_scratch);
+  free(cfg.p_out_multiplier);
+  free(cfg.p_out_shift);
+  if(p_plan)
+  {
+    free(p_plan);
+  }
 
   if(cfg.verify)
   {
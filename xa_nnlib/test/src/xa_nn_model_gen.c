@@ -0,0 +1,504 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Generates a flat model blob (xa_nnlib_model_api.h) from per layer
+   descriptions and coefficient files.
+
+   Usage: xa_nn_model_gen -o <blob_file> <layer> [<layer> ...]
+   Layers, in execution order:
+     --gru  <in_feats> <out_feats> <mat_prec> <membank_padding> <coeff_Qformat> <io_Qformat> <coef_dir>
+     --lstm <in_feats> <out_feats> <mat_prec> <membank_padding> <coeff_Qformat> <cell_Qformat> <io_Qformat> <coef_dir>
+     --cnn  <param_file> <coef_dir>
+
+   GRU/LSTM coef_dir holds the same per matrix files as the GRU/LSTM
+   testbenches (w_z.bin, u_z.bin, ... / w_xf.bin, w_hf.bin, ...); rows
+   are padded in the blob when membank_padding is 1.
+   CNN param_file holds "<name> <value>" lines using the CNN testbench
+   option names (algo, precision, input_height, ...). CNN coef_dir holds
+   kernel.bin, bias.bin, kernel_point.bin, bias_point.bin and, for
+   sym8sxasym8s, out_multiplier[_point].bin, out_shift[_point].bin,
+   already in the layout the CNN layer expects. */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "xa_type_def.h"
+#include "xa_nnlib_model_api.h"
+
+#ifdef hifi4
+#define XA_PAD_BYTES    8
+#endif
+
+#ifdef hifi5
+#define XA_PAD_BYTES    16
+#endif
+
+#define XA_MAX_FULL_FILE_NAME_LENGTH 280
+#define ALIGN_MODEL(n) (((n) + XA_NNLIB_MODEL_ALIGNMENT - 1) & ~(XA_NNLIB_MODEL_ALIGNMENT - 1))
+
+typedef struct _blob_t
+{
+  char *p_buf;
+  int size;
+  int capacity;
+} blob_t;
+
+typedef struct _layer_desc_t
+{
+  xa_nnlib_net_layer_type_t type;
+  union
+  {
+    xa_nnlib_gru_init_config_t gru;
+    xa_nnlib_lstm_init_config_t lstm;
+    xa_nnlib_cnn_init_config_t cnn;
+  } config;
+  const char *coef_dir;
+} layer_desc_t;
+
+const char *gru_files[XA_NNLIB_MODEL_GRU_N_SECTIONS] =
+{
+  "/w_z.bin", "/u_z.bin", "/w_r.bin", "/u_r.bin", "/w_h.bin", "/u_h.bin",
+  "/b_z.bin", "/b_r.bin", "/b_h.bin"
+};
+
+const char *lstm_files[XA_NNLIB_MODEL_LSTM_N_SECTIONS] =
+{
+  "/w_xf.bin", "/w_hf.bin", "/w_xi.bin", "/w_hi.bin", "/w_xc.bin", "/w_hc.bin", "/w_xo.bin", "/w_ho.bin",
+  "/b_f.bin", "/b_i.bin", "/b_c.bin", "/b_o.bin"
+};
+
+const char *cnn_files[XA_NNLIB_MODEL_CNN_N_SECTIONS] =
+{
+  "/kernel.bin", "/kernel_point.bin", "/bias.bin", "/bias_point.bin",
+  "/out_multiplier.bin", "/out_multiplier_point.bin", "/out_shift.bin", "/out_shift_point.bin"
+};
+
+/* Appends a zeroed, aligned region and returns its offset */
+static int blob_alloc(blob_t *p_blob, int size)
+{
+  int offset = ALIGN_MODEL(p_blob->size);
+
+  if(offset + size > p_blob->capacity)
+  {
+    int capacity = 2 * (offset + size) + 4096;
+    char *p_buf = (char *)realloc(p_blob->p_buf, capacity);
+    if(p_buf == NULL)
+      return -1;
+    memset(p_buf + p_blob->capacity, 0, capacity - p_blob->capacity);
+    p_blob->p_buf = p_buf;
+    p_blob->capacity = capacity;
+  }
+  p_blob->size = offset + size;
+
+  return offset;
+}
+
+static int file_size(const char *dir, const char *name)
+{
+  char fname[XA_MAX_FULL_FILE_NAME_LENGTH];
+  FILE *fptr;
+  int size;
+
+  snprintf(fname, sizeof(fname), "%s%s", dir, name);
+  fptr = fopen(fname, "rb");
+  if(fptr == NULL)
+    return -1;
+  fseek(fptr, 0, SEEK_END);
+  size = (int)ftell(fptr);
+  fclose(fptr);
+
+  return size;
+}
+
+/* Reads rows x cols elements into the blob, rows are padded to cols + pad */
+static int read_section(blob_t *p_blob, int offset, const char *dir, const char *name, int rows, int cols, int pad, int bytes)
+{
+  char fname[XA_MAX_FULL_FILE_NAME_LENGTH];
+  FILE *fptr;
+  int i;
+
+  snprintf(fname, sizeof(fname), "%s%s", dir, name);
+  fptr = fopen(fname, "rb");
+  if(fptr == NULL)
+  {
+    printf("Error opening %s\n", fname);
+    return -1;
+  }
+  for(i = 0; i < rows; i++)
+  {
+    if(fread(p_blob->p_buf + offset + i * (cols + pad) * bytes, bytes, cols, fptr) != (size_t)cols)
+    {
+      printf("File %s has insufficent data\n", fname);
+      fclose(fptr);
+      return -1;
+    }
+  }
+  fclose(fptr);
+
+  return 0;
+}
+
+static int add_rnn_sections(blob_t *p_blob, int tbl_offset, const char *dir, const char **files,
+                            int n_sections, int n_mat, int in_feats, int out_feats, int pad, int coeff_bytes)
+{
+  int i, offset, rows, cols, bytes;
+
+  for(i = 0; i < n_sections; i++)
+  {
+    xa_nnlib_model_layer_t *p_tbl;
+
+    /* Input and recurrent matrices alternate, followed by 16 bit biases */
+    rows  = (i < n_mat) ? out_feats : 1;
+    cols  = (i >= n_mat) ? out_feats : ((i & 1) ? out_feats : in_feats);
+    bytes = (i < n_mat) ? coeff_bytes : (int)sizeof(coeff_t);
+    if(i >= n_mat) pad = 0;
+
+    offset = blob_alloc(p_blob, rows * (cols + pad) * bytes);
+    if(offset < 0 || read_section(p_blob, offset, dir, files[i], rows, cols, pad, bytes))
+      return -1;
+
+    p_tbl = (xa_nnlib_model_layer_t *)(p_blob->p_buf + tbl_offset);
+    p_tbl->section_offset[i] = offset;
+    p_tbl->section_size[i]   = rows * (cols + pad) * bytes;
+  }
+
+  return 0;
+}
+
+static int add_cnn_sections(blob_t *p_blob, int tbl_offset, const char *dir)
+{
+  int i, offset, size;
+
+  for(i = 0; i < XA_NNLIB_MODEL_CNN_N_SECTIONS; i++)
+  {
+    xa_nnlib_model_layer_t *p_tbl;
+
+    /* Absent files are unused sections */
+    size = file_size(dir, cnn_files[i]);
+    if(size <= 0)
+      continue;
+
+    offset = blob_alloc(p_blob, size);
+    if(offset < 0 || read_section(p_blob, offset, dir, cnn_files[i], 1, size, 0, 1))
+      return -1;
+
+    p_tbl = (xa_nnlib_model_layer_t *)(p_blob->p_buf + tbl_offset);
+    p_tbl->section_offset[i] = offset;
+    p_tbl->section_size[i]   = size;
+  }
+
+  return 0;
+}
+
+#define FILL_SHAPE_VECTOR(shape, length_shape)                                                              \
+{                                                                                                           \
+  shape.shape_type = SHAPE_VECTOR_T;                                                                        \
+  shape.dim.vector.length = length_shape;                                                                   \
+  shape.n_shapes = 1;                                                                                       \
+  shape.shape_offset = -1;                                                                                  \
+}
+
+#define FILL_SHAPE_MATRIX(shape, rows_shape, cols_shape)                                                    \
+{                                                                                                           \
+  shape.shape_type = SHAPE_MATRIX_T;                                                                        \
+  shape.dim.matrix.rows = rows_shape;                                                                       \
+  shape.dim.matrix.cols = cols_shape;                                                                       \
+  shape.dim.matrix.row_offset = cols_shape;                                                                 \
+  shape.n_shapes = 1;                                                                                       \
+  shape.shape_offset = -1;                                                                                  \
+}
+
+#define FILL_CUBE(shape, nheight, nwidth, ndepth, type, h_off, w_off, d_off)                                \
+{                                                                                                           \
+  shape.shape_type = type;                                                                                  \
+  shape.dim.cube.height = nheight;                                                                          \
+  shape.dim.cube.width = nwidth;                                                                            \
+  shape.dim.cube.depth = ndepth;                                                                            \
+  shape.dim.cube.height_offset = h_off;                                                                     \
+  shape.dim.cube.width_offset = w_off;                                                                      \
+  shape.dim.cube.depth_offset = d_off;                                                                      \
+  shape.n_shapes = 1;                                                                                       \
+  shape.shape_offset = -1;                                                                                  \
+}
+
+/* Fills the CNN init config from a "<name> <value>" file, shapes follow
+   the CNN testbench conventions */
+static int parse_cnn_params(const char *param_file, xa_nnlib_cnn_init_config_t *cfg)
+{
+  int ih = 0, iw = 0, ic = 0, kh = 0, kw = 0, oc = 0, mult = 1;
+  char name[64], value[64];
+  FILE *fptr;
+
+  fptr = fopen(param_file, "r");
+  if(fptr == NULL)
+  {
+    printf("Error opening %s\n", param_file);
+    return -1;
+  }
+
+  memset(cfg, 0, sizeof(xa_nnlib_cnn_init_config_t));
+  cfg->algo = XA_NNLIB_CNN_CONV2D_STD;
+  cfg->precision = XA_NNLIB_CNN_8bx16b;
+
+  while(fscanf(fptr, "%63s %63s", name, value) == 2)
+  {
+    int v = atoi(value);
+
+    if     (!strcmp(name, "algo"))
+      cfg->algo = !strcmp(value, "conv1d_std") ? XA_NNLIB_CNN_CONV1D_STD :
+                  !strcmp(value, "conv2d_depth") ? XA_NNLIB_CNN_CONV2D_DS : XA_NNLIB_CNN_CONV2D_STD;
+    else if(!strcmp(name, "precision"))
+      cfg->precision = !strcmp(value, "16x16") ? XA_NNLIB_CNN_16bx16b :
+                       !strcmp(value, "8x8") ? XA_NNLIB_CNN_8bx8b :
+                       !strcmp(value, "f32") ? XA_NNLIB_CNN_f32xf32 :
+                       !strcmp(value, "sym8sxasym8s") ? XA_NNLIB_CNN_SYM8SxASYM8S : XA_NNLIB_CNN_8bx16b;
+    else if(!strcmp(name, "input_height"))           ih = v;
+    else if(!strcmp(name, "input_width"))            iw = v;
+    else if(!strcmp(name, "input_channels"))         ic = v;
+    else if(!strcmp(name, "kernel_height"))          kh = v;
+    else if(!strcmp(name, "kernel_width"))           kw = v;
+    else if(!strcmp(name, "out_channels"))           oc = v;
+    else if(!strcmp(name, "channels_multiplier"))    mult = v;
+    else if(!strcmp(name, "x_stride"))               cfg->x_stride = v;
+    else if(!strcmp(name, "y_stride"))               cfg->y_stride = v;
+    else if(!strcmp(name, "x_padding"))              cfg->x_padding = v;
+    else if(!strcmp(name, "y_padding"))              cfg->y_padding = v;
+    else if(!strcmp(name, "out_height"))             cfg->output_height = v;
+    else if(!strcmp(name, "out_width"))              cfg->output_width = v;
+    else if(!strcmp(name, "bias_shift"))             cfg->bias_shift = v;
+    else if(!strcmp(name, "acc_shift"))              cfg->acc_shift = v;
+    else if(!strcmp(name, "out_data_format"))        cfg->output_format = v;
+    else if(!strcmp(name, "input_zero_bias"))        cfg->input_zero_bias = v;
+    else if(!strcmp(name, "out_zero_bias"))          cfg->out_zero_bias = v;
+    else if(!strcmp(name, "ds_depth_out_zero_bias")) cfg->ds_depth_out_zero_bias = v;
+    else
+    {
+      printf("Unknown CNN parameter %s\n", name);
+      fclose(fptr);
+      return -1;
+    }
+  }
+  fclose(fptr);
+
+  cfg->output_channels = oc;
+  cfg->channels_multiplier = mult;
+
+  if(cfg->algo == XA_NNLIB_CNN_CONV2D_DS)
+  {
+    int kw_pad = (cfg->precision == XA_NNLIB_CNN_SYM8SxASYM8S) ? kw : ((kw + 3) & ~3);
+
+    FILL_CUBE(cfg->input_shape, ih, iw, ic, SHAPE_CUBE_WHD_T, iw, 1, iw*ih)
+    FILL_CUBE(cfg->kernel_ds_depth_shape, kh, kw, ic*mult, SHAPE_CUBE_WHD_T, kw_pad, 1, kw_pad*kh)
+    FILL_SHAPE_VECTOR(cfg->bias_ds_depth_shape, ic*mult)
+    FILL_SHAPE_MATRIX(cfg->kernel_ds_point_shape, oc, ic*mult)
+    FILL_SHAPE_VECTOR(cfg->bias_ds_point_shape, oc)
+  }
+  else
+  {
+    int align = (cfg->precision == XA_NNLIB_CNN_f32xf32) ? 2 : 4;
+
+    FILL_CUBE(cfg->input_shape, ih, iw, ic, SHAPE_CUBE_DWH_T, ic*iw, ic, 1)
+    if(cfg->algo == XA_NNLIB_CNN_CONV1D_STD)
+    {
+      int ic_iw_pad = (ic*iw + align - 1) & ~(align - 1);
+      cfg->output_width = 1;
+      FILL_CUBE(cfg->kernel_std_shape, kh, iw, ic, SHAPE_CUBE_DWH_T, ic_iw_pad, ic, 1)
+    }
+    else
+    {
+      int ic_pad = (cfg->precision == XA_NNLIB_CNN_SYM8SxASYM8S) ? ic : ((ic + align - 1) & ~(align - 1));
+      FILL_CUBE(cfg->kernel_std_shape, kh, kw, ic, SHAPE_CUBE_DWH_T, ic_pad*kw, ic_pad, 1)
+    }
+    FILL_SHAPE_VECTOR(cfg->bias_std_shape, oc)
+  }
+
+  return 0;
+}
+
+static void show_usage(void)
+{
+  printf("Usage: xa_nn_model_gen -o <blob_file> <layer> [<layer> ...]\n");
+  printf("\t--gru  <in_feats> <out_feats> <mat_prec 8|16> <membank_padding 0|1> <coeff_Qformat> <io_Qformat> <coef_dir>\n");
+  printf("\t--lstm <in_feats> <out_feats> <mat_prec 8|16> <membank_padding 0|1> <coeff_Qformat> <cell_Qformat> <io_Qformat> <coef_dir>\n");
+  printf("\t--cnn  <param_file> <coef_dir>\n");
+}
+
+int main(int argc, char *argv[])
+{
+  layer_desc_t layers[XA_NNLIB_NET_MAX_LAYERS];
+  xa_nnlib_model_header_t *p_hdr;
+  const char *out_file = NULL;
+  blob_t blob;
+  FILE *fptr;
+  int n_layers = 0, tbl_offset, i, ret = 0;
+
+  memset(layers, 0, sizeof(layers));
+
+  for(i = 1; i < argc; i++)
+  {
+    layer_desc_t *p_layer = &layers[n_layers];
+
+    if(!strcmp(argv[i], "-o") && i + 1 < argc)
+    {
+      out_file = argv[++i];
+      continue;
+    }
+    if(n_layers == XA_NNLIB_NET_MAX_LAYERS)
+    {
+      printf("Too many layers, max %d\n", XA_NNLIB_NET_MAX_LAYERS);
+      return -1;
+    }
+    if(!strcmp(argv[i], "--gru") && i + 7 < argc)
+    {
+      p_layer->type = XA_NNLIB_NET_LAYER_GRU;
+      p_layer->config.gru.in_feats      = atoi(argv[i+1]);
+      p_layer->config.gru.out_feats     = atoi(argv[i+2]);
+      p_layer->config.gru.mat_prec      = atoi(argv[i+3]);
+      p_layer->config.gru.vec_prec      = 16;
+      p_layer->config.gru.precision     = (p_layer->config.gru.mat_prec == 8) ? XA_NNLIB_GRU_8bx16b : XA_NNLIB_GRU_16bx16b;
+      p_layer->config.gru.pad           = atoi(argv[i+4]);
+      p_layer->config.gru.coeff_Qformat = atoi(argv[i+5]);
+      p_layer->config.gru.io_Qformat    = atoi(argv[i+6]);
+      p_layer->coef_dir = argv[i+7];
+      i += 7;
+    }
+    else if(!strcmp(argv[i], "--lstm") && i + 8 < argc)
+    {
+      p_layer->type = XA_NNLIB_NET_LAYER_LSTM;
+      p_layer->config.lstm.in_feats      = atoi(argv[i+1]);
+      p_layer->config.lstm.out_feats     = atoi(argv[i+2]);
+      p_layer->config.lstm.mat_prec      = atoi(argv[i+3]);
+      p_layer->config.lstm.vec_prec      = 16;
+      p_layer->config.lstm.precision     = (p_layer->config.lstm.mat_prec == 8) ? XA_NNLIB_LSTM_8bx16b : XA_NNLIB_LSTM_16bx16b;
+      p_layer->config.lstm.pad           = atoi(argv[i+4]);
+      p_layer->config.lstm.coeff_Qformat = atoi(argv[i+5]);
+      p_layer->config.lstm.cell_Qformat  = atoi(argv[i+6]);
+      p_layer->config.lstm.io_Qformat    = atoi(argv[i+7]);
+      p_layer->coef_dir = argv[i+8];
+      i += 8;
+    }
+    else if(!strcmp(argv[i], "--cnn") && i + 2 < argc)
+    {
+      p_layer->type = XA_NNLIB_NET_LAYER_CNN;
+      if(parse_cnn_params(argv[i+1], &p_layer->config.cnn))
+        return -1;
+      p_layer->coef_dir = argv[i+2];
+      i += 2;
+    }
+    else
+    {
+      show_usage();
+      return -1;
+    }
+    n_layers++;
+  }
+
+  if(out_file == NULL || n_layers == 0)
+  {
+    show_usage();
+    return -1;
+  }
+
+  memset(&blob, 0, sizeof(blob));
+  if(blob_alloc(&blob, sizeof(xa_nnlib_model_header_t)) < 0)
+    return -1;
+  tbl_offset = blob_alloc(&blob, n_layers * sizeof(xa_nnlib_model_layer_t));
+  if(tbl_offset < 0)
+    return -1;
+
+  for(i = 0; i < n_layers && ret == 0; i++)
+  {
+    layer_desc_t *p_layer = &layers[i];
+    int layer_tbl_offset = tbl_offset + i * sizeof(xa_nnlib_model_layer_t);
+    int config_size, config_offset;
+    xa_nnlib_model_layer_t *p_tbl;
+
+    config_size = (p_layer->type == XA_NNLIB_NET_LAYER_GRU)  ? sizeof(xa_nnlib_gru_init_config_t) :
+                  (p_layer->type == XA_NNLIB_NET_LAYER_LSTM) ? sizeof(xa_nnlib_lstm_init_config_t) :
+                                                               sizeof(xa_nnlib_cnn_init_config_t);
+    config_offset = blob_alloc(&blob, config_size);
+    if(config_offset < 0)
+      return -1;
+    memcpy(blob.p_buf + config_offset, &p_layer->config, config_size);
+
+    p_tbl = (xa_nnlib_model_layer_t *)(blob.p_buf + layer_tbl_offset);
+    p_tbl->type          = p_layer->type;
+    p_tbl->config_offset = config_offset;
+    p_tbl->config_size   = config_size;
+
+    if(p_layer->type == XA_NNLIB_NET_LAYER_GRU)
+    {
+      xa_nnlib_gru_init_config_t *cfg = &p_layer->config.gru;
+      ret = add_rnn_sections(&blob, layer_tbl_offset, p_layer->coef_dir, gru_files,
+                             XA_NNLIB_MODEL_GRU_N_SECTIONS, XA_NNLIB_MODEL_GRU_B_Z,
+                             cfg->in_feats, cfg->out_feats, cfg->pad * XA_PAD_BYTES,
+                             (cfg->precision == XA_NNLIB_GRU_16bx16b) ? sizeof(coeff_t) : sizeof(coeff8_t));
+    }
+    else if(p_layer->type == XA_NNLIB_NET_LAYER_LSTM)
+    {
+      xa_nnlib_lstm_init_config_t *cfg = &p_layer->config.lstm;
+      ret = add_rnn_sections(&blob, layer_tbl_offset, p_layer->coef_dir, lstm_files,
+                             XA_NNLIB_MODEL_LSTM_N_SECTIONS, XA_NNLIB_MODEL_LSTM_B_F,
+                             cfg->in_feats, cfg->out_feats, cfg->pad * XA_PAD_BYTES,
+                             (cfg->precision == XA_NNLIB_LSTM_16bx16b) ? sizeof(coeff_t) : sizeof(coeff8_t));
+    }
+    else
+    {
+      ret = add_cnn_sections(&blob, layer_tbl_offset, p_layer->coef_dir);
+    }
+  }
+  if(ret)
+  {
+    free(blob.p_buf);
+    return -1;
+  }
+
+  blob.size = ALIGN_MODEL(blob.size);
+  p_hdr = (xa_nnlib_model_header_t *)blob.p_buf;
+  p_hdr->magic              = XA_NNLIB_MODEL_MAGIC;
+  p_hdr->version            = XA_NNLIB_MODEL_VERSION;
+  p_hdr->blob_size          = blob.size;
+  p_hdr->n_layers           = n_layers;
+  p_hdr->layer_table_offset = tbl_offset;
+
+  /* Load check with the library loader */
+  ret = xa_nnlib_model_get_scratch_fast(blob.p_buf, blob.size);
+  if(ret < 0)
+  {
+    printf("Model check failed: 0x%x\n", ret);
+    free(blob.p_buf);
+    return -1;
+  }
+  printf("%d layers, blob %d bytes, persistent %d bytes, scratch %d bytes\n",
+         n_layers, blob.size, xa_nnlib_model_get_persistent_fast(blob.p_buf, blob.size), ret);
+
+  fptr = fopen(out_file, "wb");
+  if(fptr == NULL)
+  {
+    printf("Error opening %s for writing\n", out_file);
+    free(blob.p_buf);
+    return -1;
+  }
+  fwrite(blob.p_buf, 1, blob.size, fptr);
+  fclose(fptr);
+  free(blob.p_buf);
+
+  return 0;
+}
@@ -0,0 +1,1200 @@
+/*******************************************************************************
+* Copyright (c) 2018-2021 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "nnlib/xa_nnlib_net_api.h"
+#include "nnlib/xa_nnlib_model_api.h"
+#include "xt_manage_buffers.h"
+#include "cmdline_parser.h"
+#include "file_io.h"
+#include "xa_nnlib_standards.h"
+
+#define PROF_ALLOCATE
+#include "xt_profiler.h"
+
+#define XA_MAX_CMD_LINE_LENGTH 200
+#define XA_MAX_ARGS 100
+#define PARAMFILE "paramfilesimple_net.txt"
+
+/* One or two CNN layers followed by GRU layers */
+#define MAX_CNN_LAYERS 2
+#define MAX_GRU_LAYERS (XA_NNLIB_NET_MAX_LAYERS - 1)
+
+/* Bytes after net persistent and scratch memory that must stay untouched */
+#define GUARD_BYTES 64
+#define GUARD_VAL   0xA5
+
+#define ALIGN_SIZE(n) (((n)+15)&(~15))
+
+#define VALIDATE_PTR(ptr) if(NULL == ptr) { printf("%s: allocation failed\n", #ptr); return -1;}
+
+#define PRINT_VAR(var)  // printf("%d: %s = %d\n", __LINE__, #var, (int) var); fflush(stdout); fflush(stderr);
+#define PRINT_PTR(ptr)  // printf("%d: %s = %p\n", __LINE__, #ptr, (void *) ptr); fflush(stdout); fflush(stderr);
+
+#define FILL_IO_SHAPE_CUBE_DWH(shape, nheight, nwidth, ndepth)   \
+{                                                                 \
+  shape.shape_type = SHAPE_CUBE_DWH_T;                            \
+  shape.dim.cube.height = nheight;                                \
+  shape.dim.cube.width = nwidth;                                  \
+  shape.dim.cube.depth = ndepth;                                  \
+  shape.dim.cube.depth_offset = 1;                                \
+  shape.dim.cube.height_offset = ndepth*nwidth;                   \
+  shape.dim.cube.width_offset = ndepth;                           \
+  shape.n_shapes = 1;                                             \
+  shape.shape_offset = -1;                                        \
+}
+
+#define FILL_KERNEL_SHAPE_CUBE_DWH(shape, nheight, nwidth, ndepth, ndepth_pad, nshapes)  \
+{                                                                                         \
+  shape.shape_type = SHAPE_CUBE_DWH_T;                                                    \
+  shape.dim.cube.height = nheight;                                                        \
+  shape.dim.cube.width = nwidth;                                                          \
+  shape.dim.cube.depth = ndepth;                                                          \
+  shape.dim.cube.depth_offset = 1;                                                        \
+  shape.dim.cube.height_offset = (ndepth_pad)*nwidth;                                     \
+  shape.dim.cube.width_offset = ndepth_pad;                                               \
+  shape.n_shapes = nshapes;                                                               \
+  shape.shape_offset = (ndepth_pad)*nwidth*nheight;                                       \
+}
+
+#define FILL_SHAPE_MATRIX(shape, rows_shape, cols_shape)  \
+{                                                         \
+  shape.shape_type = SHAPE_MATRIX_T;                      \
+  shape.dim.matrix.rows = rows_shape;                     \
+  shape.dim.matrix.cols = cols_shape;                     \
+  shape.dim.matrix.row_offset = cols_shape;               \
+  shape.n_shapes = 1;                                     \
+  shape.shape_offset = -1;                                \
+}
+
+#define FILL_SHAPE_VECTOR(shape, length_shape)  \
+{                                               \
+  shape.shape_type = SHAPE_VECTOR_T;            \
+  shape.dim.vector.length = length_shape;       \
+  shape.n_shapes = 1;                           \
+  shape.shape_offset = -1;                      \
+}
+
+char pb_input_file_path[XA_MAX_CMD_LINE_LENGTH] = "";
+char pb_output_file_path[XA_MAX_CMD_LINE_LENGTH] = "";
+char pb_ref_file_path[XA_MAX_CMD_LINE_LENGTH] = "";
+
+typedef struct _test_config_t
+{
+
+  int help;
+  int input_height;
+  int input_width;
+  int input_channels;
+  int kernel_height;
+  int kernel_width;
+  int out_channels;
+  int x_stride;
+  int y_stride;
+  int x_padding;
+  int y_padding;
+  int out_height;
+  int out_width;
+  int bias_shift;
+  int acc_shift;
+  int cnn_kernel_precision;
+  int cnn_layers;
+  int gru_mat_prec;
+  int gru_layers;
+  int gru_out_feats[MAX_GRU_LAYERS];
+  char gru_out_feats_str[XA_MAX_CMD_LINE_LENGTH];
+  int frames;
+  char write_out_file_name[XA_MAX_CMD_LINE_LENGTH];
+  char write_coef_dir[XA_MAX_CMD_LINE_LENGTH];
+  char read_model_file_name[XA_MAX_CMD_LINE_LENGTH];
+  int verify;
+}test_config_t;
+
+/* GRU weights and biases of one layer, shared by the network and the
+   layer by layer run */
+typedef struct _gru_coeffs_t
+{
+  buf1D_t *p_weights[6];
+  buf1D_t *p_biases[3];
+  xa_nnlib_gru_weights_t weights;
+  xa_nnlib_gru_biases_t biases;
+}gru_coeffs_t;
+
+int default_config(test_config_t *p_cfg)
+{
+  if(p_cfg)
+  {
+
+    p_cfg->help     = 0;
+    p_cfg->input_height = 4;
+    p_cfg->input_width = 4;
+    p_cfg->input_channels = 4;
+    p_cfg->kernel_height = 3;
+    p_cfg->kernel_width = 3;
+    p_cfg->out_channels = 4;
+    p_cfg->x_stride = 1;
+    p_cfg->y_stride = 1;
+    p_cfg->x_padding = 1;
+    p_cfg->y_padding = 1;
+    p_cfg->out_height = 4;
+    p_cfg->out_width = 4;
+    p_cfg->bias_shift = 0;
+    p_cfg->acc_shift = -11;
+    p_cfg->cnn_kernel_precision = 8;
+    p_cfg->cnn_layers = 1;
+    p_cfg->gru_mat_prec = 16;
+    p_cfg->gru_layers = 0;
+    strcpy(p_cfg->gru_out_feats_str, "32");
+    p_cfg->frames   = 3;
+    p_cfg->write_out_file_name[0] = '\0';
+    p_cfg->write_coef_dir[0] = '\0';
+    p_cfg->read_model_file_name[0] = '\0';
+    p_cfg->verify = 1;
+
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+
+void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      //err_code = 0;
+      printf("Invalid argument: %s at index %d\n",argv[argidx], argidx);
+      exit(1);
+    }
+    ARGTYPE_INDICATE("--help", p_cfg->help);
+    ARGTYPE_INDICATE("-help", p_cfg->help);
+    ARGTYPE_INDICATE("-h", p_cfg->help);
+    ARGTYPE_ONETIME_CONFIG("-input_height",p_cfg->input_height);
+    ARGTYPE_ONETIME_CONFIG("-input_width",p_cfg->input_width);
+    ARGTYPE_ONETIME_CONFIG("-input_channels",p_cfg->input_channels);
+    ARGTYPE_ONETIME_CONFIG("-kernel_height",p_cfg->kernel_height);
+    ARGTYPE_ONETIME_CONFIG("-kernel_width",p_cfg->kernel_width);
+    ARGTYPE_ONETIME_CONFIG("-out_channels",p_cfg->out_channels);
+    ARGTYPE_ONETIME_CONFIG("-x_stride",p_cfg->x_stride);
+    ARGTYPE_ONETIME_CONFIG("-y_stride",p_cfg->y_stride);
+    ARGTYPE_ONETIME_CONFIG("-x_padding",p_cfg->x_padding);
+    ARGTYPE_ONETIME_CONFIG("-y_padding",p_cfg->y_padding);
+    ARGTYPE_ONETIME_CONFIG("-out_height",p_cfg->out_height);
+    ARGTYPE_ONETIME_CONFIG("-out_width",p_cfg->out_width);
+    ARGTYPE_ONETIME_CONFIG("-bias_shift",p_cfg->bias_shift);
+    ARGTYPE_ONETIME_CONFIG("-acc_shift",p_cfg->acc_shift);
+    ARGTYPE_ONETIME_CONFIG("-cnn_kernel_precision",p_cfg->cnn_kernel_precision);
+    ARGTYPE_ONETIME_CONFIG("-cnn_layers",p_cfg->cnn_layers);
+    ARGTYPE_ONETIME_CONFIG("-gru_mat_prec",p_cfg->gru_mat_prec);
+    ARGTYPE_STRING("-gru_out_feats",p_cfg->gru_out_feats_str, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
+    ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_STRING("-write_coef_dir",p_cfg->write_coef_dir, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_STRING("-read_model_file_name",p_cfg->read_model_file_name, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    exit(1);
+  }
+}
+
+/* -gru_out_feats is a comma separated list, one entry per GRU layer */
+int parse_gru_out_feats(test_config_t *p_cfg)
+{
+  char feats_str[XA_MAX_CMD_LINE_LENGTH];
+  char *token;
+
+  strcpy(feats_str, p_cfg->gru_out_feats_str);
+  p_cfg->gru_layers = 0;
+  token = strtok(feats_str, ",");
+  while(token != NULL)
+  {
+    if(p_cfg->gru_layers == MAX_GRU_LAYERS)
+      return -1;
+    p_cfg->gru_out_feats[p_cfg->gru_layers++] = atoi(token);
+    token = strtok(NULL, ",");
+  }
+  return (p_cfg->gru_layers > 0) ? 0 : -1;
+}
+
+void show_usage(void)
+{
+    printf ("Usage xt-run <binary> [Options]\n");
+    printf("\t-input_height: input height; Default=4\n");
+    printf("\t-input_width: input width; Default=4\n");
+    printf("\t-input_channels: input channels; Default=4\n");
+    printf("\t-kernel_height: kernel height; Default=3\n");
+    printf("\t-kernel_width: kernel width; Default=3\n");
+    printf("\t-out_channels: output channels; Default=4\n");
+    printf("\t-x_stride: stride in width dimension; Default=1\n");
+    printf("\t-y_stride: stride in height dimension; Default=1\n");
+    printf("\t-x_padding: left padding in width dimension; Default=1\n");
+    printf("\t-y_padding: top padding in height dimension; Default=1\n");
+    printf("\t-out_height: output height; Default=4\n");
+    printf("\t-out_width: output width; Default=4\n");
+    printf("\t-bias_shift: CNN bias left shift; Default=0\n");
+    printf("\t-acc_shift: CNN accumulator left shift; Default=-11\n");
+    printf("\t-cnn_kernel_precision: CNN kernel precision, 8 or 16 with 16 bit I/O; Default=8\n");
+    printf("\t-cnn_layers: 1 or 2, the second CNN layer keeps the output shape of the first one; Default=1\n");
+    printf("\t-gru_mat_prec: GRU weight precision, 8 or 16; Default=16\n");
+    printf("\t-gru_out_feats: comma separated output features of the GRU layers, one GRU layer per entry; Default=32\n");
+    printf("\t-frames: Positive number; Default=3\n");
+    printf("\t-write_out_file_name: Full filename for writing output \n");
+    printf("\t-write_coef_dir: Directory to write the coefficients to, one l<layer> subdirectory per layer in xa_nn_model_gen format \n");
+    printf("\t-read_model_file_name: Model blob generated by xa_nn_model_gen from -write_coef_dir, run instead of the network set up layer by layer \n");
+    printf("\t-verify: Verify network output against the layers run one by one; 0: Disable, 1: Bitexact match; Default=1\n");
+}
+
+/* Random data scaled down by rshift, keeps the GRU gates out of saturation */
+static void set_rand_inp_buf1D_scaled(buf1D_t *p_buf, int rshift)
+{
+  int i;
+
+  set_rand_inp_buf1D(p_buf);
+  if(p_buf->precision == 8)
+  {
+    WORD8 *p = (WORD8 *)p_buf->p;
+    for(i = 0; i < p_buf->length; i++)
+      p[i] >>= rshift;
+  }
+  else
+  {
+    WORD16 *p = (WORD16 *)p_buf->p;
+    for(i = 0; i < p_buf->length; i++)
+      p[i] >>= rshift;
+  }
+}
+
+static int setup_gru_coeffs(gru_coeffs_t *p_coeffs, xa_nnlib_gru_init_config_t *p_gru_cfg)
+{
+  int i;
+  int cols;
+
+  for(i = 0; i < 6; i++)
+  {
+    /* w_z, u_z, w_r, u_r, w_h, u_h */
+    cols = (i & 1) ? p_gru_cfg->out_feats : p_gru_cfg->in_feats;
+    p_coeffs->p_weights[i] = create_buf1D(p_gru_cfg->out_feats * cols, p_gru_cfg->mat_prec); VALIDATE_PTR(p_coeffs->p_weights[i]);
+    set_rand_inp_buf1D_scaled(p_coeffs->p_weights[i], (p_gru_cfg->mat_prec == 8) ? 1 : 2);
+  }
+  for(i = 0; i < 3; i++)
+  {
+    p_coeffs->p_biases[i] = create_buf1D(p_gru_cfg->out_feats, 16); VALIDATE_PTR(p_coeffs->p_biases[i]);
+    set_rand_inp_buf1D_scaled(p_coeffs->p_biases[i], 2 + 15 - p_gru_cfg->coeff_Qformat);
+  }
+
+  /* weights8 and weights16 have the same layout */
+  p_coeffs->weights.weights16.w_z = (coeff_t *)p_coeffs->p_weights[0]->p;
+  FILL_SHAPE_MATRIX(p_coeffs->weights.weights16.shape_w_z, p_gru_cfg->out_feats, p_gru_cfg->in_feats)
+  p_coeffs->weights.weights16.u_z = (coeff_t *)p_coeffs->p_weights[1]->p;
+  FILL_SHAPE_MATRIX(p_coeffs->weights.weights16.shape_u_z, p_gru_cfg->out_feats, p_gru_cfg->out_feats)
+  p_coeffs->weights.weights16.w_r = (coeff_t *)p_coeffs->p_weights[2]->p;
+  FILL_SHAPE_MATRIX(p_coeffs->weights.weights16.shape_w_r, p_gru_cfg->out_feats, p_gru_cfg->in_feats)
+  p_coeffs->weights.weights16.u_r = (coeff_t *)p_coeffs->p_weights[3]->p;
+  FILL_SHAPE_MATRIX(p_coeffs->weights.weights16.shape_u_r, p_gru_cfg->out_feats, p_gru_cfg->out_feats)
+  p_coeffs->weights.weights16.w_h = (coeff_t *)p_coeffs->p_weights[4]->p;
+  FILL_SHAPE_MATRIX(p_coeffs->weights.weights16.shape_w_h, p_gru_cfg->out_feats, p_gru_cfg->in_feats)
+  p_coeffs->weights.weights16.u_h = (coeff_t *)p_coeffs->p_weights[5]->p;
+  FILL_SHAPE_MATRIX(p_coeffs->weights.weights16.shape_u_h, p_gru_cfg->out_feats, p_gru_cfg->out_feats)
+
+  p_coeffs->biases.b_z = (coeff_t *)p_coeffs->p_biases[0]->p;
+  FILL_SHAPE_VECTOR(p_coeffs->biases.shape_b_z, p_gru_cfg->out_feats)
+  p_coeffs->biases.b_r = (coeff_t *)p_coeffs->p_biases[1]->p;
+  FILL_SHAPE_VECTOR(p_coeffs->biases.shape_b_r, p_gru_cfg->out_feats)
+  p_coeffs->biases.b_h = (coeff_t *)p_coeffs->p_biases[2]->p;
+  FILL_SHAPE_VECTOR(p_coeffs->biases.shape_b_h, p_gru_cfg->out_feats)
+
+  return 0;
+}
+
+static void free_gru_coeffs(gru_coeffs_t *p_coeffs)
+{
+  int i;
+
+  for(i = 0; i < 6; i++)
+    free_buf1D(p_coeffs->p_weights[i]);
+  for(i = 0; i < 3; i++)
+    free_buf1D(p_coeffs->p_biases[i]);
+}
+
+static int check_guard(char *p_buf, int size)
+{
+  int i;
+
+  for(i = 0; i < GUARD_BYTES; i++)
+  {
+    if((unsigned char)p_buf[size + i] != GUARD_VAL)
+      return -1;
+  }
+  return 0;
+}
+
+/* Network configurations the net API must reject or accept, independent of
+   the tested chain: layer count limits and a broken chain */
+static int check_net_config_errors(xa_nnlib_cnn_init_config_t *p_cnn_cfg, xa_nnlib_gru_init_config_t *p_gru_cfg)
+{
+  xa_nnlib_net_layer_config_t layers[XA_NNLIB_NET_MAX_LAYERS + 1];
+  xa_nnlib_net_init_config_t net_cfg;
+  xa_nnlib_gru_init_config_t square_gru_cfg;
+  xa_nnlib_gru_init_config_t mismatch_gru_cfg;
+  int i, ret;
+  int fail = 0;
+
+  square_gru_cfg = *p_gru_cfg;
+  square_gru_cfg.in_feats = square_gru_cfg.out_feats;
+  for(i = 0; i < XA_NNLIB_NET_MAX_LAYERS + 1; i++)
+  {
+    layers[i].type = XA_NNLIB_NET_LAYER_GRU;
+    layers[i].p_config = &square_gru_cfg;
+  }
+  net_cfg.p_layers = layers;
+
+  net_cfg.n_layers = XA_NNLIB_NET_MAX_LAYERS;
+  ret = xa_nnlib_net_get_persistent_fast(&net_cfg);
+  if(ret <= 0)
+  {
+    fprintf(stderr, "%d layers not accepted, error code: 0x%x \n", XA_NNLIB_NET_MAX_LAYERS, ret);
+    fail = 1;
+  }
+
+  net_cfg.n_layers = XA_NNLIB_NET_MAX_LAYERS + 1;
+  ret = xa_nnlib_net_get_persistent_fast(&net_cfg);
+  if(XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS != ret)
+  {
+    fprintf(stderr, "%d layers not rejected, error code: 0x%x \n", XA_NNLIB_NET_MAX_LAYERS + 1, ret);
+    fail = 1;
+  }
+  ret = xa_nnlib_net_get_scratch_fast(&net_cfg);
+  if(XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS != ret)
+  {
+    fprintf(stderr, "%d layers not rejected, error code: 0x%x \n", XA_NNLIB_NET_MAX_LAYERS + 1, ret);
+    fail = 1;
+  }
+
+  net_cfg.n_layers = 0;
+  ret = xa_nnlib_net_get_persistent_fast(&net_cfg);
+  if(XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS != ret)
+  {
+    fprintf(stderr, "0 layers not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  /* GRU input one step longer than the CNN output */
+  mismatch_gru_cfg = *p_gru_cfg;
+  mismatch_gru_cfg.in_feats = p_cnn_cfg->output_height * p_cnn_cfg->output_width * p_cnn_cfg->output_channels + 4;
+  layers[0].type = XA_NNLIB_NET_LAYER_CNN;
+  layers[0].p_config = p_cnn_cfg;
+  layers[1].type = XA_NNLIB_NET_LAYER_GRU;
+  layers[1].p_config = &mismatch_gru_cfg;
+  net_cfg.n_layers = 2;
+  ret = xa_nnlib_net_get_scratch_fast(&net_cfg);
+  if(XA_NNLIB_NET_CONFIG_FATAL_LAYER_MISMATCH != ret)
+  {
+    fprintf(stderr, "Mismatched layers not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  return fail;
+}
+
+static int write_coef_file(char *dir, int layer, const char *name, void *p, int size)
+{
+  char file_name[XA_MAX_CMD_LINE_LENGTH + 32];
+  FILE *fptr;
+
+  sprintf(file_name, "%s/l%d/%s", dir, layer, name);
+  fptr = fopen(file_name, "wb");
+  if(fptr == NULL)
+  {
+    printf("Error opening file %s with mode wb\n", file_name);
+    return -1;
+  }
+  fwrite(p, 1, size, fptr);
+  fclose(fptr);
+
+  return 0;
+}
+
+/* Writes the coefficients in the xa_nn_model_gen layout: <dir>/l<layer>/
+   holds params.txt, kernel.bin and bias.bin of a CNN layer or the per
+   matrix files of a GRU layer */
+static int write_model_coefs(char *dir, test_config_t *p_cfg,
+    xa_nnlib_cnn_init_config_t *p_cnn_cfg, buf2D_t **pp_kernel, buf1D_t **pp_bias,
+    gru_coeffs_t *p_gru_coeffs)
+{
+  static const char *gru_files[9] =
+  {
+    "w_z.bin", "u_z.bin", "w_r.bin", "u_r.bin", "w_h.bin", "u_h.bin", "b_z.bin", "b_r.bin", "b_h.bin"
+  };
+  char file_name[XA_MAX_CMD_LINE_LENGTH + 32];
+  FILE *fptr;
+  int i, j, err = 0;
+
+  for(i = 0; i < p_cfg->cnn_layers; i++)
+  {
+    xa_nnlib_cnn_init_config_t *cfg = &p_cnn_cfg[i];
+
+    sprintf(file_name, "%s/l%d/params.txt", dir, i);
+    fptr = fopen(file_name, "w");
+    if(fptr == NULL)
+    {
+      printf("Error opening file %s with mode w\n", file_name);
+      return -1;
+    }
+    fprintf(fptr, "algo conv2d_std\n");
+    fprintf(fptr, "precision %s\n", (cfg->precision == XA_NNLIB_CNN_16bx16b) ? "16x16" : "8x16");
+    fprintf(fptr, "input_height %d\ninput_width %d\ninput_channels %d\n",
+            cfg->input_shape.dim.cube.height, cfg->input_shape.dim.cube.width, cfg->input_shape.dim.cube.depth);
+    fprintf(fptr, "kernel_height %d\nkernel_width %d\nout_channels %d\n",
+            cfg->kernel_std_shape.dim.cube.height, cfg->kernel_std_shape.dim.cube.width, cfg->output_channels);
+    fprintf(fptr, "x_stride %d\ny_stride %d\nx_padding %d\ny_padding %d\n",
+            cfg->x_stride, cfg->y_stride, cfg->x_padding, cfg->y_padding);
+    fprintf(fptr, "out_height %d\nout_width %d\nbias_shift %d\nacc_shift %d\nout_data_format %d\n",
+            cfg->output_height, cfg->output_width, cfg->bias_shift, cfg->acc_shift, cfg->output_format);
+    fclose(fptr);
+
+    err |= write_coef_file(dir, i, "kernel.bin", pp_kernel[i]->p, pp_kernel[i]->rows * pp_kernel[i]->row_offset * pp_kernel[i]->bytes_per_element);
+    err |= write_coef_file(dir, i, "bias.bin", pp_bias[i]->p, pp_bias[i]->length * pp_bias[i]->bytes_per_element);
+  }
+
+  for(i = 0; i < p_cfg->gru_layers; i++)
+  {
+    for(j = 0; j < 9; j++)
+    {
+      buf1D_t *p_buf = (j < 6) ? p_gru_coeffs[i].p_weights[j] : p_gru_coeffs[i].p_biases[j - 6];
+      err |= write_coef_file(dir, p_cfg->cnn_layers + i, gru_files[j], p_buf->p, p_buf->length * p_buf->bytes_per_element);
+    }
+  }
+
+  return err;
+}
+
+/* Reads a model blob into p_mem at a XA_NNLIB_MODEL_ALIGNMENT boundary,
+   p_mem has XA_NNLIB_MODEL_ALIGNMENT bytes more than the blob */
+static char *load_model(char *file_name, void **pp_mem, int *p_size)
+{
+  FILE *fptr;
+  char *p_model;
+  int size;
+
+  fptr = file_open(pb_output_file_path, file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
+  fseek(fptr, 0, SEEK_END);
+  size = (int)ftell(fptr);
+  fseek(fptr, 0, SEEK_SET);
+
+  *pp_mem = malloc(size + XA_NNLIB_MODEL_ALIGNMENT);
+  if(*pp_mem == NULL)
+  {
+    fclose(fptr);
+    return NULL;
+  }
+  p_model = (char *)(((unsigned long)*pp_mem + XA_NNLIB_MODEL_ALIGNMENT - 1) & ~(XA_NNLIB_MODEL_ALIGNMENT - 1));
+  if(fread(p_model, 1, size, fptr) != (size_t)size)
+  {
+    printf("File %s has insufficent data\n", file_name);
+    fclose(fptr);
+    free(*pp_mem);
+    return NULL;
+  }
+  fclose(fptr);
+
+  *p_size = size;
+  return p_model;
+}
+
+/* Truncated blob, misaligned, truncated or out of range sections of the
+   first layer and misaligned blob must all be rejected by the loader */
+static int check_model_errors(char *p_model, int model_size)
+{
+  xa_nnlib_model_layer_t *p_tbl;
+  char *p_mem, *p_copy;
+  int ret;
+  int fail = 0;
+
+  p_mem = (char *)malloc(model_size + 2 * XA_NNLIB_MODEL_ALIGNMENT);
+  if(p_mem == NULL)
+    return -1;
+  p_copy = (char *)(((unsigned long)p_mem + XA_NNLIB_MODEL_ALIGNMENT - 1) & ~(XA_NNLIB_MODEL_ALIGNMENT - 1));
+  p_tbl = (xa_nnlib_model_layer_t *)(p_copy + ((xa_nnlib_model_header_t *)p_model)->layer_table_offset);
+
+  ret = xa_nnlib_model_get_persistent_fast(p_model, model_size - XA_NNLIB_MODEL_ALIGNMENT);
+  if(XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT != ret)
+  {
+    fprintf(stderr, "Truncated model not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  memcpy(p_copy, p_model, model_size);
+  p_tbl->section_offset[0] += 4;
+  ret = xa_nnlib_model_get_persistent_fast(p_copy, model_size);
+  if(XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT != ret)
+  {
+    fprintf(stderr, "Misaligned section not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  memcpy(p_copy, p_model, model_size);
+  p_tbl->section_offset[0] = model_size;
+  ret = xa_nnlib_model_get_persistent_fast(p_copy, model_size);
+  if(XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_LAYOUT != ret)
+  {
+    fprintf(stderr, "Section past the end of model not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  memcpy(p_copy, p_model, model_size);
+  p_tbl->section_size[0] -= 1;
+  ret = xa_nnlib_model_get_scratch_fast(p_copy, model_size);
+  if(XA_NNLIB_MODEL_CONFIG_FATAL_INVALID_SECTION != ret)
+  {
+    fprintf(stderr, "Truncated section not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  memcpy(p_copy + 4, p_model, model_size);
+  ret = xa_nnlib_model_get_scratch_fast(p_copy + 4, model_size);
+  if(XA_NNLIB_FATAL_MEM_ALIGN != ret)
+  {
+    fprintf(stderr, "Misaligned model not rejected, error code: 0x%x \n", ret);
+    fail = 1;
+  }
+
+  free(p_mem);
+
+  return fail;
+}
+
+int xa_nn_main_process(int argc, char *argv[])
+{
+
+  int frame;
+  int i;
+  int err = 0;
+  int pass_count=0;
+  int config_check_fail = 0;
+  char profiler_name[MAX_PROFILER_NAME_LENGTH];
+  char profiler_params[MAX_PROFILER_PARAMS_LENGTH];
+  int inp_size, out_size;
+  int n_layers;
+  int net_persistent_size, net_scratch_size;
+  int max_scratch_size, max_act_size, n_act_bufs;
+  int total_MACs;
+  xa_nnlib_handle_t net_handle;
+  void *p_net_scratch;
+  void *p_model_mem = NULL;
+  char *p_model = NULL;
+  int model_size = 0;
+
+  test_config_t cfg;
+  xa_nnlib_cnn_init_config_t cnn_cfg[MAX_CNN_LAYERS];
+  xa_nnlib_gru_init_config_t gru_cfg[MAX_GRU_LAYERS];
+  xa_nnlib_net_layer_config_t layers[XA_NNLIB_NET_MAX_LAYERS];
+  xa_nnlib_net_init_config_t net_cfg;
+
+  /* Layer by layer run, p_act[i] is the output of layer i */
+  xa_nnlib_handle_t layer_handle[XA_NNLIB_NET_MAX_LAYERS];
+  void *p_layer_scratch[XA_NNLIB_NET_MAX_LAYERS];
+  buf1D_t *p_act[XA_NNLIB_NET_MAX_LAYERS];
+
+  buf1D_t *p_inp;
+  buf2D_t *p_kernel[MAX_CNN_LAYERS];
+  buf1D_t *p_bias[MAX_CNN_LAYERS];
+  gru_coeffs_t gru_coeffs[MAX_GRU_LAYERS];
+  buf1D_t *p_out;
+  buf1D_t *p_ref;
+
+  FILE *fptr_out;
+
+  /* Library name version etc print */
+  fprintf(stderr, "\n--------------------------------------------------------\n");
+  fprintf(stderr, "%s library version %s\n",
+          xa_nnlib_get_lib_name_string(),
+          xa_nnlib_get_lib_version_string());
+  fprintf(stderr, "API version: %s\n", xa_nnlib_get_lib_api_version_string());
+  fprintf(stderr, "Cadence Design Systems, Inc. http://www.cadence.com\n");
+
+  if(default_config(&cfg))
+  {
+    return -1;
+  }
+
+  if(argc > 1)
+  {
+    printf("Parsing CMDLINE\n");
+    parse_arguments(argc, argv, &cfg);
+    if(1 == cfg.help)
+    {
+      show_usage();
+      return 0;
+    }
+  }
+
+  if(cfg.cnn_layers < 1 || cfg.cnn_layers > MAX_CNN_LAYERS)
+  {
+    fprintf(stderr, "Invalid -cnn_layers %d, 1 to %d CNN layers supported\n", cfg.cnn_layers, MAX_CNN_LAYERS);
+    return -1;
+  }
+  if(parse_gru_out_feats(&cfg) || (cfg.cnn_layers + cfg.gru_layers > XA_NNLIB_NET_MAX_LAYERS))
+  {
+    fprintf(stderr, "Invalid -gru_out_feats %s, 1 to %d GRU layers supported\n", cfg.gru_out_feats_str, XA_NNLIB_NET_MAX_LAYERS - cfg.cnn_layers);
+    return -1;
+  }
+  n_layers = cfg.cnn_layers + cfg.gru_layers;
+
+  /* CNN layers, conv2d_std with 16 bit I/O so that they can feed a GRU layer.
+     The second layer is a same size convolution of the first layer output */
+  inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
+  out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
+  total_MACs = 0;
+
+  for(i = 0; i < cfg.cnn_layers; i++)
+  {
+    int input_height   = (i == 0) ? cfg.input_height   : cfg.out_height;
+    int input_width    = (i == 0) ? cfg.input_width    : cfg.out_width;
+    int input_channels = (i == 0) ? cfg.input_channels : cfg.out_channels;
+    int input_channels_pad = (input_channels + 4 - 1) & ~(4 - 1);
+
+    memset(&cnn_cfg[i], 0, sizeof(xa_nnlib_cnn_init_config_t));
+    cnn_cfg[i].algo = XA_NNLIB_CNN_CONV2D_STD;
+    cnn_cfg[i].precision = (cfg.cnn_kernel_precision == 16) ? XA_NNLIB_CNN_16bx16b : XA_NNLIB_CNN_8bx16b;
+    cnn_cfg[i].x_stride = (i == 0) ? cfg.x_stride : 1;
+    cnn_cfg[i].y_stride = (i == 0) ? cfg.y_stride : 1;
+    cnn_cfg[i].x_padding = (i == 0) ? cfg.x_padding : (cfg.kernel_width - 1) / 2;
+    cnn_cfg[i].y_padding = (i == 0) ? cfg.y_padding : (cfg.kernel_height - 1) / 2;
+    cnn_cfg[i].bias_shift = cfg.bias_shift;
+    cnn_cfg[i].acc_shift = cfg.acc_shift;
+    cnn_cfg[i].output_height = cfg.out_height;
+    cnn_cfg[i].output_width = cfg.out_width;
+    cnn_cfg[i].output_channels = cfg.out_channels;
+    cnn_cfg[i].output_format = 0;
+    FILL_KERNEL_SHAPE_CUBE_DWH(cnn_cfg[i].kernel_std_shape, cfg.kernel_height, cfg.kernel_width, input_channels, input_channels_pad, cfg.out_channels)
+    FILL_SHAPE_VECTOR(cnn_cfg[i].bias_std_shape, cfg.out_channels)
+    FILL_IO_SHAPE_CUBE_DWH(cnn_cfg[i].input_shape, input_height, input_width, input_channels)
+
+    layers[i].type = XA_NNLIB_NET_LAYER_CNN;
+    layers[i].p_config = &cnn_cfg[i];
+
+    total_MACs += out_size * cfg.kernel_height * cfg.kernel_width * input_channels;
+  }
+
+  /* GRU layers, the first one takes the flattened CNN output */
+  for(i = 0; i < cfg.gru_layers; i++)
+  {
+    gru_cfg[i].in_feats = (i == 0) ? out_size : cfg.gru_out_feats[i-1];
+    gru_cfg[i].out_feats = cfg.gru_out_feats[i];
+    gru_cfg[i].pad = 0;
+    gru_cfg[i].mat_prec = cfg.gru_mat_prec;
+    gru_cfg[i].vec_prec = 16;
+    gru_cfg[i].precision = (cfg.gru_mat_prec == 8) ? XA_NNLIB_GRU_8bx16b : XA_NNLIB_GRU_16bx16b;
+    gru_cfg[i].coeff_Qformat = (cfg.gru_mat_prec == 8) ? 7 : 15;
+    gru_cfg[i].io_Qformat = 12;
+
+    layers[cfg.cnn_layers + i].type = XA_NNLIB_NET_LAYER_GRU;
+    layers[cfg.cnn_layers + i].p_config = &gru_cfg[i];
+
+    total_MACs += 3 * (gru_cfg[i].in_feats + gru_cfg[i].out_feats) * gru_cfg[i].out_feats;
+  }
+
+  net_cfg.n_layers = n_layers;
+  net_cfg.p_layers = layers;
+
+  // Set profiler name
+  sprintf(profiler_name, "%s_cnn_%dx16_gru_%dx16", (cfg.read_model_file_name[0] != '\0') ? "model" : "net", cfg.cnn_kernel_precision, cfg.gru_mat_prec);
+
+  // Set profiler parameters
+  sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, out_channels=%d, cnn_layers=%d, gru_out_feats=%s",
+    cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, cfg.cnn_layers, cfg.gru_out_feats_str);
+
+  // Open output file
+  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+
+  // Allocate Memory
+  p_inp = create_buf1D(inp_size, 16);                                             VALIDATE_PTR(p_inp);
+  p_out = create_buf1D(cfg.gru_out_feats[cfg.gru_layers-1], 16);                  VALIDATE_PTR(p_out);
+  p_ref = create_buf1D(cfg.gru_out_feats[cfg.gru_layers-1], 16);                  VALIDATE_PTR(p_ref);
+
+  /* Weights are fixed for all frames, zero-out the padded channels in kernel */
+  for(i = 0; i < cfg.cnn_layers; i++)
+  {
+    int input_channels = cnn_cfg[i].kernel_std_shape.dim.cube.depth;
+    int input_channels_pad = cnn_cfg[i].kernel_std_shape.dim.cube.width_offset;
+    int j;
+
+    p_kernel[i] = create_buf2D(cfg.out_channels * cfg.kernel_height * cfg.kernel_width, input_channels, input_channels_pad, cfg.cnn_kernel_precision, 0);    VALIDATE_PTR(p_kernel[i]);
+    p_bias[i] = create_buf1D(cfg.out_channels, 16);                                 VALIDATE_PTR(p_bias[i]);
+
+    set_rand_inp_buf2D(p_kernel[i]);
+    set_rand_inp_buf1D(p_bias[i]);
+    if(input_channels != input_channels_pad)
+    {
+      char *p = (char *) p_kernel[i]->p + input_channels * p_kernel[i]->bytes_per_element;
+      int padded_bytes = (input_channels_pad - input_channels) * p_kernel[i]->bytes_per_element;
+      for (j = 0; j < p_kernel[i]->rows * p_kernel[i]->row_offset; j += input_channels_pad)
+      {
+        memset((p + j * p_kernel[i]->bytes_per_element), 0, padded_bytes);
+      }
+    }
+  }
+  for(i = 0; i < cfg.gru_layers; i++)
+  {
+    if(setup_gru_coeffs(&gru_coeffs[i], &gru_cfg[i]))
+      return -1;
+  }
+
+  /* Coefficients only depend on the random seed and the options, a model
+     generated from them matches the layers set up by a later run */
+  if(cfg.write_coef_dir[0] != '\0')
+  {
+    if(write_model_coefs(cfg.write_coef_dir, &cfg, cnn_cfg, p_kernel, p_bias, gru_coeffs))
+      return -1;
+  }
+
+  XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, total_MACs, "MACs/cyc", 1);
+
+  /* Layer count limits and layer chaining errors */
+  if(check_net_config_errors(&cnn_cfg[0], &gru_cfg[0]))
+  {
+    config_check_fail = 1;
+  }
+
+  /* Initialization Loop */
+  {
+    /* Get persistent and scratch sizes and allocate them */
+    if(cfg.read_model_file_name[0] != '\0')
+    {
+      p_model = load_model(cfg.read_model_file_name, &p_model_mem, &model_size);
+      VALIDATE_PTR(p_model);
+      if(check_model_errors(p_model, model_size))
+      {
+        config_check_fail = 1;
+      }
+      net_persistent_size = xa_nnlib_model_get_persistent_fast(p_model, model_size);
+    }
+    else
+    {
+      net_persistent_size = xa_nnlib_net_get_persistent_fast(&net_cfg);
+    }
+    if(net_persistent_size < 0)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", net_persistent_size);
+      return net_persistent_size;
+    }
+    if(p_model)
+      net_scratch_size = xa_nnlib_model_get_scratch_fast(p_model, model_size);
+    else
+      net_scratch_size = xa_nnlib_net_get_scratch_fast(&net_cfg);
+    if(net_scratch_size < 0)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", net_scratch_size);
+      return net_scratch_size;
+    }
+
+    /* Layer by layer run, separate handles and scratch for each layer */
+    max_scratch_size = 0;
+    max_act_size = 0;
+    for(i = 0; i < n_layers; i++)
+    {
+      int persistent_size, scratch_size, act_length;
+
+      if(i < cfg.cnn_layers)
+      {
+        persistent_size = xa_nnlib_cnn_get_persistent_fast(&cnn_cfg[i]);
+        scratch_size = xa_nnlib_cnn_get_scratch_fast(&cnn_cfg[i]);
+        act_length = out_size;
+      }
+      else
+      {
+        persistent_size = xa_nnlib_gru_get_persistent_fast(&gru_cfg[i - cfg.cnn_layers]);
+        scratch_size = xa_nnlib_gru_get_scratch_fast(&gru_cfg[i - cfg.cnn_layers]);
+        act_length = gru_cfg[i - cfg.cnn_layers].out_feats;
+      }
+
+      layer_handle[i] = (xa_nnlib_handle_t)malloc(persistent_size);   VALIDATE_PTR(layer_handle[i]);
+      p_layer_scratch[i] = malloc(scratch_size);                      VALIDATE_PTR(p_layer_scratch[i]);
+
+      if(i < cfg.cnn_layers)
+        err = xa_nnlib_cnn_init(layer_handle[i], &cnn_cfg[i]);
+      else
+        err = xa_nnlib_gru_init(layer_handle[i], &gru_cfg[i - cfg.cnn_layers]);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      if(scratch_size > max_scratch_size)
+        max_scratch_size = scratch_size;
+
+      if(i < n_layers - 1)
+      {
+        p_act[i] = create_buf1D(act_length, 16);                      VALIDATE_PTR(p_act[i]);
+        if(act_length * (int)sizeof(vect_t) > max_act_size)
+          max_act_size = act_length * sizeof(vect_t);
+      }
+    }
+
+    /* Scratch is the largest layer scratch followed by up to two ping-pong
+       buffers, each holding the largest intermediate activation */
+    n_act_bufs = (n_layers - 1) < 2 ? (n_layers - 1) : 2;
+    if(net_scratch_size != ALIGN_SIZE(max_scratch_size) + n_act_bufs * ALIGN_SIZE(max_act_size))
+    {
+      fprintf(stderr, "Net scratch size %d, expected %d\n", net_scratch_size,
+              ALIGN_SIZE(max_scratch_size) + n_act_bufs * ALIGN_SIZE(max_act_size));
+      config_check_fail = 1;
+    }
+
+    /* Sizes are exact, anything written past them is caught by the guard bytes */
+    net_handle = (xa_nnlib_handle_t)malloc(net_persistent_size + GUARD_BYTES); PRINT_PTR(net_handle)
+    p_net_scratch  = malloc(net_scratch_size + GUARD_BYTES);    PRINT_PTR(p_net_scratch)
+    VALIDATE_PTR(net_handle);
+    VALIDATE_PTR(p_net_scratch);
+    memset((char *)net_handle + net_persistent_size, GUARD_VAL, GUARD_BYTES);
+    memset((char *)p_net_scratch + net_scratch_size, GUARD_VAL, GUARD_BYTES);
+
+    fprintf(stdout, "\nPersistent(fast) size: %8d bytes\n", net_persistent_size);
+    fprintf(stdout, "Scratch(fast) size:    %8d bytes\n", net_scratch_size);
+    fprintf(stdout, "Input size:            %8d bytes\n", inp_size*2);
+    fprintf(stdout, "Output size:           %8d bytes\n\n", p_out->length*2);
+
+    /* Initialize network with configurations, a model also binds the
+       coefficients of all layers */
+    if(p_model)
+      err = xa_nnlib_model_init(net_handle, p_model, model_size);
+    else
+      err = xa_nnlib_net_init(net_handle, &net_cfg);
+    if(XA_NNLIB_NO_ERROR != err)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+      return err;
+    }
+  }
+
+  /* Set up kernel, bias and weights of both runs */
+  {
+    xa_nnlib_net_layer_handle_t net_layer;
+
+    for(i = 0; i < n_layers; i++)
+    {
+      net_layer.layer_idx = i;
+      err = xa_nnlib_net_get_config(net_handle, XA_NNLIB_NET_LAYER_HANDLE, &net_layer);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      if(i < cfg.cnn_layers)
+      {
+        void *kernel[2];
+        void *bias[2];
+
+        kernel[0] = p_kernel[i]->p;
+        bias[0]   = p_bias[i]->p;
+        if(p_model == NULL)
+        {
+          xa_nnlib_cnn_set_config(net_layer.handle, XA_NNLIB_CNN_KERNEL, &kernel[0]);
+          xa_nnlib_cnn_set_config(net_layer.handle, XA_NNLIB_CNN_BIAS, &bias[0]);
+        }
+        xa_nnlib_cnn_set_config(layer_handle[i], XA_NNLIB_CNN_KERNEL, &kernel[0]);
+        xa_nnlib_cnn_set_config(layer_handle[i], XA_NNLIB_CNN_BIAS, &bias[0]);
+      }
+      else
+      {
+        gru_coeffs_t *p_coeffs = &gru_coeffs[i - cfg.cnn_layers];
+
+        if(p_model == NULL)
+        {
+          xa_nnlib_gru_set_config(net_layer.handle, XA_NNLIB_GRU_WEIGHT, &p_coeffs->weights);
+          xa_nnlib_gru_set_config(net_layer.handle, XA_NNLIB_GRU_BIAS,   &p_coeffs->biases);
+        }
+        xa_nnlib_gru_set_config(layer_handle[i], XA_NNLIB_GRU_WEIGHT, &p_coeffs->weights);
+        xa_nnlib_gru_set_config(layer_handle[i], XA_NNLIB_GRU_BIAS,   &p_coeffs->biases);
+      }
+    }
+
+    /* Layer index past the last layer must be rejected */
+    net_layer.layer_idx = n_layers;
+    err = xa_nnlib_net_get_config(net_handle, XA_NNLIB_NET_LAYER_HANDLE, &net_layer);
+    if(XA_NNLIB_NET_CONFIG_FATAL_INVALID_N_LAYERS != err)
+    {
+      fprintf(stderr, "Layer index %d not rejected, error code: 0x%x \n", n_layers, err);
+      config_check_fail = 1;
+    }
+  }
+
+  /* Execution Loop */
+  {
+    xa_nnlib_shape_t input_shape;
+    xa_nnlib_shape_t output_shape;
+    xa_nnlib_shape_t layer_in_shape;
+    xa_nnlib_shape_t layer_out_shape;
+    int frame_pass;
+
+    xa_nnlib_net_get_config(net_handle, XA_NNLIB_NET_INPUT_SHAPE, &input_shape);
+    xa_nnlib_net_get_config(net_handle, XA_NNLIB_NET_OUTPUT_SHAPE, &output_shape);
+
+    for(frame = 0; frame < cfg.frames; frame++)
+    {
+      /* New input every frame, GRU state carries over between frames */
+      set_rand_inp_buf1D(p_inp);
+
+      XTPWR_PROFILER_START(0);
+      err = xa_nnlib_net_process(net_handle,
+                                 p_net_scratch,
+                                 p_inp->p,
+                                 p_out->p,
+                                 &input_shape,
+                                 &output_shape);
+      XTPWR_PROFILER_STOP(0);
+
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Runtime Error, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      XTPWR_PROFILER_UPDATE(0);
+      XTPWR_PROFILER_PRINT(0);
+
+      // Write output into file
+      write_buf1D_to_file(fptr_out, p_out);
+
+      // If verify flag enabled, compare output against the layers run one by one
+      if(cfg.verify)
+      {
+        for(i = 0; (i < n_layers) && (XA_NNLIB_NO_ERROR == err); i++)
+        {
+          void *p_layer_inp = (i == 0) ? p_inp->p : p_act[i-1]->p;
+          void *p_layer_out = (i == n_layers - 1) ? p_ref->p : p_act[i]->p;
+
+          if(i < cfg.cnn_layers)
+          {
+            err = xa_nnlib_cnn_process(layer_handle[i],
+                                       p_layer_scratch[i],
+                                       p_layer_inp,
+                                       p_layer_out,
+                                       &cnn_cfg[i].input_shape,
+                                       &layer_out_shape);
+          }
+          else
+          {
+            FILL_SHAPE_VECTOR(layer_in_shape, gru_cfg[i - cfg.cnn_layers].in_feats)
+            FILL_SHAPE_VECTOR(layer_out_shape, gru_cfg[i - cfg.cnn_layers].out_feats)
+            err = xa_nnlib_gru_process(layer_handle[i],
+                                       p_layer_scratch[i],
+                                       p_layer_inp,
+                                       p_layer_out,
+                                       &layer_in_shape,
+                                       &layer_out_shape);
+          }
+        }
+        if(XA_NNLIB_NO_ERROR != err)
+        {
+          fprintf(stderr, "Runtime Error, failed with error code: 0x%x \n", err);
+          return err;
+        }
+
+        frame_pass = compare_buf1D(p_ref, p_out, cfg.verify, 16, 0);
+        if(check_guard((char *)net_handle, net_persistent_size) || check_guard((char *)p_net_scratch, net_scratch_size))
+        {
+          fprintf(stderr, "Write past net persistent or scratch memory\n");
+          frame_pass = 0;
+        }
+        pass_count += frame_pass;
+      }
+      else
+      {
+        pass_count += !err;
+      }
+    }
+  }
+
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames) && !config_check_fail);
+
+  fclose(fptr_out);
+
+  // Free all buffers
+  free_buf1D(p_inp);
+  free_buf1D(p_out);
+  free_buf1D(p_ref);
+  for(i = 0; i < cfg.cnn_layers; i++)
+  {
+    free_buf2D(p_kernel[i]);
+    free_buf1D(p_bias[i]);
+  }
+  for(i = 0; i < cfg.gru_layers; i++)
+  {
+    free_gru_coeffs(&gru_coeffs[i]);
+  }
+  for(i = 0; i < n_layers; i++)
+  {
+    if(i < n_layers - 1)
+      free_buf1D(p_act[i]);
+    free(layer_handle[i]);
+    free(p_layer_scratch[i]);
+  }
+
+  free(net_handle);
+  free(p_net_scratch);
+  if(p_model_mem)
+    free(p_model_mem);
+
+  return 0;
+}
+
+int main (int argc, char *argv[])
+{
+    FILE *param_file_id;
+    int err_code = 0;
+
+    WORD8 curr_cmd[XA_MAX_ARGS * XA_MAX_CMD_LINE_LENGTH];
+    WORD32 fargc, curpos;
+    WORD32 processcmd = 0;
+
+    char fargv[XA_MAX_ARGS][XA_MAX_CMD_LINE_LENGTH];
+
+    char *pargv[XA_MAX_ARGS+1];
+
+    if(argc == 1)
+    {
+        param_file_id = fopen(PARAMFILE, "r");
+        if (param_file_id == NULL)
+        {
+            err_code = -1;
+            printf("Error opening Parameter file for reading %s\n",PARAMFILE);
+            exit(1);
+        }
+
+        /* Process one line at a time */
+        while(fgets((char *)curr_cmd, XA_MAX_ARGS * XA_MAX_CMD_LINE_LENGTH, param_file_id))
+        {
+            curpos = 0;
+            fargc = 0;
+            /* if it is not a param_file command and if */
+            /* CLP processing is not enabled */
+            if(curr_cmd[0] != '@' && !processcmd)
+            {   /* skip it */
+                continue;
+            }
+
+            while(sscanf((const char *)curr_cmd + curpos, "%s", fargv[fargc]) != EOF)
+            {
+                if(fargv[0][0]=='/' && fargv[0][1]=='/')
+                    break;
+                if(strcmp(fargv[0], "@echo") == 0)
+                    break;
+                if(strcmp(fargv[fargc], "@New_line") == 0)
+                {
+                    fgets((char *)curr_cmd + curpos, XA_MAX_CMD_LINE_LENGTH, param_file_id);
+                    continue;
+                }
+                curpos += strlen(fargv[fargc]);
+                while(*(curr_cmd + curpos)==' ' || *(curr_cmd + curpos)=='\t')
+                    curpos++;
+                fargc++;
+            }
+
+            if(fargc < 1)   /* for blank lines etc. */
+                continue;
+
+            if(strcmp(fargv[0], "@Output_path") == 0)
+            {
+                if(fargc > 1) strcpy((char *)pb_output_file_path, fargv[1]);
+                else strcpy((char *)pb_output_file_path, "");
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Input_path") == 0)
+            {
+                if(fargc > 1) strcpy((char *)pb_input_file_path, fargv[1]);
+                else strcpy((char *)pb_input_file_path, "");
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Ref_path") == 0)
+            {
+                if(fargc > 1) strcpy((char *)pb_ref_file_path, fargv[1]);
+                else strcpy((char *)pb_ref_file_path, "");
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Start") == 0)
+            {
+                processcmd = 1;
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Stop") == 0)
+            {
+                processcmd = 0;
+                continue;
+            }
+
+            /* otherwise if this a normal command and its enabled for execution */
+            if(processcmd)
+            {
+                int i;
+
+                pargv[0] = argv[0];
+                for(i = 0; i < fargc; i++)
+                {
+                    fprintf(stdout, "%s ", fargv[i]);
+                    pargv[i+1] = fargv[i];
+                }
+
+                fprintf(stdout, "\n");
+
+                if(err_code == 0)
+                    xa_nn_main_process(fargc+1, pargv);
+
+            }
+        }
+    }
+    else
+    {
+        int i;
+
+        for(i = 1; i < argc; i++)
+        {
+            fprintf(stdout, "%s ", argv[i]);
+
+        }
+
+        fprintf(stdout, "\n");
+
+        if(err_code == 0)
+            xa_nn_main_process(argc, argv);
+
+    }
+
+    return 0;
+
+}
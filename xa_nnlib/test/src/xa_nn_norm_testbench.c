@@ -65,6 +65,12 @@ typedef struct _test_config_t
   int verify;
   // quant8 specific parameters
   int zero_point;
+  // layer_norm specific parameters
+  int num_rows;
+  int out_multiplier;
+  int out_shift;
+  int out_zero_bias;
+  int variance_limit;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -85,6 +91,11 @@ int default_config(test_config_t *p_cfg)
     p_cfg->write_out_file_name[0] = '\0';
     p_cfg->verify = 1;
     p_cfg->zero_point = 0;
+    p_cfg->num_rows = 1;
+    p_cfg->out_multiplier = 0x40000000;
+    p_cfg->out_shift = 0;
+    p_cfg->out_zero_bias = 0;
+    p_cfg->variance_limit = 1;
     return 0;
   }
   else
@@ -120,6 +131,11 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-zero_point",p_cfg->zero_point);
+    ARGTYPE_ONETIME_CONFIG("-num_rows",p_cfg->num_rows);
+    ARGTYPE_ONETIME_CONFIG("-out_multiplier",p_cfg->out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-out_shift",p_cfg->out_shift);
+    ARGTYPE_ONETIME_CONFIG("-out_zero_bias",p_cfg->out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-variance_limit",p_cfg->variance_limit);
 
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -130,11 +146,11 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 void show_usage(void)
 {
     printf ("Usage xt-run <binary> [Options]\n");
-    printf("\t-num_elms: Number of elements; Default=256\n");
+    printf("\t-num_elms: Number of elements (row length for layer_norm); Default=256\n");
     printf("\t-inp_precision: 8, 16, -1(single prec float), -4(asym8s); Default=16\n");
     printf("\t-out_precision: 8, 16, -1(single prec float), -4(asym8s); Default=16\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: l2_norm; Default=""l2_norm""\n");
+    printf("\t-kernel_name: l2_norm, layer_norm; Default=""l2_norm""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -142,6 +158,11 @@ void show_usage(void)
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
     printf("\t-zero_point: l2_norm_asym8s input parameter; Default=0\n");
+    printf("\t-num_rows: layer_norm number of rows; Default=1\n");
+    printf("\t-out_multiplier: layer_norm sym16s/asym8s output multiplier; Default=0x40000000\n");
+    printf("\t-out_shift: layer_norm sym16s/asym8s output shift; Default=0\n");
+    printf("\t-out_zero_bias: layer_norm asym8s output zero bias; Default=0\n");
+    printf("\t-variance_limit: layer_norm sym16s/asym8s variance limit; Default=1\n");
 }
 
 #if HIFI_VFPU
@@ -169,9 +190,34 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define LAYER_NORM_KERNEL_SYM16S_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_sym16s_sym16s ( \
+        (WORD16 *)p_out->p, (WORD16 *) p_inp->p, \
+        (WORD16 *)p_gamma->p, (WORD32 *)p_beta->p, \
+        cfg.num_rows, cfg.num_elms, \
+        cfg.out_multiplier, cfg.out_shift, cfg.variance_limit); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define LAYER_NORM_KERNEL_ASYM8S_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8s_asym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, \
+        (WORD16 *)p_gamma->p, (WORD32 *)p_beta->p, \
+        cfg.num_rows, cfg.num_elms, \
+        cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+        cfg.variance_limit); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define PROCESS_NORM \
     L2_NORM_KERNEL_F_FN(l2_norm, -1, -1) \
     else L2_NORM_KERNEL_ASYM8S_FN(l2_norm, -4, -4) \
+    else LAYER_NORM_KERNEL_SYM16S_FN(layer_norm, 16, 16) \
+    else LAYER_NORM_KERNEL_ASYM8S_FN(layer_norm, -4, -4) \
     else {  printf("unsupported normalization operation\n"); return -1;}
 
 int xa_nn_main_process(int argc, char *argv[])
@@ -190,6 +236,8 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_inp;
   buf1D_t *p_out;
   buf1D_t *p_ref;
+  buf1D_t *p_gamma = NULL;
+  buf1D_t *p_beta = NULL;
 
   FILE *fptr_inp;
   FILE *fptr_out;
@@ -213,6 +261,11 @@ int xa_nn_main_process(int argc, char *argv[])
 
   inp_size = cfg.num_elms;
   out_size = cfg.num_elms;
+  if(!strcmp(cfg.kernel_name,"layer_norm"))
+  {
+    inp_size = cfg.num_rows * cfg.num_elms;
+    out_size = cfg.num_rows * cfg.num_elms;
+  }
 
   // Set profiler name 
   if(cfg.kernel_name[0])
@@ -244,7 +297,10 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   
   // Set profiler parameters
-  sprintf(profiler_params, "num_elms=%d", cfg.num_elms);
+  if(!strcmp(cfg.kernel_name,"layer_norm"))
+    sprintf(profiler_params, "num_rows=%d, row_length=%d", cfg.num_rows, cfg.num_elms);
+  else
+    sprintf(profiler_params, "num_elms=%d", cfg.num_elms);
 
   // Open input file
   if(cfg.write_file)
@@ -276,9 +332,16 @@ int xa_nn_main_process(int argc, char *argv[])
   // Allocate Memory
   p_inp = create_buf1D(inp_size, cfg.inp_precision);                              VALIDATE_PTR(p_inp);
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
+  if(!strcmp(cfg.kernel_name,"layer_norm"))
+  {
+    p_gamma = create_buf1D(cfg.num_elms, 16);                                       VALIDATE_PTR(p_gamma);
+    p_beta = create_buf1D(cfg.num_elms, 32);                                        VALIDATE_PTR(p_beta);
+  }
   
   if(!strcmp(cfg.kernel_name,"l2_norm"))
     num_ops = 2*cfg.num_elms;   // First calculated square root of energy and then divide input by it
+  else if(!strcmp(cfg.kernel_name,"layer_norm"))
+    num_ops = 4*cfg.num_rows*cfg.num_elms;   // Sums, then subtract, scale and shift per element
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
 
@@ -286,7 +349,10 @@ int xa_nn_main_process(int argc, char *argv[])
   for(frame = 0; frame < cfg.frames; frame++)
   {
     // If write_file enabled, generate random data for input, else read from file
-    load_norm_input_data(cfg.write_file, fptr_inp, p_inp);
+    if(!strcmp(cfg.kernel_name,"layer_norm"))
+      load_layer_norm_input_data(cfg.write_file, fptr_inp, p_inp, p_gamma, p_beta);
+    else
+      load_norm_input_data(cfg.write_file, fptr_inp, p_inp);
 
     // Call the cnn kernel_name specified on command line
     PROCESS_NORM;
@@ -324,6 +390,8 @@ int xa_nn_main_process(int argc, char *argv[])
   // Free all buffers
   free_buf1D(p_inp);
   free_buf1D(p_out);
+  if(p_gamma) free_buf1D(p_gamma);
+  if(p_beta) free_buf1D(p_beta);
 
   if(cfg.verify)
   {
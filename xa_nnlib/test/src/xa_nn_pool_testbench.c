@@ -89,6 +89,12 @@ typedef struct _test_config_t
   int out_data_format;
   int inp_precision;
   int out_precision;
+  int inp_zero_bias;
+  int out_multiplier;
+  int out_shift;
+  int out_zero_bias;
+  int out_activation_min;
+  int out_activation_max;
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
@@ -97,6 +103,7 @@ typedef struct _test_config_t
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_out_file_name[XA_MAX_CMD_LINE_LENGTH];
   int verify;
+  int plan;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -121,6 +128,12 @@ int default_config(test_config_t *p_cfg)
     p_cfg->out_data_format = 1;
     p_cfg->inp_precision = 16;
     p_cfg->out_precision = 16;
+    p_cfg->inp_zero_bias = 0;
+    p_cfg->out_multiplier = 0x40000000;
+    p_cfg->out_shift = 0;
+    p_cfg->out_zero_bias = 0;
+    p_cfg->out_activation_min = -128;
+    p_cfg->out_activation_max = 127;
     strcpy(p_cfg->kernel_name, "avgpool");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
@@ -129,6 +142,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->write_inp_file_name[0]='\0';
     p_cfg->write_out_file_name[0] = '\0';
     p_cfg->verify = 1;
+    p_cfg->plan = 0;
 
     return 0;
   }
@@ -169,6 +183,12 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-out_data_format",p_cfg->out_data_format);
     ARGTYPE_ONETIME_CONFIG("-inp_precision",p_cfg->inp_precision);
     ARGTYPE_ONETIME_CONFIG("-out_precision",p_cfg->out_precision);
+    ARGTYPE_ONETIME_CONFIG("-inp_zero_bias",p_cfg->inp_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-out_multiplier",p_cfg->out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-out_shift",p_cfg->out_shift);
+    ARGTYPE_ONETIME_CONFIG("-out_zero_bias",p_cfg->out_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-out_activation_min",p_cfg->out_activation_min);
+    ARGTYPE_ONETIME_CONFIG("-out_activation_max",p_cfg->out_activation_max);
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
@@ -177,6 +197,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
+    ARGTYPE_ONETIME_CONFIG("-plan",p_cfg->plan);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -201,16 +222,23 @@ void show_usage(void)
     printf("\t-out_width: output width; Default=16\n");
     printf("\t-acc_shift: accumulator left shift; Default=-7\n");
     printf("\t-out_data_format: data format; Default=1 (WHD)\n");
-    printf("\t-inp_precision: 8, 16, -1(single prec float); Default=16\n");
-    printf("\t-out_precision: 8, 16, -1(single prec float); Default=16\n");
+    printf("\t-inp_precision: 8, 16, -4(asym8s, global_avgpool only), -1(single prec float); Default=16\n");
+    printf("\t-out_precision: 8, 16, -4(asym8s, global_avgpool only), -1(single prec float); Default=16\n");
+    printf("\t-inp_zero_bias: input zero bias (global_avgpool asym8s); Default=0\n");
+    printf("\t-out_multiplier: output multiplier with 1/(input_height*input_width) folded in (global_avgpool asym8s); Default=0x40000000\n");
+    printf("\t-out_shift: output shift (global_avgpool asym8s); Default=0\n");
+    printf("\t-out_zero_bias: output zero bias (global_avgpool asym8s); Default=0\n");
+    printf("\t-out_activation_min: output activation min (global_avgpool asym8s); Default=-128\n");
+    printf("\t-out_activation_max: output activation max (global_avgpool asym8s); Default=127\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: avgpool, maxpool; Default=""avgpool""\n");
+    printf("\t-kernel_name: avgpool, maxpool, global_avgpool (nhwc only, output is input_channels); Default=""avgpool""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - inp) \n");
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
+    printf("\t-plan: Flag to run avgpool or maxpool (8-bit) through plan_create once and plan_execute per frame; 0: Disable, 1: Enable; Default=0\n");
 }
 
 #define AVGPOOL_KERNEL_F_FN(KERNEL, IPREC, OPREC) \
@@ -225,7 +253,7 @@ void show_usage(void)
   }
 
 #define AVGPOOL_KERNEL_FN(KERNEL, IPREC, OPREC) \
-  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision) && !cfg.plan) {\
     XTPWR_PROFILER_START(0);\
     err = xa_nn_##KERNEL##_##IPREC ( \
         (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, \
@@ -247,7 +275,7 @@ void show_usage(void)
   }
 
 #define MAXPOOL_KERNEL_FN(KERNEL, IPREC, OPREC) \
-  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision) && !cfg.plan) {\
     XTPWR_PROFILER_START(0);\
     err = xa_nn_##KERNEL##_##IPREC ( \
         (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, \
@@ -257,6 +285,14 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define POOL_PLAN_KERNEL_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision) && cfg.plan) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_##IPREC##_plan_execute ( \
+        p_plan, (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define POOL_KERNEL_ASYM8_FN(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -268,9 +304,31 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define GLOBAL_AVGPOOL_ASYM8S_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8s_asym8s( \
+        (WORD8 *)p_out->p, (WORD8 *)p_inp->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, \
+        cfg.inp_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+        cfg.out_activation_min, cfg.out_activation_max);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define GLOBAL_AVGPOOL_F_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *)p_inp->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #if HIFI_VFPU
 #define PROCESS_POOL \
-    AVGPOOL_KERNEL_FN(avgpool, 16, 16) \
+    POOL_PLAN_KERNEL_FN(avgpool, 8, 8) \
+    else POOL_PLAN_KERNEL_FN(maxpool, 8, 8) \
+    else AVGPOOL_KERNEL_FN(avgpool, 16, 16) \
     else AVGPOOL_KERNEL_FN(avgpool, 8, 8) \
     else AVGPOOL_KERNEL_F_FN(avgpool, -1, -1) \
     else MAXPOOL_KERNEL_FN(maxpool, 8, 8) \
@@ -278,15 +336,20 @@ void show_usage(void)
     else MAXPOOL_KERNEL_F_FN(maxpool, -1, -1) \
     else POOL_KERNEL_ASYM8_FN(maxpool, -3, -3) \
     else POOL_KERNEL_ASYM8_FN(avgpool, -3, -3) \
+    else GLOBAL_AVGPOOL_ASYM8S_FN(global_avgpool, -4, -4) \
+    else GLOBAL_AVGPOOL_F_FN(global_avgpool, -1, -1) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #else
 #define PROCESS_POOL \
-    AVGPOOL_KERNEL_FN(avgpool, 16, 16) \
+    POOL_PLAN_KERNEL_FN(avgpool, 8, 8) \
+    else POOL_PLAN_KERNEL_FN(maxpool, 8, 8) \
+    else AVGPOOL_KERNEL_FN(avgpool, 16, 16) \
     else AVGPOOL_KERNEL_FN(avgpool, 8, 8) \
     else MAXPOOL_KERNEL_FN(maxpool, 8, 8) \
     else MAXPOOL_KERNEL_FN(maxpool, 16, 16) \
     else POOL_KERNEL_ASYM8_FN(maxpool, -3, -3) \
     else POOL_KERNEL_ASYM8_FN(avgpool, -3, -3) \
+    else GLOBAL_AVGPOOL_ASYM8S_FN(global_avgpool, -4, -4) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #endif
 
@@ -299,6 +362,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_scratch;
+  void *p_plan = NULL;
   int inp_size, out_size;
   int num_ops=0;
 
@@ -330,6 +394,8 @@ int xa_nn_main_process(int argc, char *argv[])
 
   inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
   out_size = cfg.out_height * cfg.out_width * cfg.input_channels;
+  if(!strcmp(cfg.kernel_name,"global_avgpool"))
+    out_size = cfg.input_channels;
 
   // Set profiler name 
   if(cfg.kernel_name[0])
@@ -353,6 +419,11 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "_asym8");
     strcat(profiler_name, profiler_params);
   }
+  else if(cfg.inp_precision == -4)
+  {
+    sprintf(profiler_params, "_asym8s");
+    strcat(profiler_name, profiler_params);
+  }
   else
   {
     sprintf(profiler_params, "_%d", 
@@ -365,6 +436,10 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "_nhwc");
     strcat(profiler_name, profiler_params);
   }
+  if(cfg.plan)
+  {
+    strcat(profiler_name, "_plan");
+  }
   
   // Set profiler parameters
   sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_height=%d, out_width=%d", 
@@ -404,6 +479,8 @@ int xa_nn_main_process(int argc, char *argv[])
     num_ops = out_size * (1 + cfg.kernel_height * cfg.kernel_width);
   else if(!strcmp(cfg.kernel_name,"maxpool"))
     num_ops = out_size * cfg.kernel_height * cfg.kernel_width;
+  else if(!strcmp(cfg.kernel_name,"global_avgpool"))
+    num_ops = inp_size + out_size;
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
 
@@ -411,7 +488,44 @@ int xa_nn_main_process(int argc, char *argv[])
   WORD32 scratch_size = 0;
 
   // Get persistent size and allocate 
-  if(!strcmp(cfg.kernel_name,"avgpool"))
+  if(cfg.plan && !strcmp(cfg.kernel_name,"avgpool"))
+  {
+      /* Plan is created once, plan_create returns the scratch size */
+      p_plan = malloc(xa_nn_avgpool_8_plan_getsize()); VALIDATE_PTR(p_plan);
+      scratch_size = xa_nn_avgpool_8_plan_create(p_plan
+              ,cfg.input_height
+              ,cfg.input_width
+              ,cfg.input_channels
+              ,cfg.kernel_height
+              ,cfg.kernel_width
+              ,cfg.x_stride
+              ,cfg.y_stride
+              ,cfg.x_padding
+              ,cfg.y_padding
+              ,cfg.out_height
+              ,cfg.out_width
+              ,cfg.inp_data_format
+              ,cfg.out_data_format);
+  }
+  else if(cfg.plan && !strcmp(cfg.kernel_name,"maxpool"))
+  {
+      p_plan = malloc(xa_nn_maxpool_8_plan_getsize()); VALIDATE_PTR(p_plan);
+      scratch_size = xa_nn_maxpool_8_plan_create(p_plan
+              ,cfg.input_height
+              ,cfg.input_width
+              ,cfg.input_channels
+              ,cfg.kernel_height
+              ,cfg.kernel_width
+              ,cfg.x_stride
+              ,cfg.y_stride
+              ,cfg.x_padding
+              ,cfg.y_padding
+              ,cfg.out_height
+              ,cfg.out_width
+              ,cfg.inp_data_format
+              ,cfg.out_data_format);
+  }
+  else if(!strcmp(cfg.kernel_name,"avgpool"))
   {
       scratch_size = xa_nn_avgpool_getsize(cfg.input_channels
               ,cfg.inp_precision
@@ -450,6 +564,12 @@ int xa_nn_main_process(int argc, char *argv[])
 
   PRINT_VAR(scratch_size)
 
+  if(p_plan && (scratch_size < 0))
+  {
+    printf("[Error] [%s] plan_create returned error (invalid parameters)\n", profiler_name);
+    return -1;
+  }
+
   p_scratch = (xa_nnlib_handle_t)malloc(scratch_size); PRINT_PTR(p_scratch)
 
   fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
@@ -504,6 +624,10 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   free(p_scratch);
+  if(p_plan)
+  {
+    free(p_plan);
+  }
 
   return 0;
 }
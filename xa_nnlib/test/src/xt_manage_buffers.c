@@ -50,6 +50,17 @@ int  RAND(void)
   }
 }
 
+/* Random IEEE half precision bit pattern, normal values in (-2, 2) with
+ * magnitude at least 2^-10 */
+static unsigned short RAND_F16(void)
+{
+  int r = RAND();
+  unsigned short sign = (r < 0) ? 0x8000 : 0;
+  unsigned short exponent = 5 + ((r >> 10) & 0x7) + ((r >> 13) & 0x1) + ((r >> 14) & 0x1);
+  unsigned short mantissa = r & 0x3FF;
+  return sign | (exponent << 10) | mantissa;
+}
+
 buf1D_t *create_buf1D(int len, int precision)
 {
   int size_in_bytes;
@@ -64,6 +75,7 @@ buf1D_t *create_buf1D(int len, int precision)
   switch(precision)
   {
     case -1: pbuf->bytes_per_element = 4; break;
+    case FLOAT16_TYPE: pbuf->bytes_per_element = 2; break;
     case ASYM8_TYPE: pbuf->bytes_per_element = 1; break;
     case ASYM8S_TYPE: pbuf->bytes_per_element = 1; break;
     case SYM8S_TYPE: pbuf->bytes_per_element = 1; break;
@@ -111,6 +123,7 @@ buf2D_t *create_buf2D(int rows, int cols, int row_offset, int precision, int pad
   switch(precision)
   {
     case -1:pbuf->bytes_per_element = 4; break;
+    case FLOAT16_TYPE: pbuf->bytes_per_element = 2; break;
     case ASYM8_TYPE: pbuf->bytes_per_element = 1;break;
     case ASYM8S_TYPE: pbuf->bytes_per_element = 1; break;
     case SYM8S_TYPE: pbuf->bytes_per_element = 1; break;
@@ -311,6 +324,15 @@ int set_rand_inp_buf1D(buf1D_t *ptr_buf1D)
         }
       }
       break;
+    case FLOAT16_TYPE:
+      {
+        unsigned short *p = (unsigned short *) ptr_buf1D->p;
+        for (i = 0; i < ptr_buf1D->length; i++)
+        {
+          p[i] = RAND_F16();
+        }
+      }
+      break;
     case ASYM8_TYPE: 
     case ASYM8S_TYPE: 
     case SYM8S_TYPE: 
@@ -382,6 +404,15 @@ int set_rand_inp_buf2D(buf2D_t *ptr_buf2D)
         }
       }
       break;
+    case FLOAT16_TYPE:
+      {
+        unsigned short *p = (unsigned short *) ptr_buf2D->p;
+        for (i = 0; i < ptr_buf2D->rows * ptr_buf2D->row_offset; i++)
+        {
+          p[i] = RAND_F16();
+        }
+      }
+      break;
     case ASYM8_TYPE: 
     case ASYM8S_TYPE: 
     case SYM8S_TYPE: 
@@ -477,6 +508,7 @@ void write_buf1D(buf1D_t *pbuf, FILE *file,int extensionIndicator, char * var_na
     switch(pbuf->precision)
     {
       case -1: length = sizeof(float) * pbuf->length;   break;
+      case FLOAT16_TYPE: length = sizeof(short) * pbuf->length;   break;
       case ASYM8_TYPE:  length = sizeof(char)  * pbuf->length;   break;
       case ASYM8S_TYPE:  length = sizeof(char)  * pbuf->length;   break;
       case SYM8S_TYPE:  length = sizeof(char)  * pbuf->length;   break;
@@ -501,6 +533,7 @@ void write_buf2D(buf2D_t *pbuf, FILE *file,int extensionIndicator, char * var_na
     switch(pbuf->precision)
     {
       case -1: length = sizeof(float) * pbuf->rows * pbuf->row_offset;   break;
+      case FLOAT16_TYPE: length = sizeof(short) * pbuf->rows * pbuf->row_offset;   break;
       case ASYM8_TYPE: length = sizeof(char)  * pbuf->rows * pbuf->row_offset;   break;
       case ASYM8S_TYPE:  length = sizeof(char)  * pbuf->rows * pbuf->row_offset;   break;
       case SYM8S_TYPE:  length = sizeof(char)  * pbuf->rows * pbuf->row_offset;   break;
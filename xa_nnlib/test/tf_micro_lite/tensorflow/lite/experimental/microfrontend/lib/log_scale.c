@@ -38,6 +38,10 @@ limitations under the License.
 #include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/log_lut.h"
 
+#if defined(HIFI_NNLIB_OPT)
+#include "xa_nnlib_api.h"
+#endif
+
 #define kuint16max 0x0000FFFF
 
 // The following functions implement integer logarithms of various sizes. The
@@ -84,6 +88,13 @@ uint16_t* LogScaleApply(struct LogScaleState* state, uint32_t* signal,
   uint16_t* output = (uint16_t*)signal;
   uint16_t* ret = output;
   int i;
+#if defined(HIFI_NNLIB_OPT)
+  if (state->enable_log && signal_size > 0) {
+    xa_nn_vec_log_scale_32_16((UWORD16*)output, (const UWORD32*)signal, scale_shift, correction_bits,
+                              signal_size);
+    return ret;
+  }
+#endif
   for (i = 0; i < signal_size; ++i) {
     uint32_t value = *signal++;
     if (state->enable_log) {
@@ -37,7 +37,19 @@ limitations under the License.
 
 #include <string.h>
 
+#if defined(HIFI_NNLIB_OPT)
+#include "xa_nnlib_api.h"
+#endif
+
 void NoiseReductionApply(struct NoiseReductionState* state, uint32_t* signal) {
+#if defined(HIFI_NNLIB_OPT)
+  xa_nn_vec_noise_reduction_32_32((UWORD32*)signal,
+                                  (UWORD32*)state->estimate,
+                                  state->smoothing_bits, state->even_smoothing,
+                                  state->odd_smoothing,
+                                  state->min_signal_remaining,
+                                  state->num_channels);
+#else
   int i;
   for (i = 0; i < state->num_channels; ++i) {
     const uint32_t smoothing =
@@ -65,6 +77,7 @@ void NoiseReductionApply(struct NoiseReductionState* state, uint32_t* signal) {
     const uint32_t output = subtracted > floor ? subtracted : floor;
     signal[i] = output;
   }
+#endif
 }
 
 void NoiseReductionReset(struct NoiseReductionState* state) {
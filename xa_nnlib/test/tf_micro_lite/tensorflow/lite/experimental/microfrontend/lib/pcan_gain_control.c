@@ -37,6 +37,10 @@ limitations under the License.
 
 #include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
 
+#if defined(HIFI_NNLIB_OPT)
+#include "xa_nnlib_api.h"
+#endif
+
 int16_t WideDynamicFunction(const uint32_t x, const int16_t* lut) {
   if (x <= 2) {
     return lut[x];
@@ -67,6 +71,12 @@ uint32_t PcanShrink(const uint32_t x) {
 
 void PcanGainControlApply(struct PcanGainControlState* state,
                           uint32_t* signal) {
+#if defined(HIFI_NNLIB_OPT)
+  xa_nn_vec_pcan_gain_control_32_32((UWORD32*)signal,
+                                    (const UWORD32*)state->noise_estimate,
+                                    (const WORD16*)state->gain_lut, state->snr_shift,
+                                    state->num_channels);
+#else
   int i;
   for (i = 0; i < state->num_channels; ++i) {
     const uint32_t gain =
@@ -74,4 +84,5 @@ void PcanGainControlApply(struct PcanGainControlState* state,
     const uint32_t snr = ((uint64_t)signal[i] * gain) >> state->snr_shift;
     signal[i] = PcanShrink(snr);
   }
+#endif
 }
@@ -1,3 +1,25 @@
+/*
+* Copyright (c) 2019-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
 /* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
 
 Licensed under the Apache License, Version 2.0 (the "License");
@@ -21,6 +43,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/micro_utils.h"
+#include "tensorflow/lite/micro/kernels/xtensa_hifi/xtensa_tf_micro_common.h"
 
 namespace tflite {
 namespace ops {
@@ -53,6 +76,50 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node, bool is_arg_max) {
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kOutputTensor);
 
+#ifdef NNLIB_HIFI5
+  if (axis->type == kTfLiteInt32 && output->type == kTfLiteInt32) {
+    const RuntimeShape& input_shape = tflite::micro::GetTensorShape(input);
+    const int32_t* inp_dims = input_shape.DimsData();
+    const int num_inp_dims = input_shape.DimensionsCount();
+    const int32_t axis_value = tflite::micro::GetTensorData<int32_t>(axis)[0];
+    int32_t* out_data = tflite::micro::GetTensorData<int32_t>(output);
+    int err = 0;
+    switch (input->type) {
+#if HIFI_VFPU
+      case kTfLiteFloat32: {
+        const float* inp_data = tflite::micro::GetTensorData<float>(input);
+        err = is_arg_max ? xa_nn_argmax_f32(out_data, inp_data, inp_dims,
+                                            num_inp_dims, axis_value)
+                         : xa_nn_argmin_f32(out_data, inp_data, inp_dims,
+                                            num_inp_dims, axis_value);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_argmax/argmin_f32 failed");
+        return kTfLiteOk;
+      }
+#endif /* HIFI_VFPU */
+      case kTfLiteUInt8: {
+        const uint8_t* inp_data = tflite::micro::GetTensorData<uint8_t>(input);
+        err = is_arg_max ? xa_nn_argmax_asym8u(out_data, inp_data, inp_dims,
+                                               num_inp_dims, axis_value)
+                         : xa_nn_argmin_asym8u(out_data, inp_data, inp_dims,
+                                               num_inp_dims, axis_value);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_argmax/argmin_asym8u failed");
+        return kTfLiteOk;
+      }
+      case kTfLiteInt8: {
+        const int8_t* inp_data = tflite::micro::GetTensorData<int8_t>(input);
+        err = is_arg_max ? xa_nn_argmax_asym8s(out_data, inp_data, inp_dims,
+                                               num_inp_dims, axis_value)
+                         : xa_nn_argmin_asym8s(out_data, inp_data, inp_dims,
+                                               num_inp_dims, axis_value);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_argmax/argmin_asym8s failed");
+        return kTfLiteOk;
+      }
+      default:
+        break;
+    }
+  }
+#endif /* NNLIB_HIFI5 */
+
 #define TF_LITE_ARG_MIN_MAX(data_type, axis_type, output_type)       \
   ArgMinMaxHelper(tflite::micro::GetTensorShape(input),              \
                   tflite::micro::GetTensorData<data_type>(input),    \
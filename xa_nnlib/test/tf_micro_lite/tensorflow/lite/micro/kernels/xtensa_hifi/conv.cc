@@ -222,7 +222,39 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     }
 
     int output_channels = output->dims->data[3];
-    int required_scratch = xa_nn_conv2d_std_getsize(
+    int required_scratch;
+#ifdef NNLIB_HIFI5
+    if (input->type == kTfLiteInt8) {
+      // Dilated convolutions run the reference kernel and need no scratch
+      data->scratch_tensor_index = -1;
+      if ((params->dilation_width_factor != 1) ||
+          (params->dilation_height_factor != 1)) {
+        return kTfLiteOk;
+      }
+
+      required_scratch = xa_nn_conv2d_per_chan_sym8sxasym8s_getsize(
+          input_height, input_width, input_depth, filter_height, filter_width,
+          output_channels, 1, params->stride_width, stride_height,
+          data->padding.width, pad_height, output_height, output_width, 0,
+          XA_NN_CONV2D_ALGO_AUTO);
+
+      if (required_scratch < 0) {
+        TF_LITE_KERNEL_LOG(context,
+            "conv2d_sym8s: xa_nn_conv2d_per_chan_sym8sxasym8s_getsize failed");
+        return kTfLiteError;
+      }
+
+      // Pointwise and 1xN patchify convolutions need no scratch
+      if (required_scratch > 0) {
+        const TfLiteStatus scratch_status = context->RequestScratchBufferInArena(
+            context, required_scratch,
+            &(data->scratch_tensor_index));
+        TF_LITE_ENSURE_OK(context, scratch_status);
+      }
+      return kTfLiteOk;
+    }
+#endif /* NNLIB_HIFI5 */
+    required_scratch = xa_nn_conv2d_std_getsize(
         input_height, input_depth, filter_height, filter_width, stride_height,
         pad_height, output_height, output_channels, input_precision);
 
@@ -436,46 +468,46 @@ TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
 
     int err, output_data_format = 0;
     void* p_scratch;
-    int8_t *p_filter;
     int out_length = output_height * output_width * output_depth;
 
 #ifdef NNLIB_HIFI5
-    if(filter_height == 1 && filter_width == 1)
-    {
-      for (int batch = 0; batch < batches; ++batch) {
-        int8_t * p_out_temp;
-        p_out_temp = &output_data[batch * out_length];
+    p_scratch = nullptr;
+    if (data.scratch_tensor_index >= 0) {
+      p_scratch = static_cast<void*>(
+          context->GetScratchBuffer(context, data.scratch_tensor_index));
+    }
 
-        err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(p_out_temp,
-            const_cast<WORD8*>(filter_data),
-            const_cast<WORD8*>(&input_data[batch * input_height * input_width * input_depth]),
-            const_cast<WORD32*>(bias_data),
-            input_height,
-            input_width,
-            input_depth,
-            output_depth,
-            input_offset,
-            data.per_channel_output_multiplier,
-            data.per_channel_output_shift,
-            output_offset,
-            output_data_format
-            );
-
-        CHECK_ERR_HIFI_NNLIB_KER(err, "conv2d_pointwise_sym8PerChannel: xa_nn_conv2d_pointwise_sym8sxasym8s failed");
+    for (int batch = 0; batch < batches; ++batch) {
+      int8_t* p_out_temp;
+      p_out_temp = &output_data[batch * out_length];
 
-        err = xa_nn_vec_activation_min_max_8_8(p_out_temp,
-                                                       p_out_temp,
-                                                       output_activation_min,
-                                                       output_activation_max,
-                                                       out_length);
+      // Pointwise, patchify, direct or circular buffer, picked by the
+      // library from the shape
+      err = xa_nn_conv2d_per_chan_sym8sxasym8s(p_out_temp,
+              &input_data[batch * input_height * input_width * input_depth],
+              filter_data, bias_data, input_height, input_width, input_depth,
+              filter_height, filter_width, output_depth, 1, stride_width,
+              stride_height, pad_width, pad_height, output_height, output_width,
+              input_offset, data.per_channel_output_multiplier,
+              data.per_channel_output_shift, output_offset, output_data_format,
+              XA_NN_CONV2D_ALGO_AUTO, p_scratch);
 
-        CHECK_ERR_HIFI_NNLIB_KER(
-            err, "xa_nn_vec_activation_min_max_8_8 failed");
-      }
+      CHECK_ERR_HIFI_NNLIB_KER(
+          err, "conv2d_sym8s: xa_nn_conv2d_per_chan_sym8sxasym8s failed");
+
+      err = xa_nn_vec_activation_min_max_8_8(p_out_temp,
+                                                     p_out_temp,
+                                                     output_activation_min,
+                                                     output_activation_max,
+                                                     out_length);
+
+      CHECK_ERR_HIFI_NNLIB_KER(
+          err, "xa_nn_vec_activation_min_max_8_8 failed");
     }
-    else
-#endif /* NNLIB_HIFI5 */
+#else
     {
+      int8_t *p_filter;
+
       p_scratch = static_cast<void*>(
           context->GetScratchBuffer(context, data.scratch_tensor_index));
 
@@ -507,6 +539,7 @@ TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
             err, "xa_nn_vec_activation_min_max_8_8 failed");
       }
     }
+#endif /* NNLIB_HIFI5 */
     return kTfLiteOk;
   }
   // TODO(b/154032858): Investigate removing extra copies.
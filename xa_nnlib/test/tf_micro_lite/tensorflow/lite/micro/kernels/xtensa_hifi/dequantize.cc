@@ -1,3 +1,25 @@
+/*
+* Copyright (c) 2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
 /* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
 
 Licensed under the Apache License, Version 2.0 (the "License");
@@ -23,6 +45,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/xtensa_hifi/xtensa_tf_micro_common.h"
 
 namespace tflite {
 namespace ops {
@@ -92,6 +115,32 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                                   tflite::micro::GetTensorShape(output),
                                   tflite::micro::GetTensorData<float>(output));
         break;
+#if defined NNLIB_HIFI5
+      case kTfLiteInt8: {
+        int err = 0;
+        int flat_size = MatchingFlatSize(tflite::micro::GetTensorShape(input),
+                                         tflite::micro::GetTensorShape(output));
+        err = xa_nn_elm_quantize_asym8s_f32(
+            tflite::micro::GetTensorData<float>(output),
+            tflite::micro::GetTensorData<int8_t>(input),
+            data->quantization_params.zero_point,
+            static_cast<float>(data->quantization_params.scale), flat_size);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_elm_quantize_asym8s_f32 failed");
+        break;
+      }
+      case kTfLiteInt16: {
+        int err = 0;
+        int flat_size = MatchingFlatSize(tflite::micro::GetTensorShape(input),
+                                         tflite::micro::GetTensorShape(output));
+        err = xa_nn_elm_quantize_asym16s_f32(
+            tflite::micro::GetTensorData<float>(output),
+            tflite::micro::GetTensorData<int16_t>(input),
+            data->quantization_params.zero_point,
+            static_cast<float>(data->quantization_params.scale), flat_size);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_elm_quantize_asym16s_f32 failed");
+        break;
+      }
+#else
       case kTfLiteInt8:
         reference_ops::Dequantize(data->quantization_params,
                                   tflite::micro::GetTensorShape(input),
@@ -106,6 +155,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                                   tflite::micro::GetTensorShape(output),
                                   tflite::micro::GetTensorData<float>(output));
         break;
+#endif
       default:
         TF_LITE_KERNEL_LOG(context, "Input %s, output %s not supported.",
                            TfLiteTypeGetName(input->type),
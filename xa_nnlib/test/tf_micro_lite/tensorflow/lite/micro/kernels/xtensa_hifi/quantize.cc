@@ -87,15 +87,18 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   TF_LITE_ENSURE(context, input->type == kTfLiteFloat32 ||
                               input->type == kTfLiteInt16 ||
-                              input->type == kTfLiteInt8);
+                              input->type == kTfLiteInt8 ||
+                              input->type == kTfLiteUInt8);
   TF_LITE_ENSURE(context, output->type == kTfLiteUInt8 ||
                               output->type == kTfLiteInt8 ||
                               output->type == kTfLiteInt16 ||
                               output->type == kTfLiteInt32);
 
-  if (((input->type == kTfLiteInt16 || input->type == kTfLiteInt8) &&
+  if (((input->type == kTfLiteInt16 || input->type == kTfLiteInt8 ||
+        input->type == kTfLiteUInt8) &&
        output->type == kTfLiteInt8) ||
-      (input->type == kTfLiteInt16 && output->type == kTfLiteInt16)) {
+      ((input->type == kTfLiteInt16 || input->type == kTfLiteInt8) &&
+       output->type == kTfLiteInt16)) {
     double effective_scale = static_cast<double>(input->params.scale) /
                              static_cast<double>(output->params.scale);
 
@@ -119,6 +122,19 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   if (input->type == kTfLiteFloat32) {
     switch (output->type) {
+#if defined NNLIB_HIFI5
+      case kTfLiteInt8: {
+        int err = 0;
+        size_t size = ElementCount(*input->dims);
+        err = xa_nn_elm_quantize_f32_asym8s(
+            tflite::micro::GetTensorData<int8_t>(output),
+            tflite::micro::GetTensorData<float>(input),
+            static_cast<float>(data->quantization_params.scale),
+            data->quantization_params.zero_point, size);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_elm_quantize_f32_asym8s failed");
+        break;
+      }
+#else
       case kTfLiteInt8:
         reference_ops::AffineQuantize(
             data->quantization_params, tflite::micro::GetTensorShape(input),
@@ -126,6 +142,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
             tflite::micro::GetTensorShape(output),
             tflite::micro::GetTensorData<int8_t>(output));
         break;
+#endif
       case kTfLiteUInt8:
         reference_ops::AffineQuantize(
             data->quantization_params, tflite::micro::GetTensorShape(input),
@@ -195,6 +212,28 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     // have different scales and/or zero points.
     size_t size = ElementCount(*input->dims);
     switch (output->type) {
+#if defined NNLIB_HIFI5
+      case kTfLiteInt8: {
+        int err = 0;
+        err = xa_nn_elm_quantize_asym8s_asym8s(
+            tflite::micro::GetTensorData<int8_t>(output),
+            tflite::micro::GetTensorData<int8_t>(input),
+            data->input_zero_point, data->quantization_params.zero_point,
+            data->output_shift, data->output_multiplier, size);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_elm_quantize_asym8s_asym8s failed");
+        break;
+      }
+      case kTfLiteInt16: {
+        int err = 0;
+        err = xa_nn_elm_quantize_asym8s_asym16s(
+            tflite::micro::GetTensorData<int16_t>(output),
+            tflite::micro::GetTensorData<int8_t>(input),
+            data->input_zero_point, data->quantization_params.zero_point,
+            data->output_shift, data->output_multiplier, size);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_elm_quantize_asym8s_asym16s failed");
+        break;
+      }
+#else
       case kTfLiteInt8:
         reference_ops::Requantize(tflite::micro::GetTensorData<int8_t>(input),
                                   size, data->output_multiplier,
@@ -202,6 +241,44 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
                                   data->quantization_params.zero_point,
                                   tflite::micro::GetTensorData<int8_t>(output));
         break;
+      case kTfLiteInt16:
+        reference_ops::Requantize(
+            tflite::micro::GetTensorData<int8_t>(input), size,
+            data->output_multiplier, data->output_shift, data->input_zero_point,
+            data->quantization_params.zero_point,
+            tflite::micro::GetTensorData<int16_t>(output));
+        break;
+#endif
+      default:
+        TF_LITE_KERNEL_LOG(context, "Input %s, output %s not supported.",
+                           TfLiteTypeGetName(input->type),
+                           TfLiteTypeGetName(output->type));
+        return kTfLiteError;
+    }
+  } else if (input->type == kTfLiteUInt8) {
+    // UInt8 to Int8 requantization
+    size_t size = ElementCount(*input->dims);
+    switch (output->type) {
+#if defined NNLIB_HIFI5
+      case kTfLiteInt8: {
+        int err = 0;
+        err = xa_nn_elm_quantize_asym8u_asym8s(
+            tflite::micro::GetTensorData<int8_t>(output),
+            tflite::micro::GetTensorData<uint8_t>(input),
+            data->input_zero_point, data->quantization_params.zero_point,
+            data->output_shift, data->output_multiplier, size);
+        CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_elm_quantize_asym8u_asym8s failed");
+        break;
+      }
+#else
+      case kTfLiteInt8:
+        reference_ops::Requantize(tflite::micro::GetTensorData<uint8_t>(input),
+                                  size, data->output_multiplier,
+                                  data->output_shift, data->input_zero_point,
+                                  data->quantization_params.zero_point,
+                                  tflite::micro::GetTensorData<int8_t>(output));
+        break;
+#endif
       default:
         TF_LITE_KERNEL_LOG(context, "Input %s, output %s not supported.",
                            TfLiteTypeGetName(input->type),
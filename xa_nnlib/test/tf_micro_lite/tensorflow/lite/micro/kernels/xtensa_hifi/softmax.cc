@@ -55,6 +55,10 @@ static constexpr int kInt16LUTArraySize = 513;
 struct OpData {
   SoftmaxParams op_data;
   int scratch_tensor_index;
+#ifdef NNLIB_HIFI5
+  int32_t sym16s_beta_multiplier;
+  int sym16s_beta_left_shift;
+#endif /* NNLIB_HIFI5 */
 };
 
 TfLiteStatus CalculateSoftmaxParams(TfLiteContext* context,
@@ -228,11 +232,34 @@ TfLiteStatus SoftmaxQuantized(TfLiteContext* context,
       }
     }
   } else {
+#ifdef NNLIB_HIFI5
+    const RuntimeShape& input_shape = tflite::micro::GetTensorShape(input);
+    const int16_t* input_data = tflite::micro::GetTensorData<int16_t>(input);
+    const RuntimeShape& output_shape = tflite::micro::GetTensorShape(output);
+    int16_t* output_data = tflite::micro::GetTensorData<int16_t>(output);
+    const int trailing_dim = input_shape.DimensionsCount() - 1;
+    const int outer_size =
+        MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+    const int depth =
+        MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+    void *p_scratch = static_cast<void*>(
+        context->GetScratchBuffer(context, data.scratch_tensor_index));
+
+    for (int i = 0; i < outer_size; ++i) {
+      int err = xa_nn_vec_softmax_sym16s_sym16s(
+          &output_data[i * depth], &input_data[i * depth],
+          data.sym16s_beta_left_shift, data.sym16s_beta_multiplier, depth,
+          p_scratch);
+      CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_vec_softmax_sym16s_sym16s failed");
+    }
+#else
     tflite::reference_ops::SoftmaxInt16(
         op_data, tflite::micro::GetTensorShape(input),
         tflite::micro::GetTensorData<int16_t>(input),
         tflite::micro::GetTensorShape(output),
         tflite::micro::GetTensorData<int16_t>(output));
+#endif /* NNLIB_HIFI5 */
   }
   return kTfLiteOk;
 }
@@ -311,6 +338,30 @@ TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node) {
     TF_LITE_ENSURE_OK(context, scratch_status);
   }
 
+#ifdef NNLIB_HIFI5
+  if (input->type == kTfLiteInt16) {
+    int required_scratch = get_softmax_scratch_size(PREC_SYM16S, PREC_SYM16S, depth);
+
+    if (required_scratch <= 0) {
+      TF_LITE_KERNEL_LOG(context,
+          "softmax: get_softmax_scratch_size failed");
+      return kTfLiteError;
+    }
+    const TfLiteStatus scratch_status = context->RequestScratchBufferInArena(
+        context, required_scratch,
+        &(data->scratch_tensor_index));
+    TF_LITE_ENSURE_OK(context, scratch_status);
+
+    // xa_nn_vec_softmax_sym16s_sym16s takes beta * input_scale * 2^11 as a
+    // quantized multiplier and converts (x - max) to Q6.25 internally.
+    auto* sm_params = static_cast<TfLiteSoftmaxParams*>(node->builtin_data);
+    QuantizeMultiplier(static_cast<double>(input->params.scale) *
+                           static_cast<double>(sm_params->beta) * 2048.0,
+                       &data->sym16s_beta_multiplier,
+                       &data->sym16s_beta_left_shift);
+  }
+#endif /* NNLIB_HIFI5 */
+
   if (input->type == kTfLiteFloat32) {
     int required_scratch = depth * sizeof(float);
     const TfLiteStatus scratch_status = context->RequestScratchBufferInArena(
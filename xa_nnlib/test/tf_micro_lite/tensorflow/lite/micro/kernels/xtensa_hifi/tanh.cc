@@ -63,6 +63,10 @@ struct OpData {
   int32_t input_range_radius;
   int32_t input_multiplier;
   int input_left_shift;
+#ifdef NNLIB_HIFI5
+  int32_t sym16s_input_multiplier;
+  int sym16s_input_left_shift;
+#endif /* NNLIB_HIFI5 */
 };
 
 void* TanhInit(TfLiteContext* context, const char* buffer, size_t length) {
@@ -93,6 +97,18 @@ TfLiteStatus CalculateArithmeticOpData(TfLiteContext* context, TfLiteNode* node,
     data->input_range_radius =
         CalculateInputRadius(kInputIntegerBits, data->input_left_shift, 31);
   }
+#ifdef NNLIB_HIFI5
+  else if (input->type == kTfLiteInt16) {
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
+    TF_LITE_ENSURE_NEAR(context, output->params.scale, 1.f / 32768,
+                        (0.001f * 1.f / 32768));
+    // xa_nn_vec_tanh_sym16s_sym16s takes input_scale * 2^11 as a quantized
+    // multiplier and converts the input to Q6.25 internally.
+    QuantizeMultiplier(static_cast<double>(input->params.scale) * 2048.0,
+                       &data->sym16s_input_multiplier,
+                       &data->sym16s_input_left_shift);
+  }
+#endif /* NNLIB_HIFI5 */
   return kTfLiteOk;
 }
 
@@ -178,6 +194,23 @@ TfLiteStatus TanhEval(TfLiteContext* context, TfLiteNode* node) {
 #endif /* NNLIB_HIFI5 */
       return kTfLiteOk;
     } break;
+#ifdef NNLIB_HIFI5
+    case kTfLiteInt16: {
+      int err;
+      const RuntimeShape& input_shape  = tflite::micro::GetTensorShape(input);
+      const RuntimeShape& output_shape = tflite::micro::GetTensorShape(output);
+      const int flat_size = MatchingFlatSize(input_shape, output_shape);
+
+      err = xa_nn_vec_tanh_sym16s_sym16s(
+          tflite::micro::GetTensorData<int16_t>(output),
+          tflite::micro::GetTensorData<int16_t>(input),
+          data.sym16s_input_multiplier,
+          data.sym16s_input_left_shift,
+          flat_size);
+      CHECK_ERR_HIFI_NNLIB_KER(err, "xa_nn_vec_tanh_sym16s_sym16s failed");
+      return kTfLiteOk;
+    } break;
+#endif /* NNLIB_HIFI5 */
     default:
       TF_LITE_KERNEL_LOG(context, "Input %s, output %s not supported.",
                          TfLiteTypeGetName(input->type),
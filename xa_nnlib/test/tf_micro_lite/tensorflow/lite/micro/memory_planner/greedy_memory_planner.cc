@@ -77,6 +77,7 @@ TfLiteStatus GreedyMemoryPlanner::AddBuffer(
   current->first_time_used = first_time_used;
   current->last_time_used = last_time_used;
   current->offline_offset = kOnlinePlannedBuffer;
+  current->inplace_source = kNotInPlaceBuffer;
   ++buffer_count_;
   need_to_calculate_offsets_ = true;
   return kTfLiteOk;
@@ -94,6 +95,43 @@ TfLiteStatus GreedyMemoryPlanner::AddBuffer(
   return kTfLiteOk;
 }
 
+TfLiteStatus GreedyMemoryPlanner::AddInPlaceBuffer(
+    tflite::ErrorReporter* error_reporter, int size, int first_time_used,
+    int last_time_used, int source_buffer_index) {
+  if ((source_buffer_index < 0) || (source_buffer_index >= buffer_count_)) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "In-place source buffer index %d is outside range 0 "
+                         "to %d",
+                         source_buffer_index, buffer_count_ - 1);
+    return kTfLiteError;
+  }
+  // Always point at the buffer that actually owns the memory, so that chains
+  // of in-place ops resolve in one step.
+  int root_index = source_buffer_index;
+  if (requirements_[root_index].inplace_source != kNotInPlaceBuffer) {
+    root_index = requirements_[root_index].inplace_source;
+  }
+  BufferRequirements* source = &requirements_[root_index];
+  if ((size > source->size) || (first_time_used < source->first_time_used)) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "In-place buffer (%d bytes, first used %d) does not "
+                         "fit source buffer %d (%d bytes, first used %d)",
+                         size, first_time_used, root_index, source->size,
+                         source->first_time_used);
+    return kTfLiteError;
+  }
+  BufferRequirements* current = &requirements_[buffer_count_];
+  if (AddBuffer(error_reporter, size, first_time_used, last_time_used) !=
+      kTfLiteOk) {
+    return kTfLiteError;
+  }
+  current->inplace_source = root_index;
+  if (last_time_used > source->last_time_used) {
+    source->last_time_used = last_time_used;
+  }
+  return kTfLiteOk;
+}
+
 bool GreedyMemoryPlanner::DoesEntryOverlapInTime(
     const GreedyMemoryPlanner::ListEntry* entry, const int first_time_used,
     const int last_time_used) const {
@@ -148,11 +186,20 @@ void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
   // about putting the large buffers in place first, and then the
   // smaller buffers can fit in the gaps, rather than fragmenting the
   // gaps with small buffers at the beginning. Add offline planned offsets
-  // first in the list, since they have a predetermined offset.
-  int idx_from_tail = buffer_count_;
+  // first in the list, since they have a predetermined offset. In-place
+  // buffers are left out, they are given their source offset at the end.
+  int placed_count = 0;
+  for (int i = 0; i < buffer_count_; ++i) {
+    if (requirements_[i].inplace_source == kNotInPlaceBuffer) {
+      ++placed_count;
+    }
+  }
+  int idx_from_tail = placed_count;
   int idx_from_head = 0;
   for (int i = 0; i < buffer_count_; ++i) {
-    if (requirements_[i].offline_offset == kOnlinePlannedBuffer) {
+    if (requirements_[i].inplace_source != kNotInPlaceBuffer) {
+      buffer_offsets_[i] = -1;
+    } else if (requirements_[i].offline_offset == kOnlinePlannedBuffer) {
       idx_from_tail--;
       buffer_sizes_sorted_[idx_from_tail] = requirements_[i].size;
       buffer_ids_sorted_[idx_from_tail] = i;
@@ -169,7 +216,7 @@ void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
   // with hundreds of buffers. Do not sort the offline planned offsets.
   ReverseSortInPlace(&buffer_sizes_sorted_[idx_from_head],
                      &buffer_ids_sorted_[idx_from_head],
-                     buffer_count_ - idx_from_head);
+                     placed_count - idx_from_head);
 
   // Initialize the first entry to the first buffer in
   // buffer_ids_sorted_.
@@ -189,7 +236,7 @@ void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
   first_entry->offset = buffer_offsets_[buffer_id];
 
   // Work through the rest of the buffers to find a good gap to place each one.
-  for (int i = 1; i < buffer_count_; ++i) {
+  for (int i = 1; i < placed_count; ++i) {
     // The id is the order the buffer was originally added by the client.
     buffer_id = buffer_ids_sorted_[i];
     // Look at what size and time range the buffer needs to be active.
@@ -285,6 +332,14 @@ void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
       }
     }
   }
+
+  // In-place buffers share the memory of their source buffer, whose lifetime
+  // already covers theirs.
+  for (int i = 0; i < buffer_count_; ++i) {
+    if (requirements_[i].inplace_source != kNotInPlaceBuffer) {
+      buffer_offsets_[i] = buffer_offsets_[requirements_[i].inplace_source];
+    }
+  }
 }
 
 size_t GreedyMemoryPlanner::GetMaximumMemorySize() {
@@ -410,6 +465,14 @@ bool GreedyMemoryPlanner::DoAnyBuffersOverlap(ErrorReporter* error_reporter) {
         continue;
       }
       BufferRequirements* b_requirements = &requirements_[j];
+      if ((a_requirements->inplace_source == j) ||
+          (b_requirements->inplace_source == i) ||
+          ((a_requirements->inplace_source != kNotInPlaceBuffer) &&
+           (a_requirements->inplace_source ==
+            b_requirements->inplace_source))) {
+        // Buffers intentionally share memory.
+        continue;
+      }
       const int b_start_offset = buffer_offsets_[j];
       const int b_first_time_used = b_requirements->first_time_used;
       const int b_last_time_used = b_requirements->last_time_used;
@@ -43,6 +43,7 @@ limitations under the License.
 namespace tflite {
 
 constexpr int kOnlinePlannedBuffer = -1;
+constexpr int kNotInPlaceBuffer = -1;
 
 // A memory planner that uses a greedy algorithm to arrange buffers in memory
 // to minimize the overall arena size needed.
@@ -88,6 +89,15 @@ class GreedyMemoryPlanner : public MemoryPlanner {
                          int first_time_used, int last_time_used,
                          int offline_offset);
 
+  // Record details of a buffer that shares the memory of an already added
+  // buffer, for ops whose kernels can write their output over their input.
+  // The buffer is given the same offset as source_buffer_index (or as the
+  // buffer that one shares its memory with), and the source buffer is kept
+  // alive until last_time_used. size must not exceed the source buffer size.
+  TfLiteStatus AddInPlaceBuffer(ErrorReporter* error_reporter, int size,
+                                int first_time_used, int last_time_used,
+                                int source_buffer_index);
+
   // Returns the high-water mark of used memory. This is the minimum size of a
   // memory arena you'd need to allocate to hold these buffers.
   size_t GetMaximumMemorySize() override;
@@ -153,6 +163,7 @@ class GreedyMemoryPlanner : public MemoryPlanner {
     int offline_offset;
     int first_time_used;
     int last_time_used;
+    int inplace_source;
   };
 
   // Working arrays used during the layout algorithm.
@@ -162,6 +173,7 @@ class GreedyMemoryPlanner : public MemoryPlanner {
   //     offline planned buffers,
   //     online planned buffers sorted by size
   //   }
+  // In-place buffers are not sorted, they take the offset of their source.
   int* buffer_sizes_sorted_;
   int* buffer_ids_sorted_;
   ListEntry* buffers_sorted_by_offset_;
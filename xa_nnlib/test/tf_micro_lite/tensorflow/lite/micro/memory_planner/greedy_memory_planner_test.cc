@@ -0,0 +1,123 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+constexpr int kScratchBufferSize = 4096;
+unsigned char g_scratch_buffer[kScratchBufferSize];
+unsigned char g_reference_scratch_buffer[kScratchBufferSize];
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestGreedyInPlaceSharesSourceOffset) {
+  tflite::MicroErrorReporter micro_error_reporter;
+
+  tflite::GreedyMemoryPlanner planner(g_scratch_buffer, kScratchBufferSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.AddBuffer(&micro_error_reporter, 100, 0, 1));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.AddBuffer(&micro_error_reporter, 50, 0, 3));
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.AddInPlaceBuffer(&micro_error_reporter, 100, 1, 2, 0));
+
+  int source_offset = -1;
+  int inplace_offset = -1;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.GetOffsetForBuffer(
+                                         &micro_error_reporter, 0,
+                                         &source_offset));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.GetOffsetForBuffer(
+                                         &micro_error_reporter, 2,
+                                         &inplace_offset));
+  TF_LITE_MICRO_EXPECT_EQ(source_offset, inplace_offset);
+  TF_LITE_MICRO_EXPECT_FALSE(planner.DoAnyBuffersOverlap(&micro_error_reporter));
+
+  // The in-place buffer costs no memory: the arena is the same as with the
+  // source buffer alone, alive until the in-place buffer's last use.
+  tflite::GreedyMemoryPlanner reference(g_reference_scratch_buffer,
+                                        kScratchBufferSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          reference.AddBuffer(&micro_error_reporter, 100, 0, 2));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          reference.AddBuffer(&micro_error_reporter, 50, 0, 3));
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(150),
+                          reference.GetMaximumMemorySize());
+  TF_LITE_MICRO_EXPECT_EQ(reference.GetMaximumMemorySize(),
+                          planner.GetMaximumMemorySize());
+}
+
+TF_LITE_MICRO_TEST(TestGreedyInPlaceChain) {
+  tflite::MicroErrorReporter micro_error_reporter;
+
+  tflite::GreedyMemoryPlanner planner(g_scratch_buffer, kScratchBufferSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.AddBuffer(&micro_error_reporter, 64, 0, 1));
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.AddInPlaceBuffer(&micro_error_reporter, 64, 1, 2, 0));
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.AddInPlaceBuffer(&micro_error_reporter, 64, 2, 3, 1));
+  // Alive together with the end of the chain, so it must not be placed over
+  // the shared memory.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.AddBuffer(&micro_error_reporter, 32, 3, 4));
+
+  int offset = -1;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.GetOffsetForBuffer(&micro_error_reporter, 0, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(0, offset);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.GetOffsetForBuffer(&micro_error_reporter, 1, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(0, offset);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.GetOffsetForBuffer(&micro_error_reporter, 2, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(0, offset);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, planner.GetOffsetForBuffer(&micro_error_reporter, 3, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(64, offset);
+
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(96),
+                          planner.GetMaximumMemorySize());
+  TF_LITE_MICRO_EXPECT_FALSE(planner.DoAnyBuffersOverlap(&micro_error_reporter));
+}
+
+TF_LITE_MICRO_TEST(TestGreedyInPlaceErrors) {
+  tflite::MicroErrorReporter micro_error_reporter;
+
+  tflite::GreedyMemoryPlanner planner(g_scratch_buffer, kScratchBufferSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.AddBuffer(&micro_error_reporter, 10, 1, 2));
+
+  // Source index out of range.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, planner.AddInPlaceBuffer(
+                                            &micro_error_reporter, 10, 2, 3, 1));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, planner.AddInPlaceBuffer(
+                                            &micro_error_reporter, 10, 2, 3, -1));
+  // Larger than the source buffer.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, planner.AddInPlaceBuffer(
+                                            &micro_error_reporter, 11, 2, 3, 0));
+  // Used before the source buffer exists.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, planner.AddInPlaceBuffer(
+                                            &micro_error_reporter, 10, 0, 3, 0));
+
+  // Nothing was added by the failed calls.
+  TF_LITE_MICRO_EXPECT_EQ(1, planner.GetBufferCount());
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(10),
+                          planner.GetMaximumMemorySize());
+}
+
+TF_LITE_MICRO_TESTS_END
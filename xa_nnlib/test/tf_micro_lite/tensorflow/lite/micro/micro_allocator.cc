@@ -33,6 +33,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/simple_memory_allocator.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/schema/schema_utils.h"
+#include "xa_nnlib_api.h"
 
 namespace tflite {
 
@@ -54,6 +55,8 @@ struct AllocationInfo {
   int last_used;
   int32_t offline_offset;
   bool needs_allocating;
+  // Index of the tensor whose buffer this one shares, or kNotInPlaceBuffer.
+  int inplace_source;
 };
 
 // We align tensor buffers to 16-byte boundaries, since this is a common
@@ -172,6 +175,11 @@ class AllocationInfoBuilder {
                           const int32_t* offline_offsets,
                           TfLiteEvalTensor* eval_tensors);
 
+  // Let the output of an op share the buffer of its input when the NNLib
+  // kernel run for the op supports in-place execution and the input is not
+  // used after the op. Must be called after AddTensors.
+  TfLiteStatus AddInPlaceTensors(const Model* model, const SubGraph* subgraph);
+
   // Add allocation information for the scratch buffers.
   TfLiteStatus AddScratchBuffers(
       internal::ScratchBufferRequest* scratch_buffer_requests,
@@ -202,6 +210,7 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
 
     current->first_created = -1;
     current->last_used = -1;
+    current->inplace_source = kNotInPlaceBuffer;
     current->needs_allocating = (eval_tensors[i].data.data == nullptr) &&
                                 (!subgraph->tensors()->Get(i)->is_variable());
     if (offline_offsets) {
@@ -265,6 +274,172 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
   return kTfLiteOk;
 }
 
+// Returns the NNLib kernel the xtensa_hifi kernels run for an op with the
+// given input and output types, or nullptr if the op is not a candidate for
+// in-place execution.
+const char* GetNnlibKernelName(BuiltinOperator op, TensorType input_type,
+                               TensorType output_type) {
+  switch (op) {
+    case BuiltinOperator_RELU:
+      if (input_type == TensorType_FLOAT32) {
+        return "xa_nn_vec_relu_std_f32_f32";
+      } else if (input_type == TensorType_INT8) {
+        return "xa_nn_vec_relu_asym8s_asym8s";
+      } else if (input_type == TensorType_UINT8) {
+        return "xa_nn_vec_relu_asym8u_asym8u";
+      }
+      break;
+    case BuiltinOperator_RELU6:
+      if (input_type == TensorType_FLOAT32) {
+        return "xa_nn_vec_relu6_f32_f32";
+      } else if (input_type == TensorType_INT8) {
+        return "xa_nn_vec_activation_min_max_8_8";
+      } else if (input_type == TensorType_UINT8) {
+        return "xa_nn_vec_activation_min_max_asym8u_asym8u";
+      }
+      break;
+    case BuiltinOperator_LOGISTIC:
+      if (input_type == TensorType_FLOAT32) {
+        return "xa_nn_vec_sigmoid_f32_f32";
+      } else if (input_type == TensorType_INT8) {
+        return "xa_nn_vec_sigmoid_asym8s_asym8s";
+      } else if (input_type == TensorType_INT16) {
+        return "xa_nn_vec_sigmoid_sym16s_sym16s";
+      }
+      break;
+    case BuiltinOperator_TANH:
+      if (input_type == TensorType_INT8) {
+        return "xa_nn_vec_tanh_asym8s_asym8s";
+      } else if (input_type == TensorType_INT16) {
+        return "xa_nn_vec_tanh_sym16s_sym16s";
+      }
+      break;
+    case BuiltinOperator_HARD_SWISH:
+      if (input_type == TensorType_INT8) {
+        return "xa_nn_vec_hard_swish_asym8s_asym8s";
+      }
+      break;
+    case BuiltinOperator_PRELU:
+      if (input_type == TensorType_INT8) {
+        return "xa_nn_vec_prelu_asym8s_asym8s";
+      }
+      break;
+    case BuiltinOperator_ADD:
+      if (input_type == TensorType_FLOAT32) {
+        return "xa_nn_elm_add_f32xf32_f32";
+      } else if (input_type == TensorType_INT8) {
+        return "xa_nn_elm_add_asym8sxasym8s_asym8s";
+      }
+      break;
+    case BuiltinOperator_SUB:
+      if (input_type == TensorType_INT8) {
+        return "xa_nn_elm_sub_asym8sxasym8s_asym8s";
+      }
+      break;
+    case BuiltinOperator_MUL:
+      if (input_type == TensorType_FLOAT32) {
+        return "xa_nn_elm_mul_f32xf32_f32";
+      } else if (input_type == TensorType_INT8) {
+        return "xa_nn_elm_mul_asym8sxasym8s_asym8s";
+      }
+      break;
+    case BuiltinOperator_FLOOR:
+      if (input_type == TensorType_FLOAT32) {
+        return "xa_nn_elm_floor_f32_f32";
+      }
+      break;
+    case BuiltinOperator_QUANTIZE:
+      if (output_type != TensorType_INT8) {
+        break;
+      }
+      if (input_type == TensorType_INT8) {
+        return "xa_nn_elm_quantize_asym8s_asym8s";
+      } else if (input_type == TensorType_UINT8) {
+        return "xa_nn_elm_quantize_asym8u_asym8s";
+      }
+      break;
+    default:
+      break;
+  }
+  return nullptr;
+}
+
+bool IsSubgraphInputOrOutput(const SubGraph* subgraph, int tensor_index) {
+  for (size_t i = 0; i < subgraph->inputs()->size(); ++i) {
+    if (subgraph->inputs()->Get(i) == tensor_index) {
+      return true;
+    }
+  }
+  for (size_t i = 0; i < subgraph->outputs()->size(); ++i) {
+    if (subgraph->outputs()->Get(i) == tensor_index) {
+      return true;
+    }
+  }
+  return false;
+}
+
+TfLiteStatus AllocationInfoBuilder::AddInPlaceTensors(
+    const Model* model, const SubGraph* subgraph) {
+  auto* opcodes = model->operator_codes();
+  auto* tensors = subgraph->tensors();
+  // Walk the ops in execution order so that a chain of in-place ops resolves
+  // to the tensor that owns the buffer.
+  for (size_t i = 0; i < subgraph->operators()->size(); ++i) {
+    const auto* op = subgraph->operators()->Get(i);
+    if ((op->outputs()->size() != 1) || (op->inputs()->size() == 0) ||
+        (op->opcode_index() >= opcodes->size())) {
+      continue;
+    }
+    const int output_index = op->outputs()->Get(0);
+    if (output_index < 0) {
+      continue;
+    }
+    AllocationInfo* output = &info_[output_index];
+    if (!output->needs_allocating ||
+        (output->offline_offset != kOnlinePlannedBuffer) ||
+        (output->first_created != static_cast<int>(i))) {
+      continue;
+    }
+    // Only ops without broadcast: every input has the size of the output.
+    bool same_size = true;
+    for (size_t n = 0; n < op->inputs()->size(); ++n) {
+      const int tensor_index = op->inputs()->Get(n);
+      if ((tensor_index < 0) || (info_[tensor_index].bytes != output->bytes)) {
+        same_size = false;
+        break;
+      }
+    }
+    if (!same_size) {
+      continue;
+    }
+    const char* kernel_name = GetNnlibKernelName(
+        GetBuiltinCode((*opcodes)[op->opcode_index()]),
+        tensors->Get(op->inputs()->Get(0))->type(),
+        tensors->Get(output_index)->type());
+    if (kernel_name == nullptr) {
+      continue;
+    }
+    const int capability = xa_nn_get_inplace_capability(kernel_name);
+    for (size_t n = 0; (n < op->inputs()->size()) && (n < 2); ++n) {
+      if ((capability & (XA_NN_INPLACE_INP1 << n)) == 0) {
+        continue;
+      }
+      const int tensor_index = op->inputs()->Get(n);
+      const AllocationInfo* input = &info_[tensor_index];
+      if (input->needs_allocating &&
+          (input->offline_offset == kOnlinePlannedBuffer) &&
+          (input->last_used == static_cast<int>(i)) &&
+          !IsSubgraphInputOrOutput(subgraph, tensor_index)) {
+        output->inplace_source = (input->inplace_source != kNotInPlaceBuffer)
+                                     ? input->inplace_source
+                                     : tensor_index;
+        break;
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 // The tensor offsets will be encoded in the metadata:[Metadata] field of the
 // Model. The following encoding applies:
 //
@@ -330,10 +505,25 @@ TfLiteStatus AllocationInfoBuilder::AddScratchBuffers(
     current->last_used = current_request->node_idx;
     current->offline_offset = kOnlinePlannedBuffer;
     current->needs_allocating = true;
+    current->inplace_source = kNotInPlaceBuffer;
   }
   return kTfLiteOk;
 }
 
+// Buffers that own their memory are added to the planner first, in tensor
+// order, followed by the in-place buffers. Returns the planner index of a
+// buffer of the first kind.
+int GetPlannerIndex(const AllocationInfo* allocation_info, int tensor_index) {
+  int planner_index = 0;
+  for (int i = 0; i < tensor_index; ++i) {
+    if (allocation_info[i].needs_allocating &&
+        (allocation_info[i].inplace_source == kNotInPlaceBuffer)) {
+      ++planner_index;
+    }
+  }
+  return planner_index;
+}
+
 TfLiteStatus CreatePlan(ErrorReporter* error_reporter,
                         GreedyMemoryPlanner* planner,
                         const AllocationInfo* allocation_info,
@@ -341,7 +531,8 @@ TfLiteStatus CreatePlan(ErrorReporter* error_reporter,
   // Add the tensors to our allocation plan.
   for (size_t i = 0; i < allocation_info_size; ++i) {
     const AllocationInfo* current = &allocation_info[i];
-    if (current->needs_allocating) {
+    if (current->needs_allocating &&
+        (current->inplace_source == kNotInPlaceBuffer)) {
       size_t aligned_bytes_required =
           AlignSizeUp(current->bytes, kBufferAlignment);
       if (current->offline_offset == kOnlinePlannedBuffer) {
@@ -355,6 +546,19 @@ TfLiteStatus CreatePlan(ErrorReporter* error_reporter,
       }
     }
   }
+  // Then the buffers that share the memory of one of the above.
+  for (size_t i = 0; i < allocation_info_size; ++i) {
+    const AllocationInfo* current = &allocation_info[i];
+    if (current->needs_allocating &&
+        (current->inplace_source != kNotInPlaceBuffer)) {
+      size_t aligned_bytes_required =
+          AlignSizeUp(current->bytes, kBufferAlignment);
+      TF_LITE_ENSURE_STATUS(planner->AddInPlaceBuffer(
+          error_reporter, aligned_bytes_required, current->first_created,
+          current->last_used,
+          GetPlannerIndex(allocation_info, current->inplace_source)));
+    }
+  }
   return kTfLiteOk;
 }
 
@@ -363,15 +567,20 @@ TfLiteStatus CommitPlan(ErrorReporter* error_reporter, MemoryPlanner* planner,
                         const AllocationInfo* allocation_info,
                         size_t allocation_info_size) {
   // Figure out the actual memory addresses for each buffer, based on the plan.
+  // The buffers are visited in the order CreatePlan added them.
   int planner_index = 0;
-  for (size_t i = 0; i < allocation_info_size; ++i) {
-    const AllocationInfo* current = &allocation_info[i];
-    if (current->needs_allocating) {
-      int offset = -1;
-      TF_LITE_ENSURE_STATUS(
-          planner->GetOffsetForBuffer(error_reporter, planner_index, &offset));
-      *current->output_ptr = reinterpret_cast<void*>(starting_point + offset);
-      ++planner_index;
+  for (int pass = 0; pass < 2; ++pass) {
+    const bool in_place_pass = (pass == 1);
+    for (size_t i = 0; i < allocation_info_size; ++i) {
+      const AllocationInfo* current = &allocation_info[i];
+      const bool in_place = (current->inplace_source != kNotInPlaceBuffer);
+      if (current->needs_allocating && (in_place == in_place_pass)) {
+        int offset = -1;
+        TF_LITE_ENSURE_STATUS(planner->GetOffsetForBuffer(
+            error_reporter, planner_index, &offset));
+        *current->output_ptr = reinterpret_cast<void*>(starting_point + offset);
+        ++planner_index;
+      }
     }
   }
   return kTfLiteOk;
@@ -1060,6 +1269,7 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
       builder.GetOfflinePlannedOffsets(model, &offline_planner_offsets));
   TF_LITE_ENSURE_STATUS(
       builder.AddTensors(subgraph, offline_planner_offsets, eval_tensors));
+  TF_LITE_ENSURE_STATUS(builder.AddInPlaceTensors(model, subgraph));
 
   internal::ScratchBufferRequest* scratch_buffer_requests =
       GetScratchBufferRequests();